@@ -3,8 +3,15 @@
 
 #pragma once
 
+#ifndef YWLIB
+#include <span>
+#else
+import std;
+#endif
+
 #include "vector.hpp"
 #include "utility.hpp"
+#include "string.hpp"
 
 export namespace yw {
 
@@ -13,6 +20,7 @@ struct Color {
 
   struct Rgb;
   struct Hsv;
+  struct Rgba8;
 
   static const Color BLACK, DIMGRAY, GRAY, DARKGRAY, SILVER, LIGHTGRAY, GAINSBORO, WHITESMOKE, WHITE, SNOW, GHOSTWHITE,
     FLORALWHITE, LINEN, ANTIQUEWHITE, PAPAYAWHIP, BLANCHEDALMOND, BISQUE, MOCCASIN, NAVAJOWHITE, PEACHPUFF, MISTYROSE,
@@ -45,6 +53,11 @@ struct Color {
   constexpr Color(numeric auto&& R, numeric auto&& G, numeric auto&& B, numeric auto&& A)
     noexcept : r(fat4(R)), g(fat4(G)), b(fat4(B)), a(fat4(A)) {}
 
+  /// returns the named color of `Name` case-insensitively, e.g. `Color::from_name("DeepSkyBlue")`
+  /// \return the named color; `Color::UNDEFINED` if not found
+  /// \note This is a constexpr perfect-hash lookup, usable in static initializers.
+  static constexpr Color from_name(stv1 Name) noexcept;
+
   /// for `yw::get`
   template<nat I> requires (I < 4) constexpr fat4& get()
     noexcept { return select_parameter<I>(r, g, b, a); }
@@ -173,6 +186,50 @@ private:
   }
 };
 
+/// struct to represent a color in packed 8-bit RGBA format
+/// \note The channels are laid out in memory in the order of red, green, blue and alpha.
+struct Color::Rgba8 {
+
+  nat1 r = 0;   // Red [0..255]
+  nat1 g = 0;   // Green [0..255]
+  nat1 b = 0;   // Blue [0..255]
+  nat1 a = 255; // Alpha [0..255]
+
+  /// default constructor
+  constexpr Rgba8() noexcept = default;
+
+  /// constructor with `yw::Color`; each channel is clamped to [0..1] and rounded
+  constexpr Rgba8(const Color& c) noexcept : r(to8(c.r)), g(to8(c.g)), b(to8(c.b)), a(to8(c.a)) {}
+
+  /// conversion operator to `yw::Color`
+  constexpr operator Color() const noexcept { return {r / 255.f, g / 255.f, b / 255.f, a / 255.f}; }
+
+  /// constructor with RGB values
+  constexpr Rgba8(numeric auto&& R, numeric auto&& G, numeric auto&& B)
+    noexcept : r(nat1(R)), g(nat1(G)), b(nat1(B)) {}
+
+  /// constructor with RGBA values
+  constexpr Rgba8(numeric auto&& R, numeric auto&& G, numeric auto&& B, numeric auto&& A)
+    noexcept : r(nat1(R)), g(nat1(G)), b(nat1(B)), a(nat1(A)) {}
+
+  /// for `yw::get`
+  template<nat Ix> requires(Ix < 4) constexpr nat1& get()
+    noexcept { return select_parameter<Ix>(r, g, b, a); }
+
+  /// for `yw::get`
+  template<nat Ix> requires(Ix < 4) constexpr nat1 get() const
+    noexcept { return select_parameter<Ix>(r, g, b, a); }
+
+  /// equality operator
+  friend constexpr bool operator==(const Rgba8&, const Rgba8&) noexcept = default;
+
+private:
+
+  static constexpr nat1 to8(const fat4 v) noexcept {
+    return v <= 0.f ? 0 : v >= 1.f ? 255 : nat1(v * 255.f + 0.5f);
+  }
+};
+
 inline constexpr Color Color::BLACK = Color::Rgb(0x000000);
 inline constexpr Color Color::DIMGRAY = Color::Rgb(0x696969);
 inline constexpr Color Color::GRAY = Color::Rgb(0x808080);
@@ -316,6 +373,291 @@ inline constexpr Color Color::MEDIUMSLATEBLUE = Color::Rgb(0x7b68ee);
 inline constexpr Color Color::TRANSPARENT = Color::Rgb(0x00000000);
 inline constexpr Color Color::UNDEFINED = Color(0, 0, 0, -1);
 inline constexpr Color Color::YW = Color::Rgb(0x081020);
+
+/// names and values of the named colors except `Color::UNDEFINED`, in the order of declaration
+inline constexpr Array<std::pair<stv1, Color>, 142> COLOR_NAMES = {{
+  {"BLACK", Color::BLACK}, {"DIMGRAY", Color::DIMGRAY}, {"GRAY", Color::GRAY}, {"DARKGRAY", Color::DARKGRAY},
+  {"SILVER", Color::SILVER}, {"LIGHTGRAY", Color::LIGHTGRAY}, {"GAINSBORO", Color::GAINSBORO},
+  {"WHITESMOKE", Color::WHITESMOKE}, {"WHITE", Color::WHITE}, {"SNOW", Color::SNOW},
+  {"GHOSTWHITE", Color::GHOSTWHITE}, {"FLORALWHITE", Color::FLORALWHITE}, {"LINEN", Color::LINEN},
+  {"ANTIQUEWHITE", Color::ANTIQUEWHITE}, {"PAPAYAWHIP", Color::PAPAYAWHIP},
+  {"BLANCHEDALMOND", Color::BLANCHEDALMOND}, {"BISQUE", Color::BISQUE}, {"MOCCASIN", Color::MOCCASIN},
+  {"NAVAJOWHITE", Color::NAVAJOWHITE}, {"PEACHPUFF", Color::PEACHPUFF}, {"MISTYROSE", Color::MISTYROSE},
+  {"LAVENDERBLUSH", Color::LAVENDERBLUSH}, {"SEASHELL", Color::SEASHELL}, {"OLDLACE", Color::OLDLACE},
+  {"IVORY", Color::IVORY}, {"HONEYDEW", Color::HONEYDEW}, {"MINTCREAM", Color::MINTCREAM}, {"AZURE", Color::AZURE},
+  {"ALICEBLUE", Color::ALICEBLUE}, {"LAVENDER", Color::LAVENDER}, {"LIGHTSTEELBLUE", Color::LIGHTSTEELBLUE},
+  {"LIGHTSLATEGRAY", Color::LIGHTSLATEGRAY}, {"SLATEGRAY", Color::SLATEGRAY}, {"STEELBLUE", Color::STEELBLUE},
+  {"ROYALBLUE", Color::ROYALBLUE}, {"MIDNIGHTBLUE", Color::MIDNIGHTBLUE}, {"NAVY", Color::NAVY},
+  {"DARKBLUE", Color::DARKBLUE}, {"MEDIUMBLUE", Color::MEDIUMBLUE}, {"BLUE", Color::BLUE},
+  {"DODGERBLUE", Color::DODGERBLUE}, {"CORNFLOWERBLUE", Color::CORNFLOWERBLUE}, {"DEEPSKYBLUE", Color::DEEPSKYBLUE},
+  {"LIGHTSKYBLUE", Color::LIGHTSKYBLUE}, {"SKYBLUE", Color::SKYBLUE}, {"LIGHTBLUE", Color::LIGHTBLUE},
+  {"POWDERBLUE", Color::POWDERBLUE}, {"PALETURQUOISE", Color::PALETURQUOISE}, {"LIGHTCYAN", Color::LIGHTCYAN},
+  {"CYAN", Color::CYAN}, {"AQUA", Color::AQUA}, {"TURQUOISE", Color::TURQUOISE},
+  {"MEDIUMTURQUOISE", Color::MEDIUMTURQUOISE}, {"DARKTURQUOISE", Color::DARKTURQUOISE},
+  {"LIGHTSEAGREEN", Color::LIGHTSEAGREEN}, {"CADETBLUE", Color::CADETBLUE}, {"DARKCYAN", Color::DARKCYAN},
+  {"TEAL", Color::TEAL}, {"DARKSLATEGRAY", Color::DARKSLATEGRAY}, {"DARKGREEN", Color::DARKGREEN},
+  {"GREEN", Color::GREEN}, {"FORESTGREEN", Color::FORESTGREEN}, {"SEAGREEN", Color::SEAGREEN},
+  {"MEDIUMSEAGREEN", Color::MEDIUMSEAGREEN}, {"MEDIUMAQUAMARINE", Color::MEDIUMAQUAMARINE},
+  {"DARKSEAGREEN", Color::DARKSEAGREEN}, {"AQUAMARINE", Color::AQUAMARINE}, {"PALEGREEN", Color::PALEGREEN},
+  {"LIGHTGREEN", Color::LIGHTGREEN}, {"SPRINGGREEN", Color::SPRINGGREEN},
+  {"MEDIUMSPRINGGREEN", Color::MEDIUMSPRINGGREEN}, {"LAWNGREEN", Color::LAWNGREEN},
+  {"CHARTREUSE", Color::CHARTREUSE}, {"GREENYELLOW", Color::GREENYELLOW}, {"LIME", Color::LIME},
+  {"LIMEGREEN", Color::LIMEGREEN}, {"YELLOWGREEN", Color::YELLOWGREEN}, {"DARKOLIVEGREEN", Color::DARKOLIVEGREEN},
+  {"OLIVEDRAB", Color::OLIVEDRAB}, {"OLIVE", Color::OLIVE}, {"DARKKHAKI", Color::DARKKHAKI},
+  {"PALEGOLDENROD", Color::PALEGOLDENROD}, {"CORNSILK", Color::CORNSILK}, {"BEIGE", Color::BEIGE},
+  {"LIGHTYELLOW", Color::LIGHTYELLOW}, {"LIGHTGOLDENRODYELLOW", Color::LIGHTGOLDENRODYELLOW},
+  {"LEMONCHIFFON", Color::LEMONCHIFFON}, {"WHEAT", Color::WHEAT}, {"BURLYWOOD", Color::BURLYWOOD},
+  {"TAN", Color::TAN}, {"KHAKI", Color::KHAKI}, {"YELLOW", Color::YELLOW}, {"GOLD", Color::GOLD},
+  {"ORANGE", Color::ORANGE}, {"SANDYBROWN", Color::SANDYBROWN}, {"DARKORANGE", Color::DARKORANGE},
+  {"GOLDENROD", Color::GOLDENROD}, {"PERU", Color::PERU}, {"DARKGOLDENROD", Color::DARKGOLDENROD},
+  {"CHOCOLATE", Color::CHOCOLATE}, {"SIENNA", Color::SIENNA}, {"SADDLEBROWN", Color::SADDLEBROWN},
+  {"MAROON", Color::MAROON}, {"DARKRED", Color::DARKRED}, {"BROWN", Color::BROWN}, {"FIREBRICK", Color::FIREBRICK},
+  {"INDIANRED", Color::INDIANRED}, {"ROSYBROWN", Color::ROSYBROWN}, {"DARKSALMON", Color::DARKSALMON},
+  {"LIGHTCORAL", Color::LIGHTCORAL}, {"SALMON", Color::SALMON}, {"LIGHTSALMON", Color::LIGHTSALMON},
+  {"CORAL", Color::CORAL}, {"TOMATO", Color::TOMATO}, {"ORANGERED", Color::ORANGERED}, {"RED", Color::RED},
+  {"CRIMSON", Color::CRIMSON}, {"MEDIUMVIOLETRED", Color::MEDIUMVIOLETRED}, {"DEEPPINK", Color::DEEPPINK},
+  {"HOTPINK", Color::HOTPINK}, {"PALEVIOLETRED", Color::PALEVIOLETRED}, {"PINK", Color::PINK},
+  {"LIGHTPINK", Color::LIGHTPINK}, {"THISTLE", Color::THISTLE}, {"MAGENTA", Color::MAGENTA},
+  {"FUCHSIA", Color::FUCHSIA}, {"VIOLET", Color::VIOLET}, {"PLUM", Color::PLUM}, {"ORCHID", Color::ORCHID},
+  {"MEDIUMORCHID", Color::MEDIUMORCHID}, {"DARKORCHID", Color::DARKORCHID}, {"DARKVIOLET", Color::DARKVIOLET},
+  {"DARKMAGENTA", Color::DARKMAGENTA}, {"PURPLE", Color::PURPLE}, {"INDIGO", Color::INDIGO},
+  {"DARKSLATEBLUE", Color::DARKSLATEBLUE}, {"BLUEVIOLET", Color::BLUEVIOLET}, {"MEDIUMPURPLE", Color::MEDIUMPURPLE},
+  {"SLATEBLUE", Color::SLATEBLUE}, {"MEDIUMSLATEBLUE", Color::MEDIUMSLATEBLUE}, {"TRANSPARENT", Color::TRANSPARENT},
+  {"YW", Color::YW},
+}};
+
+} // namespace yw
+
+
+namespace yw::_ {
+
+/// folds ASCII lowercase letters to uppercase
+inline constexpr cat1 _color_upper(const cat1 c) noexcept { return 'a' <= c && c <= 'z' ? cat1(c - 32) : c; }
+
+/// case-insensitive hash of a color name
+inline constexpr nat4 _color_hash(const stv1 s, const nat4 seed) noexcept {
+  nat4 h = 2166136261u ^ (seed * 0x9e3779b9u);
+  for (const auto c : s) h = (h ^ nat1(_color_upper(c))) * 16777619u;
+  h ^= h >> 16, h *= 0x85ebca6bu, h ^= h >> 13, h *= 0xc2b2ae35u;
+  return h ^ (h >> 16);
+}
+
+/// perfect hash of `COLOR_NAMES`; a name goes to bucket `hash(name, 0) % BUCKETS`,
+/// then to slot `hash(name, seeds[bucket]) % SLOTS` which holds its index
+struct _color_phf {
+  static constexpr nat BUCKETS = 64, SLOTS = 256, EMPTY = 255;
+  Array<nat4, BUCKETS> seeds{};
+  Array<nat1, SLOTS> slots{};
+};
+
+/// searches the seed of each bucket, larger buckets first
+consteval _color_phf _color_phf_build() {
+  _color_phf t;
+  nat4 keys[_color_phf::BUCKETS][COLOR_NAMES.COUNT]{};
+  nat counts[_color_phf::BUCKETS]{}, order[_color_phf::BUCKETS]{};
+  for (nat i{}; i < COLOR_NAMES.COUNT; ++i) {
+    const nat b = _color_hash(COLOR_NAMES[i].first, 0) % _color_phf::BUCKETS;
+    keys[b][counts[b]++] = nat4(i);
+  }
+  for (nat i{}; i < _color_phf::BUCKETS; ++i) order[i] = i;
+  std::ranges::sort(order, [&](const nat a, const nat b) { return counts[a] > counts[b]; });
+  for (auto& s : t.slots.array) s = _color_phf::EMPTY;
+  for (const auto b : order) {
+    for (nat4 seed{1};; ++seed) {
+      if (seed == 100000) throw "no seed found for the color name hash";
+      nat used[COLOR_NAMES.COUNT]{}, k{};
+      for (; k < counts[b]; ++k) {
+        const nat s = _color_hash(COLOR_NAMES[keys[b][k]].first, seed) % _color_phf::SLOTS;
+        if (t.slots[s] != _color_phf::EMPTY || std::ranges::find(used, used + k, s) != used + k) break;
+        used[k] = s;
+      }
+      if (k < counts[b]) continue;
+      for (k = 0; k < counts[b]; ++k) t.slots[used[k]] = nat1(keys[b][k]);
+      t.seeds[b] = seed;
+      break;
+    }
+  }
+  return t;
+}
+
+inline constexpr _color_phf _color_names_phf = _color_phf_build();
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+constexpr Color Color::from_name(const stv1 Name) noexcept {
+  using t = _::_color_phf;
+  const auto& phf = _::_color_names_phf;
+  const nat i = phf.slots[_::_color_hash(Name, phf.seeds[_::_color_hash(Name, 0) % t::BUCKETS]) % t::SLOTS];
+  if (i == t::EMPTY) return UNDEFINED;
+  const auto& [name, color] = COLOR_NAMES[i];
+  if (name.size() != Name.size()) return UNDEFINED;
+  for (nat k{}; k < name.size(); ++k) if (name[k] != _::_color_upper(Name[k])) return UNDEFINED;
+  return color;
+}
+
+} // namespace yw
+
+
+namespace yw::_ {
+
+/// loads 4 colors and transposes them into channel vectors
+inline void _color_load4(const fat4* p, XMatrix& m) noexcept {
+  m = {_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), _mm_loadu_ps(p + 12)};
+  xvtranspose(m);
+}
+
+/// transposes channel vectors into 4 colors and stores them
+inline void _color_store4(fat4* p, XMatrix& m) noexcept {
+  xvtranspose(m);
+  _mm_storeu_ps(p, m[0]), _mm_storeu_ps(p + 4, m[1]), _mm_storeu_ps(p + 8, m[2]), _mm_storeu_ps(p + 12, m[3]);
+}
+
+/// selects `b` where `m` is set, otherwise `a`
+inline XVector _color_select(const XVector& a, const XVector& b, const XVector& m) noexcept {
+  return _mm_blendv_ps(a, b, m);
+}
+
+/// converts `n` HSV colors to RGB colors; same results as `Color::Hsv::to_rgb`
+inline void _hsv_to_rgb(const fat4* in, fat4* out, const nat n) noexcept {
+  nat i{};
+  for (XMatrix m; i + 4 <= n; i += 4) {
+    _color_load4(in + i * 4, m);
+    const auto& h = m[0], & s = m[1], & v = m[2];
+    const auto hs6 = xvmul(xvmul(xvfill(6.f), h), s), s3 = xvmul(xvfill(3.f), s), s5 = xvmul(xvfill(5.f), s);
+    const auto vms = xvsub(v, s), z = XVector(XVZERO);
+    // 0 < h <= 1/6, 1/6 < h <= 2/6, 2/6 < h < 3/6
+    auto c1 = _mm_cmplt_ps(xvfill(0 / 6.f), h), c2 = _mm_cmplt_ps(xvfill(1 / 6.f), h), c3 = _mm_cmplt_ps(xvfill(2 / 6.f), h);
+    auto lr = _color_select(_color_select(_color_select(z, v, c1), xvsub(xvadd(v, s), hs6), c2), vms, c3);
+    auto lg = _color_select(_color_select(_color_select(z, xvadd(vms, hs6), c1), v, c2), v, c3);
+    auto lb = _color_select(_color_select(_color_select(z, vms, c1), vms, c2), xvadd(xvsub(v, s3), hs6), c3);
+    // 3/6 <= h < 4/6, 4/6 <= h < 5/6, 5/6 <= h < 1
+    c1 = _mm_cmplt_ps(h, xvfill(1.f)), c2 = _mm_cmplt_ps(h, xvfill(5.f / 6.f)), c3 = _mm_cmplt_ps(h, xvfill(4.f / 6.f));
+    auto hr = _color_select(_color_select(_color_select(z, v, c1), xvadd(xvsub(v, s5), hs6), c2), vms, c3);
+    auto hg = _color_select(_color_select(_color_select(z, vms, c1), vms, c2), xvsub(xvadd(v, s3), hs6), c3);
+    auto hb = _color_select(_color_select(_color_select(z, xvsub(xvadd(v, s5), hs6), c1), v, c2), v, c3);
+    const auto lo = _mm_cmplt_ps(h, xvfill(0.5f)), gray = _mm_cmpeq_ps(s, z);
+    m[0] = _color_select(_color_select(hr, lr, lo), v, gray);
+    m[1] = _color_select(_color_select(hg, lg, lo), v, gray);
+    m[2] = _color_select(_color_select(hb, lb, lo), v, gray);
+    _color_store4(out + i * 4, m);
+  }
+  for (; i < n; ++i) {
+    const Color c = Color::Hsv(in[i * 4], in[i * 4 + 1], in[i * 4 + 2], in[i * 4 + 3]);
+    out[i * 4] = c.r, out[i * 4 + 1] = c.g, out[i * 4 + 2] = c.b, out[i * 4 + 3] = c.a;
+  }
+}
+
+/// converts `n` RGB colors to HSV colors; same results as `Color::Hsv::from_rgb`
+inline void _rgb_to_hsv(const fat4* in, fat4* out, const nat n) noexcept {
+  nat i{};
+  for (XMatrix m; i + 4 <= n; i += 4) {
+    _color_load4(in + i * 4, m);
+    const auto& r = m[0], & g = m[1], & b = m[2];
+    // keeps the first minimum and the first maximum as `yw::mini` and `yw::max` do
+    const auto gmin = _mm_cmpgt_ps(r, g), rgmin = _color_select(r, g, gmin);
+    const auto bmin = _mm_cmpgt_ps(rgmin, b), min = _color_select(rgmin, b, bmin);
+    const auto rgmax = _color_select(r, g, _mm_cmplt_ps(r, g));
+    const auto v = _color_select(rgmax, b, _mm_cmplt_ps(rgmax, b)), s = xvsub(v, min);
+    const auto h0 = xvadd(xvdiv(xvsub(b, g), s), xvfill(3.f));
+    const auto h1 = xvadd(xvdiv(xvsub(r, b), s), xvfill(5.f));
+    const auto h2 = xvadd(xvdiv(xvsub(g, r), s), xvfill(1.f));
+    const auto h = xvmul(xvfill(1.0f / 6.0f), _color_select(_color_select(h0, h1, gmin), h2, bmin));
+    const auto gray = _mm_cmpeq_ps(v, min), z = XVector(XVZERO);
+    m[0] = _color_select(h, z, gray), m[1] = _color_select(s, z, gray), m[2] = v;
+    _color_store4(out + i * 4, m);
+  }
+  for (; i < n; ++i) {
+    const Color::Hsv c(Color(in[i * 4], in[i * 4 + 1], in[i * 4 + 2], in[i * 4 + 3]));
+    out[i * 4] = c.h, out[i * 4 + 1] = c.s, out[i * 4 + 2] = c.v, out[i * 4 + 3] = c.a;
+  }
+}
+
+/// unpacks `n` 8-bit colors to float colors; same results as `Color::Rgba8::operator Color`
+inline void _rgba8_to_color(const nat1* in, fat4* out, const nat n) noexcept {
+  const auto k = xvfill(255.f);
+  nat i{};
+  for (; i + 4 <= n; i += 4) {
+    const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 4));
+    _mm_storeu_ps(out + i * 4, xvdiv(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(x)), k));
+    _mm_storeu_ps(out + i * 4 + 4, xvdiv(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(x, 4))), k));
+    _mm_storeu_ps(out + i * 4 + 8, xvdiv(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(x, 8))), k));
+    _mm_storeu_ps(out + i * 4 + 12, xvdiv(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(x, 12))), k));
+  }
+  for (; i < n; ++i) {
+    const auto x = _mm_cvtsi32_si128(bitcast<int4>(reinterpret_cast<const Color::Rgba8*>(in)[i]));
+    _mm_storeu_ps(out + i * 4, xvdiv(_mm_cvtepi32_ps(_mm_cvtepu8_epi32(x)), k));
+  }
+}
+
+/// packs `n` float colors to 8-bit colors; same results as `Color::Rgba8(const Color&)`
+inline void _color_to_rgba8(const fat4* in, nat1* out, const nat n) noexcept {
+  const auto k = xvfill(255.f), h = xvfill(0.5f), one = xvfill(1.f), z = XVector(XVZERO);
+  auto q = [&](const fat4* p) noexcept {
+    return _mm_cvttps_epi32(xvadd(xvmul(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), z), one), k), h));
+  };
+  nat i{};
+  for (; i + 4 <= n; i += 4) {
+    const auto a = _mm_packs_epi32(q(in + i * 4), q(in + i * 4 + 4));
+    const auto b = _mm_packs_epi32(q(in + i * 4 + 8), q(in + i * 4 + 12));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 4), _mm_packus_epi16(a, b));
+  }
+  for (; i < n; ++i) {
+    const auto a = _mm_packs_epi32(q(in + i * 4), _mm_setzero_si128());
+    reinterpret_cast<Color::Rgba8*>(out)[i] = bitcast<Color::Rgba8>(_mm_cvtsi128_si32(_mm_packus_epi16(a, a)));
+  }
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+
+/// converts HSV colors to RGB colors, 4 colors at a time
+/// \param In (in) colors to convert
+/// \param Out (out) converted colors; may be the same memory as `In`
+/// \note `min(In.size(), Out.size())` colors are converted.
+inline void convert(std::span<const Color::Hsv> In, std::span<Color> Out) noexcept {
+  _::_hsv_to_rgb(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// converts HSV colors to RGB colors, 4 colors at a time
+inline void convert(std::span<const Color::Hsv> In, std::span<Color::Rgb> Out) noexcept {
+  _::_hsv_to_rgb(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// converts RGB colors to HSV colors, 4 colors at a time
+/// \param In (in) colors to convert
+/// \param Out (out) converted colors; may be the same memory as `In`
+/// \note `min(In.size(), Out.size())` colors are converted.
+inline void convert(std::span<const Color> In, std::span<Color::Hsv> Out) noexcept {
+  _::_rgb_to_hsv(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// converts RGB colors to HSV colors, 4 colors at a time
+inline void convert(std::span<const Color::Rgb> In, std::span<Color::Hsv> Out) noexcept {
+  _::_rgb_to_hsv(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// unpacks 8-bit colors to float colors, 4 colors at a time
+/// \param In (in) colors to convert
+/// \param Out (out) converted colors
+/// \note `min(In.size(), Out.size())` colors are converted.
+inline void convert(std::span<const Color::Rgba8> In, std::span<Color> Out) noexcept {
+  _::_rgba8_to_color(reinterpret_cast<const nat1*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// packs float colors to 8-bit colors, 4 colors at a time; each channel is clamped to [0..1] and rounded
+/// \param In (in) colors to convert
+/// \param Out (out) converted colors
+/// \note `min(In.size(), Out.size())` colors are converted.
+inline void convert(std::span<const Color> In, std::span<Color::Rgba8> Out) noexcept {
+  _::_color_to_rgba8(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<nat1*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
 } // namespace yw
 
 
@@ -326,9 +668,11 @@ namespace std {
 template<> struct tuple_size<yw::Color> : integral_constant<size_t, 4> {};
 template<> struct tuple_size<yw::Color::Rgb> : integral_constant<size_t, 4> {};
 template<> struct tuple_size<yw::Color::Hsv> : integral_constant<size_t, 4> {};
+template<> struct tuple_size<yw::Color::Rgba8> : integral_constant<size_t, 4> {};
 
 template<size_t I> requires (I < 4) struct tuple_element<I, yw::Color> : type_identity<float> {};
 template<size_t I> requires (I < 4) struct tuple_element<I, yw::Color::Rgb> : type_identity<float> {};
 template<size_t I> requires (I < 4) struct tuple_element<I, yw::Color::Hsv> : type_identity<float> {};
+template<size_t I> requires (I < 4) struct tuple_element<I, yw::Color::Rgba8> : type_identity<unsigned char> {};
 
 } // namespace std
@@ -0,0 +1,348 @@
+/// \file color_lab.hpp
+/// \brief defines `yw::Oklab`, `yw::Lab` and `yw::ColorIndex`
+
+#pragma once
+
+#ifndef YWLIB
+#include <algorithm>
+#include <span>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "color_srgb.hpp"
+#include "parallel.hpp"
+
+export namespace yw {
+
+
+/// struct to represent a color in OKLab
+/// \note Conversions from/to `yw::Color` treat it as sRGB-encoded.
+struct Oklab {
+
+  fat4 l = 0.f;     // Lightness [0..1]
+  fat4 a = 0.f;     // green (-) to red (+)
+  fat4 b = 0.f;     // blue (-) to yellow (+)
+  fat4 alpha = 1.f; // Alpha [0..1]
+
+  /// default constructor
+  constexpr Oklab() noexcept = default;
+
+  /// constructor with Lab values
+  constexpr Oklab(numeric auto&& L, numeric auto&& A, numeric auto&& B)
+    noexcept : l(fat4(L)), a(fat4(A)), b(fat4(B)) {}
+
+  /// constructor with Lab values and alpha
+  constexpr Oklab(numeric auto&& L, numeric auto&& A, numeric auto&& B, numeric auto&& Alpha)
+    noexcept : l(fat4(L)), a(fat4(A)), b(fat4(B)), alpha(fat4(Alpha)) {}
+
+  /// constructor with `yw::Color`
+  Oklab(const Color& c) noexcept;
+
+  /// conversion operator to `yw::Color`
+  operator Color() const noexcept;
+
+  /// for `yw::get`
+  template<nat I> requires (I < 4) constexpr fat4& get()
+    noexcept { return select_parameter<I>(l, a, b, alpha); }
+
+  /// for `yw::get`
+  template<nat I> requires (I < 4) constexpr fat4 get() const
+    noexcept { return select_parameter<I>(l, a, b, alpha); }
+};
+
+
+/// struct to represent a color in CIELAB with the D65 white point
+/// \note Conversions from/to `yw::Color` treat it as sRGB-encoded.
+struct Lab {
+
+  fat4 l = 0.f;     // Lightness [0..100]
+  fat4 a = 0.f;     // green (-) to red (+)
+  fat4 b = 0.f;     // blue (-) to yellow (+)
+  fat4 alpha = 1.f; // Alpha [0..1]
+
+  /// default constructor
+  constexpr Lab() noexcept = default;
+
+  /// constructor with Lab values
+  constexpr Lab(numeric auto&& L, numeric auto&& A, numeric auto&& B)
+    noexcept : l(fat4(L)), a(fat4(A)), b(fat4(B)) {}
+
+  /// constructor with Lab values and alpha
+  constexpr Lab(numeric auto&& L, numeric auto&& A, numeric auto&& B, numeric auto&& Alpha)
+    noexcept : l(fat4(L)), a(fat4(A)), b(fat4(B)), alpha(fat4(Alpha)) {}
+
+  /// constructor with `yw::Color`
+  Lab(const Color& c) noexcept;
+
+  /// conversion operator to `yw::Color`
+  operator Color() const noexcept;
+
+  /// for `yw::get`
+  template<nat I> requires (I < 4) constexpr fat4& get()
+    noexcept { return select_parameter<I>(l, a, b, alpha); }
+
+  /// for `yw::get`
+  template<nat I> requires (I < 4) constexpr fat4 get() const
+    noexcept { return select_parameter<I>(l, a, b, alpha); }
+};
+
+} // namespace yw
+
+
+namespace yw::_ {
+
+/// multiplies a row-major 3x3 matrix to channel vectors
+inline void _lab_mat3(const fat4 (&m)[9], XVector& x, XVector& y, XVector& z) noexcept {
+  const auto a = x, b = y, c = z;
+  x = xvadd(xvadd(xvmul(xvfill(m[0]), a), xvmul(xvfill(m[1]), b)), xvmul(xvfill(m[2]), c));
+  y = xvadd(xvadd(xvmul(xvfill(m[3]), a), xvmul(xvfill(m[4]), b)), xvmul(xvfill(m[5]), c));
+  z = xvadd(xvadd(xvmul(xvfill(m[6]), a), xvmul(xvfill(m[7]), b)), xvmul(xvfill(m[8]), c));
+}
+
+inline constexpr fat4 _oklab_m1[9] = {
+  0.4122214708f, 0.5363325363f, 0.0514459929f, 0.2119034982f, 0.6806995451f, 0.1073969566f,
+  0.0883024619f, 0.2817188376f, 0.6299787005f};
+inline constexpr fat4 _oklab_m2[9] = {
+  0.2104542553f, 0.7936177850f, -0.0040720468f, 1.9779984951f, -2.4285922050f, 0.4505937099f,
+  0.0259040371f, 0.7827717662f, -0.8086757660f};
+inline constexpr fat4 _oklab_m2_inv[9] = {
+  1.f, 0.3963377774f, 0.2158037573f, 1.f, -0.1055613458f, -0.0638541728f, 1.f, -0.0894841775f, -1.2914855480f};
+inline constexpr fat4 _oklab_m1_inv[9] = {
+  4.0767416621f, -3.3077115913f, 0.2309699292f, -1.2684380046f, 2.6097574011f, -0.3413193965f,
+  -0.0041960863f, -0.7034186147f, 1.7076147010f};
+
+// sRGB to XYZ, with the D65 white point divided out
+inline constexpr fat4 _lab_m[9] = {
+  0.4124564f / 0.95047f, 0.3575761f / 0.95047f, 0.1804375f / 0.95047f, 0.2126729f, 0.7151522f, 0.0721750f,
+  0.0193339f / 1.08883f, 0.1191920f / 1.08883f, 0.9503041f / 1.08883f};
+inline constexpr fat4 _lab_m_inv[9] = {
+  3.2404542f * 0.95047f, -1.5371385f, -0.4985314f * 1.08883f, -0.9692660f * 0.95047f, 1.8760108f, 0.0415560f * 1.08883f,
+  0.0556434f * 0.95047f, -0.2040259f, 1.0572252f * 1.08883f};
+
+/// CIELAB companding function
+inline XVector _lab_f(const XVector& t) noexcept {
+  const auto lo = xvadd(xvmul(t, xvfill(841.f / 108.f)), xvfill(4.f / 29.f));
+  return _mm_blendv_ps(xvcbrt(t), lo, _mm_cmple_ps(t, xvfill(216.f / 24389.f)));
+}
+
+/// inverse of `_lab_f`
+inline XVector _lab_f_inv(const XVector& t) noexcept {
+  const auto lo = xvmul(xvsub(t, xvfill(4.f / 29.f)), xvfill(108.f / 841.f));
+  return _mm_blendv_ps(xvmul(xvmul(t, t), t), lo, _mm_cmple_ps(t, xvfill(6.f / 29.f)));
+}
+
+/// converts channel vectors of sRGB-encoded colors in place
+template<bool Ok> inline void _to_lab(XMatrix& m) noexcept {
+  m[0] = _srgb_to_linear(m[0]), m[1] = _srgb_to_linear(m[1]), m[2] = _srgb_to_linear(m[2]);
+  if constexpr (Ok) {
+    _lab_mat3(_oklab_m1, m[0], m[1], m[2]);
+    m[0] = xvcbrt(m[0]), m[1] = xvcbrt(m[1]), m[2] = xvcbrt(m[2]);
+    _lab_mat3(_oklab_m2, m[0], m[1], m[2]);
+  } else {
+    _lab_mat3(_lab_m, m[0], m[1], m[2]);
+    const auto x = _lab_f(m[0]), y = _lab_f(m[1]), z = _lab_f(m[2]);
+    m[0] = xvsub(xvmul(y, xvfill(116.f)), xvfill(16.f));
+    m[1] = xvmul(xvsub(x, y), xvfill(500.f));
+    m[2] = xvmul(xvsub(y, z), xvfill(200.f));
+  }
+}
+
+/// converts channel vectors of Lab colors to sRGB-encoded colors in place
+template<bool Ok> inline void _from_lab(XMatrix& m) noexcept {
+  if constexpr (Ok) {
+    _lab_mat3(_oklab_m2_inv, m[0], m[1], m[2]);
+    m[0] = xvmul(xvmul(m[0], m[0]), m[0]), m[1] = xvmul(xvmul(m[1], m[1]), m[1]), m[2] = xvmul(xvmul(m[2], m[2]), m[2]);
+    _lab_mat3(_oklab_m1_inv, m[0], m[1], m[2]);
+  } else {
+    const auto y = xvmul(xvadd(m[0], xvfill(16.f)), xvfill(1 / 116.f));
+    const auto x = xvadd(y, xvmul(m[1], xvfill(1 / 500.f))), z = xvsub(y, xvmul(m[2], xvfill(1 / 200.f)));
+    m[0] = _lab_f_inv(x), m[1] = _lab_f_inv(y), m[2] = _lab_f_inv(z);
+    _lab_mat3(_lab_m_inv, m[0], m[1], m[2]);
+  }
+  m[0] = _linear_to_srgb(m[0]), m[1] = _linear_to_srgb(m[1]), m[2] = _linear_to_srgb(m[2]);
+}
+
+/// converts `n` colors, 4 colors at a time; alpha is copied
+/// \note The remainder goes through the same vector path, so single colors give the same results.
+template<bool Ok, bool Forward> inline void _lab_convert(const fat4* in, fat4* out, const nat n) noexcept {
+  auto f = [](XMatrix& m) noexcept { if constexpr (Forward) _to_lab<Ok>(m); else _from_lab<Ok>(m); };
+  nat i{};
+  for (XMatrix m; i + 4 <= n; i += 4) _color_load4(in + i * 4, m), f(m), _color_store4(out + i * 4, m);
+  if (i == n) return;
+  fat4 t[16]{};
+  std::ranges::copy(in + i * 4, in + n * 4, t);
+  XMatrix m;
+  _color_load4(t, m), f(m), _color_store4(t, m);
+  std::ranges::copy(t, t + (n - i) * 4, out + i * 4);
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+inline Oklab::Oklab(const Color& c) noexcept { _::_lab_convert<true, true>(&c.r, &l, 1); }
+
+inline Oklab::operator Color() const noexcept {
+  Color c;
+  _::_lab_convert<true, false>(&l, &c.r, 1);
+  return c;
+}
+
+inline Lab::Lab(const Color& c) noexcept { _::_lab_convert<false, true>(&c.r, &l, 1); }
+
+inline Lab::operator Color() const noexcept {
+  Color c;
+  _::_lab_convert<false, false>(&l, &c.r, 1);
+  return c;
+}
+
+/// converts sRGB-encoded colors to OKLab colors, 4 colors at a time
+/// \param In (in) colors to convert
+/// \param Out (out) converted colors; may be the same memory as `In`
+/// \note `min(In.size(), Out.size())` colors are converted.
+inline void convert(std::span<const Color> In, std::span<Oklab> Out) noexcept {
+  _::_lab_convert<true, true>(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// converts OKLab colors to sRGB-encoded colors, 4 colors at a time
+inline void convert(std::span<const Oklab> In, std::span<Color> Out) noexcept {
+  _::_lab_convert<true, false>(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// converts sRGB-encoded colors to CIELAB colors, 4 colors at a time
+inline void convert(std::span<const Color> In, std::span<Lab> Out) noexcept {
+  _::_lab_convert<false, true>(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// converts CIELAB colors to sRGB-encoded colors, 4 colors at a time
+inline void convert(std::span<const Lab> In, std::span<Color> Out) noexcept {
+  _::_lab_convert<false, false>(reinterpret_cast<const fat4*>(In.data()), reinterpret_cast<fat4*>(Out.data()), std::min(In.size(), Out.size()));
+}
+
+/// returns the squared euclidean distance between two OKLab colors; alpha is ignored
+inline constexpr fat4 distance2(const Oklab& x, const Oklab& y) noexcept {
+  const fat4 l = x.l - y.l, a = x.a - y.a, b = x.b - y.b;
+  return l * l + a * a + b * b;
+}
+
+
+/// class to find the nearest color of a palette by the euclidean distance in OKLab
+/// \note A balanced k-d tree is stored in an array; the node of a range is at its middle.
+class ColorIndex {
+protected:
+
+  struct Node {
+    fat4 p[3]; // OKLab coordinates
+    nat4 index; // index in the palette
+    nat4 axis;  // axis to split the children
+  };
+
+  std::vector<Node> _nodes{};
+
+  void _build(const nat lo, const nat hi) noexcept {
+    if (hi - lo < 2) return;
+    fat4 mn[3]{+1e30f, +1e30f, +1e30f}, mx[3]{-1e30f, -1e30f, -1e30f};
+    for (nat i = lo; i < hi; ++i)
+      for (nat k{}; k < 3; ++k) mn[k] = std::min(mn[k], _nodes[i].p[k]), mx[k] = std::max(mx[k], _nodes[i].p[k]);
+    nat4 axis{};
+    for (nat4 k{1}; k < 3; ++k) if (mx[k] - mn[k] > mx[axis] - mn[axis]) axis = k;
+    const nat mid = (lo + hi) / 2;
+    std::nth_element(_nodes.begin() + lo, _nodes.begin() + mid, _nodes.begin() + hi, [axis](const Node& a, const Node& b) {
+      return a.p[axis] < b.p[axis] || (a.p[axis] == b.p[axis] && a.index < b.index);
+    });
+    _nodes[mid].axis = axis;
+    _build(lo, mid), _build(mid + 1, hi);
+  }
+
+  void _search(const nat lo, const nat hi, const fat4 (&q)[3], fat4& best, nat4& found) const noexcept {
+    if (lo >= hi) return;
+    const nat mid = (lo + hi) / 2;
+    const auto& n = _nodes[mid];
+    const fat4 d0 = q[0] - n.p[0], d1 = q[1] - n.p[1], d2 = q[2] - n.p[2], d = d0 * d0 + d1 * d1 + d2 * d2;
+    if (d < best || (d == best && n.index < found)) best = d, found = n.index;
+    if (hi - lo == 1) return;
+    const fat4 diff = q[n.axis] - n.p[n.axis];
+    if (diff < 0) {
+      _search(lo, mid, q, best, found);
+      if (diff * diff <= best) _search(mid + 1, hi, q, best, found);
+    } else {
+      _search(mid + 1, hi, q, best, found);
+      if (diff * diff <= best) _search(lo, mid, q, best, found);
+    }
+  }
+
+public:
+
+  /// default constructor
+  ColorIndex() noexcept = default;
+
+  /// constructor with a palette of sRGB-encoded colors; alpha is ignored
+  explicit ColorIndex(std::span<const Color> Palette) {
+    std::vector<Oklab> lab(Palette.size());
+    convert(Palette, lab);
+    _nodes.resize(lab.size());
+    for (nat i{}; i < lab.size(); ++i) _nodes[i] = {{lab[i].l, lab[i].a, lab[i].b}, nat4(i), 0};
+    _build(0, _nodes.size());
+  }
+
+  /// returns the number of colors in the palette
+  nat size() const noexcept { return _nodes.size(); }
+
+  /// returns the index of the nearest palette color; the smallest index among ties
+  /// \return index in the palette; `npos` if the palette is empty
+  nat nearest(const Oklab& c) const noexcept {
+    if (_nodes.empty()) return npos;
+    const fat4 q[3]{c.l, c.a, c.b};
+    fat4 best = std::numeric_limits<fat4>::infinity();
+    nat4 found = ~nat4{};
+    _search(0, _nodes.size(), q, best, found);
+    return found;
+  }
+
+  /// returns the index of the nearest palette color to an sRGB-encoded color
+  nat nearest(const Color& c) const noexcept { return nearest(Oklab(c)); }
+
+  /// finds the nearest palette colors of many sRGB-encoded colors
+  /// \param In (in) colors to look up
+  /// \param Out (out) indices in the palette
+  /// \note Large inputs are processed concurrently with `yw::parallel_for`.
+  void nearest(std::span<const Color> In, std::span<nat> Out) const {
+    constexpr nat chunk = 1024;
+    const nat n = std::min(In.size(), Out.size());
+    parallel_for((n + chunk - 1) / chunk, 1, [&](const nat c) {
+      Oklab lab[chunk];
+      const nat lo = c * chunk, m = std::min(chunk, n - lo);
+      convert(In.subspan(lo, m), std::span(lab, m));
+      for (nat i{}; i < m; ++i) Out[lo + i] = nearest(lab[i]);
+    });
+  }
+};
+
+
+/// returns the entry of `yw::COLOR_NAMES` nearest to an sRGB-encoded color in OKLab; alpha is ignored
+inline const std::pair<stv1, Color>& nearest_named_color(const Color& c) noexcept {
+  static const ColorIndex index = [] {
+    Array<Color, COLOR_NAMES.COUNT> colors;
+    for (nat i{}; i < colors.size(); ++i) colors[i] = COLOR_NAMES[i].second;
+    return ColorIndex(std::span<const Color>(colors.data(), colors.size()));
+  }();
+  return COLOR_NAMES[index.nearest(c)];
+}
+
+} // namespace yw
+
+
+namespace std {
+
+// tuple
+
+template<> struct tuple_size<yw::Oklab> : integral_constant<size_t, 4> {};
+template<> struct tuple_size<yw::Lab> : integral_constant<size_t, 4> {};
+
+template<size_t I> requires (I < 4) struct tuple_element<I, yw::Oklab> : type_identity<float> {};
+template<size_t I> requires (I < 4) struct tuple_element<I, yw::Lab> : type_identity<float> {};
+
+} // namespace std
@@ -0,0 +1,243 @@
+/// \file color_srgb.hpp
+/// \brief defines sRGB transfer functions and premultiplied alpha conversions for `yw::Color`
+
+#pragma once
+
+#ifndef YWLIB
+#include <cmath>
+#include <span>
+#else
+import std;
+#endif
+
+#include "color.hpp"
+
+namespace yw::_ {
+
+/// calculates `log2(v)` for positive normal `v`; the absolute error is about 1e-7
+inline XVector _srgb_log2(const XVector& v) noexcept {
+  const auto i = _mm_castps_si128(v);
+  auto e = _mm_sub_epi32(_mm_srli_epi32(i, 23), _mm_set1_epi32(127));
+  auto m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(i, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000)));
+  const auto big = _mm_cmpgt_ps(m, xvfill(1.41421356f)); // m in [sqrt(1/2), sqrt(2))
+  m = _mm_blendv_ps(m, xvmul(m, xvfill(0.5f)), big);
+  e = _mm_sub_epi32(e, _mm_castps_si128(big));
+  // log2(m) = 2 / ln2 * atanh(t), t = (m - 1) / (m + 1)
+  const auto t = xvdiv(xvsub(m, xvfill(1.f)), xvadd(m, xvfill(1.f))), t2 = xvmul(t, t);
+  auto p = xvadd(xvmul(t2, xvfill(1 / 9.f)), xvfill(1 / 7.f));
+  p = xvadd(xvmul(p, t2), xvfill(1 / 5.f));
+  p = xvadd(xvmul(p, t2), xvfill(1 / 3.f));
+  p = xvadd(xvmul(p, t2), xvfill(1.f));
+  return xvadd(_mm_cvtepi32_ps(e), xvmul(xvmul(p, t), xvfill(2.88539008f)));
+}
+
+/// calculates `2^v` for `v` in [-126..127]; the relative error is about 1e-7
+inline XVector _srgb_exp2(const XVector& v) noexcept {
+  const auto n = xvround(v), z = xvmul(xvsub(v, n), xvfill(0.693147181f));
+  auto p = xvadd(xvmul(z, xvfill(1 / 5040.f)), xvfill(1 / 720.f));
+  p = xvadd(xvmul(p, z), xvfill(1 / 120.f));
+  p = xvadd(xvmul(p, z), xvfill(1 / 24.f));
+  p = xvadd(xvmul(p, z), xvfill(1 / 6.f));
+  p = xvadd(xvmul(p, z), xvfill(1 / 2.f));
+  p = xvadd(xvmul(p, z), xvfill(1.f));
+  p = xvadd(xvmul(p, z), xvfill(1.f));
+  return xvmul(p, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23)));
+}
+
+/// converts sRGB-encoded values to linear values
+inline XVector _srgb_to_linear(const XVector& v) noexcept {
+  const auto lo = xvmul(v, xvfill(1 / 12.92f));
+  const auto hi = _srgb_exp2(xvmul(_srgb_log2(xvmul(xvadd(v, xvfill(0.055f)), xvfill(1 / 1.055f))), xvfill(2.4f)));
+  return _mm_blendv_ps(hi, lo, _mm_cmple_ps(v, xvfill(0.04045f)));
+}
+
+/// converts linear values to sRGB-encoded values
+inline XVector _linear_to_srgb(const XVector& v) noexcept {
+  const auto lo = xvmul(v, xvfill(12.92f));
+  const auto hi = xvsub(xvmul(_srgb_exp2(xvmul(_srgb_log2(v), xvfill(1 / 2.4f))), xvfill(1.055f)), xvfill(0.055f));
+  return _mm_blendv_ps(hi, lo, _mm_cmple_ps(v, xvfill(0.0031308f)));
+}
+
+/// exact sRGB curve in double precision
+inline fat8 _srgb_to_linear(const fat8 v) noexcept {
+  return v <= 0.04045 ? v / 12.92 : std::pow((v + 0.055) / 1.055, 2.4);
+}
+
+/// exact inverse sRGB curve in double precision
+inline fat8 _linear_to_srgb(const fat8 v) noexcept {
+  return v <= 0.0031308 ? v * 12.92 : 1.055 * std::pow(v, 1 / 2.4) - 0.055;
+}
+
+/// linear values of 8-bit sRGB values
+inline const Array<fat4, 256> _srgb8_linear = [] {
+  Array<fat4, 256> t;
+  for (nat i{}; i < 256; ++i) t[i] = fat4(_srgb_to_linear(i / 255.0));
+  return t;
+}();
+
+/// `_srgb8_threshold[k]` is the least linear value encoded to `k` or more
+inline const Array<fat4, 256> _srgb8_threshold = [] {
+  Array<fat4, 256> t;
+  t[0] = 0.f;
+  for (nat k{1}; k < 256; ++k) {
+    const fat8 h = (k - 0.5) / 255.0;
+    auto x = fat4(_srgb_to_linear(h));
+    while (_linear_to_srgb(fat8(x)) < h) x = std::nextafter(x, 1.f);
+    while (_linear_to_srgb(fat8(std::nextafter(x, 0.f))) >= h) x = std::nextafter(x, 0.f);
+    t[k] = x;
+  }
+  return t;
+}();
+
+/// `_srgb8_bucket[i]` is the 8-bit sRGB value of the linear value `i / 4096`
+/// \note Thresholds are at least 1/3300 apart, so a bucket contains at most one of them.
+inline const Array<nat1, 4096> _srgb8_bucket = [] {
+  Array<nat1, 4096> t;
+  for (nat i{}, k{}; i < 4096; ++i) {
+    while (k < 255 && _srgb8_threshold[k + 1] <= fat4(i / 4096.0)) ++k;
+    t[i] = nat1(k);
+  }
+  return t;
+}();
+
+/// encodes a linear value to an 8-bit sRGB value with correct rounding
+inline nat1 _linear_to_srgb8(const fat4 v) noexcept {
+  if (!(v > 0.f)) return 0;
+  else if (v >= 1.f) return 255;
+  const nat1 k = _srgb8_bucket[nat(v * 4096.f)];
+  return nat1(k + (k < 255 && v >= _srgb8_threshold[k + 1]));
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+
+/// converts an sRGB-encoded value to a linear value
+inline fat4 srgb_to_linear(const fat4 v) noexcept { return fat4(_::_srgb_to_linear(fat8(v))); }
+
+/// converts a linear value to an sRGB-encoded value
+inline fat4 linear_to_srgb(const fat4 v) noexcept { return fat4(_::_linear_to_srgb(fat8(v))); }
+
+/// converts an sRGB-encoded color to a linear color; alpha is not changed
+inline Color srgb_to_linear(const Color& c) noexcept {
+  return {srgb_to_linear(c.r), srgb_to_linear(c.g), srgb_to_linear(c.b), c.a};
+}
+
+/// converts a linear color to an sRGB-encoded color; alpha is not changed
+inline Color linear_to_srgb(const Color& c) noexcept {
+  return {linear_to_srgb(c.r), linear_to_srgb(c.g), linear_to_srgb(c.b), c.a};
+}
+
+/// converts sRGB-encoded colors to linear colors; alpha is not changed
+/// \param In (in) colors to convert
+/// \param Out (out) converted colors; may be the same memory as `In`
+/// \note The curve is evaluated with polynomials; the relative error is below 1e-6.
+inline void srgb_to_linear(std::span<const Color> In, std::span<Color> Out) noexcept {
+  auto i = reinterpret_cast<const fat4*>(In.data());
+  auto o = reinterpret_cast<fat4*>(Out.data());
+  for (nat n = std::min(In.size(), Out.size()); n--; i += 4, o += 4) {
+    const auto v = _mm_loadu_ps(i);
+    _mm_storeu_ps(o, _mm_blend_ps(_::_srgb_to_linear(v), v, 0b1000));
+  }
+}
+
+/// converts linear colors to sRGB-encoded colors; alpha is not changed
+/// \param In (in) colors to convert
+/// \param Out (out) converted colors; may be the same memory as `In`
+/// \note The curve is evaluated with polynomials; the relative error is below 1e-6.
+inline void linear_to_srgb(std::span<const Color> In, std::span<Color> Out) noexcept {
+  auto i = reinterpret_cast<const fat4*>(In.data());
+  auto o = reinterpret_cast<fat4*>(Out.data());
+  for (nat n = std::min(In.size(), Out.size()); n--; i += 4, o += 4) {
+    const auto v = _mm_loadu_ps(i);
+    _mm_storeu_ps(o, _mm_blend_ps(_::_linear_to_srgb(v), v, 0b1000));
+  }
+}
+
+/// decodes 8-bit sRGB colors to linear colors with a lookup table
+/// \note Alpha is scaled to [0..1] without the transfer function.
+inline void srgb_to_linear(std::span<const Color::Rgba8> In, std::span<Color> Out) noexcept {
+  for (nat i{}, n = std::min(In.size(), Out.size()); i < n; ++i) {
+    const auto c = In[i];
+    Out[i] = {_::_srgb8_linear[c.r], _::_srgb8_linear[c.g], _::_srgb8_linear[c.b], c.a / 255.f};
+  }
+}
+
+/// encodes linear colors to 8-bit sRGB colors with a lookup table
+/// \note The results are correctly rounded; alpha is quantized without the transfer function.
+inline void linear_to_srgb(std::span<const Color> In, std::span<Color::Rgba8> Out) noexcept {
+  for (nat i{}, n = std::min(In.size(), Out.size()); i < n; ++i) {
+    const auto c = In[i];
+    Out[i] = {_::_linear_to_srgb8(c.r), _::_linear_to_srgb8(c.g), _::_linear_to_srgb8(c.b), Color::Rgba8(c).a};
+  }
+}
+
+/// multiplies the color channels by alpha
+/// \param In (in) straight-alpha colors
+/// \param Out (out) premultiplied-alpha colors; may be the same memory as `In`
+inline void premultiply(std::span<const Color> In, std::span<Color> Out) noexcept {
+  auto i = reinterpret_cast<const fat4*>(In.data());
+  auto o = reinterpret_cast<fat4*>(Out.data());
+  for (nat n = std::min(In.size(), Out.size()); n--; i += 4, o += 4) {
+    const auto v = _mm_loadu_ps(i);
+    _mm_storeu_ps(o, xvmul(v, _mm_blend_ps(xvpermute<3, 3, 3, 3>(v), xvfill(1.f), 0b1000)));
+  }
+}
+
+/// divides the color channels by alpha; colors with zero alpha become zero
+/// \param In (in) premultiplied-alpha colors
+/// \param Out (out) straight-alpha colors; may be the same memory as `In`
+inline void unpremultiply(std::span<const Color> In, std::span<Color> Out) noexcept {
+  auto i = reinterpret_cast<const fat4*>(In.data());
+  auto o = reinterpret_cast<fat4*>(Out.data());
+  for (nat n = std::min(In.size(), Out.size()); n--; i += 4, o += 4) {
+    const auto v = _mm_loadu_ps(i), a = xvpermute<3, 3, 3, 3>(v);
+    const auto r = _mm_blend_ps(xvdiv(v, a), v, 0b1000);
+    _mm_storeu_ps(o, _mm_andnot_ps(_mm_cmpeq_ps(a, XVZERO), r));
+  }
+}
+
+/// multiplies the color channels by alpha with correct rounding
+/// \param In (in) straight-alpha colors
+/// \param Out (out) premultiplied-alpha colors; may be the same memory as `In`
+inline void premultiply(std::span<const Color::Rgba8> In, std::span<Color::Rgba8> Out) noexcept {
+  const nat n = std::min(In.size(), Out.size());
+  auto i = reinterpret_cast<const nat1*>(In.data());
+  auto o = reinterpret_cast<nat1*>(Out.data());
+  const auto shuf = _mm_setr_epi8(3, 3, 3, -1, 7, 7, 7, -1, 11, 11, 11, -1, 15, 15, 15, -1);
+  const auto one = _mm_set1_epi64x(0x00ff000000000000), zero = _mm_setzero_si128(), half = _mm_set1_epi16(128);
+  auto mul = [&](const __m128i& c, const __m128i& a) noexcept { // round(c * a / 255)
+    const auto t = _mm_add_epi16(_mm_mullo_epi16(c, a), half);
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+  };
+  nat k{};
+  for (; k + 4 <= n; k += 4) {
+    const auto x = _mm_loadu_si128((const __m128i*)(i + k * 4));
+    const auto a = _mm_shuffle_epi8(x, shuf);
+    const auto lo = mul(_mm_unpacklo_epi8(x, zero), _mm_or_si128(_mm_unpacklo_epi8(a, zero), one));
+    const auto hi = mul(_mm_unpackhi_epi8(x, zero), _mm_or_si128(_mm_unpackhi_epi8(a, zero), one));
+    _mm_storeu_si128((__m128i*)(o + k * 4), _mm_packus_epi16(lo, hi));
+  }
+  for (; k < n; ++k) {
+    auto c = In[k];
+    auto f = [a = nat4(c.a)](const nat1 v) noexcept { const nat4 t = v * a + 128; return nat1((t + (t >> 8)) >> 8); };
+    Out[k] = {f(c.r), f(c.g), f(c.b), c.a};
+  }
+}
+
+/// divides the color channels by alpha; colors with zero alpha become zero
+/// \param In (in) premultiplied-alpha colors
+/// \param Out (out) straight-alpha colors; may be the same memory as `In`
+inline void unpremultiply(std::span<const Color::Rgba8> In, std::span<Color::Rgba8> Out) noexcept {
+  for (nat k{}, n = std::min(In.size(), Out.size()); k < n; ++k) {
+    const auto v = _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(bitcast<int4>(In[k]))));
+    const auto a = xvpermute<3, 3, 3, 3>(v);
+    const auto f = _mm_blend_ps(_mm_andnot_ps(_mm_cmpeq_ps(a, XVZERO), xvdiv(xvfill(255.f), a)), xvfill(1.f), 0b1000);
+    const auto x = _mm_cvtps_epi32(xvmul(v, f));
+    Out[k] = bitcast<Color::Rgba8>(_mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(x, x), x)));
+  }
+}
+
+} // namespace yw
@@ -0,0 +1,136 @@
+/// \file colormap.hpp
+/// \brief defines `yw::Colormap` to map scalar values to colors
+
+#pragma once
+
+#ifndef YWLIB
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "image.hpp"
+
+export namespace yw {
+
+/// class to map scalar values to colors through a lookup table baked from color stops
+class Colormap {
+protected:
+  std::vector<Color> _lut{};
+  std::vector<Color::Rgba8> _lut8{};
+
+  template<typename T> void _map(std::span<const fat4> In, std::span<T> Out, const fat4 Min, const fat4 Max, const T* lut) const noexcept {
+    const nat n = std::min(In.size(), Out.size());
+    const fat4 last = fat4(_lut.size() - 1), s = Max == Min ? 0.f : last / (Max - Min);
+    const auto vmin = xvfill(Min), vs = xvfill(s), vlast = xvfill(last), half = xvfill(0.5f), zero = XVector(XVZERO);
+    nat i{};
+    for (alignas(16) int4 k[4]; i + 4 <= n; i += 4) {
+      const auto t = _mm_min_ps(_mm_max_ps(xvmul(xvsub(_mm_loadu_ps(In.data() + i), vmin), vs), zero), vlast);
+      _mm_store_si128(reinterpret_cast<__m128i*>(k), _mm_cvttps_epi32(xvadd(t, half)));
+      Out[i] = lut[k[0]], Out[i + 1] = lut[k[1]], Out[i + 2] = lut[k[2]], Out[i + 3] = lut[k[3]];
+    }
+    for (; i < n; ++i) Out[i] = lut[_index(In[i], Min, s)];
+  }
+
+  nat _index(const fat4 v, const fat4 Min, const fat4 s) const noexcept {
+    const fat4 t = (v - Min) * s;
+    return !(t > 0.f) ? 0 : t >= fat4(_lut.size() - 1) ? _lut.size() - 1 : nat(t + 0.5f);
+  }
+
+public:
+
+  /// default number of entries of the lookup table
+  static constexpr nat RESOLUTION = 4096;
+
+  /// default constructor; maps every value to transparent black
+  Colormap() : _lut(2, Color(0, 0, 0, 0)), _lut8(2, Color::Rgba8(0, 0, 0, 0)) {}
+
+  /// constructor with color stops at given positions
+  /// \param Stops (in) pairs of positions in [0..1] and colors, sorted by position
+  /// \param Resolution number of entries of the lookup table; at least 2
+  /// \note Colors are interpolated linearly between stops; values out of the stops take the nearest stop.
+  explicit Colormap(std::span<const std::pair<fat4, Color>> Stops, const nat Resolution = RESOLUTION)
+    : _lut(std::max(Resolution, nat(2))), _lut8(_lut.size()) {
+    const nat n = _lut.size();
+    for (nat i{}, s{}; i < n; ++i) {
+      const fat4 t = fat4(i) / fat4(n - 1);
+      if (Stops.empty()) _lut[i] = Color(0, 0, 0, 0);
+      else if (t <= Stops.front().first) _lut[i] = Stops.front().second;
+      else if (t >= Stops.back().first) _lut[i] = Stops.back().second;
+      else {
+        while (Stops[s + 1].first < t) ++s;
+        const auto& [p0, c0] = Stops[s];
+        const auto& [p1, c1] = Stops[s + 1];
+        const fat4 u = p1 == p0 ? 0.f : (t - p0) / (p1 - p0);
+        _lut[i] = Color(c0.r + (c1.r - c0.r) * u, c0.g + (c1.g - c0.g) * u, c0.b + (c1.b - c0.b) * u, c0.a + (c1.a - c0.a) * u);
+      }
+    }
+    convert(std::span<const Color>(_lut), std::span(_lut8));
+  }
+
+  /// constructor with evenly spaced color stops
+  explicit Colormap(std::span<const Color> Stops, const nat Resolution = RESOLUTION)
+    : Colormap([&] {
+      std::vector<std::pair<fat4, Color>> s(Stops.size());
+      for (nat i{}; i < s.size(); ++i) s[i] = {s.size() == 1 ? 0.f : fat4(i) / fat4(s.size() - 1), Stops[i]};
+      return s;
+    }(), Resolution) {}
+
+  /// returns the lookup table
+  std::span<const Color> table() const noexcept { return _lut; }
+
+  /// returns the color of a value in [0..1]; values out of the range are clamped and NaN is 0
+  Color operator()(const fat4 v) const noexcept { return _lut[_index(v, 0.f, fat4(_lut.size() - 1))]; }
+
+  /// maps values to colors, 4 values at a time
+  /// \param In (in) values to map
+  /// \param Out (out) colors
+  /// \param Min value mapped to the first stop
+  /// \param Max value mapped to the last stop
+  /// \note `min(In.size(), Out.size())` values are mapped.
+  void map(std::span<const fat4> In, std::span<Color> Out, const fat4 Min = 0.f, const fat4 Max = 1.f) const noexcept {
+    _map(In, Out, Min, Max, _lut.data());
+  }
+
+  /// maps values to 8-bit colors, 4 values at a time
+  void map(std::span<const fat4> In, std::span<Color::Rgba8> Out, const fat4 Min = 0.f, const fat4 Max = 1.f) const noexcept {
+    _map(In, Out, Min, Max, _lut8.data());
+  }
+
+  /// maps a scalar image to colors with rows processed concurrently
+  void map(ImageView<const fat4> In, ImageView<Color> Out, const fat4 Min = 0.f, const fat4 Max = 1.f) const {
+    parallel_for(std::min(In.height(), Out.height()), 16, [&](const nat y) { map(In.row(y), Out.row(y), Min, Max); });
+  }
+
+  /// maps a scalar image to 8-bit colors with rows processed concurrently
+  void map(ImageView<const fat4> In, ImageView<Color::Rgba8> Out, const fat4 Min = 0.f, const fat4 Max = 1.f) const {
+    parallel_for(std::min(In.height(), Out.height()), 16, [&](const nat y) { map(In.row(y), Out.row(y), Min, Max); });
+  }
+
+  /// returns the built-in viridis colormap
+  /// \note The table is interpolated from 11 evenly spaced samples of the original.
+  static const Colormap& viridis() {
+    static const Color stops[] = {
+      Color(Color::Rgb(0x440154)), Color(Color::Rgb(0x482475)), Color(Color::Rgb(0x414487)), Color(Color::Rgb(0x355f8d)),
+      Color(Color::Rgb(0x2a788e)), Color(Color::Rgb(0x21918c)), Color(Color::Rgb(0x22a884)), Color(Color::Rgb(0x44bf70)),
+      Color(Color::Rgb(0x7ad151)), Color(Color::Rgb(0xbddf26)), Color(Color::Rgb(0xfde725))};
+    static const Colormap m(stops);
+    return m;
+  }
+
+  /// returns the built-in magma colormap
+  /// \note The table is interpolated from 11 evenly spaced samples of the original.
+  static const Colormap& magma() {
+    static const Color stops[] = {
+      Color(Color::Rgb(0x000004)), Color(Color::Rgb(0x140e36)), Color(Color::Rgb(0x3b0f70)), Color(Color::Rgb(0x641a80)),
+      Color(Color::Rgb(0x8c2981)), Color(Color::Rgb(0xb73779)), Color(Color::Rgb(0xde4968)), Color(Color::Rgb(0xf7705c)),
+      Color(Color::Rgb(0xfe9f6d)), Color(Color::Rgb(0xfecf92)), Color(Color::Rgb(0xfcfdbf))};
+    static const Colormap m(stops);
+    return m;
+  }
+};
+
+} // namespace yw
@@ -89,3 +89,79 @@ inline constexpr auto write = [](convertible_to<Path> auto&& p, cnt_range auto&&
 } // namespace file
 
 } // namespace yw
+
+
+namespace yw::_ {
+
+/// class to read a binary file through a fixed buffer
+class _file_reader {
+  std::ifstream _ifs;
+  nat1 _buf[16384];
+  nat _pos{}, _end{};
+
+  bool _fill() {
+    _ifs.read(reinterpret_cast<char*>(_buf), sizeof(_buf));
+    _pos = 0, _end = nat(_ifs.gcount());
+    return _end != 0;
+  }
+
+public:
+
+  explicit _file_reader(const Path& p) : _ifs(p, std::ios::binary) {}
+
+  /// checks if the file is open
+  bool is_open() const noexcept { return _ifs.is_open(); }
+
+  /// returns the next byte; `-1` at the end of the file
+  int4 get() { return _pos < _end || _fill() ? _buf[_pos++] : -1; }
+
+  /// reads `n` bytes; returns `false` if the file ends before
+  bool read(nat1* p, nat n) {
+    while (n != 0) {
+      if (_pos == _end && !_fill()) return false;
+      const nat k = std::min<nat>(n, _end - _pos);
+      std::copy_n(_buf + _pos, k, p);
+      _pos += k, p += k, n -= k;
+    }
+    return true;
+  }
+};
+
+/// class to write a binary file through a fixed buffer
+class _file_writer {
+  std::ofstream _ofs;
+  nat1 _buf[16384];
+  nat _pos{};
+
+public:
+
+  explicit _file_writer(const Path& p) : _ofs(p, std::ios::binary) {}
+
+  /// checks if the file is open
+  bool is_open() const noexcept { return _ofs.is_open(); }
+
+  /// writes a byte
+  void put(const nat1 c) {
+    if (_pos == sizeof(_buf)) flush();
+    _buf[_pos++] = c;
+  }
+
+  /// writes `n` bytes
+  void write(const nat1* p, nat n) {
+    while (n != 0) {
+      if (_pos == sizeof(_buf)) flush();
+      const nat k = std::min<nat>(n, sizeof(_buf) - _pos);
+      std::copy_n(p, k, _buf + _pos);
+      _pos += k, p += k, n -= k;
+    }
+  }
+
+  /// writes the buffered bytes to the file; returns `false` on failure
+  bool flush() {
+    _ofs.write(reinterpret_cast<const char*>(_buf), _pos);
+    _pos = 0;
+    return bool(_ofs.flush());
+  }
+};
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
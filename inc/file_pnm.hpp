@@ -0,0 +1,266 @@
+/// \file file_pnm.hpp
+/// \brief to read and write PPM/PGM (binary) and PAM files
+
+#pragma once
+
+#ifndef YWLIB
+#include <span>
+#include <string>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "file.hpp"
+#include "image.hpp"
+
+
+export namespace yw::file::pnm {
+
+
+/// class to write a PPM (3 channels) or PAM (4 channels) file pixel by pixel through a fixed buffer
+class Writer {
+protected:
+  _::_file_writer _out;
+  std::vector<Color::Rgba8> _row{};
+  nat _left{};
+  nat _channels{};
+  bool _ok{};
+
+public:
+
+  /// opens a file and writes the header
+  /// \param p path to the file
+  /// \param Width width in pixels
+  /// \param Height height in pixels
+  /// \param Channels 3 for PPM (`P6`), or 4 for PAM (`P7`, `RGB_ALPHA`)
+  Writer(const Path& p, const nat Width, const nat Height, const nat Channels = 3)
+    : _out(p), _left(Width * Height), _channels(Channels) {
+    if (!_out.is_open()) { logger.error("Failed to open the file: " + p.string()); return; }
+    if (Width == 0 || Height == 0 || (Channels != 3 && Channels != 4)) {
+      logger.error("Invalid PNM header parameters: " + p.string());
+      return;
+    }
+    const auto w = std::to_string(Width), h = std::to_string(Height);
+    const auto s = Channels == 3 ? "P6\n" + w + " " + h + "\n255\n"
+      : "P7\nWIDTH " + w + "\nHEIGHT " + h + "\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n";
+    _out.write(reinterpret_cast<const nat1*>(s.data()), s.size());
+    _ok = true;
+  }
+
+  Writer(const Writer&) = delete;
+  Writer& operator=(const Writer&) = delete;
+
+  /// closes the file if not yet
+  ~Writer() noexcept { try { close(); } catch (...) {} }
+
+  /// checks if no error has occurred
+  explicit operator bool() const noexcept { return _ok; }
+
+  /// returns the number of pixels left to write
+  nat left() const noexcept { return _left; }
+
+  /// writes pixels; returns `false` if more pixels than left are given
+  bool write(std::span<const Color::Rgba8> Pixels) {
+    if (!_ok) return false;
+    if (Pixels.size() > _left) return logger.error("Too many pixels for the PNM image."), _ok = false;
+    if (_channels == 4) _out.write(reinterpret_cast<const nat1*>(Pixels.data()), Pixels.size() * 4);
+    else for (const auto& px : Pixels) _out.put(px.r), _out.put(px.g), _out.put(px.b);
+    _left -= Pixels.size();
+    return true;
+  }
+
+  /// writes pixels after packing them to 8 bits
+  bool write(std::span<const Color> Pixels) {
+    _row.resize(Pixels.size());
+    convert(Pixels, std::span(_row));
+    return write(std::span<const Color::Rgba8>(_row));
+  }
+
+  /// flushes the buffer
+  /// \return `false` if pixels are missing or writing failed
+  bool close() {
+    if (!_ok) return false;
+    _ok = false;
+    if (_left != 0) return logger.error("Missing pixels for the PNM image."), false;
+    return _out.flush() || (logger.error("Failed to write the PNM file."), false);
+  }
+};
+
+
+/// class to read a binary PGM (`P5`), PPM (`P6`) or PAM (`P7`) file pixel by pixel through a fixed buffer
+/// \note Samples are scaled to 8 bits; gray is expanded to RGB and missing alpha is 255.
+/// \note Headers of more than 400M pixels are rejected as invalid.
+class Reader {
+protected:
+  _::_file_reader _in;
+  std::vector<Color::Rgba8> _row{};
+  nat _left{};
+  nat _width{};
+  nat _height{};
+  nat _channels{};
+  nat _maxval{};
+  bool _ok{};
+
+  /// reads a whitespace-delimited token, skipping comments
+  std::string _token() {
+    std::string s;
+    for (int4 c = _in.get(); c >= 0; c = _in.get()) {
+      if (c == '#') while (c >= 0 && c != '\n') c = _in.get();
+      else if (c == ' ' || c == '\t' || c == '\n' || c == '\r') { if (!s.empty()) break; }
+      else s += cat1(c);
+    }
+    return s;
+  }
+
+  static nat _number(const std::string& s) noexcept {
+    nat v{};
+    if (s.empty() || s.size() > 10) return 0;
+    for (const auto c : s) if (c < '0' || '9' < c) return 0; else v = v * 10 + (c - '0');
+    return v;
+  }
+
+  bool _sample(nat1& v) {
+    nat1 t[2];
+    if (!_in.read(t, _maxval > 255 ? 2 : 1)) return false;
+    const nat x = _maxval > 255 ? nat(t[0]) << 8 | t[1] : t[0];
+    return v = nat1((std::min(x, _maxval) * 255 + _maxval / 2) / _maxval), true;
+  }
+
+public:
+
+  /// opens a file and reads the header
+  explicit Reader(const Path& p) : _in(p) {
+    if (!_in.is_open()) { logger.error("Failed to open the file: " + p.string()); return; }
+    const auto magic = _token();
+    if (magic == "P5" || magic == "P6") {
+      _width = _number(_token()), _height = _number(_token()), _maxval = _number(_token());
+      _channels = magic == "P5" ? 1 : 3;
+    } else if (magic == "P7") {
+      for (auto k = _token(); !k.empty() && k != "ENDHDR"; k = _token()) {
+        if (k == "WIDTH") _width = _number(_token());
+        else if (k == "HEIGHT") _height = _number(_token());
+        else if (k == "DEPTH") _channels = _number(_token());
+        else if (k == "MAXVAL") _maxval = _number(_token());
+        else if (k == "TUPLTYPE") _token();
+      }
+    } else {
+      logger.error("Not a binary PNM file: " + p.string());
+      return;
+    }
+    if (_width == 0 || _height == 0 || _height > 400000000 / _width || _maxval == 0 || _maxval > 65535 || _channels == 0 || _channels > 4) {
+      logger.error("Invalid PNM header: " + p.string());
+      return;
+    }
+    _left = _width * _height, _ok = true;
+  }
+
+  /// checks if no error has occurred
+  explicit operator bool() const noexcept { return _ok; }
+
+  /// returns the width in pixels
+  nat width() const noexcept { return _width; }
+
+  /// returns the height in pixels
+  nat height() const noexcept { return _height; }
+
+  /// returns the number of channels in the file; 1 (gray), 2 (gray and alpha), 3 (RGB) or 4 (RGBA)
+  nat channels() const noexcept { return _channels; }
+
+  /// returns the number of pixels left to read
+  nat left() const noexcept { return _left; }
+
+  /// reads `Pixels.size()` pixels
+  /// \return `false` if the file is broken or fewer pixels are left
+  bool read(std::span<Color::Rgba8> Pixels) {
+    if (!_ok) return false;
+    if (Pixels.size() > _left) return logger.error("Too many pixels requested from the PNM image."), _ok = false;
+    if (_channels == 4 && _maxval == 255) {
+      if (!_in.read(reinterpret_cast<nat1*>(Pixels.data()), Pixels.size() * 4))
+        return logger.error("Unexpected end of the PNM file."), _ok = false;
+    } else for (auto& px : Pixels) {
+      nat1 v[4]{0, 0, 0, 255};
+      for (nat k{}; k < _channels; ++k) if (!_sample(v[k])) return logger.error("Unexpected end of the PNM file."), _ok = false;
+      px = _channels < 3 ? Color::Rgba8(v[0], v[0], v[0], _channels == 2 ? v[1] : nat1(255)) : Color::Rgba8(v[0], v[1], v[2], v[3]);
+    }
+    _left -= Pixels.size();
+    return true;
+  }
+
+  /// reads `Pixels.size()` pixels and unpacks them to `yw::Color`
+  bool read(std::span<Color> Pixels) {
+    _row.resize(Pixels.size());
+    if (!read(std::span(_row))) return false;
+    convert(std::span<const Color::Rgba8>(_row), Pixels);
+    return true;
+  }
+};
+
+} // namespace yw::file::pnm
+
+
+namespace yw::_ {
+
+template<typename T> bool _pnm_write(const Path& p, ImageView<const T> Pixels, const nat Channels) noexcept {
+  try {
+    file::pnm::Writer w(p, Pixels.width(), Pixels.height(), Channels);
+    for (nat y{}; w && y < Pixels.height(); ++y) w.write(Pixels.row(y));
+    return w.close();
+  } catch (const std::exception& e) { return logger.error(e.what()), false; }
+  catch (...) { return logger.error("Failed to write the PNM file by unknown error: " + p.string()), false; }
+}
+
+template<typename T> bool _pnm_read(const Path& p, Image<T>& Pixels) noexcept {
+  try {
+    file::pnm::Reader r(p);
+    if (!r) return false;
+    Image<T> i(r.width(), r.height());
+    for (nat y{}; y < i.height(); ++y) if (!r.read(i.row(y))) return false;
+    Pixels = mv(i);
+    return true;
+  } catch (const std::exception& e) { return logger.error(e.what()), false; }
+  catch (...) { return logger.error("Failed to read the PNM file by unknown error: " + p.string()), false; }
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw::file::pnm {
+
+/// writes an image to a PPM (3 channels) or PAM (4 channels) file
+/// \return `true` if succeeded
+inline bool write(const Path& p, ImageView<const Color::Rgba8> Pixels, const nat Channels = 3) noexcept {
+  return _::_pnm_write(p, Pixels, Channels);
+}
+
+/// writes an image to a PPM (3 channels) or PAM (4 channels) file after packing the pixels to 8 bits
+inline bool write(const Path& p, ImageView<const Color> Pixels, const nat Channels = 3) noexcept {
+  return _::_pnm_write(p, Pixels, Channels);
+}
+
+/// reads a PGM, PPM or PAM file
+/// \param p path to the file
+/// \param Pixels (out) decoded image; not changed on failure
+/// \return `true` if succeeded
+inline bool read(const Path& p, Image<Color::Rgba8>& Pixels) noexcept { return _::_pnm_read(p, Pixels); }
+
+/// reads a PGM, PPM or PAM file and unpacks the pixels to `yw::Color`
+inline bool read(const Path& p, Image<Color>& Pixels) noexcept { return _::_pnm_read(p, Pixels); }
+
+/// writes frames to PPM/PAM files concurrently with `yw::parallel_for`
+/// \return `true` if all frames are written
+inline bool write(std::span<const Path> Paths, std::span<const ImageView<const Color>> Frames, const nat Channels = 3) noexcept {
+  std::atomic<bool> ok = Paths.size() == Frames.size();
+  parallel_for(std::min(Paths.size(), Frames.size()), 1, [&](const nat i) { if (!write(Paths[i], Frames[i], Channels)) ok = false; });
+  return ok;
+}
+
+/// reads PGM/PPM/PAM files concurrently with `yw::parallel_for`
+/// \return `true` if all files are read
+inline bool read(std::span<const Path> Paths, std::span<Image<Color>> Frames) noexcept {
+  std::atomic<bool> ok = Paths.size() == Frames.size();
+  parallel_for(std::min(Paths.size(), Frames.size()), 1, [&](const nat i) { if (!read(Paths[i], Frames[i])) ok = false; });
+  return ok;
+}
+
+} // namespace yw::file::pnm
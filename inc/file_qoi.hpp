@@ -0,0 +1,294 @@
+/// \file file_qoi.hpp
+/// \brief to read and write QOI (Quite OK Image) files
+
+#pragma once
+
+#ifndef YWLIB
+#include <span>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "file.hpp"
+#include "image.hpp"
+
+
+namespace yw::_ {
+
+/// index of a pixel in the QOI color cache
+inline nat _qoi_hash(const Color::Rgba8& p) noexcept { return (p.r * 3 + p.g * 5 + p.b * 7 + p.a * 11) & 63; }
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw::file::qoi {
+
+
+/// class to write a QOI file pixel by pixel through a fixed buffer
+/// \note Pixels may be written in any number of calls, e.g. row by row.
+class Writer {
+protected:
+  _::_file_writer _out;
+  Color::Rgba8 _index[64]{};
+  Color::Rgba8 _prev{0, 0, 0, 255};
+  std::vector<Color::Rgba8> _row{};
+  nat _run{};
+  nat _left{};
+  bool _opaque{};
+  bool _ok{};
+
+  void _put(Color::Rgba8 px) {
+    if (_opaque) px.a = 255;
+    if (px == _prev) {
+      if (++_run == 62) _out.put(nat1(0xc0 | 61)), _run = 0;
+      return;
+    }
+    if (_run != 0) _out.put(nat1(0xc0 | (_run - 1))), _run = 0;
+    const nat h = _::_qoi_hash(px);
+    if (_index[h] == px) _out.put(nat1(h));
+    else if (_index[h] = px; px.a == _prev.a) {
+      const int1 vr = int1(px.r - _prev.r), vg = int1(px.g - _prev.g), vb = int1(px.b - _prev.b);
+      const int1 vgr = int1(vr - vg), vgb = int1(vb - vg);
+      if (vr > -3 && vr < 2 && vg > -3 && vg < 2 && vb > -3 && vb < 2)
+        _out.put(nat1(0x40 | (vr + 2) << 4 | (vg + 2) << 2 | (vb + 2)));
+      else if (vgr > -9 && vgr < 8 && vg > -33 && vg < 32 && vgb > -9 && vgb < 8)
+        _out.put(nat1(0x80 | (vg + 32))), _out.put(nat1((vgr + 8) << 4 | (vgb + 8)));
+      else _out.put(0xfe), _out.put(px.r), _out.put(px.g), _out.put(px.b);
+    } else _out.put(0xff), _out.put(px.r), _out.put(px.g), _out.put(px.b), _out.put(px.a);
+    _prev = px;
+  }
+
+public:
+
+  /// opens a file and writes the header
+  /// \param p path to the file
+  /// \param Width width in pixels
+  /// \param Height height in pixels
+  /// \param Channels 3 to drop alpha, or 4
+  /// \param Linear whether the color channels are linear instead of sRGB-encoded
+  Writer(const Path& p, const nat Width, const nat Height, const nat Channels = 4, const bool Linear = false)
+    : _out(p), _left(Width * Height), _opaque(Channels == 3) {
+    for (auto& x : _index) x = {0, 0, 0, 0};
+    if (!_out.is_open()) { logger.error("Failed to open the file: " + p.string()); return; }
+    if (Width == 0 || Height == 0 || Width > 0xffffffff || Height > 0xffffffff || (Channels != 3 && Channels != 4)) {
+      logger.error("Invalid QOI header parameters: " + p.string());
+      return;
+    }
+    const nat1 h[14] = {'q', 'o', 'i', 'f',
+      nat1(Width >> 24), nat1(Width >> 16), nat1(Width >> 8), nat1(Width),
+      nat1(Height >> 24), nat1(Height >> 16), nat1(Height >> 8), nat1(Height), nat1(Channels), nat1(Linear)};
+    _out.write(h, 14);
+    _ok = true;
+  }
+
+  Writer(const Writer&) = delete;
+  Writer& operator=(const Writer&) = delete;
+
+  /// closes the file if not yet
+  ~Writer() noexcept { try { close(); } catch (...) {} }
+
+  /// checks if no error has occurred
+  explicit operator bool() const noexcept { return _ok; }
+
+  /// returns the number of pixels left to write
+  nat left() const noexcept { return _left; }
+
+  /// writes pixels; returns `false` if more pixels than left are given
+  bool write(std::span<const Color::Rgba8> Pixels) {
+    if (!_ok) return false;
+    if (Pixels.size() > _left) return logger.error("Too many pixels for the QOI image."), _ok = false;
+    for (const auto& px : Pixels) _put(px);
+    _left -= Pixels.size();
+    return true;
+  }
+
+  /// writes pixels after packing them to 8 bits
+  bool write(std::span<const Color> Pixels) {
+    _row.resize(Pixels.size());
+    convert(Pixels, std::span(_row));
+    return write(std::span<const Color::Rgba8>(_row));
+  }
+
+  /// writes the end marker and flushes the buffer
+  /// \return `false` if pixels are missing or writing failed
+  bool close() {
+    if (!_ok) return false;
+    _ok = false;
+    if (_left != 0) return logger.error("Missing pixels for the QOI image."), false;
+    if (_run != 0) _out.put(nat1(0xc0 | (_run - 1)));
+    const nat1 end[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+    _out.write(end, 8);
+    return _out.flush() || (logger.error("Failed to write the QOI file."), false);
+  }
+};
+
+
+/// class to read a QOI file pixel by pixel through a fixed buffer
+class Reader {
+protected:
+  _::_file_reader _in;
+  Color::Rgba8 _index[64]{};
+  Color::Rgba8 _prev{0, 0, 0, 255};
+  std::vector<Color::Rgba8> _row{};
+  nat _run{};
+  nat _left{};
+  nat _width{};
+  nat _height{};
+  nat _channels{};
+  bool _linear{};
+  bool _ok{};
+
+  bool _next(Color::Rgba8& px) {
+    if (_run != 0) return --_run, px = _prev, true;
+    const int4 b = _in.get();
+    if (b < 0) return false;
+    if (b == 0xfe || b == 0xff) {
+      nat1 t[4]{0, 0, 0, _prev.a};
+      if (!_in.read(t, b == 0xff ? 4 : 3)) return false;
+      _prev = {t[0], t[1], t[2], t[3]};
+    } else if ((b >> 6) == 0) _prev = _index[b];
+    else if ((b >> 6) == 1) {
+      _prev.r = nat1(_prev.r + ((b >> 4) & 3) - 2);
+      _prev.g = nat1(_prev.g + ((b >> 2) & 3) - 2);
+      _prev.b = nat1(_prev.b + (b & 3) - 2);
+    } else if ((b >> 6) == 2) {
+      const int4 c = _in.get(), vg = (b & 0x3f) - 32;
+      if (c < 0) return false;
+      _prev.r = nat1(_prev.r + vg - 8 + (c >> 4));
+      _prev.g = nat1(_prev.g + vg);
+      _prev.b = nat1(_prev.b + vg - 8 + (c & 15));
+    } else _run = b & 0x3f;
+    _index[_::_qoi_hash(_prev)] = _prev;
+    return px = _prev, true;
+  }
+
+public:
+
+  /// opens a file and reads the header
+  explicit Reader(const Path& p) : _in(p) {
+    for (auto& x : _index) x = {0, 0, 0, 0};
+    if (!_in.is_open()) { logger.error("Failed to open the file: " + p.string()); return; }
+    nat1 h[14];
+    if (!_in.read(h, 14) || h[0] != 'q' || h[1] != 'o' || h[2] != 'i' || h[3] != 'f') {
+      logger.error("Not a QOI file: " + p.string());
+      return;
+    }
+    _width = nat(h[4]) << 24 | nat(h[5]) << 16 | nat(h[6]) << 8 | h[7];
+    _height = nat(h[8]) << 24 | nat(h[9]) << 16 | nat(h[10]) << 8 | h[11];
+    _channels = h[12], _linear = h[13] == 1, _left = _width * _height;
+    if (_left == 0 || _left > 400000000 || (_channels != 3 && _channels != 4) || h[13] > 1) {
+      logger.error("Invalid QOI header: " + p.string());
+      return;
+    }
+    _ok = true;
+  }
+
+  /// checks if no error has occurred
+  explicit operator bool() const noexcept { return _ok; }
+
+  /// returns the width in pixels
+  nat width() const noexcept { return _width; }
+
+  /// returns the height in pixels
+  nat height() const noexcept { return _height; }
+
+  /// returns the number of channels in the header; 3 or 4
+  nat channels() const noexcept { return _channels; }
+
+  /// checks if the header marks the color channels as linear
+  bool linear() const noexcept { return _linear; }
+
+  /// returns the number of pixels left to read
+  nat left() const noexcept { return _left; }
+
+  /// reads `Pixels.size()` pixels
+  /// \return `false` if the file is broken or fewer pixels are left
+  bool read(std::span<Color::Rgba8> Pixels) {
+    if (!_ok) return false;
+    if (Pixels.size() > _left) return logger.error("Too many pixels requested from the QOI image."), _ok = false;
+    for (auto& px : Pixels) if (!_next(px)) return logger.error("Unexpected end of the QOI file."), _ok = false;
+    _left -= Pixels.size();
+    return true;
+  }
+
+  /// reads `Pixels.size()` pixels and unpacks them to `yw::Color`
+  bool read(std::span<Color> Pixels) {
+    _row.resize(Pixels.size());
+    if (!read(std::span(_row))) return false;
+    convert(std::span<const Color::Rgba8>(_row), Pixels);
+    return true;
+  }
+};
+
+} // namespace yw::file::qoi
+
+
+namespace yw::_ {
+
+template<typename T> bool _qoi_write(const Path& p, ImageView<const T> Pixels, const nat Channels) noexcept {
+  try {
+    file::qoi::Writer w(p, Pixels.width(), Pixels.height(), Channels);
+    for (nat y{}; w && y < Pixels.height(); ++y) w.write(Pixels.row(y));
+    return w.close();
+  } catch (const std::exception& e) { return logger.error(e.what()), false; }
+  catch (...) { return logger.error("Failed to write the QOI file by unknown error: " + p.string()), false; }
+}
+
+template<typename T> bool _qoi_read(const Path& p, Image<T>& Pixels) noexcept {
+  try {
+    file::qoi::Reader r(p);
+    if (!r) return false;
+    Image<T> i(r.width(), r.height());
+    for (nat y{}; y < i.height(); ++y) if (!r.read(i.row(y))) return false;
+    Pixels = mv(i);
+    return true;
+  } catch (const std::exception& e) { return logger.error(e.what()), false; }
+  catch (...) { return logger.error("Failed to read the QOI file by unknown error: " + p.string()), false; }
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw::file::qoi {
+
+/// writes an image to a QOI file
+/// \param p path to the file
+/// \param Pixels (in) pixels to write
+/// \param Channels 3 to drop alpha, or 4
+/// \return `true` if succeeded
+inline bool write(const Path& p, ImageView<const Color::Rgba8> Pixels, const nat Channels = 4) noexcept {
+  return _::_qoi_write(p, Pixels, Channels);
+}
+
+/// writes an image to a QOI file after packing the pixels to 8 bits
+inline bool write(const Path& p, ImageView<const Color> Pixels, const nat Channels = 4) noexcept {
+  return _::_qoi_write(p, Pixels, Channels);
+}
+
+/// reads a QOI file
+/// \param p path to the file
+/// \param Pixels (out) decoded image; not changed on failure
+/// \return `true` if succeeded
+inline bool read(const Path& p, Image<Color::Rgba8>& Pixels) noexcept { return _::_qoi_read(p, Pixels); }
+
+/// reads a QOI file and unpacks the pixels to `yw::Color`
+inline bool read(const Path& p, Image<Color>& Pixels) noexcept { return _::_qoi_read(p, Pixels); }
+
+/// writes frames to QOI files concurrently with `yw::parallel_for`
+/// \return `true` if all frames are written
+inline bool write(std::span<const Path> Paths, std::span<const ImageView<const Color>> Frames) noexcept {
+  std::atomic<bool> ok = Paths.size() == Frames.size();
+  parallel_for(std::min(Paths.size(), Frames.size()), 1, [&](const nat i) { if (!write(Paths[i], Frames[i])) ok = false; });
+  return ok;
+}
+
+/// reads QOI files concurrently with `yw::parallel_for`
+/// \return `true` if all files are read
+inline bool read(std::span<const Path> Paths, std::span<Image<Color>> Frames) noexcept {
+  std::atomic<bool> ok = Paths.size() == Frames.size();
+  parallel_for(std::min(Paths.size(), Frames.size()), 1, [&](const nat i) { if (!read(Paths[i], Frames[i])) ok = false; });
+  return ok;
+}
+
+} // namespace yw::file::qoi
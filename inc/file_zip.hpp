@@ -15,6 +15,7 @@ import std;
 #include "logger.hpp"
 #include "file.hpp"
 #include "string.hpp"
+#include "string_search.hpp"
 
 
 export namespace yw::file::zip {
@@ -84,13 +85,12 @@ namespace yw::_ {
 
 
 inline nat8 _zip_search_eocd(const Array<cat1>& file_data) {
-  auto find_end_result = std::ranges::find_end(
-    file_data, Array{0x50, 0x4b, 0x05, 0x06}).begin();
-  if (find_end_result == file_data.end()) {
+  const nat8 offset = rfind(stv1(file_data.data(), file_data.size()), stv1("PK\x05\x06", 4));
+  if (offset == npos) {
     logger.error("End of central directory signature not found.");
     return 0;
   }
-  return nat8(std::ranges::distance(file_data.begin(), find_end_result));
+  return offset;
 }
 
 
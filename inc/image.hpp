@@ -0,0 +1,314 @@
+/// \file image.hpp
+/// \brief defines `yw::Image`, `yw::ImageView` and tiled iteration over images
+
+#pragma once
+
+#ifndef YWLIB
+#include <algorithm>
+#include <new>
+#include <span>
+#else
+import std;
+#endif
+
+#include "color.hpp"
+#include "parallel.hpp"
+
+export namespace yw {
+
+
+/// struct to represent a rectangle of pixels
+struct Rect {
+
+  nat x = 0; // left
+  nat y = 0; // top
+  nat w = 0; // width
+  nat h = 0; // height
+
+  /// checks if the rectangle has no pixels
+  constexpr bool empty() const noexcept { return w == 0 || h == 0; }
+
+  /// returns the right edge (exclusive)
+  constexpr nat right() const noexcept { return x + w; }
+
+  /// returns the bottom edge (exclusive)
+  constexpr nat bottom() const noexcept { return y + h; }
+
+  /// returns the intersection of two rectangles
+  friend constexpr Rect operator&(const Rect& a, const Rect& b) noexcept {
+    const nat l = std::max(a.x, b.x), t = std::max(a.y, b.y);
+    const nat r = std::min(a.right(), b.right()), d = std::min(a.bottom(), b.bottom());
+    return l < r && t < d ? Rect{l, t, r - l, d - t} : Rect{};
+  }
+
+  /// returns the smallest rectangle containing both rectangles
+  friend constexpr Rect operator|(const Rect& a, const Rect& b) noexcept {
+    if (a.empty()) return b;
+    else if (b.empty()) return a;
+    const nat l = std::min(a.x, b.x), t = std::min(a.y, b.y);
+    return {l, t, std::max(a.right(), b.right()) - l, std::max(a.bottom(), b.bottom()) - t};
+  }
+
+  /// equality operator
+  friend constexpr bool operator==(const Rect&, const Rect&) noexcept = default;
+};
+
+
+/// concept to check if `T` is a pixel type of images; `fat4` is for single-channel images such as masks
+template<typename T> concept pixel = included_in<remove_const<T>, Color, Color::Rgba8, fat4>;
+
+
+/// class to represent a non-owning view of pixels
+/// \tparam T pixel type; `const` for read-only views
+/// \note Rows are `pitch()` pixels apart; only the first `width()` pixels of each row belong to the view.
+template<pixel T> class ImageView {
+protected:
+  T* _data{};
+  nat _width{};
+  nat _height{};
+  nat _pitch{};
+public:
+
+  using value_type = remove_const<T>;
+
+  /// default constructor
+  constexpr ImageView() noexcept = default;
+
+  /// constructor with a pointer to the first pixel, the size and the row pitch in pixels
+  constexpr ImageView(T* Data, const nat Width, const nat Height, const nat Pitch) noexcept
+    : _data(Data), _width(Width), _height(Height), _pitch(Pitch) {}
+
+  /// constructor with a pointer to tightly packed pixels
+  constexpr ImageView(T* Data, const nat Width, const nat Height) noexcept
+    : ImageView(Data, Width, Height, Width) {}
+
+  /// conversion to a read-only view
+  constexpr operator ImageView<const T>() const noexcept requires (!is_const<T>) {
+    return {_data, _width, _height, _pitch};
+  }
+
+  /// returns the pointer to the first pixel
+  constexpr T* data() const noexcept { return _data; }
+
+  /// returns the width in pixels
+  constexpr nat width() const noexcept { return _width; }
+
+  /// returns the height in pixels
+  constexpr nat height() const noexcept { return _height; }
+
+  /// returns the distance between rows in pixels
+  constexpr nat pitch() const noexcept { return _pitch; }
+
+  /// checks if the view has no pixels
+  constexpr bool empty() const noexcept { return _width == 0 || _height == 0; }
+
+  /// returns the rectangle `{0, 0, width(), height()}`
+  constexpr Rect bounds() const noexcept { return {0, 0, _width, _height}; }
+
+  /// returns the `y`-th row
+  constexpr std::span<T> row(const nat y) const noexcept { return {_data + y * _pitch, _width}; }
+
+  /// returns the pixel at `(x, y)`
+  constexpr T& operator()(const nat x, const nat y) const noexcept { return _data[y * _pitch + x]; }
+
+  /// returns the view of a rectangle, clipped to the bounds
+  constexpr ImageView sub(const Rect& Area) const noexcept {
+    const auto r = Area & bounds();
+    return r.empty() ? ImageView{} : ImageView{_data + r.y * _pitch + r.x, r.w, r.h, _pitch};
+  }
+
+  /// fills all pixels with `Value`
+  void fill(const value_type& Value) const noexcept requires (!is_const<T>) {
+    for (nat y{}; y < _height; ++y) std::ranges::fill(row(y), Value);
+  }
+
+  /// copies the pixels of `Source` to the top-left of this view
+  void copy_from(ImageView<const T> Source) const noexcept requires (!is_const<T>) {
+    const nat w = std::min(_width, Source.width()), h = std::min(_height, Source.height());
+    for (nat y{}; y < h; ++y) std::ranges::copy(Source.row(y).first(w), _data + y * _pitch);
+  }
+};
+
+
+/// class to own pixels in rows aligned to `Image::ALIGNMENT` bytes
+/// \tparam T pixel type
+template<pixel T> requires (!is_const<T>) class Image {
+protected:
+  T* _data{};
+  nat _width{};
+  nat _height{};
+  nat _pitch{};
+
+  /// \note throws `std::bad_array_new_length` if the size in bytes overflows
+  void _allocate(const nat Width, const nat Height) {
+    constexpr nat max = (npos - ALIGNMENT) / sizeof(T);
+    if (Width > max) throw std::bad_array_new_length();
+    const nat pitch = (Width * sizeof(T) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT / sizeof(T);
+    if (Height != 0 && pitch > max / Height) throw std::bad_array_new_length();
+    _width = Width, _height = Height, _pitch = pitch;
+    if (_pitch * _height == 0) return;
+    _data = static_cast<T*>(::operator new(_pitch * _height * sizeof(T), std::align_val_t(ALIGNMENT)));
+  }
+
+  void _release() noexcept {
+    if (_data) ::operator delete(_data, std::align_val_t(ALIGNMENT));
+    _data = nullptr, _width = _height = _pitch = 0;
+  }
+
+public:
+
+  /// alignment of each row in bytes
+  static constexpr nat ALIGNMENT = 64;
+
+  using value_type = T;
+
+  /// default constructor
+  Image() noexcept = default;
+
+  /// constructor with the size; all pixels are `Value`
+  Image(const nat Width, const nat Height, const T& Value = T{}) {
+    _allocate(Width, Height);
+    std::uninitialized_fill_n(_data, _pitch * _height, Value);
+  }
+
+  /// copy constructor
+  Image(const Image& i) {
+    _allocate(i._width, i._height);
+    std::uninitialized_copy_n(i._data, _pitch * _height, _data);
+  }
+
+  /// move constructor
+  Image(Image&& i) noexcept
+    : _data(std::exchange(i._data, nullptr)), _width(std::exchange(i._width, 0)),
+      _height(std::exchange(i._height, 0)), _pitch(std::exchange(i._pitch, 0)) {}
+
+  /// destructor
+  ~Image() noexcept { _release(); }
+
+  /// copy assignment
+  Image& operator=(const Image& i) {
+    if (this != &i) *this = Image(i);
+    return *this;
+  }
+
+  /// move assignment
+  Image& operator=(Image&& i) noexcept {
+    if (this == &i) return *this;
+    _release();
+    _data = std::exchange(i._data, nullptr), _width = std::exchange(i._width, 0);
+    _height = std::exchange(i._height, 0), _pitch = std::exchange(i._pitch, 0);
+    return *this;
+  }
+
+  /// returns the pointer to the first pixel
+  T* data() noexcept { return _data; }
+
+  /// returns the pointer to the first pixel
+  const T* data() const noexcept { return _data; }
+
+  /// returns the width in pixels
+  nat width() const noexcept { return _width; }
+
+  /// returns the height in pixels
+  nat height() const noexcept { return _height; }
+
+  /// returns the distance between rows in pixels
+  nat pitch() const noexcept { return _pitch; }
+
+  /// checks if the image has no pixels
+  bool empty() const noexcept { return _width == 0 || _height == 0; }
+
+  /// returns the rectangle `{0, 0, width(), height()}`
+  Rect bounds() const noexcept { return {0, 0, _width, _height}; }
+
+  /// returns the view of the whole image
+  ImageView<T> view() noexcept { return {_data, _width, _height, _pitch}; }
+
+  /// returns the read-only view of the whole image
+  ImageView<const T> view() const noexcept { return {_data, _width, _height, _pitch}; }
+
+  /// conversion to a view
+  operator ImageView<T>() noexcept { return view(); }
+
+  /// conversion to a read-only view
+  operator ImageView<const T>() const noexcept { return view(); }
+
+  /// returns the view of a rectangle, clipped to the bounds
+  ImageView<T> sub(const Rect& Area) noexcept { return view().sub(Area); }
+
+  /// returns the read-only view of a rectangle, clipped to the bounds
+  ImageView<const T> sub(const Rect& Area) const noexcept { return view().sub(Area); }
+
+  /// returns the `y`-th row
+  std::span<T> row(const nat y) noexcept { return {_data + y * _pitch, _width}; }
+
+  /// returns the `y`-th row
+  std::span<const T> row(const nat y) const noexcept { return {_data + y * _pitch, _width}; }
+
+  /// returns the pixel at `(x, y)`
+  T& operator()(const nat x, const nat y) noexcept { return _data[y * _pitch + x]; }
+
+  /// returns the pixel at `(x, y)`
+  const T& operator()(const nat x, const nat y) const noexcept { return _data[y * _pitch + x]; }
+
+  /// fills all pixels with `Value`
+  void fill(const T& Value) noexcept { view().fill(Value); }
+
+  /// changes the size; all pixels are `Value`
+  void resize(const nat Width, const nat Height, const T& Value = T{}) { *this = Image(Width, Height, Value); }
+};
+
+
+/// invokes `Func(Rect)` for each tile of `TileW` x `TileH` pixels covering `Area`, row by row
+/// \note Tiles on the right and bottom edges may be smaller.
+inline constexpr auto for_each_tile = []<invocable<Rect> Fn>(const Rect& Area, const nat TileW, const nat TileH, Fn&& Func) {
+  const nat tw = std::max(TileW, nat(1)), th = std::max(TileH, nat(1));
+  for (nat y = Area.y; y < Area.bottom(); y += th)
+    for (nat x = Area.x; x < Area.right(); x += tw)
+      invoke(Func, Rect{x, y, std::min(tw, Area.right() - x), std::min(th, Area.bottom() - y)});
+};
+
+/// invokes `Func(Rect)` for each tile of `TileW` x `TileH` pixels covering `Area` with `yw::parallel_for`
+/// \note Tiles do not overlap, so `Func` may write to its own tile without synchronization.
+inline constexpr auto parallel_for_each_tile = []<invocable<Rect> Fn>(const Rect& Area, const nat TileW, const nat TileH, Fn&& Func) {
+  if (Area.empty()) return;
+  const nat tw = std::max(TileW, nat(1)), th = std::max(TileH, nat(1));
+  const nat nx = (Area.w + tw - 1) / tw, ny = (Area.h + th - 1) / th;
+  parallel_for(nx * ny, 1, [&](const nat i) {
+    const nat x = Area.x + i % nx * tw, y = Area.y + i / nx * th;
+    invoke(Func, Rect{x, y, std::min(tw, Area.right() - x), std::min(th, Area.bottom() - y)});
+  });
+};
+
+
+/// unpacks 8-bit pixels to float pixels row by row
+/// \note `min` of both widths and heights are converted.
+inline void convert(ImageView<const Color::Rgba8> In, ImageView<Color> Out) noexcept {
+  for (nat y{}, h = std::min(In.height(), Out.height()); y < h; ++y) convert(In.row(y), Out.row(y));
+}
+
+/// packs float pixels to 8-bit pixels row by row; each channel is clamped to [0..1] and rounded
+/// \note `min` of both widths and heights are converted.
+inline void convert(ImageView<const Color> In, ImageView<Color::Rgba8> Out) noexcept {
+  for (nat y{}, h = std::min(In.height(), Out.height()); y < h; ++y) convert(In.row(y), Out.row(y));
+}
+
+/// same as `convert`, but bands of 16 rows are converted concurrently with `yw::parallel_for`
+inline void parallel_convert(ImageView<const Color::Rgba8> In, ImageView<Color> Out) {
+  const nat h = std::min(In.height(), Out.height()), w = std::min(In.width(), Out.width());
+  parallel_for((h + 15) / 16, 1, [&](const nat i) {
+    const Rect r{0, i * 16, w, std::min(nat(16), h - i * 16)};
+    convert(In.sub(r), Out.sub(r));
+  });
+}
+
+/// same as `convert`, but bands of 16 rows are converted concurrently with `yw::parallel_for`
+inline void parallel_convert(ImageView<const Color> In, ImageView<Color::Rgba8> Out) {
+  const nat h = std::min(In.height(), Out.height()), w = std::min(In.width(), Out.width());
+  parallel_for((h + 15) / 16, 1, [&](const nat i) {
+    const Rect r{0, i * 16, w, std::min(nat(16), h - i * 16)};
+    convert(In.sub(r), Out.sub(r));
+  });
+}
+
+} // namespace yw
@@ -0,0 +1,237 @@
+/// \file image_composite.hpp
+/// \brief defines alpha compositing of `yw::Image<Color>` and `yw::Compositor`
+
+#pragma once
+
+#ifndef YWLIB
+#include <vector>
+#else
+import std;
+#endif
+
+#include "image.hpp"
+#include "logger.hpp"
+
+export namespace yw {
+
+
+/// enum to represent the compositing operator
+/// \note All operators expect colors in premultiplied alpha.
+enum class Blend {
+  SOURCE_OVER, // s + d * (1 - sa)
+  SOURCE_IN,   // s * da
+  SOURCE_OUT,  // s * (1 - da)
+  ADD,         // min(s + d, 1)
+  MULTIPLY,    // s * d + s * (1 - da) + d * (1 - sa)
+  SCREEN,      // s + d - s * d
+};
+
+} // namespace yw
+
+
+namespace yw::_ {
+
+/// blends a premultiplied source pixel with a premultiplied destination pixel
+template<Blend B> inline XVector _blend(const XVector& s, const XVector& d) noexcept {
+  const auto one = xvfill(1.f);
+  if constexpr (B == Blend::SOURCE_OVER) return xvadd(s, xvmul(d, xvsub(one, xvpermute<3, 3, 3, 3>(s))));
+  else if constexpr (B == Blend::SOURCE_IN) return xvmul(s, xvpermute<3, 3, 3, 3>(d));
+  else if constexpr (B == Blend::SOURCE_OUT) return xvmul(s, xvsub(one, xvpermute<3, 3, 3, 3>(d)));
+  else if constexpr (B == Blend::ADD) return _mm_min_ps(xvadd(s, d), one);
+  else if constexpr (B == Blend::MULTIPLY) {
+    const auto t = xvadd(xvmul(s, xvsub(one, xvpermute<3, 3, 3, 3>(d))), xvmul(d, xvsub(one, xvpermute<3, 3, 3, 3>(s))));
+    return xvadd(xvmul(s, d), t);
+  } else return xvsub(xvadd(s, d), xvmul(s, d));
+}
+
+/// composites `n` pixels; the result is `lerp(d, blend(s, d), m[i] * o)`
+/// \note `m` may be `nullptr` for no mask.
+template<Blend B> inline void _composite_row(fat4* d, const fat4* s, const fat4* m, const fat4 o, const nat n) noexcept {
+  if (!m && o == 1.f)
+    for (nat i{}; i < n; ++i, d += 4, s += 4) _mm_storeu_ps(d, _blend<B>(_mm_loadu_ps(s), _mm_loadu_ps(d)));
+  else
+    for (nat i{}; i < n; ++i, d += 4, s += 4) {
+      const auto dv = _mm_loadu_ps(d), k = xvfill(m ? m[i] * o : o);
+      _mm_storeu_ps(d, xvadd(dv, xvmul(k, xvsub(_blend<B>(_mm_loadu_ps(s), dv), dv))));
+    }
+}
+
+/// composites views of the same size on the calling thread
+inline void _composite(ImageView<Color> d, ImageView<const Color> s, ImageView<const fat4> m, const Blend b, const fat4 o) noexcept {
+  auto f = [&]<Blend B>(constant<B>) {
+    for (nat y{}; y < d.height(); ++y) {
+      const fat4* mr = m.empty() ? nullptr : m.row(y).data();
+      _composite_row<B>(reinterpret_cast<fat4*>(d.row(y).data()), reinterpret_cast<const fat4*>(s.row(y).data()), mr, o, d.width());
+    }
+  };
+  switch (b) {
+  case Blend::SOURCE_OVER: return f(constant<Blend::SOURCE_OVER>{});
+  case Blend::SOURCE_IN: return f(constant<Blend::SOURCE_IN>{});
+  case Blend::SOURCE_OUT: return f(constant<Blend::SOURCE_OUT>{});
+  case Blend::ADD: return f(constant<Blend::ADD>{});
+  case Blend::MULTIPLY: return f(constant<Blend::MULTIPLY>{});
+  case Blend::SCREEN: return f(constant<Blend::SCREEN>{});
+  }
+}
+
+/// checks if a mask is empty or of the same size as the source
+inline bool _mask_fits(ImageView<const fat4> m, const nat Width, const nat Height) noexcept {
+  return m.empty() || (m.width() == Width && m.height() == Height);
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+
+/// size of tiles processed by a thread in compositing
+inline constexpr nat COMPOSITE_TILE = 64;
+
+
+/// composites `Source` onto `Dest` at `(X, Y)`
+/// \param Dest (inout) destination in premultiplied alpha
+/// \param Source (in) source in premultiplied alpha
+/// \param X left of `Source` on `Dest`
+/// \param Y top of `Source` on `Dest`
+/// \param Mode compositing operator
+/// \param Opacity coverage multiplied to all pixels of `Source`
+/// \param Mask (in) coverage of each pixel of `Source`; empty for no mask, otherwise of the same size as `Source`
+/// \note Nothing is composited and an error is logged if `Mask` is not empty and differs in size from `Source`.
+/// \note Pixels out of `Dest` are ignored. Tiles are processed concurrently with `yw::parallel_for` for large areas.
+inline void composite(ImageView<Color> Dest, ImageView<const Color> Source, const nat X, const nat Y,
+                      const Blend Mode = Blend::SOURCE_OVER, const fat4 Opacity = 1.f, ImageView<const fat4> Mask = {}) {
+  const auto area = Rect{X, Y, Source.width(), Source.height()} & Dest.bounds();
+  if (!_::_mask_fits(Mask, Source.width(), Source.height())) {
+    logger.error("The mask differs in size from the source image.");
+    return;
+  }
+  if (area.empty() || Opacity <= 0.f) return;
+  auto tile = [&](const Rect& r) noexcept {
+    const Rect sr{r.x - X, r.y - Y, r.w, r.h};
+    _::_composite(Dest.sub(r), Source.sub(sr), Mask.empty() ? Mask : Mask.sub(sr), Mode, Opacity);
+  };
+  if (area.w * area.h < COMPOSITE_TILE * COMPOSITE_TILE * 4) tile(area);
+  else parallel_for_each_tile(area, COMPOSITE_TILE, COMPOSITE_TILE, tile);
+}
+
+
+/// class to composite layers onto a target image, recomputing only the invalidated regions
+class Compositor {
+public:
+
+  /// struct to represent a layer
+  struct Layer {
+    Image<Color> image{};               // pixels in premultiplied alpha
+    nat x = 0;                          // left on the target
+    nat y = 0;                          // top on the target
+    Blend mode = Blend::SOURCE_OVER;    // compositing operator
+    fat4 opacity = 1.f;                 // coverage of all pixels
+    Image<fat4> mask{};                 // coverage of each pixel; empty for no mask, otherwise of the size of `image`
+    bool visible = true;                // whether to composite
+
+    /// returns the rectangle covered on the target
+    Rect bounds() const noexcept { return {x, y, image.width(), image.height()}; }
+  };
+
+protected:
+  Image<Color> _target{};
+  Color _background{};
+  std::vector<Layer> _layers{};
+  std::vector<Rect> _dirty{};
+
+public:
+
+  /// maximum number of dirty rectangles kept apart; more are merged into one
+  static constexpr nat MAX_DIRTY = 16;
+
+  /// constructor with the size of the target and the background color in premultiplied alpha
+  Compositor(const nat Width, const nat Height, const Color& Background = Color(0, 0, 0, 0))
+    : _target(Width, Height, Background), _background(Background) {}
+
+  /// returns the target image; call `render` to bring it up to date
+  const Image<Color>& target() const noexcept { return _target; }
+
+  /// returns the number of layers
+  nat size() const noexcept { return _layers.size(); }
+
+  /// returns the `i`-th layer
+  /// \note Call `invalidate` for the changed region after modifying the layer.
+  Layer& operator[](const nat i) noexcept { return _layers[i]; }
+
+  /// returns the `i`-th layer
+  const Layer& operator[](const nat i) const noexcept { return _layers[i]; }
+
+  /// returns the regions to be recomputed by `render`; they do not overlap each other
+  std::span<const Rect> dirty() const noexcept { return _dirty; }
+
+  /// marks a region to be recomputed
+  void invalidate(const Rect& Area) {
+    auto r = Area & _target.bounds();
+    if (r.empty()) return;
+    for (bool merged = true; merged;) {
+      merged = false;
+      for (nat i{}; i < _dirty.size(); ++i) {
+        if ((_dirty[i] & r).empty()) continue;
+        r = r | _dirty[i], _dirty.erase(_dirty.begin() + i), merged = true;
+        break;
+      }
+    }
+    _dirty.push_back(r);
+    if (_dirty.size() > MAX_DIRTY) {
+      for (nat i{1}; i < _dirty.size(); ++i) _dirty[0] = _dirty[0] | _dirty[i];
+      _dirty.resize(1);
+    }
+  }
+
+  /// marks the whole target to be recomputed
+  void invalidate() { _dirty.assign(1, _target.bounds()); }
+
+  /// adds a layer on top and returns its index
+  /// \return `npos` without adding the layer if its mask is not empty and differs in size from its image
+  nat push(Layer l) {
+    if (!_::_mask_fits(l.mask, l.image.width(), l.image.height()))
+      return logger.error("The mask of the layer differs in size from its image."), npos;
+    invalidate(l.bounds());
+    _layers.push_back(mv(l));
+    return _layers.size() - 1;
+  }
+
+  /// removes the `i`-th layer
+  void erase(const nat i) {
+    invalidate(_layers[i].bounds());
+    _layers.erase(_layers.begin() + i);
+  }
+
+  /// moves the `i`-th layer to `(X, Y)`
+  void move(const nat i, const nat X, const nat Y) {
+    invalidate(_layers[i].bounds());
+    _layers[i].x = X, _layers[i].y = Y;
+    invalidate(_layers[i].bounds());
+  }
+
+  /// recomputes the dirty regions and returns the target image
+  /// \note Layers whose mask has been changed to a different size from their image are skipped.
+  /// \note Tiles of the dirty regions are processed concurrently with `yw::parallel_for`.
+  const Image<Color>& render() {
+    std::vector<Rect> tiles;
+    for (const auto& d : _dirty) for_each_tile(d, COMPOSITE_TILE, COMPOSITE_TILE, [&](const Rect& r) { tiles.push_back(r); });
+    _dirty.clear();
+    auto target = _target.view();
+    parallel_for(tiles.size(), 1, [&](const nat i) {
+      const auto& t = tiles[i];
+      target.sub(t).fill(_background);
+      for (const auto& l : _layers) {
+        if (!l.visible || l.opacity <= 0.f || !_::_mask_fits(l.mask, l.image.width(), l.image.height())) continue;
+        const auto r = l.bounds() & t;
+        if (r.empty()) continue;
+        const Rect sr{r.x - l.x, r.y - l.y, r.w, r.h};
+        const auto m = l.mask.empty() ? ImageView<const fat4>{} : l.mask.sub(sr);
+        _::_composite(target.sub(r), l.image.sub(sr), m, l.mode, l.opacity);
+      }
+    });
+    return _target;
+  }
+};
+
+} // namespace yw
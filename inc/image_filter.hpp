@@ -0,0 +1,234 @@
+/// \file image_filter.hpp
+/// \brief defines convolution, blur and resize of images
+
+#pragma once
+
+#ifndef YWLIB
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "image.hpp"
+
+export namespace yw {
+
+
+/// enum to represent the filter of resampling
+enum class Resample {
+  BILINEAR, // triangle filter; support is 1 pixel
+  LANCZOS3, // windowed sinc filter; support is 3 pixels
+};
+
+/// number of rows processed by a thread at once in filters
+inline constexpr nat FILTER_STRIP = 32;
+
+} // namespace yw
+
+
+namespace yw::_ {
+
+inline XVector _px_load(const Color& c) noexcept { return _mm_loadu_ps(&c.r); }
+inline void _px_store(Color& c, const XVector& v) noexcept { _mm_storeu_ps(&c.r, v); }
+
+/// convolves a row horizontally with clamp-to-edge borders
+inline void _convolve_row(std::span<const Color> In, Color* Out, std::span<const fat4> k) noexcept {
+  const int8 w = int8(In.size()), r = int8(k.size() / 2);
+  for (int8 x{}; x < w; ++x) {
+    auto acc = xvfill(0.f);
+    if (x >= r && x + r < w) for (int8 i{}; i < int8(k.size()); ++i) acc = xvadd(acc, xvmul(xvfill(k[i]), _px_load(In[x - r + i])));
+    else for (int8 i{}; i < int8(k.size()); ++i) acc = xvadd(acc, xvmul(xvfill(k[i]), _px_load(In[std::clamp(x - r + i, int8(0), w - 1)])));
+    _px_store(Out[x], acc);
+  }
+}
+
+/// resampling weights of output pixels along one axis
+struct _resample_axis {
+  std::vector<nat> first{};  // first input index of each output pixel
+  std::vector<nat> count{};  // number of taps of each output pixel
+  std::vector<fat4> weight{}; // `taps` weights per output pixel
+  nat taps{};
+
+  _resample_axis(const nat Src, const nat Dst, const Resample Filter) {
+    const fat8 scale = fat8(Src) / Dst, s = std::max(scale, 1.0);
+    const fat8 support = (Filter == Resample::BILINEAR ? 1.0 : 3.0) * s;
+    taps = nat(std::ceil(support) * 2 + 1);
+    first.resize(Dst), count.resize(Dst), weight.assign(Dst * taps, 0.f);
+    auto f = [Filter](const fat8 x) noexcept {
+      if (Filter == Resample::BILINEAR) return std::max(0.0, 1.0 - std::abs(x));
+      else if (x == 0) return 1.0;
+      else if (std::abs(x) >= 3) return 0.0;
+      const fat8 p = std::numbers::pi * x;
+      return 3 * std::sin(p) * std::sin(p / 3) / (p * p);
+    };
+    for (nat j{}; j < Dst; ++j) {
+      const fat8 c = (j + 0.5) * scale - 0.5;
+      const int8 lo = std::max(int8(std::floor(c - support)) + 1, int8(0));
+      const int8 hi = std::min(int8(std::ceil(c + support)), int8(Src) - 1);
+      fat8 sum{};
+      for (int8 i = lo; i <= hi; ++i) sum += f((i - c) / s);
+      first[j] = nat(lo), count[j] = nat(std::max(hi - lo + 1, int8(0)));
+      for (nat i{}; i < count[j]; ++i) weight[j * taps + i] = fat4(sum == 0 ? 0.0 : f((lo + fat8(i) - c) / s) / sum);
+    }
+  }
+};
+
+/// converts 8-bit images to `Color`, applies `Fn` and packs the result
+template<typename Fn> void _via_color(ImageView<const Color::Rgba8> In, ImageView<Color::Rgba8> Out, Fn&& Func) {
+  Image<Color> a(In.width(), In.height()), b(Out.width(), Out.height());
+  parallel_convert(In, a);
+  Func(a.view(), b.view());
+  parallel_convert(b, Out);
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+
+/// convolves an image with a separable kernel; borders are clamped to the edge
+/// \param In (in) source image
+/// \param Out (out) destination image of the same size as `In`; must not overlap `In`
+/// \param KernelX (in) horizontal kernel of odd length; the center is the middle element
+/// \param KernelY (in) vertical kernel of odd length; the center is the middle element
+/// \note Strips of `FILTER_STRIP` rows are processed concurrently with `yw::parallel_for`.
+inline void convolve(ImageView<const Color> In, ImageView<Color> Out, std::span<const fat4> KernelX, std::span<const fat4> KernelY) {
+  const nat w = std::min(In.width(), Out.width()), h = std::min(In.height(), Out.height());
+  if (w == 0 || h == 0 || KernelX.empty() || KernelY.empty()) return;
+  const int8 ry = int8(KernelY.size() / 2);
+  parallel_for((h + FILTER_STRIP - 1) / FILTER_STRIP, 1, [&](const nat s) {
+    const int8 y0 = int8(s * FILTER_STRIP), y1 = int8(std::min(h, (s + 1) * FILTER_STRIP));
+    const int8 t0 = std::max(y0 - ry, int8(0)), t1 = std::min(y1 + ry, int8(h));
+    std::vector<Color> tmp(nat(t1 - t0) * w);
+    for (int8 y = t0; y < t1; ++y) _::_convolve_row(In.row(y).first(w), tmp.data() + (y - t0) * w, KernelX);
+    for (int8 y = y0; y < y1; ++y) {
+      auto out = Out.row(y);
+      for (nat x{}; x < w; ++x) {
+        auto acc = xvfill(0.f);
+        for (int8 i{}; i < int8(KernelY.size()); ++i)
+          acc = xvadd(acc, xvmul(xvfill(KernelY[i]), _::_px_load(tmp[(std::clamp(y - ry + i, int8(0), int8(h) - 1) - t0) * w + x])));
+        _::_px_store(out[x], acc);
+      }
+    }
+  });
+}
+
+/// returns a normalized Gaussian kernel of radius `ceil(3 * Sigma)`
+inline std::vector<fat4> gaussian_kernel(const fat4 Sigma) {
+  if (!(Sigma > 0.f)) return {1.f};
+  const int8 r = int8(std::ceil(3 * Sigma));
+  std::vector<fat4> k(r * 2 + 1);
+  fat8 sum{};
+  for (int8 i = -r; i <= r; ++i) sum += std::exp(-0.5 * i * i / (fat8(Sigma) * Sigma));
+  for (int8 i = -r; i <= r; ++i) k[i + r] = fat4(std::exp(-0.5 * i * i / (fat8(Sigma) * Sigma)) / sum);
+  return k;
+}
+
+/// blurs an image with a Gaussian kernel
+/// \param In (in) source image
+/// \param Out (out) destination image of the same size as `In`; must not overlap `In`
+/// \param Sigma standard deviation in pixels
+inline void gaussian_blur(ImageView<const Color> In, ImageView<Color> Out, const fat4 Sigma) {
+  const auto k = gaussian_kernel(Sigma);
+  convolve(In, Out, k, k);
+}
+
+/// blurs an image with a box of `(2 * Radius + 1)` pixels square using running sums
+/// \param In (in) source image
+/// \param Out (out) destination image of the same size as `In`; may be the same as `In`
+/// \param Radius radius of the box in pixels
+/// \note The cost per pixel does not depend on `Radius`; borders are clamped to the edge, and the clamped copies
+///       of an edge pixel are multiplied rather than summed one by one.
+inline void box_blur(ImageView<const Color> In, ImageView<Color> Out, const nat Radius) {
+  const nat w = std::min(In.width(), Out.width()), h = std::min(In.height(), Out.height());
+  if (w == 0 || h == 0) return;
+  const int8 r = int8(Radius);
+  const auto k = xvfill(1.f / (2 * Radius + 1));
+  Image<Color> tmp(w, h);
+  auto seed = [r](auto&& at, const int8 n) {
+    const int8 m = std::min(r, n - 1);
+    auto sum = xvmul(xvfill(fat4(r)), at(0));
+    for (int8 i{}; i <= m; ++i) sum = xvadd(sum, at(i));
+    return m < r ? xvadd(sum, xvmul(xvfill(fat4(r - m)), at(n - 1))) : sum;
+  };
+  auto horizontal = [&](const nat y) {
+    const auto in = In.row(y);
+    auto out = tmp.row(y);
+    auto at = [&](const int8 x) { return _::_px_load(in[std::clamp(x, int8(0), int8(w) - 1)]); };
+    auto sum = seed(at, int8(w));
+    for (int8 x{}; x < int8(w); ++x) {
+      _::_px_store(out[x], xvmul(sum, k));
+      sum = xvadd(sum, xvsub(at(x + r + 1), at(x - r)));
+    }
+  };
+  parallel_for(h, FILTER_STRIP, horizontal);
+  constexpr nat cols = 64;
+  parallel_for((w + cols - 1) / cols, 1, [&](const nat c) {
+    const nat x0 = c * cols, n = std::min(cols, w - x0);
+    XVector sum[cols];
+    auto at = [&](const int8 y, const nat x) { return _::_px_load(tmp(x0 + x, std::clamp(y, int8(0), int8(h) - 1))); };
+    for (nat x{}; x < n; ++x) sum[x] = seed([&](const int8 y) { return at(y, x); }, int8(h));
+    for (int8 y{}; y < int8(h); ++y)
+      for (nat x{}; x < n; ++x) {
+        _::_px_store(Out(x0 + x, y), xvmul(sum[x], k));
+        sum[x] = xvadd(sum[x], xvsub(at(y + r + 1, x), at(y - r, x)));
+      }
+  });
+}
+
+/// resizes an image to the size of `Out`
+/// \param In (in) source image
+/// \param Out (out) destination image; its size is the target size
+/// \param Filter filter of resampling; downscaling widens the filter to avoid aliasing
+/// \note Rows are processed concurrently with `yw::parallel_for`.
+inline void resize(ImageView<const Color> In, ImageView<Color> Out, const Resample Filter = Resample::BILINEAR) {
+  if (In.empty() || Out.empty()) return;
+  const _::_resample_axis ax(In.width(), Out.width(), Filter), ay(In.height(), Out.height(), Filter);
+  Image<Color> tmp(Out.width(), In.height());
+  parallel_for(In.height(), FILTER_STRIP, [&](const nat y) {
+    const auto in = In.row(y);
+    auto out = tmp.row(y);
+    for (nat x{}; x < out.size(); ++x) {
+      auto acc = xvfill(0.f);
+      const fat4* w = ax.weight.data() + x * ax.taps;
+      for (nat i{}; i < ax.count[x]; ++i) acc = xvadd(acc, xvmul(xvfill(w[i]), _::_px_load(in[ax.first[x] + i])));
+      _::_px_store(out[x], acc);
+    }
+  });
+  parallel_for(Out.height(), FILTER_STRIP, [&](const nat y) {
+    auto out = Out.row(y);
+    const fat4* w = ay.weight.data() + y * ay.taps;
+    for (nat x{}; x < out.size(); ++x) {
+      auto acc = xvfill(0.f);
+      for (nat i{}; i < ay.count[y]; ++i) acc = xvadd(acc, xvmul(xvfill(w[i]), _::_px_load(tmp(x, ay.first[y] + i))));
+      _::_px_store(out[x], acc);
+    }
+  });
+}
+
+/// convolves an 8-bit image with a separable kernel through `yw::Color`
+inline void convolve(ImageView<const Color::Rgba8> In, ImageView<Color::Rgba8> Out, std::span<const fat4> KernelX, std::span<const fat4> KernelY) {
+  _::_via_color(In, Out, [&](ImageView<const Color> a, ImageView<Color> b) { convolve(a, b, KernelX, KernelY); });
+}
+
+/// blurs an 8-bit image with a Gaussian kernel through `yw::Color`
+inline void gaussian_blur(ImageView<const Color::Rgba8> In, ImageView<Color::Rgba8> Out, const fat4 Sigma) {
+  _::_via_color(In, Out, [&](ImageView<const Color> a, ImageView<Color> b) { gaussian_blur(a, b, Sigma); });
+}
+
+/// blurs an 8-bit image with a box through `yw::Color`
+inline void box_blur(ImageView<const Color::Rgba8> In, ImageView<Color::Rgba8> Out, const nat Radius) {
+  _::_via_color(In, Out, [&](ImageView<const Color> a, ImageView<Color> b) { box_blur(a, b, Radius); });
+}
+
+/// resizes an 8-bit image through `yw::Color`; results are clamped to [0..255]
+inline void resize(ImageView<const Color::Rgba8> In, ImageView<Color::Rgba8> Out, const Resample Filter = Resample::BILINEAR) {
+  _::_via_color(In, Out, [&](ImageView<const Color> a, ImageView<Color> b) { resize(a, b, Filter); });
+}
+
+} // namespace yw
@@ -0,0 +1,285 @@
+/// \file image_quantize.hpp
+/// \brief defines palette quantization of images with optional dithering
+
+#pragma once
+
+#ifndef YWLIB
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "image.hpp"
+
+export namespace yw {
+
+
+/// enum to represent the method to build a palette
+enum class Quantizer {
+  MEDIAN_CUT, // splits the color histogram at weighted medians
+  KMEANS,     // refines the median cut palette with k-means
+};
+
+/// enum to represent the dithering of quantized images
+enum class Dither {
+  NONE,            // nearest palette color
+  ORDERED,         // 8x8 Bayer matrix
+  FLOYD_STEINBERG, // error diffusion; processed on one thread
+};
+
+/// struct to represent a quantized image
+struct Quantized {
+  std::vector<Color> palette{}; // at most 256 colors
+  std::vector<nat1> indices{};  // palette indices of the pixels, row by row
+  nat width = 0;                // width in pixels
+  nat height = 0;               // height in pixels
+};
+
+} // namespace yw
+
+
+namespace yw::_ {
+
+/// bits per RGB channel of the histogram
+inline constexpr nat _qz_bits = 5;
+
+/// weighted point of the histogram
+struct _qz_point {
+  fat4 c[4]; // mean color
+  fat4 w;    // number of pixels
+};
+
+/// returns the histogram bin of a color
+inline nat _qz_bin(const Color& c) noexcept {
+  constexpr fat4 m = (1 << _qz_bits) - 1;
+  auto q = [](const fat4 v) noexcept { return nat(std::clamp(v, 0.f, 1.f) * m + 0.5f); };
+  return q(c.r) << (2 * _qz_bits) | q(c.g) << _qz_bits | q(c.b);
+}
+
+/// builds the histogram of an image concurrently and returns its non-empty bins
+inline std::vector<_qz_point> _qz_histogram(ImageView<const Color> Image) {
+  struct Bin { fat8 c[4]; nat n; };
+  constexpr nat bins = nat(1) << (3 * _qz_bits), band = 64;
+  const nat bands = (Image.height() + band - 1) / band;
+  const nat parts = std::max(nat(1), std::min(bands, ThreadPool::global().size() + 1));
+  std::vector<std::vector<Bin>> hists(parts);
+  parallel_for(parts, 1, [&](const nat p) {
+    auto& h = hists[p];
+    h.assign(bins, Bin{});
+    for (nat b = p; b < bands; b += parts)
+      for (nat y = b * band, e = std::min(Image.height(), y + band); y < e; ++y)
+        for (const auto& c : Image.row(y)) {
+          auto& x = h[_qz_bin(c)];
+          x.c[0] += c.r, x.c[1] += c.g, x.c[2] += c.b, x.c[3] += c.a, ++x.n;
+        }
+  });
+  std::vector<_qz_point> points;
+  for (nat i{}; i < bins; ++i) {
+    Bin s{};
+    for (const auto& h : hists) for (nat k{}; k < 4; ++k) s.c[k] += h[i].c[k];
+    for (const auto& h : hists) s.n += h[i].n;
+    if (s.n == 0) continue;
+    points.push_back({{fat4(s.c[0] / s.n), fat4(s.c[1] / s.n), fat4(s.c[2] / s.n), fat4(s.c[3] / s.n)}, fat4(s.n)});
+  }
+  return points;
+}
+
+/// returns the weighted mean of points
+inline Color _qz_mean(std::span<const _qz_point> p) noexcept {
+  fat8 c[4]{}, w{};
+  for (const auto& x : p) {
+    for (nat k{}; k < 4; ++k) c[k] += fat8(x.c[k]) * x.w;
+    w += x.w;
+  }
+  return w == 0 ? Color{} : Color(c[0] / w, c[1] / w, c[2] / w, c[3] / w);
+}
+
+/// builds a palette by median cut; `points` are reordered
+inline std::vector<Color> _qz_median_cut(std::vector<_qz_point>& points, const nat Count) {
+  struct Box { nat lo, hi, axis; fat8 score; };
+  auto make = [&](const nat lo, const nat hi) {
+    fat4 mn[3]{1e30f, 1e30f, 1e30f}, mx[3]{-1e30f, -1e30f, -1e30f};
+    fat8 w{};
+    for (nat i = lo; i < hi; ++i) {
+      for (nat k{}; k < 3; ++k) mn[k] = std::min(mn[k], points[i].c[k]), mx[k] = std::max(mx[k], points[i].c[k]);
+      w += points[i].w;
+    }
+    nat axis{};
+    for (nat k{1}; k < 3; ++k) if (mx[k] - mn[k] > mx[axis] - mn[axis]) axis = k;
+    return Box{lo, hi, axis, hi - lo < 2 ? 0.0 : (mx[axis] - mn[axis]) * w};
+  };
+  std::vector<Box> boxes;
+  if (!points.empty()) boxes.push_back(make(0, points.size()));
+  while (!boxes.empty() && boxes.size() < Count) {
+    const auto it = std::ranges::max_element(boxes, {}, &Box::score);
+    if (it->score <= 0) break;
+    const auto b = *it;
+    std::sort(points.begin() + b.lo, points.begin() + b.hi, [a = b.axis](const _qz_point& x, const _qz_point& y) { return x.c[a] < y.c[a]; });
+    fat8 total{}, acc{};
+    for (nat i = b.lo; i < b.hi; ++i) total += points[i].w;
+    nat mid = b.lo;
+    while (mid < b.hi - 1 && (acc += points[mid].w) < total / 2) ++mid;
+    mid = std::clamp(mid + 1, b.lo + 1, b.hi - 1);
+    *it = make(b.lo, mid);
+    boxes.push_back(make(mid, b.hi));
+  }
+  std::vector<Color> palette(boxes.size());
+  for (nat i{}; i < boxes.size(); ++i)
+    palette[i] = _qz_mean(std::span(points).subspan(boxes[i].lo, boxes[i].hi - boxes[i].lo));
+  return palette;
+}
+
+/// palette in channel-major order, padded to a multiple of 4 with far colors
+struct _qz_palette {
+  std::vector<fat4> c[4];
+  nat size = 0;
+
+  explicit _qz_palette(std::span<const Color> Palette) : size(Palette.size()) {
+    const nat n = (size + 3) & ~nat(3);
+    for (auto& v : c) v.assign(n, 1e18f);
+    for (nat i{}; i < size; ++i) c[0][i] = Palette[i].r, c[1][i] = Palette[i].g, c[2][i] = Palette[i].b, c[3][i] = Palette[i].a;
+  }
+
+  /// returns the index of the nearest color; the smallest index among ties
+  nat nearest(const fat4 r, const fat4 g, const fat4 b, const fat4 a) const noexcept {
+    const auto pr = xvfill(r), pg = xvfill(g), pb = xvfill(b), pa = xvfill(a);
+    auto best = xvfill(std::numeric_limits<fat4>::infinity()), index = xvfill(0.f), j = _mm_setr_ps(0, 1, 2, 3);
+    for (nat i{}; i < c[0].size(); i += 4, j = xvadd(j, xvfill(4.f))) {
+      const auto dr = xvsub(pr, _mm_loadu_ps(&c[0][i])), dg = xvsub(pg, _mm_loadu_ps(&c[1][i]));
+      const auto db = xvsub(pb, _mm_loadu_ps(&c[2][i])), da = xvsub(pa, _mm_loadu_ps(&c[3][i]));
+      const auto d = xvadd(xvadd(xvmul(dr, dr), xvmul(dg, dg)), xvadd(xvmul(db, db), xvmul(da, da)));
+      const auto m = _mm_cmplt_ps(d, best);
+      best = _mm_min_ps(d, best), index = _mm_blendv_ps(index, j, m);
+    }
+    alignas(16) fat4 bd[4], bi[4];
+    _mm_store_ps(bd, best), _mm_store_ps(bi, index);
+    nat k{};
+    for (nat i{1}; i < 4; ++i) if (bd[i] < bd[k] || (bd[i] == bd[k] && bi[i] < bi[k])) k = i;
+    return nat(bi[k]);
+  }
+};
+
+/// refines a palette by weighted k-means over the histogram points
+inline void _qz_kmeans(std::span<const _qz_point> points, std::vector<Color>& palette, const nat Iterations) {
+  constexpr nat chunk = 4096;
+  const nat chunks = (points.size() + chunk - 1) / chunk, k = palette.size();
+  std::vector<fat8> sums(chunks * k * 5);
+  for (nat it{}; it < Iterations; ++it) {
+    const _qz_palette p(palette);
+    std::ranges::fill(sums, 0.0);
+    parallel_for(chunks, 1, [&](const nat c) {
+      fat8* s = sums.data() + c * k * 5;
+      for (nat i = c * chunk, e = std::min<nat>(points.size(), i + chunk); i < e; ++i) {
+        const auto& x = points[i];
+        fat8* t = s + p.nearest(x.c[0], x.c[1], x.c[2], x.c[3]) * 5;
+        for (nat q{}; q < 4; ++q) t[q] += fat8(x.c[q]) * x.w;
+        t[4] += x.w;
+      }
+    });
+    bool moved = false;
+    for (nat j{}; j < k; ++j) {
+      fat8 t[5]{};
+      for (nat c{}; c < chunks; ++c) for (nat q{}; q < 5; ++q) t[q] += sums[(c * k + j) * 5 + q];
+      if (t[4] == 0) continue;
+      const Color m(t[0] / t[4], t[1] / t[4], t[2] / t[4], t[3] / t[4]);
+      moved |= m.r != palette[j].r || m.g != palette[j].g || m.b != palette[j].b || m.a != palette[j].a;
+      palette[j] = m;
+    }
+    if (!moved) break;
+  }
+}
+
+/// 8x8 Bayer matrix
+inline constexpr nat1 _qz_bayer[8][8] = {
+  {0, 32, 8, 40, 2, 34, 10, 42}, {48, 16, 56, 24, 50, 18, 58, 26}, {12, 44, 4, 36, 14, 46, 6, 38},
+  {60, 28, 52, 20, 62, 30, 54, 22}, {3, 35, 11, 43, 1, 33, 9, 41}, {51, 19, 59, 27, 49, 17, 57, 25},
+  {15, 47, 7, 39, 13, 45, 5, 37}, {63, 31, 55, 23, 61, 29, 53, 21}};
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+
+/// builds a palette of an image
+/// \param Image (in) pixels to quantize
+/// \param Count maximum number of colors; clamped to [1..256]
+/// \param Method method to build the palette
+/// \param Iterations maximum number of k-means iterations
+/// \return palette; fewer than `Count` colors if the image has few distinct colors
+inline std::vector<Color> make_palette(ImageView<const Color> Image, const nat Count,
+                                       const Quantizer Method = Quantizer::MEDIAN_CUT, const nat Iterations = 16) {
+  auto points = _::_qz_histogram(Image);
+  auto palette = _::_qz_median_cut(points, std::clamp(Count, nat(1), nat(256)));
+  if (Method == Quantizer::KMEANS) _::_qz_kmeans(points, palette, Iterations);
+  return palette;
+}
+
+/// maps pixels to the nearest colors of a palette
+/// \param Image (in) pixels to map
+/// \param Palette (in) at most 256 colors
+/// \param Mode dithering; `Dither::NONE` and `Dither::ORDERED` run rows concurrently
+/// \return palette indices of the pixels, row by row
+inline std::vector<nat1> remap(ImageView<const Color> Image, std::span<const Color> Palette, const Dither Mode = Dither::NONE) {
+  const nat w = Image.width(), h = Image.height();
+  std::vector<nat1> out(w * h);
+  if (Palette.empty() || out.empty()) return out;
+  const _::_qz_palette p(Palette.first(std::min<nat>(Palette.size(), 256)));
+  if (Mode == Dither::FLOYD_STEINBERG) {
+    std::vector<XVector> err((w + 2) * 2, XVZERO);
+    XVector* cur = err.data() + 1, * next = cur + w + 2;
+    for (nat y{}; y < h; ++y) {
+      std::fill(next - 1, next + w + 1, XVector(XVZERO));
+      for (nat x{}; x < w; ++x) {
+        const auto& c = Image(x, y);
+        const auto v = xvadd(_mm_loadu_ps(&c.r), cur[x]);
+        alignas(16) fat4 t[4];
+        _mm_store_ps(t, v);
+        const nat i = p.nearest(t[0], t[1], t[2], t[3]);
+        out[y * w + x] = nat1(i);
+        const auto e = xvsub(v, _mm_setr_ps(p.c[0][i], p.c[1][i], p.c[2][i], p.c[3][i]));
+        cur[x + 1] = xvadd(cur[x + 1], xvmul(e, xvfill(7 / 16.f)));
+        next[x - 1] = xvadd(next[x - 1], xvmul(e, xvfill(3 / 16.f)));
+        next[x] = xvadd(next[x], xvmul(e, xvfill(5 / 16.f)));
+        next[x + 1] = xvadd(next[x + 1], xvmul(e, xvfill(1 / 16.f)));
+      }
+      std::swap(cur, next);
+    }
+    return out;
+  }
+  const fat4 spread = Mode == Dither::ORDERED ? 1.f / std::cbrt(fat4(p.size)) : 0.f;
+  parallel_for(h, 16, [&](const nat y) {
+    const auto row = Image.row(y);
+    for (nat x{}; x < w; ++x) {
+      const auto& c = row[x];
+      const fat4 o = spread * ((_::_qz_bayer[y & 7][x & 7] + 0.5f) / 64 - 0.5f);
+      out[y * w + x] = nat1(p.nearest(c.r + o, c.g + o, c.b + o, c.a));
+    }
+  });
+  return out;
+}
+
+/// quantizes an image to a palette and indices
+/// \param Image (in) pixels to quantize
+/// \param Count maximum number of colors; clamped to [1..256]
+/// \param Method method to build the palette
+/// \param Mode dithering
+inline Quantized quantize(ImageView<const Color> Image, const nat Count,
+                          const Quantizer Method = Quantizer::MEDIAN_CUT, const Dither Mode = Dither::NONE) {
+  Quantized q{make_palette(Image, Count, Method), {}, Image.width(), Image.height()};
+  q.indices = remap(Image, q.palette, Mode);
+  return q;
+}
+
+/// quantizes an image of 8-bit pixels to a palette and indices
+/// \note Pixels are unpacked to `yw::Color` first.
+inline Quantized quantize(ImageView<const Color::Rgba8> Image, const nat Count,
+                          const Quantizer Method = Quantizer::MEDIAN_CUT, const Dither Mode = Dither::NONE) {
+  yw::Image<Color> f(Image.width(), Image.height());
+  parallel_convert(Image, f);
+  return quantize(f, Count, Method, Mode);
+}
+
+} // namespace yw
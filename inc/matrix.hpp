@@ -0,0 +1,344 @@
+/// \file matrix.hpp
+/// \brief defines `yw::Matrix` and its related definitions
+
+#pragma once
+
+#ifndef YWLIB
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#else
+import std;
+#endif
+
+#include "parallel.hpp"
+#include "xvector.hpp"
+
+export namespace yw {
+
+
+/// maximum size in bytes of matrices returned by value
+/// \note Larger matrices (e.g. 1 MiB for 512x512, the whole default stack of a Windows thread) should be
+///       allocated on the heap and used only through the functions with out-parameters.
+inline constexpr nat MATRIX_STACK_LIMIT = 64 * 1024;
+
+
+/// struct to represent a fixed-size row-major matrix of `fat4`
+/// \tparam R number of rows
+/// \tparam C number of columns
+/// \note Each row is padded to `PITCH` elements so that rows can be processed as `XVector`s.
+///       The padding elements must be kept zero.
+/// \note Functions returning a matrix by value are available only up to `MATRIX_STACK_LIMIT` bytes.
+template<nat R, nat C = R> requires (R > 0 && C > 0) struct Matrix {
+
+  /// number of rows
+  static constexpr nat ROWS = R;
+
+  /// number of columns
+  static constexpr nat COLS = C;
+
+  /// number of elements between the heads of two adjacent rows
+  static constexpr nat PITCH = (C + 3) & ~nat(3);
+
+  /// checks if the matrix is small enough to be returned by value; see `MATRIX_STACK_LIMIT`
+  static constexpr bool BY_VALUE = R * PITCH * sizeof(fat4) <= MATRIX_STACK_LIMIT;
+
+  /// base array
+  alignas(16) Array<fat4, R * PITCH> array{};
+
+  /// default constructor; all elements are zero
+  constexpr Matrix() noexcept = default;
+
+  /// constructor with the elements in row-major order
+  constexpr Matrix(std::initializer_list<fat4> il) noexcept {
+    auto p = il.begin();
+    for (nat i{}; i < R; ++i)
+      for (nat j{}; j < C && p != il.end(); ++j) array[i * PITCH + j] = *p++;
+  }
+
+  /// returns the identity matrix
+  static constexpr Matrix identity() noexcept requires (R == C && BY_VALUE) {
+    Matrix m;
+    for (nat i{}; i < R; ++i) m.array[i * PITCH + i] = 1.f;
+    return m;
+  }
+
+  /// returns a pointer to the head of the `I`-th row
+  constexpr fat4* operator[](const nat I) noexcept { return array.data() + I * PITCH; }
+
+  /// returns a pointer to the head of the `I`-th row (const)
+  constexpr const fat4* operator[](const nat I) const noexcept { return array.data() + I * PITCH; }
+
+  /// returns a reference to the element at (`I`, `J`)
+  constexpr fat4& operator()(const nat I, const nat J) noexcept { return array[I * PITCH + J]; }
+
+  /// returns the element at (`I`, `J`) (const)
+  constexpr fat4 operator()(const nat I, const nat J) const noexcept { return array[I * PITCH + J]; }
+
+  /// returns the number of rows
+  constexpr nat rows() const noexcept { return R; }
+
+  /// returns the number of columns
+  constexpr nat cols() const noexcept { return C; }
+
+  /// returns a pointer to the base array
+  constexpr fat4* data() noexcept { return array.data(); }
+
+  /// returns a pointer to the base array (const)
+  constexpr const fat4* data() const noexcept { return array.data(); }
+
+  /// addition assignment operator
+  Matrix& operator+=(const Matrix& b) noexcept {
+    for (nat i{}; i < R * PITCH; i += 4) xvstore(data() + i, xvadd(xvload(data() + i), xvload(b.data() + i)));
+    return *this;
+  }
+
+  /// subtraction assignment operator
+  Matrix& operator-=(const Matrix& b) noexcept {
+    for (nat i{}; i < R * PITCH; i += 4) xvstore(data() + i, xvsub(xvload(data() + i), xvload(b.data() + i)));
+    return *this;
+  }
+
+  /// multiplication assignment operator
+  Matrix& operator*=(numeric auto&& b) noexcept {
+    const auto f = xvfill(fat4(b));
+    for (nat i{}; i < R * PITCH; i += 4) xvstore(data() + i, xvmul(xvload(data() + i), f));
+    return *this;
+  }
+
+  /// addition operator
+  friend Matrix operator+(Matrix a, const Matrix& b) noexcept requires BY_VALUE { return a += b; }
+
+  /// subtraction operator
+  friend Matrix operator-(Matrix a, const Matrix& b) noexcept requires BY_VALUE { return a -= b; }
+
+  /// multiplication operator
+  friend Matrix operator*(Matrix a, numeric auto&& b) noexcept requires BY_VALUE { return a *= b; }
+
+  /// multiplication operator
+  friend Matrix operator*(numeric auto&& a, Matrix b) noexcept requires BY_VALUE { return b *= a; }
+
+  /// equality operator
+  friend constexpr bool operator==(const Matrix& a, const Matrix& b) noexcept {
+    for (nat i{}; i < R * PITCH; ++i) if (a.array[i] != b.array[i]) return false;
+    return true;
+  }
+};
+
+} // namespace yw
+
+
+namespace yw::_ {
+
+inline constexpr nat _mx_mc = 32;  // rows of a block handled by one task
+inline constexpr nat _mx_kc = 256; // depth of a block; `_mx_kc` rows of `b` stay in L2
+inline constexpr nat _mx_nc = 512; // columns of a block
+
+/// `r[0..M)[0..N) += a[0..M)[0..K) * b[0..K)[0..N)`; `N` is 4 or 8
+template<nat M, nat N> inline void _mx_kernel(
+  const fat4* a, const nat lda, const fat4* b, const nat ldb, const nat K, fat4* r, const nat ldr) noexcept {
+  XVector c[M][N / 4];
+  for (nat m{}; m < M; ++m)
+    for (nat n{}; n < N / 4; ++n) c[m][n] = xvload(r + m * ldr + n * 4);
+  for (nat k{}; k < K; ++k, b += ldb) {
+    XVector v[N / 4];
+    for (nat n{}; n < N / 4; ++n) v[n] = xvload(b + n * 4);
+    for (nat m{}; m < M; ++m) {
+      const XVector e = xvfill(a[m * lda + k]);
+      for (nat n{}; n < N / 4; ++n) c[m][n] = xvadd(c[m][n], xvmul(e, v[n]));
+    }
+  }
+  for (nat m{}; m < M; ++m)
+    for (nat n{}; n < N / 4; ++n) xvstore(r + m * ldr + n * 4, c[m][n]);
+}
+
+/// processes up to 4 rows of a block
+template<nat M> inline void _mx_panel(
+  const fat4* a, const nat lda, const fat4* b, const nat ldb, const nat K, fat4* r, const nat ldr, const nat N) noexcept {
+  nat j{};
+  for (; j + 8 <= N; j += 8) _mx_kernel<M, 8>(a, lda, b + j, ldb, K, r + j, ldr);
+  if (j < N) _mx_kernel<M, 4>(a, lda, b + j, ldb, K, r + j, ldr);
+}
+
+/// `y[Begin..End) -= x[Begin..End) * f`; `End` is a multiple of 4
+inline void _mx_axpy(fat4* y, const fat4* x, const fat4 f, nat Begin, const nat End) noexcept {
+  for (; Begin < End && (Begin & 3); ++Begin) y[Begin] -= x[Begin] * f;
+  const auto v = xvfill(f);
+  for (; Begin < End; Begin += 4) xvstore(y + Begin, xvsub(xvload(y + Begin), xvmul(xvload(x + Begin), v)));
+}
+
+/// `y[0..N) *= f`; `N` is a multiple of 4
+inline void _mx_scale(fat4* y, const fat4 f, const nat N) noexcept {
+  const auto v = xvfill(f);
+  for (nat i{}; i < N; i += 4) xvstore(y + i, xvmul(xvload(y + i), v));
+}
+
+/// returns the dot product of `a[0..N)` and `b[0..N)`
+inline fat4 _mx_dot(const fat4* a, const fat4* b, const nat N) noexcept {
+  auto s = XVector(XVZERO);
+  nat i{};
+  for (; i + 4 <= N; i += 4) s = xvadd(s, xvmul(xvload(a + i), xvload(b + i)));
+  fat4 r = xvextract<0>(xvsum(s));
+  for (; i < N; ++i) r += a[i] * b[i];
+  return r;
+}
+
+/// swaps two rows of `N` elements; `N` is a multiple of 4
+inline void _mx_swap(fat4* a, fat4* b, const nat N) noexcept {
+  for (nat i{}; i < N; i += 4) {
+    const auto t = xvload(a + i);
+    xvstore(a + i, xvload(b + i));
+    xvstore(b + i, t);
+  }
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+
+/// calculates the product of two matrices
+/// \param a left-hand side matrix
+/// \param b right-hand side matrix
+/// \param r result; must not be the same object as `a` or `b`
+/// \note The product is computed block by block with a 4x8 register tile;
+///       row blocks are distributed over `ThreadPool::global()` for large matrices.
+template<nat R, nat K, nat C>
+void mxdot(const Matrix<R, K>& a, const Matrix<K, C>& b, Matrix<R, C>& r) {
+  constexpr nat P = Matrix<R, C>::PITCH, blocks = (R + _::_mx_mc - 1) / _::_mx_mc;
+  std::ranges::fill(r.array, 0.f);
+  auto block = [&](const nat ib) noexcept {
+    const nat i0 = ib * _::_mx_mc, i1 = std::min(R, i0 + _::_mx_mc);
+    for (nat jc{}; jc < P; jc += _::_mx_nc) {
+      const nat jn = std::min(_::_mx_nc, P - jc);
+      for (nat pc{}; pc < K; pc += _::_mx_kc) {
+        const nat kn = std::min(_::_mx_kc, K - pc);
+        for (nat i = i0; i < i1; i += 4) {
+          const fat4* pa = a[i] + pc;
+          const fat4* pb = b[pc] + jc;
+          fat4* pr = r[i] + jc;
+          constexpr nat la = Matrix<R, K>::PITCH;
+          switch (std::min(nat(4), i1 - i)) {
+          case 4: _::_mx_panel<4>(pa, la, pb, P, kn, pr, P, jn); break;
+          case 3: _::_mx_panel<3>(pa, la, pb, P, kn, pr, P, jn); break;
+          case 2: _::_mx_panel<2>(pa, la, pb, P, kn, pr, P, jn); break;
+          default: _::_mx_panel<1>(pa, la, pb, P, kn, pr, P, jn); break;
+          }
+        }
+      }
+    }
+  };
+  if constexpr (blocks > 1 && R * K * C >= 64 * 64 * 64) parallel_for(blocks, 1, block);
+  else for (nat ib{}; ib < blocks; ++ib) block(ib);
+}
+
+/// multiplication operator of two matrices
+template<nat R, nat K, nat C> requires Matrix<R, C>::BY_VALUE
+Matrix<R, C> operator*(const Matrix<R, K>& a, const Matrix<K, C>& b) {
+  Matrix<R, C> r;
+  mxdot(a, b, r);
+  return r;
+}
+
+/// transposes a matrix
+/// \param m matrix to transpose
+/// \param r result; must not be the same object as `m`
+template<nat R, nat C>
+void mxtranspose(const Matrix<R, C>& m, Matrix<C, R>& r) noexcept {
+  constexpr nat R4 = R & ~nat(3), C4 = C & ~nat(3), T = 32;
+  for (nat ii{}; ii < R4; ii += T)
+    for (nat jj{}; jj < C4; jj += T)
+      for (nat i = ii, ie = std::min(R4, ii + T); i < ie; i += 4)
+        for (nat j = jj, je = std::min(C4, jj + T); j < je; j += 4) {
+          XMatrix x{xvload(m[i] + j), xvload(m[i + 1] + j), xvload(m[i + 2] + j), xvload(m[i + 3] + j)};
+          xvtranspose(x);
+          for (nat k{}; k < 4; ++k) xvstore(r[j + k] + i, x[k]);
+        }
+  for (nat i{}; i < R; ++i)
+    for (nat j = i < R4 ? C4 : 0; j < C; ++j) r(j, i) = m(i, j);
+}
+
+/// returns the transposed matrix
+template<nat R, nat C> requires Matrix<C, R>::BY_VALUE
+Matrix<C, R> mxtranspose(const Matrix<R, C>& m) noexcept {
+  Matrix<C, R> r;
+  mxtranspose(m, r);
+  return r;
+}
+
+/// performs LU decomposition with partial pivoting in place
+/// \param m (in) matrix to decompose; (out) `L` below the diagonal (unit diagonal omitted) and `U` on and above it
+/// \param Pivot (out) `Pivot[k]` is the row swapped with the `k`-th row at the `k`-th step
+/// \return `false` if `m` is singular
+/// \note The row updates of each step are distributed over `ThreadPool::global()` for large matrices.
+template<nat N> bool mxlu(Matrix<N, N>& m, Array<nat, N>& Pivot) {
+  constexpr nat P = Matrix<N, N>::PITCH;
+  for (nat k{}; k < N; ++k) {
+    nat p = k;
+    for (nat i = k + 1; i < N; ++i) if (std::abs(m(i, k)) > std::abs(m(p, k))) p = i;
+    Pivot[k] = p;
+    if (m(p, k) == 0.f) return false;
+    if (p != k) _::_mx_swap(m[p], m[k], P);
+    const fat4 d = 1.f / m(k, k);
+    auto row = [&](const nat i) noexcept {
+      const fat4 l = m(i + k + 1, k) *= d;
+      _::_mx_axpy(m[i + k + 1], m[k], l, k + 1, P);
+    };
+    if (const nat n = N - k - 1; N >= 256 && n >= 128) parallel_for(n, 32, row);
+    else for (nat i{}; i < n; ++i) row(i);
+  }
+  return true;
+}
+
+/// solves `a * x = b` with the result of `mxlu`
+/// \param Lu matrix decomposed by `mxlu`
+/// \param Pivot pivot indices obtained by `mxlu`
+/// \param b (in) right-hand sides; (out) solutions
+template<nat N, nat M>
+void mxlu_solve(const Matrix<N, N>& Lu, const Array<nat, N>& Pivot, Matrix<N, M>& b) noexcept {
+  constexpr nat P = Matrix<N, M>::PITCH;
+  for (nat k{}; k < N; ++k) if (Pivot[k] != k) _::_mx_swap(b[k], b[Pivot[k]], P);
+  for (nat i{}; i < N; ++i)
+    for (nat k{}; k < i; ++k) _::_mx_axpy(b[i], b[k], Lu(i, k), 0, P);
+  for (nat i = N; i-- > 0;) {
+    for (nat k = i + 1; k < N; ++k) _::_mx_axpy(b[i], b[k], Lu(i, k), 0, P);
+    _::_mx_scale(b[i], 1.f / Lu(i, i), P);
+  }
+}
+
+/// performs Cholesky decomposition in place
+/// \param m (in) symmetric positive-definite matrix; only the lower triangle is read
+///          (out) lower triangular matrix `L` such that `L * transpose(L)` is the input
+/// \return `false` if `m` is not positive-definite
+template<nat N> bool mxcholesky(Matrix<N, N>& m) noexcept {
+  for (nat i{}; i < N; ++i) {
+    for (nat j{}; j <= i; ++j) {
+      const fat4 s = m(i, j) - _::_mx_dot(m[i], m[j], j);
+      if (i != j) m(i, j) = s / m(j, j);
+      else if (s > 0.f) m(i, i) = std::sqrt(s);
+      else return false;
+    }
+    for (nat j = i + 1; j < N; ++j) m(i, j) = 0.f;
+  }
+  return true;
+}
+
+/// solves `a * x = b` with the result of `mxcholesky`
+/// \param L lower triangular matrix obtained by `mxcholesky`
+/// \param b (in) right-hand sides; (out) solutions
+template<nat N, nat M>
+void mxcholesky_solve(const Matrix<N, N>& L, Matrix<N, M>& b) noexcept {
+  constexpr nat P = Matrix<N, M>::PITCH;
+  for (nat i{}; i < N; ++i) {
+    for (nat k{}; k < i; ++k) _::_mx_axpy(b[i], b[k], L(i, k), 0, P);
+    _::_mx_scale(b[i], 1.f / L(i, i), P);
+  }
+  for (nat i = N; i-- > 0;) {
+    _::_mx_scale(b[i], 1.f / L(i, i), P);
+    for (nat k{}; k < i; ++k) _::_mx_axpy(b[k], b[i], L(i, k), 0, P);
+  }
+}
+
+} // namespace yw
+
@@ -0,0 +1,122 @@
+/// \file parallel.hpp
+/// \brief defines `yw::ThreadPool` and `yw::parallel_for`
+
+#pragma once
+
+#ifndef YWLIB
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "core.hpp"
+
+export namespace yw {
+
+
+/// class to represent a pool of worker threads
+class ThreadPool {
+protected:
+  std::vector<std::jthread> _workers{};
+  std::deque<std::function<void()>> _tasks{};
+  std::mutex _mutex{};
+  std::condition_variable _cv{};
+  bool _stop{};
+
+  void _run() {
+    for (std::function<void()> f;;) {
+      {
+        std::unique_lock lock(_mutex);
+        _cv.wait(lock, [this] { return _stop || !_tasks.empty(); });
+        if (_tasks.empty()) return;
+        f = mv(_tasks.front());
+        _tasks.pop_front();
+      }
+      f();
+    }
+  }
+
+public:
+
+  /// constructs the pool with `Count` workers
+  explicit ThreadPool(const nat Count) {
+    _workers.reserve(Count);
+    for (nat i{}; i < Count; ++i) _workers.emplace_back([this] { _run(); });
+  }
+
+  /// constructs the pool with one worker less than the hardware concurrency
+  /// \note the calling thread is expected to take part in the work
+  ThreadPool() : ThreadPool(std::max(nat(std::thread::hardware_concurrency()), nat(2)) - 1) {}
+
+  /// finishes the queued tasks and joins the workers
+  ~ThreadPool() {
+    { std::scoped_lock lock(_mutex); _stop = true; }
+    _cv.notify_all();
+    _workers.clear();
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// returns the number of workers
+  nat size() const noexcept { return _workers.size(); }
+
+  /// queues a task
+  void push(std::function<void()> Task) {
+    { std::scoped_lock lock(_mutex); _tasks.push_back(mv(Task)); }
+    _cv.notify_one();
+  }
+
+  /// returns the process-wide pool, created on first use
+  static ThreadPool& global() {
+    static ThreadPool pool;
+    return pool;
+  }
+};
+
+
+/// invokes `Func(i)` for each `i` in `[0, Count)` on `ThreadPool::global()`
+/// \param Count number of iterations
+/// \param Grain number of consecutive iterations taken by a thread at once
+/// \param Func function to invoke; calls for different `i` may run concurrently
+/// \note the calling thread takes part and returns after all iterations finished;
+///       the first exception thrown by `Func` is rethrown.
+inline constexpr auto parallel_for = []<invocable<nat> Fn>(const nat Count, const nat Grain, Fn&& Func) {
+  const nat grain = Grain == 0 ? 1 : Grain, chunks = (Count + grain - 1) / grain;
+  if (chunks == 0) return;
+  auto& pool = ThreadPool::global();
+  if (chunks == 1 || pool.size() == 0) {
+    for (nat i{}; i < Count; ++i) invoke(Func, i);
+    return;
+  }
+  struct State {
+    std::atomic<nat> next{}, done{};
+    std::mutex mutex{};
+    std::condition_variable cv{};
+    std::exception_ptr error{};
+  };
+  auto state = std::make_shared<State>();
+  auto* fn = &Func;
+  auto work = [state, fn, Count, grain, chunks] {
+    for (nat c; (c = state->next.fetch_add(1)) < chunks;) {
+      try { for (nat i = c * grain, e = std::min(Count, i + grain); i < e; ++i) invoke(*fn, i); }
+      catch (...) { std::scoped_lock lock(state->mutex); if (!state->error) state->error = std::current_exception(); }
+      if (state->done.fetch_add(1) + 1 == chunks) { std::scoped_lock lock(state->mutex); state->cv.notify_all(); }
+    }
+  };
+  for (nat i{}, n = std::min(pool.size(), chunks - 1); i < n; ++i) pool.push(work);
+  work();
+  std::unique_lock lock(state->mutex);
+  state->cv.wait(lock, [&] { return state->done.load() == chunks; });
+  if (state->error) std::rethrow_exception(state->error);
+};
+
+} // namespace yw
@@ -75,12 +75,18 @@ struct Sha256 {
   /// result array of 32-bit integers
   Array<nat4, 8> array{_::_sha256_H};
 
+  /// writes the 64 lowercase hexadecimal digits of the hash
+  /// \param Out (out) buffer of at least 64 characters
+  /// \return pointer past the last character written
+  template<character Ct> Ct* to(Ct* Out) const noexcept {
+    for (nat i{}; i < 8; ++i, Out += 8) _::_write_hex(Out, array[i], 8);
+    return Out;
+  }
+
   /// conversion operator to `String<cat1>`
   operator String<cat1>() const noexcept {
-    return std::format(
-      "{:08x}{:08x}{:08x}{:08x}{:08x}{:08x}{:08x}{:08x}",
-      array[0], array[1], array[2], array[3],
-      array[4], array[5], array[6], array[7]);
+    cat1 temp[64];
+    return String<cat1>(temp, to(temp));
   }
 
   /// calculates the SHA-256 hash of a string
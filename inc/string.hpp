@@ -3,7 +3,14 @@
 
 #pragma once
 
+#include <immintrin.h>
+
 #ifndef YWLIB
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #else
@@ -817,7 +824,206 @@ inline constexpr cat2 _shiftjis_table2[29][192] = {
   0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffe, 0xfffe, 0xfffe, },
 };
 
-inline constexpr cat2 _unicode_table_0000_0100[]{
+/// unicode-to-shift-jis table in pages of 64 code points; generated by `scr/sjis_table.py`
+inline constexpr nat8 _sjis_encode_mask[1024]{
+  0xffffffffffffffff, 0xffffffffffffffff, 0x0fffffee00000001, 0xffffffffffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xfffe03fbfffe0000, 0x00000000000003fb,
+  0xffffffffffff0002, 0x000000000002ffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x080d006333210000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000080200400008, 0x03ff03ff00000000, 0x00000000000f0000, 0x0000000000140000,
+  0x20305fa1e402098d, 0x00000cc300040000, 0x80000020000000cc, 0x0000000000000000, 0x0000000000040000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x000fffff00000000, 0x0000000000000000, 0x0000000000000000, 0x999999393999900f, 0x0000000000000804, 0x300c000300000000, 0x000080000000c8c0,
+  0x0000000000000060, 0x0000a40000000005, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x00000000a03fffef, 0xfffffffffffffffe, 0xfffffffe7e1fffff, 0x787fffffffffffff, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0206000000000000, 0x0000000000000000, 0x000001f000000000, 0x0000000000000000, 0x084008cc01102008, 0x7800000000822600, 0x000000027000c000, 0x0000000000002010,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x9b46254243f36f8b, 0x400a0004e3e0e82c, 0x04497977db365f65, 0x18c5603ae3f0ecd7, 0x375180003403e60b, 0x986982007eebe0c8, 0x8060e8032d56ad48, 0xc568c03aad93661c,
+  0x02403f7ec656aa60, 0x21751020146183cd, 0x40bc300007122021, 0x0a3060a84562a624, 0x9c84040285740217, 0x11e27f3414157ffb, 0x60ff1f7522efb665, 0x676336c338403a70,
+  0x0fc946b020b24dd9, 0xa03f86384850bc98, 0x5232be4998162388, 0xc72c00ddeba422ab, 0x8f0a841b26e1a1e7, 0x89bfc241559e27eb, 0x084d636185480014, 0x05cfff3eaad07f0c,
+  0x7b407a41a803ff1a, 0x38eb050080024745, 0x710c9b341005dc51, 0xa404636601000397, 0x430ac000005180d0, 0x5800000830c89071, 0x00415f80f7000ed9, 0x62800018941000b0,
+  0x0156820009d00240, 0x05101d1008015004, 0x10504025001084c1, 0xa60d40094d8a410f, 0x098121c0914cab19, 0x800006720203c485, 0x0009141d00080b04, 0x16900009905c49c9,
+  0x2433841222200c65, 0x42250a0447960c03, 0x4f0c4900d0880028, 0x3e87d830d3aa14a2, 0x41867ea41f618e04, 0x211857ad2dbbc390, 0x4e0411382a48241e, 0x88400d60161b0a40,
+  0x106082219502020a, 0x8000144404000243, 0x700000000c040000, 0x0c00024a00c11a06, 0x4045140400401a00, 0x052b0a78bdf30029, 0x8379407cbfa0bba9, 0xc5695bf6e91d12fd,
+  0xff022115444aeff6, 0x0242d033402bed63, 0x5dca1b4200131000, 0x2c61a703020000a0, 0x000002848ff24880, 0x0048b200100d5804, 0x3780500420011894, 0x68be49ea684d3200,
+  0x21c9a8202e42184c, 0xff7c001e80b050b9, 0x01e028c114e0849a, 0xdddb130fac49870e, 0x51b2a2e289fbbe1a, 0x928b3ec632ca5522, 0x32986703438f1dbf, 0xa923081173c03028,
+  0x04028fe33a65c000, 0x00a1bf3da6252c4e, 0x317c06c98cd43e3a, 0x0edf018bd52a00e0, 0xf09111838c22e34b, 0x40fbc9aca7287d94, 0x44445a9007534484, 0xf5d4004800013fc8,
+  0x891dc442ec5f7701, 0xd242410949286b83, 0x3a22184059fe061d, 0xc0eaf0033b9fb7e4, 0xe400898082021386, 0x0cc44b8010a1b200, 0x48341faf8944d309, 0x0470420a0c458259,
+  0x4450314010c8a040, 0x0540828101004004, 0x1a056a30642c0108, 0x645690cf051460a6, 0xcbf09c1831000021, 0x01b5104c63e2e120, 0x3281b8b29a83538c, 0x0c0233e70a84987a,
+  0x9872e1b1d038d6cd, 0x0459c3f4e2848a1e, 0xd314484523c2439a, 0xffbd024136400292, 0xa5d27dc0e8f0eb09, 0xd0afa47fd24bc242, 0x0bd8824734a11aa0, 0xc83ad294651bc453,
+  0x33140e0640c8001e, 0xc0d00088b21f615f, 0x166ba1c5a898a02a, 0x0604c08b85b4af50, 0xa251056e1e04f933, 0x73b8ed0776380400, 0xc816408119324406, 0xaa04298463097c8a,
+  0x27614e0eca9c1c24, 0xc10c0846830009d0, 0x0908540d10816011, 0x0c000514cc0a000e, 0x6784008ba0440430, 0x8b18865e8a195288, 0x9cbe8c1041602e59, 0x00089800895c6861,
+  0xc1900018089a8100, 0x640d8505f4a14007, 0xff0a48060e4d314e, 0x000b852e2ea81632, 0x696c0e20ca841810, 0x0390d65816000032, 0x112490001a6851a0, 0x1fae5d52432698e1,
+  0x5700fafbae280fa0, 0xc044c88099406408, 0xa4c48424b1419005, 0xc1949000603a1a34, 0xc106180d003a8246, 0x1511e05099100022, 0x022a041a00824157, 0x446ad8138930004f,
+  0x400511c0ed228aa2, 0x3101880801021000, 0x0f08f80002044620, 0x22020000a2008900, 0x1040004216108210, 0x200052f4126052c0, 0x4202110082308510, 0xda2070e180b5430a,
+  0xfc65350008012040, 0x62140286ab0419c1, 0x4246908500440087, 0x338032070a85405c, 0xc0d0ce30b8c00400, 0x0da505080080c030, 0x280c020000400a90, 0x4122642940446705,
+  0x847c4664000002e8, 0x4049861dde200002, 0x20010084c0000a08, 0x01c742cd10108400, 0x1d8f9968d52a703a, 0x81d9aef53e12be50, 0x732e08282412cec4, 0xd41d020c4b3424ac,
+  0x0811009780002a02, 0x7d451786114411c4, 0x879140405e4949dd, 0x491444bad8c4254c, 0x15800271c8001b92, 0xc200096a0c0000c1, 0xba49302140024800, 0x1008e2ac1c802080,
+  0x841400e300341004, 0x1414981020004020, 0x5420868804aa70c2, 0x2010918004130c62, 0x54011c4002064082, 0x84802125e4e90383, 0xe60944c02810e433, 0x080112da81260a03,
+  0xf886400197906901, 0xa6510a0e0081e24d, 0x8441c60081ec011a, 0x8741acefb62eadb8, 0x026811614b028d54, 0x043350a02057bb60, 0x01122402f7b4a8c0, 0x00c8227120009ad3,
+  0xe1800c8a809e2081, 0x402810318151b009, 0x620e69b689a52a0e, 0x4d548085d1444425, 0x862dd8071fb12c75, 0x226e414e5841d97c, 0xedb7f80d9e088200, 0x0814931375668c80,
+  0x6ea6484ec8040e32, 0xba0126c066742c4a, 0x00000000185dd70c, 0x0000000000000000, 0x0540000000000000, 0x03a54f81813370a0, 0x2344c31a641055ec, 0x1a090a4300341462,
+  0xa848010213a5187b, 0xe2dd8106c5440440, 0x0416b6262d481af0, 0x311280326e405058, 0x420a82080c0007e4, 0x87134860803b4840, 0xe52903193428850d, 0x5c1825a9870a2345,
+  0x03e85e00d9c577a6, 0x41c6cd54a7000081, 0x2b0ab860a2042800, 0x0e1a08eada9e0020, 0x0376890811c0427e, 0x98a8000401058621, 0x20220d05c44846a0, 0x28d78a01914854a2,
+  0x3122160500087898, 0x06a2fa4e08804340, 0x9b14200292110814, 0x9010500016432e52, 0x2020304285ba0041, 0x40802f0807a84f0b, 0x0601df501a930591, 0x4e8006303021a202,
+  0x8001a00404c80cc4, 0x0a020880d4316000, 0x00418e1800281c00, 0x4b00f210ca106ad0, 0x889002201506274d, 0x8150454982a85a00, 0x2c08880480002004, 0x4ac48001000508d1,
+  0x0a42008e0062e0a0, 0xe0a5090e6a8c3055, 0x80b3481442c42906, 0x733c0102b330803e, 0x09400c20700d1494, 0xc094a451c040301a, 0xa40c96c205c88dca, 0x011000c834040001,
+  0x1cda2428a9cd550d, 0x120f7a4d48370142, 0xd20531fb452a32b4, 0x45ca68d7dc44b894, 0x420819432ed15097, 0xa09798409d48d202, 0x00000000064d5409, 0x0000000000000000,
+  0x8480000000000000, 0x17001c0604215542, 0xb9ddff8761107624, 0x3c11245d5c0a659f, 0x00000000005dadb0, 0x00db28d000000000, 0x4408010802000422, 0x90288d0aac409804,
+  0x00310400e0018700, 0x1054001982211794, 0x40039c02021a2cb2, 0x7900080c8804bd60, 0xcb088640ba3c1628, 0x0000001e90807274, 0x9c87e188d8000000, 0x2791ae6404124034,
+  0x5366408fe6fbe86b, 0xb5e4e3ab537feea6, 0x012285480002869f, 0x20a0211648004402, 0x0005208002240004, 0x01ac162c01547e00, 0x05308c1410852a84, 0x906060fafdc3fbc3,
+  0x9690120040336440, 0x418200d44e834b31, 0x028020801d6a0129, 0x9f0c269102ad8000, 0x0c24d96f67018044, 0x5021500118d02910, 0x0201709004d01000, 0x0100013261c30148,
+  0x0562080207190088, 0xf0a104054c0e0132, 0x0000000000000002, 0x0000000000000000, 0x0000000000000000, 0x0080000000000000, 0x5a0421bd035e8e8d, 0x0000002611703488,
+  0x8804c50210000000, 0x25ed147cf801b815, 0x1bd785893bb0ed60, 0x0ac50d0c1a627af3, 0x6b0d0490524ae5d1, 0x16122b575266a35c, 0x001829491101a872, 0x886c600010080948,
+  0x39903012058f916e, 0x001b88a049b0f840, 0x0042850000000000, 0x7014ea0498000058, 0x60005193611d1628, 0x0000000000a71a24, 0x1018712043c00000, 0x89066004a9270172,
+  0x40810900020cc022, 0x00000e348ca0602d, 0x1101210000000000, 0x0892ec4cd31a8011, 0x1806c7ac85000040, 0x003480000512e03e, 0x0a126d0180cec008, 0x0027011e08568641,
+  0x4e05e032083d3751, 0x01400081048401c0, 0x0000000000000000, 0x00591aa000000000, 0xc8001d48882443c8, 0x0405981372030152, 0x0d148a1004008280, 0x2704a04002088056,
+  0x000000004e000000, 0xa320000000000000, 0xdf002660a0ae1902, 0x3ad081217b17f010, 0x4800100300284180, 0x00c414cf8014cc00, 0x0000000130202000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+  0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+  0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff,
+  0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0x0000000000ffffff, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000f000000000000, 0x0000020000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010000000,
+  0x00003fffffffc000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+  0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0xfffffffffffffffe, 0xfffffffe7fffffff, 0x00000000ffffffff, 0xc000003f00000000
+};
+
+inline constexpr nat2 _sjis_encode_base[1024]{
+  0x0000, 0x0040, 0x0080, 0x009b, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x00db, 0x0102,
+  0x010b, 0x013c, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d,
+  0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d,
+  0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d,
+  0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d,
+  0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d,
+  0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d,
+  0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d, 0x014d,
+  0x014d, 0x015b, 0x015b, 0x015b, 0x015b, 0x015f, 0x0173, 0x0177, 0x0179, 0x0190, 0x0197, 0x019d, 0x019d, 0x019e, 0x019e, 0x019e,
+  0x019e, 0x019e, 0x01b2, 0x01b2, 0x01b2, 0x01d0, 0x01d2, 0x01d8, 0x01de, 0x01e0, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5,
+  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5,
+  0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5, 0x01e5,
+  0x01e5, 0x01fc, 0x023b, 0x0275, 0x02b0, 0x02b0, 0x02b0, 0x02b0, 0x02b0, 0x02b3, 0x02b3, 0x02b8, 0x02b8, 0x02c3, 0x02cc, 0x02d2,
+  0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4,
+  0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4,
+  0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4,
+  0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4,
+  0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4,
+  0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4,
+  0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02d4, 0x02f4, 0x0307, 0x032a, 0x034a, 0x0360, 0x037b, 0x0393,
+  0x03b0, 0x03cc, 0x03e2, 0x03f2, 0x0407, 0x041b, 0x043e, 0x0464, 0x0480, 0x049c, 0x04b6, 0x04d0, 0x04ee, 0x050b, 0x052d, 0x0540,
+  0x0565, 0x0583, 0x0597, 0x05b0, 0x05c4, 0x05d2, 0x05e1, 0x05f9, 0x0606, 0x0614, 0x0621, 0x062e, 0x0645, 0x065b, 0x066b, 0x0678,
+  0x068c, 0x069f, 0x06b3, 0x06c4, 0x06e1, 0x06fc, 0x071a, 0x072f, 0x0741, 0x0750, 0x075a, 0x0760, 0x076e, 0x0779, 0x0794, 0x07b5,
+  0x07da, 0x07fa, 0x0813, 0x0826, 0x0836, 0x0846, 0x0854, 0x0864, 0x087f, 0x0894, 0x08b0, 0x08c4, 0x08e5, 0x0906, 0x0923, 0x0943,
+  0x0958, 0x096e, 0x098b, 0x09a9, 0x09c3, 0x09dd, 0x09fd, 0x0a12, 0x0a28, 0x0a46, 0x0a5d, 0x0a77, 0x0a99, 0x0aaa, 0x0abc, 0x0ad8,
+  0x0aeb, 0x0afa, 0x0b04, 0x0b17, 0x0b30, 0x0b44, 0x0b5b, 0x0b76, 0x0b8f, 0x0bae, 0x0bc9, 0x0be2, 0x0bfc, 0x0c1c, 0x0c3c, 0x0c54,
+  0x0c71, 0x0c84, 0x0c9d, 0x0cb7, 0x0ccf, 0x0ceb, 0x0d06, 0x0d19, 0x0d31, 0x0d4c, 0x0d5d, 0x0d6d, 0x0d7c, 0x0d8e, 0x0da7, 0x0dc1,
+  0x0dd2, 0x0de0, 0x0df7, 0x0e13, 0x0e2a, 0x0e3f, 0x0e51, 0x0e62, 0x0e81, 0x0ea0, 0x0eb1, 0x0ec5, 0x0ed9, 0x0eec, 0x0efd, 0x0f0e,
+  0x0f25, 0x0f3a, 0x0f44, 0x0f54, 0x0f5d, 0x0f68, 0x0f7a, 0x0f87, 0x0f9f, 0x0fb1, 0x0fc6, 0x0fd6, 0x0feb, 0x0ffe, 0x100d, 0x1017,
+  0x102b, 0x103d, 0x1050, 0x1059, 0x106a, 0x1089, 0x10aa, 0x10c2, 0x10da, 0x10e7, 0x1100, 0x111a, 0x1133, 0x1146, 0x1154, 0x1164,
+  0x1174, 0x1182, 0x118d, 0x11a1, 0x11b0, 0x11be, 0x11d4, 0x11ea, 0x11fc, 0x1212, 0x1228, 0x123b, 0x125e, 0x1273, 0x128a, 0x12a0,
+  0x12b3, 0x12c6, 0x12d7, 0x12f3, 0x1309, 0x1328, 0x1344, 0x1360, 0x1377, 0x1390, 0x13a9, 0x13b8, 0x13b8, 0x13bb, 0x13d3, 0x13ec,
+  0x13fe, 0x1414, 0x142a, 0x1443, 0x1457, 0x1467, 0x147b, 0x1493, 0x14ac, 0x14ca, 0x14df, 0x14f1, 0x1508, 0x151f, 0x152e, 0x1540,
+  0x1557, 0x1569, 0x157e, 0x158f, 0x15a1, 0x15b1, 0x15c7, 0x15df, 0x15f0, 0x15fe, 0x160c, 0x1619, 0x162f, 0x1642, 0x1655, 0x165f,
+  0x166e, 0x167e, 0x1697, 0x16ab, 0x16c3, 0x16d4, 0x16e7, 0x1700, 0x170a, 0x1726, 0x173f, 0x175c, 0x177a, 0x1792, 0x17a9, 0x17b4,
+  0x17b4, 0x17b7, 0x17c9, 0x17eb, 0x1808, 0x1815, 0x1820, 0x1829, 0x183c, 0x1848, 0x185a, 0x186d, 0x1880, 0x1898, 0x18a7, 0x18b9,
+  0x18cf, 0x18f2, 0x191a, 0x192c, 0x1939, 0x1941, 0x1956, 0x1968, 0x198a, 0x199b, 0x19b1, 0x19c1, 0x19d6, 0x19ee, 0x19fe, 0x1a0a,
+  0x1a19, 0x1a28, 0x1a3c, 0x1a3d, 0x1a3d, 0x1a3d, 0x1a3e, 0x1a5a, 0x1a67, 0x1a70, 0x1a8d, 0x1aad, 0x1ac9, 0x1ae3, 0x1b00, 0x1b12,
+  0x1b20, 0x1b39, 0x1b4d, 0x1b52, 0x1b63, 0x1b78, 0x1b82, 0x1b8f, 0x1ba4, 0x1bb0, 0x1bc1, 0x1bc6, 0x1bdd, 0x1bee, 0x1bfe, 0x1c11,
+  0x1c24, 0x1c3e, 0x1c48, 0x1c48, 0x1c51, 0x1c64, 0x1c77, 0x1c84, 0x1c93, 0x1c97, 0x1c9c, 0x1cb3, 0x1ccd, 0x1cd7, 0x1ce9, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee, 0x1cee,
+  0x1cee, 0x1d2e, 0x1d6e, 0x1dae, 0x1dee, 0x1e2e, 0x1e6e, 0x1eae, 0x1eee, 0x1f2e, 0x1f6e, 0x1fae, 0x1fee, 0x202e, 0x206e, 0x20ae,
+  0x20ee, 0x212e, 0x216e, 0x21ae, 0x21ee, 0x222e, 0x226e, 0x22ae, 0x22ee, 0x232e, 0x236e, 0x23ae, 0x23ee, 0x242e, 0x2446, 0x2446,
+  0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446,
+  0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446,
+  0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446,
+  0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446, 0x2446,
+  0x2446, 0x2446, 0x2446, 0x2446, 0x244a, 0x244b, 0x244b, 0x244b, 0x244c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c,
+  0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x246c, 0x24ab, 0x24e9, 0x2509
+};
+
+inline constexpr nat2 _sjis_encode_table[9489]{
   0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
   0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d, 0x001e, 0x001f,
   0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
@@ -826,1797 +1032,1557 @@ inline constexpr cat2 _unicode_table_0000_0100[]{
   0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
   0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
   0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x007f,
-  0x0080, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x0021, 0x9181, 0x9281, 0x8888, 0x005c, 0x007c, 0x9881, 0x4e81, 0x0063, 0x0061, 0xe181, 0xca81, 0x002d, 0x0052, 0x5081,
-  0x8b81, 0x7d81, 0x0032, 0x0033, 0x4c81, 0xca83, 0xf781, 0x4581, 0x4381, 0x0031, 0x006f, 0xe281, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041, 0x0043, 0x0045, 0x0045, 0x0045, 0x0045, 0x0049, 0x0049, 0x0049, 0x0049,
-  0x0044, 0x004e, 0x004f, 0x004f, 0x004f, 0x004f, 0x004f, 0x7e81, 0x004f, 0x0055, 0x0055, 0x0055, 0x0055, 0x0059, 0x0054, 0x0073,
-  0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0063, 0x0065, 0x0065, 0x0065, 0x0065, 0x0069, 0x0069, 0x0069, 0x0069,
-  0x0064, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x8081, 0x006f, 0x0075, 0x0075, 0x0075, 0x0075, 0x0079, 0x0074, 0x0079, };
-static_assert(arraysize(_unicode_table_0000_0100) == 0x0100 - 0x0000);
-
-inline constexpr cat2 _unicode_table_0390_0460[]{
-  0x8888, 0x9f83, 0xa083, 0xa183, 0xa283, 0xa383, 0xa483, 0xa583, 0xa683, 0xa783, 0xa883, 0xa983, 0xaa83, 0xab83, 0xac83, 0xad83,
-  0xae83, 0xaf83, 0x8888, 0xb083, 0xb183, 0xb283, 0xb383, 0xb483, 0xb583, 0xb683, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xbf83, 0xc083, 0xc183, 0xc283, 0xc383, 0xc483, 0xc583, 0xc683, 0xc783, 0xc883, 0xc983, 0xca83, 0xcb83, 0xcc83, 0xcd83,
-  0xce83, 0xcf83, 0x8888, 0xd083, 0xd183, 0xd283, 0xd383, 0xd483, 0xd583, 0xd683, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x4684, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x4084, 0x4184, 0x4284, 0x4384, 0x4484, 0x4584, 0x4784, 0x4884, 0x4984, 0x4a84, 0x4b84, 0x4c84, 0x4d84, 0x4e84, 0x4f84, 0x5084,
-  0x5184, 0x5284, 0x5384, 0x5484, 0x5584, 0x5684, 0x5784, 0x5884, 0x5984, 0x5a84, 0x5b84, 0x5c84, 0x5d84, 0x5e84, 0x5f84, 0x6084,
-  0x7084, 0x7184, 0x7284, 0x7384, 0x7484, 0x7584, 0x7784, 0x7884, 0x7984, 0x7a84, 0x7b84, 0x7c84, 0x7d84, 0x7e84, 0x8084, 0x8184,
-  0x8284, 0x8384, 0x8484, 0x8584, 0x8684, 0x8784, 0x8884, 0x8984, 0x8a84, 0x8b84, 0x8c84, 0x8d84, 0x8e84, 0x8f84, 0x9084, 0x9184,
-  0x8888, 0x7684, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, };
-static_assert(arraysize(_unicode_table_0390_0460) == 0x0460 - 0x0390);
-
-inline constexpr cat2 _unicode_table_2010_2670[]{
-  0x5d81, 0x8888, 0x8888, 0x8888, 0x8888, 0x5c81, 0x8888, 0x8888, 0x6581, 0x6681, 0x8888, 0x8888, 0x6781, 0x6881, 0x8888, 0x8888,
-  0xf581, 0xf681, 0x8888, 0x8888, 0x8888, 0x6481, 0x6381, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xf181, 0x8888, 0x8c81, 0x8d81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa681, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8e81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8287, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8487, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf081, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x5487, 0x5587, 0x5687, 0x5787, 0x5887, 0x5987, 0x5a87, 0x5b87, 0x5c87, 0x5d87, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x40fa, 0x41fa, 0x42fa, 0x43fa, 0x44fa, 0x45fa, 0x46fa, 0x47fa, 0x48fa, 0x49fa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xa981, 0xaa81, 0xa881, 0xab81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xcb81, 0x8888, 0xcc81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xcd81, 0x8888, 0xdd81, 0xce81, 0x8888, 0x8888, 0x8888, 0xde81, 0xb881, 0x8888, 0x8888, 0xb981, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x9487, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe381, 0x8888, 0x8888, 0xe581, 0x8781, 0x9887,
-  0xda81, 0x8888, 0x8888, 0x8888, 0x8888, 0x6181, 0x8888, 0xc881, 0xc981, 0xbf81, 0xbe81, 0xe781, 0xe881, 0x8888, 0x9387, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8881, 0xe681, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe481, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xe081, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8281, 0xdf81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8581, 0x8681, 0x8888, 0x8888, 0xe181, 0xe281, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xbc81, 0xbd81, 0x8888, 0x8888, 0xba81, 0xbb81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdb81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9987,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xdc81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x4087, 0x4187, 0x4287, 0x4387, 0x4487, 0x4587, 0x4687, 0x4787, 0x4887, 0x4987, 0x4a87, 0x4b87, 0x4c87, 0x4d87, 0x4e87, 0x4f87,
-  0x5087, 0x5187, 0x5287, 0x5387, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x9f84, 0xaa84, 0xa084, 0xab84, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa184, 0x8888, 0x8888, 0xac84,
-  0xa284, 0x8888, 0x8888, 0xad84, 0xa484, 0x8888, 0x8888, 0xaf84, 0xa384, 0x8888, 0x8888, 0xae84, 0xa584, 0xba84, 0x8888, 0x8888,
-  0xb584, 0x8888, 0x8888, 0xb084, 0xa784, 0xbc84, 0x8888, 0x8888, 0xb784, 0x8888, 0x8888, 0xb284, 0xa684, 0x8888, 0x8888, 0xb684,
-  0xbb84, 0x8888, 0x8888, 0xb184, 0xa884, 0x8888, 0x8888, 0xb884, 0xbd84, 0x8888, 0x8888, 0xb384, 0xa984, 0x8888, 0x8888, 0xb984,
-  0x8888, 0x8888, 0xbe84, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb484, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xa181, 0xa081, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xa381, 0xa281, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa581, 0xa481, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9f81, 0x9e81, 0x8888, 0x8888, 0x8888, 0x9b81, 0x8888, 0x8888, 0x9d81, 0x9c81,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xfc81,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9a81, 0x9981, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8a81, 0x8888, 0x8981, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf481, 0x8888, 0x8888, 0xf381, 0x8888, 0xf281, };
-static_assert(arraysize(_unicode_table_2010_2670) == 0x2670 - 0x2010);
-
-inline constexpr cat2 _unicode_table_3000_33d0[]{
-  0x4081, 0x4181, 0x4281, 0x5681, 0x8888, 0x5881, 0x5981, 0x5a81, 0x7181, 0x7281, 0x7381, 0x7481, 0x7581, 0x7681, 0x7781, 0x7881,
-  0x7981, 0x7a81, 0xa781, 0xac81, 0x6b81, 0x6c81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8087, 0x8888, 0x8187,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x9f82, 0xa082, 0xa182, 0xa282, 0xa382, 0xa482, 0xa582, 0xa682, 0xa782, 0xa882, 0xa982, 0xaa82, 0xab82, 0xac82, 0xad82,
-  0xae82, 0xaf82, 0xb082, 0xb182, 0xb282, 0xb382, 0xb482, 0xb582, 0xb682, 0xb782, 0xb882, 0xb982, 0xba82, 0xbb82, 0xbc82, 0xbd82,
-  0xbe82, 0xbf82, 0xc082, 0xc182, 0xc282, 0xc382, 0xc482, 0xc582, 0xc682, 0xc782, 0xc882, 0xc982, 0xca82, 0xcb82, 0xcc82, 0xcd82,
-  0xce82, 0xcf82, 0xd082, 0xd182, 0xd282, 0xd382, 0xd482, 0xd582, 0xd682, 0xd782, 0xd882, 0xd982, 0xda82, 0xdb82, 0xdc82, 0xdd82,
-  0xde82, 0xdf82, 0xe082, 0xe182, 0xe282, 0xe382, 0xe482, 0xe582, 0xe682, 0xe782, 0xe882, 0xe982, 0xea82, 0xeb82, 0xec82, 0xed82,
-  0xee82, 0xef82, 0xf082, 0xf182, 0x9483, 0x8888, 0x8888, 0x8888, 0x8888, 0x4a81, 0x4b81, 0x4a81, 0x4b81, 0x5481, 0x5581, 0x8888,
-  0x8888, 0x4083, 0x4183, 0x4283, 0x4383, 0x4483, 0x4583, 0x4683, 0x4783, 0x4883, 0x4983, 0x4a83, 0x4b83, 0x4c83, 0x4d83, 0x4e83,
-  0x4f83, 0x5083, 0x5183, 0x5283, 0x5383, 0x5483, 0x5583, 0x5683, 0x5783, 0x5883, 0x5983, 0x5a83, 0x5b83, 0x5c83, 0x5d83, 0x5e83,
-  0x5f83, 0x6083, 0x6183, 0x6283, 0x6383, 0x6483, 0x6583, 0x6683, 0x6783, 0x6883, 0x6983, 0x6a83, 0x6b83, 0x6c83, 0x6d83, 0x6e83,
-  0x6f83, 0x7083, 0x7183, 0x7283, 0x7383, 0x7483, 0x7583, 0x7683, 0x7783, 0x7883, 0x7983, 0x7a83, 0x7b83, 0x7c83, 0x7d83, 0x7e83,
-  0x8083, 0x8183, 0x8283, 0x8383, 0x8483, 0x8583, 0x8683, 0x8783, 0x8883, 0x8983, 0x8a83, 0x8b83, 0x8c83, 0x8d83, 0x8e83, 0x8f83,
-  0x9083, 0x9183, 0x9283, 0x9383, 0x9483, 0x9583, 0x9683, 0x8888, 0x8888, 0x8888, 0x8888, 0x4581, 0x5b81, 0x5281, 0x5381, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8a87, 0x8b87, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8c87, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8587, 0x8687, 0x8787, 0x8887, 0x8987, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x6587, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6987, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x6087, 0x8888, 0x8888, 0x8888, 0x6387, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x6187, 0x6b87, 0x8888, 0x8888, 0x6a87, 0x6487, 0x8888, 0x8888, 0x8888, 0x6c87, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6687, 0x8888, 0x8888, 0x8888, 0x8888, 0x6e87, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5f87, 0x6d87, 0x8888, 0x8888, 0x6287, 0x8888, 0x8888,
-  0x8888, 0x6787, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6887, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7e87, 0x8f87, 0x8e87, 0x8d87, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7287, 0x7387,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6f87, 0x7087, 0x7187, 0x8888,
-  0x8888, 0x7587, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x7487, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8387, 0x8888, 0x8888, };
-static_assert(arraysize(_unicode_table_3000_33d0) == 0x33d0 - 0x3000);
-
-inline constexpr cat2 _unicode_table_4e00_9fb0[]{
-  0xea88, 0x9a92, 0x8888, 0xb58e, 0x8888, 0x8888, 0x8888, 0x9c96, 0xe48f, 0x4f8e, 0xe38f, 0xba89, 0x8888, 0x7395, 0x5e97, 0x8888,
-  0xa098, 0x4e89, 0x8888, 0x8888, 0x8e8a, 0xa198, 0xa290, 0xc099, 0x758b, 0xb895, 0x8888, 0x8888, 0x8888, 0x8888, 0xe58f, 0x8888,
-  0x8888, 0xbc97, 0x8888, 0x8888, 0x8888, 0x8888, 0xc095, 0x8888, 0x68fa, 0x8888, 0xa298, 0x8888, 0x8888, 0x8692, 0x8888, 0x8888,
-  0x8888, 0xa398, 0xf88b, 0x8888, 0x8888, 0x8888, 0xa498, 0x8888, 0xdb8a, 0x4f92, 0x8888, 0xe58e, 0xa598, 0x8888, 0x8888, 0xa698,
-  0x8888, 0x8888, 0xa798, 0x5494, 0x8888, 0x768b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5694, 0x8888, 0xe193, 0xc18c, 0x5296,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x68e5, 0xa898, 0xe68f, 0xa998, 0xb389, 0x8888, 0x8888, 0x8888, 0xe38b, 0xee8c, 0xe796,
-  0x8888, 0x8888, 0xa49b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x9097, 0x8888, 0xfb93, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa38a, 0x8888,
-  0x548b, 0x8888, 0xaa98, 0x8888, 0x8888, 0xab98, 0xb997, 0x8888, 0x5c97, 0x8891, 0xad98, 0x968e, 0xf193, 0x8888, 0xb098, 0x8888,
-  0x8888, 0x5d89, 0xdd8c, 0x8888, 0xdc8c, 0xe488, 0x8888, 0x8888, 0x6a98, 0x6998, 0x8888, 0xb18d, 0x9f88, 0x8888, 0xb198, 0xb298,
-  0xb398, 0x5396, 0xb498, 0x8888, 0xf08c, 0xe588, 0x9296, 0x8888, 0x9c8b, 0x8888, 0x8888, 0x9d8b, 0x9e8b, 0xe092, 0xba97, 0x8888,
-  0xb598, 0x8888, 0x8888, 0xb698, 0x8888, 0x8888, 0xb798, 0x8888, 0x8888, 0x8888, 0x6c90, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x598f, 0x6d90, 0xbc98, 0x8888, 0xba98, 0x8888, 0xbb98, 0x778b, 0x8888, 0x8888, 0xa18d, 0xee89, 0x8888, 0xb998, 0xb898, 0xa795,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x658e, 0x648e, 0xbc91, 0xbd98, 0x7495, 0xe590, 0x8888, 0x8888, 0x8888, 0x5781, 0xbe98, 0xc098,
-  0x8888, 0x69fa, 0x8888, 0xe391, 0xdf97, 0xc888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbf98, 0xbc89, 0x8888,
-  0xc28b, 0x8888, 0x8792, 0x8888, 0x8888, 0x8888, 0x8f8c, 0xc198, 0x8888, 0x8888, 0x8888, 0x4394, 0x6afa, 0x8888, 0x8888, 0x8888,
-  0x6bfa, 0xe98a, 0x8888, 0x6cfa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc298, 0xc988, 0x8888, 0x8888, 0xde8c, 0xea8a, 0x9a95,
-  0xb094, 0x788b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xef89, 0x8888, 0xe598, 0x6093, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8c94,
-  0xc498, 0x8888, 0x8888, 0x8888, 0xba94, 0x8888, 0xe097, 0x8888, 0x4c90, 0x6dfa, 0x668e, 0x8888, 0x978e, 0xbe89, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xcf92, 0x8888, 0x8888, 0x4192, 0xc898, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xca88, 0xe192, 0x5a8f,
-  0xb28d, 0x4397, 0x8888, 0xcc91, 0x8888, 0xbd89, 0x6efa, 0xc798, 0x8888, 0x5d97, 0xc398, 0xc598, 0xec8d, 0xc698, 0x439b, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xce98, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd198,
-  0xcf98, 0x8888, 0x8888, 0xc089, 0x8888, 0xb995, 0xc998, 0x8888, 0x8888, 0x8888, 0x8888, 0xcd98, 0xf18c, 0x8888, 0x8888, 0x678e,
-  0x8888, 0x8888, 0x8888, 0xa48a, 0x8888, 0x8888, 0xd298, 0x8888, 0xca98, 0x8888, 0x70fa, 0xe197, 0x8888, 0x988e, 0x8888, 0xcb98,
-  0x8888, 0xd098, 0x6ffa, 0x8888, 0x72fa, 0x8888, 0xd398, 0x8888, 0xcc98, 0x8888, 0x71fa, 0x9f8b, 0x8888, 0xcb88, 0x8888, 0x8888,
-  0xa08b, 0xbf89, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x449b, 0x8888, 0x9996, 0x8e95, 0xf28c,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4e90, 0xb597, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd695,
-  0x8888, 0x8888, 0x578c, 0xa391, 0xe289, 0x8888, 0x8888, 0x8888, 0x8888, 0x61fa, 0x728f, 0x8888, 0x8888, 0x73fa, 0xd798, 0x8888,
-  0xdc98, 0xda98, 0x8888, 0x8888, 0xd598, 0x8888, 0x8888, 0xad91, 0xd898, 0x8888, 0xdb98, 0xd998, 0x8888, 0xdb95, 0x8888, 0xd698,
-  0x8888, 0x4d90, 0x8888, 0x9396, 0xdd98, 0xde98, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x438f, 0xeb98,
-  0x8888, 0x8888, 0x8888, 0x6f94, 0x8888, 0x5595, 0xe698, 0x8888, 0xee95, 0x8888, 0xb489, 0x8888, 0x8888, 0x8888, 0xea98, 0x76fa,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe498, 0xed98, 0x8888, 0x8888, 0x7191, 0x8888, 0xc28c, 0x8888, 0x7b94, 0x8888, 0xc5e0,
-  0x8888, 0xec98, 0x7c93, 0x8888, 0xe198, 0x8888, 0xf48c, 0x8888, 0x8888, 0xf38c, 0xdf98, 0x8888, 0x8888, 0x8888, 0x77fa, 0xd88e,
-  0x8888, 0xe798, 0x75fa, 0xed95, 0x6c92, 0xe398, 0x918c, 0x8888, 0xe098, 0xe898, 0xe298, 0xcf97, 0xe998, 0x6098, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe48b, 0x8888, 0x8888, 0x908c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x74fa, 0x8888, 0x7afa, 0xee98, 0x8888, 0x8888, 0x78fa, 0xef98, 0xf398, 0xcc88, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xce95,
-  0xf298, 0x8888, 0x8888, 0x8888, 0x8888, 0xf198, 0xf598, 0x8888, 0x8888, 0x8888, 0xf498, 0x8888, 0xe292, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x928c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf698, 0x8888, 0x8888, 0x8888,
-  0x79fa, 0x8888, 0xc38e, 0x8888, 0xa491, 0xe392, 0xf48b, 0x8888, 0xf798, 0x8888, 0x8888, 0x8888, 0x8888, 0x558b, 0x8888, 0x8888,
-  0xf898, 0x8888, 0x8888, 0x8888, 0x8888, 0xfa98, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5496, 0x8888, 0x8888,
-  0x8888, 0x868c, 0x8888, 0x8888, 0x7bfa, 0x8888, 0x8888, 0x8888, 0x508e, 0xf594, 0xf998, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc38d, 0x6297, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xfc98, 0x4299, 0xfb98, 0xc28d, 0x8888, 0x9d8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x588c, 0x8888,
-  0x8888, 0x8888, 0x4399, 0x8888, 0x8888, 0xcd8b, 0x8888, 0x8888, 0x8888, 0x4099, 0x4199, 0x8888, 0x8888, 0xad93, 0x8888, 0x9c91,
-  0x8888, 0xa18b, 0x8888, 0x8888, 0x8888, 0x6c96, 0x4499, 0x8888, 0x7dfa, 0x8888, 0xbb97, 0x8888, 0x8888, 0x8888, 0x4599, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x4899, 0x8888, 0x4699, 0x8888, 0x6d91, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4799, 0x4999, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x7cfa, 0x4b99, 0x8888, 0x8888, 0x8888, 0x4a99, 0x8888, 0xc695, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x568b, 0x4d99, 0x4e99, 0x8888, 0xad89, 0x8888, 0x8888, 0x8888, 0x8888, 0x4c99, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xf28e, 0x8888, 0x5199, 0x5099, 0x4f99, 0x8888, 0xd498, 0x8888, 0x5299, 0x8888, 0x8888, 0x8888, 0x8888, 0x9e8f,
-  0x8888, 0x5399, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4497, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xd796, 0x8888, 0x8888, 0x8888, 0x8888, 0x5599, 0x8888, 0x8888, 0x5499, 0x5799, 0x5699, 0x8888, 0x8888, 0x5899,
-  0x5999, 0xf288, 0x8888, 0xb38c, 0x5a8c, 0x5b8f, 0x9b92, 0xa28b, 0xe690, 0xf58c, 0x7efa, 0x8e8d, 0x5b99, 0xc696, 0x6593, 0x8888,
-  0x998e, 0x8888, 0x5a99, 0x8888, 0x5c99, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7d93, 0x8888, 0x958a, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x5d99, 0x8888, 0x80fa, 0xfc93, 0x8888, 0x8888, 0x5391, 0x5f99, 0x6099, 0xaa94, 0xf68c, 0x5a98, 0x6199, 0x8888,
-  0x8888, 0xa48b, 0x8888, 0x8888, 0x8888, 0xba95, 0xb491, 0xef8b, 0x5493, 0x8888, 0x8888, 0x8888, 0x938c, 0x8888, 0x8888, 0x8888,
-  0x6299, 0x8888, 0x6399, 0x8888, 0x8888, 0xe093, 0x7e89, 0x8888, 0x8888, 0x6699, 0xfb8d, 0x8888, 0x6599, 0xc48d, 0x8888, 0x6799,
-  0xece3, 0x6899, 0x6096, 0x6999, 0x8888, 0x6a99, 0x6b99, 0xe78f, 0x8888, 0xca8e, 0x8888, 0x8888, 0x8888, 0x81fa, 0x8888, 0x8888,
-  0xa58a, 0x8888, 0x6e99, 0x8888, 0x6c99, 0xbb96, 0x6d99, 0x8888, 0x7995, 0x6f99, 0x7099, 0x7199, 0x7e93, 0x8888, 0x8888, 0x8888,
-  0x7599, 0x7399, 0x7499, 0x7299, 0xe18d, 0x7699, 0xe896, 0xe297, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7799, 0x82fa, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xa690, 0x7899, 0x798f, 0x8888, 0x8888, 0x7999, 0x8888, 0x9c92, 0xbd97, 0x8093, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc399, 0x8888, 0x8888, 0x8888, 0x8888, 0x7a99, 0xa3ea, 0xc38b, 0x8888, 0x8888,
-  0x7b99, 0x7d96, 0x8888, 0x8888, 0x8888, 0x8888, 0x888f, 0xfa91, 0x8888, 0x7d99, 0xe293, 0x8888, 0x83fa, 0x7e99, 0x8888, 0x8888,
-  0x8099, 0x4d8a, 0x8888, 0x8888, 0x8888, 0x8199, 0xa58b, 0x8888, 0xca93, 0x9a89, 0x6f8f, 0x8888, 0x8888, 0x9f94, 0x8299, 0x8888,
-  0x8193, 0x8888, 0x8888, 0x6e90, 0x8399, 0x8888, 0xaa95, 0xd890, 0xa08a, 0x8888, 0xa78a, 0x8499, 0x8888, 0x8888, 0x8699, 0x8888,
-  0x8888, 0x598c, 0x8888, 0x8888, 0x8599, 0x84fa, 0x8888, 0xf197, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x898f, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xbb94, 0xca95, 0x8888, 0x8799, 0x8888, 0x9897, 0x8899, 0x8888, 0x8888, 0x8888, 0x8999, 0x8888,
-  0x9e93, 0x8888, 0x8888, 0x8a99, 0x8888, 0x8888, 0xa790, 0xfc8d, 0x948c, 0x8b99, 0x688e, 0x8f8d, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xe492, 0x8d99, 0x8888, 0x8888, 0xa591, 0x8888, 0x8888, 0xed8d, 0x8e99, 0x8f99, 0x4f91, 0x8888, 0x8c99,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x9199, 0x8888, 0x5596, 0x8888, 0x8888, 0x8888, 0x8888, 0x848d, 0x8888, 0x8888, 0x9099, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x958c, 0xdc8d, 0x8d94, 0x8888, 0x8888, 0x8888, 0x9499, 0x9299, 0x8888, 0x8888, 0x8888, 0x8888, 0x9b95,
-  0xe88f, 0x9b99, 0x848a, 0x9599, 0x9399, 0x6e91, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9799, 0x8888, 0x9699,
-  0x8888, 0x8888, 0x8888, 0x638a, 0x8888, 0x8888, 0x8888, 0x808c, 0x9c99, 0xab97, 0x8888, 0x8888, 0x8888, 0x9899, 0x8888, 0x8888,
-  0x8888, 0x9d99, 0x9a99, 0x8888, 0x9999, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcd97, 0x85fa, 0x8888, 0x8888, 0xf78c,
-  0xc189, 0x8888, 0x8888, 0xf297, 0x8888, 0x8888, 0x86fa, 0x8888, 0x8888, 0x958f, 0x7793, 0x858d, 0xa099, 0xa199, 0x8888, 0x77fb,
-  0x8888, 0xe397, 0x8888, 0x8888, 0x4a98, 0xa399, 0x8888, 0x8888, 0x8888, 0xf88c, 0x8888, 0x8888, 0xa299, 0x8888, 0x4e8a, 0x8888,
-  0x87fa, 0xa499, 0x8888, 0x7596, 0x8888, 0xba92, 0x8888, 0x4597, 0x8888, 0xd795, 0x8888, 0x8888, 0x8888, 0xa599, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xd3e8, 0x8888, 0x8888, 0xae93, 0x8888, 0xa699, 0xa88a, 0xb196, 0x8888, 0x88fa, 0x8888, 0x9f8f, 0xa799, 0xe595,
-  0xab99, 0x8888, 0xa890, 0xa899, 0xce8b, 0x8888, 0xa999, 0xa98a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x4d8c, 0xac99, 0x8888, 0xad99, 0x8888, 0x8888, 0xae99, 0xaf99, 0xd98e, 0x8888, 0x8888, 0x8888, 0xf98c, 0xdc96,
-  0x89fa, 0xe696, 0xf593, 0x8888, 0x8888, 0xef95, 0xb099, 0x8afa, 0xb199, 0x8888, 0x8888, 0x8888, 0x8888, 0xb399, 0x8888, 0xb599,
-  0xb499, 0x8888, 0x8888, 0x8888, 0x8888, 0xb699, 0xbb89, 0x6b96, 0x8888, 0xfa8d, 0xb799, 0x8888, 0x8888, 0x7891, 0x8888, 0x8888,
-  0xa08f, 0xa78b, 0x8888, 0xb899, 0x8bfa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd994, 0x8888, 0x8888, 0x8888, 0x8888, 0xb999,
-  0x8888, 0xba99, 0x8888, 0xbb99, 0x8888, 0x8888, 0x8888, 0x8888, 0xbc99, 0x4395, 0xe68b, 0xe388, 0x8888, 0x8888, 0x8888, 0xbd93,
-  0xbd99, 0x5c8f, 0x8888, 0xe790, 0x8888, 0xbf99, 0xbe99, 0xa18f, 0xdf8c, 0xc199, 0xbc94, 0x8888, 0x8888, 0xc299, 0x8888, 0x8888,
-  0x8888, 0xda94, 0xb291, 0xec91, 0xa68b, 0x8888, 0x8888, 0xec93, 0x5092, 0x8888, 0x8e94, 0x8888, 0x6d96, 0x8888, 0xc499, 0x8888,
-  0xe890, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x548c, 0x8888, 0x8888, 0xc599, 0x8888, 0x8888, 0x8888, 0x8888, 0xc699, 0x4b89,
-  0xf388, 0xeb8a, 0x8cfa, 0xa691, 0x708b, 0x9197, 0x8888, 0xc999, 0xb589, 0x8888, 0x8888, 0xc899, 0x8888, 0x8888, 0x8888, 0xa88b,
-  0x8888, 0x8888, 0xca99, 0x8888, 0xef96, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8dfa, 0x8888, 0x8888, 0xcb99, 0x8888, 0xd097, 0x8888, 0xfa8c, 0x8888, 0x8888, 0x8888, 0x8888, 0xb48c,
-  0xcc99, 0x8888, 0x8888, 0x8888, 0x8888, 0xce99, 0xcd99, 0x8888, 0x7e90, 0x5889, 0x8888, 0x8888, 0x8888, 0x7d89, 0xcf99, 0x8888,
-  0xd099, 0x8888, 0x8efa, 0xb58c, 0x8888, 0x8888, 0xd199, 0x8888, 0x8888, 0x8888, 0x8888, 0x8e8b, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x518e, 0xd299, 0x8888, 0x8888, 0x8888, 0x8888, 0x9496, 0xb38d, 0x798b, 0x4697, 0x6f91, 0xbd94, 0xfb8e, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x668f, 0x8888, 0xe68e, 0xf38e, 0x8888, 0x968f, 0x8888, 0xbe94, 0x8888, 0x8ffa, 0x8888, 0xd599,
-  0x8888, 0x6289, 0x7091, 0xfb8c, 0xc38c, 0xe58b, 0x8888, 0x8888, 0xd999, 0x4092, 0xfc91, 0xa98b, 0xa28f, 0xda99, 0xd899, 0xc289,
-  0xe491, 0xb68e, 0x6a8e, 0x4589, 0x8888, 0x8888, 0x908a, 0x868d, 0x698e, 0x8888, 0xdb99, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xdc99, 0x8888, 0x688b, 0x658a, 0x8888, 0x8888, 0x8888, 0x878d, 0x678b, 0xdd92, 0x4489, 0xaf93, 0xbc96, 0x408d, 0x9997,
-  0x6693, 0xfc8c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4e8c, 0x8888, 0xe599, 0x8888, 0xe18b,
-  0x6996, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdb94, 0x8888, 0x8888, 0xe499, 0x8888, 0xdc8a, 0xdf99, 0xe099, 0xe299, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe399, 0x8888, 0x7a8b, 0x8190, 0x8888, 0xab95, 0xe199, 0xdd99, 0xe18c, 0x8888,
-  0xde99, 0x8888, 0x4398, 0x8888, 0x8888, 0x8888, 0xf095, 0x8888, 0xe692, 0xe08c, 0x908d, 0x8888, 0x8888, 0x8888, 0xe699, 0x8888,
-  0x8888, 0xdb93, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xea99,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xfc8e, 0x8888, 0xf48e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xed99, 0xeb99, 0x8888, 0xa196, 0x8888, 0xe899, 0xf199, 0xec99, 0x8888, 0x8888, 0x8888, 0xef99, 0xc48c, 0xbd96, 0x8888, 0x8888,
-  0xf099, 0x8888, 0x8888, 0x8888, 0xf299, 0x8888, 0xf499, 0x8888, 0x8888, 0x8888, 0x92fa, 0xee8d, 0x6198, 0x8888, 0xe999, 0xe799,
-  0xf399, 0x8888, 0xee99, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x91fa, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xf699, 0x8888, 0x429a, 0xf899, 0x8888, 0x8888, 0xfc99, 0x93fa, 0x8888, 0x409a, 0xf999, 0x8888, 0x8888, 0x5d9a,
-  0x8888, 0x8888, 0xe78d, 0x508a, 0x8888, 0x8888, 0x8888, 0x8888, 0xf799, 0x8888, 0x8888, 0x8888, 0x449a, 0xf488, 0x439a, 0x8888,
-  0xa388, 0x6995, 0x419a, 0x8888, 0xfa99, 0x8888, 0x8888, 0xf599, 0xfb99, 0xc68d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x459a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xf588, 0x4e9a, 0x8888, 0x8888, 0x469a, 0x479a, 0x8888, 0xa38f, 0x8996, 0x8888, 0x8888, 0x8888, 0x4c9a, 0x4b9a, 0x8888,
-  0x8888, 0x8888, 0x4e93, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4d9a, 0x8888, 0x8888, 0x4a9a, 0x8888, 0x94fa,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x5389, 0x8888, 0xb48d, 0x4f90, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x489a,
-  0x8293, 0x8888, 0x8888, 0x8888, 0x499a, 0x8888, 0xa088, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x539a, 0x4297,
-  0x8888, 0xa58f, 0x8888, 0x599a, 0x8888, 0x8888, 0x8888, 0x8888, 0x589a, 0x4f9a, 0x8888, 0x8888, 0x8888, 0x8888, 0xc191, 0x8888,
-  0x509a, 0x8888, 0x8888, 0x8888, 0xed91, 0x559a, 0xa48f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x529a, 0x8888, 0x8888, 0xe296,
-  0x8888, 0x8888, 0x8888, 0x5b8c, 0x8888, 0x8888, 0x569a, 0x579a, 0x8888, 0x8888, 0x8888, 0x8888, 0x549a, 0x5a9a, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x519a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x609a, 0x659a, 0x8888, 0x619a, 0x8888,
-  0x5c9a, 0x8888, 0x8888, 0x669a, 0x5091, 0x8888, 0x95fa, 0x689a, 0x8888, 0x418d, 0x5e9a, 0x9d92, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x629a, 0x5b9a, 0xab8a, 0x8888, 0xec8a, 0x858a, 0x639a, 0x5f9a,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x968c, 0x699a, 0x679a, 0x7291, 0x698b, 0xaa8b, 0x8888, 0x649a, 0x8888,
-  0xf28b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6389, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x6d9a, 0x6b9a, 0x8888, 0xa59a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x709a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6a9a, 0x8888, 0x6e9a, 0x8888, 0x8888, 0x6c9a,
-  0x8888, 0x8888, 0x8888, 0x6b8e, 0x6f9a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x729a, 0x8888, 0x779a, 0x8888, 0x8888, 0x8888, 0x759a, 0x749a, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5192, 0x8888, 0x8888, 0xc389, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x719a, 0x8888, 0x739a, 0xa68f, 0x5289, 0x8888, 0x8888, 0x769a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdc89, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x829a,
-  0x8888, 0xfa8f, 0x7d9a, 0x8888, 0x7b9a, 0x8888, 0x7c9a, 0x8888, 0x7e9a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x5c89, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5891, 0x8888, 0x789a, 0x8888,
-  0x799a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9a8a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x819a, 0x8888, 0x8888, 0x8888, 0xed8a, 0x8888, 0x849a, 0x809a, 0x839a, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xac95, 0x8888, 0x8888, 0x8888, 0xd393, 0x8888, 0xb694, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x869a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x859a, 0x648a, 0x8888, 0x8888, 0x879a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8a9a,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x899a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x889a, 0x8888, 0x5894, 0x8888, 0x8888, 0x8b9a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8c9a, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8e9a, 0x8888, 0x8d9a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x909a, 0x8888, 0x8888, 0x8888,
-  0x939a, 0x919a, 0x8f9a, 0x929a, 0x8888, 0x8888, 0x8888, 0x8888, 0x949a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x959a, 0x8888,
-  0x8888, 0x969a, 0x8888, 0x979a, 0x8888, 0x8888, 0x8888, 0x989a, 0x6499, 0x8888, 0xfa8e, 0x6c8e, 0x8888, 0x8888, 0xf189, 0x8888,
-  0xf688, 0x8888, 0x8888, 0x6392, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x999a, 0x8888,
-  0xa28d, 0x8888, 0xcd88, 0x7d90, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9a9a, 0xc58c, 0x8888, 0x8888, 0x918d, 0x8888, 0x9c9a,
-  0x9b9a, 0x8888, 0x8888, 0xde95, 0x9d9a, 0x8888, 0x8888, 0x8888, 0x9f9a, 0x9e9a, 0x8888, 0xa09a, 0x8888, 0xa19a, 0x8888, 0x978c,
-  0x8888, 0x8888, 0x8089, 0xa29a, 0x8888, 0x8888, 0xa49a, 0x8888, 0xa39a, 0x8888, 0x8888, 0x8888, 0xa69a, 0x8888, 0x8888, 0x7993,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa79a, 0xb388, 0xdd8d, 0x8888, 0x8888, 0x8888, 0x8888, 0x5c8c, 0x8888, 0x8888,
-  0x6e92, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa89a, 0xa99a, 0x8888, 0x8888, 0xab9a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xac9a, 0x8888, 0xe28d, 0x8888, 0x8888, 0x8888, 0x8888, 0xcf8b, 0x8888, 0x8888, 0x5696, 0x8888, 0x8888, 0x8888, 0xaa9a, 0xad9a,
-  0xbf8d, 0x428d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x96fa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xb19a, 0x8888, 0x8888, 0xa38d, 0x97fa, 0x5292, 0x8888, 0x8888, 0xae9a, 0xd892, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb29a,
-  0x8888, 0x8888, 0x8290, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb09a, 0xb39a, 0x8888, 0x5e8c, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xb49a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xb59a, 0x8888, 0x438d, 0x5f8a, 0xb79a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb89a, 0x8888, 0x98fa, 0x8888, 0x8888, 0x8888,
-  0xb99a, 0x8888, 0x8888, 0xb69a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xaf9a, 0x8888, 0x8888, 0xba9a, 0x8888, 0x8888, 0xbb9a, 0x9afa, 0x99fa, 0x8888, 0x8888, 0x8496, 0x8888, 0x8888, 0xe98f, 0x8888,
-  0x8888, 0x8888, 0xbd9a, 0xbe9a, 0xbc9a, 0x8888, 0xc09a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5794, 0x8888, 0x8888, 0xe688,
-  0x7595, 0x8888, 0x8888, 0xc19a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xfb8f, 0x8888, 0x8888, 0xb78e, 0x8888, 0x7c94, 0xee8a, 0x8888, 0xe98d, 0x8888, 0x8888, 0x8888,
-  0x7896, 0x8888, 0xb093, 0x8888, 0x8888, 0x988c, 0xcd91, 0x8888, 0x8888, 0x8888, 0xbf9a, 0xc29a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc291, 0x8888, 0x8888, 0x8888, 0xc39a, 0x8888, 0x8888, 0x8888, 0xc49a, 0x8888, 0x8888,
-  0x8888, 0xc69a, 0x8888, 0x8888, 0xe792, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xac8a, 0x8888, 0x8888, 0x8888, 0x8888, 0x9fea,
-  0x8189, 0xf195, 0x8888, 0x8888, 0xea8f, 0x6793, 0x8888, 0x8888, 0x8888, 0x8888, 0xe48d, 0x8888, 0x8888, 0xcc9a, 0x8888, 0x8888,
-  0xbb95, 0xdb97, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf289, 0xc89a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x5991, 0xcb9a, 0x8888, 0x8393, 0x8888, 0x8888, 0x6893, 0x8493, 0xb794, 0xcb92, 0x8888, 0x8888, 0x8888, 0xc78d, 0x8888,
-  0x8888, 0x8888, 0xc79a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9689, 0x8888, 0x5593, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xc99a, 0x8888, 0xc59a, 0x8888, 0x8888, 0x6f90, 0x8888, 0x8888, 0x8888, 0xcd9a, 0x8888, 0x8888, 0x8888, 0x8888, 0x6d8f, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xab8b, 0x8888, 0xce9a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xe695, 0x8888, 0x8888, 0x8888, 0x9d91, 0x8888, 0x8888, 0x8888, 0x8888, 0xc492, 0x8888, 0x9dfa, 0xd09a,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6e96, 0x8888, 0x8888, 0xd19a, 0x8888, 0x8888, 0xd69a, 0x8888,
-  0x8888, 0x8888, 0x9efa, 0xad95, 0x8888, 0x8888, 0x8888, 0x8888, 0xd59a, 0xcf9a, 0xd29a, 0xd49a, 0x8888, 0x8888, 0xa48d, 0x8888,
-  0x8888, 0xc795, 0x8888, 0x8888, 0x8888, 0xd79a, 0x8888, 0x6492, 0x8888, 0x8888, 0xf389, 0x8888, 0xeb8f, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xd99a, 0x8888, 0xd89a, 0x8888, 0x888d, 0x8888, 0xda9a, 0xdc9a, 0xdb9a, 0x8888, 0x8888, 0xde9a, 0x8888, 0xd39a, 0xe09a,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xdf9a, 0xdd9a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6d8e, 0x7090, 0x8888, 0x7391, 0xe19a,
-  0xba90, 0xeb88, 0x8494, 0x8888, 0x8888, 0x8888, 0x8888, 0xd992, 0x8888, 0xe39a, 0xe29a, 0xe49a, 0xe59a, 0xe69a, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xe79a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcf95, 0xe89a, 0x9ffa, 0x8888, 0x8888, 0x8888, 0xc489,
-  0xe99a, 0x8888, 0x8888, 0x8888, 0x8888, 0x5b97, 0x4f8a, 0x8888, 0xc799, 0x678f, 0xbd91, 0xea9a, 0xe996, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xb296, 0x8888, 0x8888, 0xec9a, 0x8888, 0xe591, 0x8888, 0x5693, 0xbe91, 0x7695, 0xed9a, 0xee9a, 0x9b89, 0x8888,
-  0x8888, 0xb88e, 0xef9a, 0x8888, 0x8888, 0x8888, 0x8888, 0xce88, 0xf09a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf19a, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8289, 0x8888, 0x8888, 0xef8a, 0xde93, 0xf295, 0x8888, 0x8888, 0x8888, 0x8888, 0xf59a, 0x7491,
-  0xf49a, 0x5f8c, 0x8888, 0xa0fa, 0x7a96, 0xf39a, 0x8888, 0x8593, 0xf79a, 0x8888, 0xf69a, 0xa1fa, 0x8888, 0xa2fa, 0x8888, 0x8888,
-  0xf99a, 0x8888, 0xf89a, 0xa3fa, 0x8888, 0x9c89, 0x8888, 0xfa9a, 0xa78f, 0xfc9a, 0x4492, 0x8888, 0xfb9a, 0x8888, 0xb195, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x978f, 0x7a93, 0x8888, 0x8888, 0x8888, 0x409b, 0x8888, 0x8888, 0x8888, 0x8888, 0x448d, 0x8888, 0x8888,
-  0x8888, 0x419b, 0x4094, 0xdc94, 0xcf96, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4494, 0x8888, 0x8888, 0x4a9b, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x578b, 0x8888, 0x8888, 0x6497, 0x8888, 0x8888, 0xad96, 0x8888, 0xaa9b, 0x8888, 0x429b, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x459b, 0xa4fa, 0xc391, 0x8888, 0x8888, 0x5796, 0x8888, 0x8888, 0x8888, 0x6993, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x469b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8596, 0xa5fa, 0xc88d, 0x8888, 0x8888, 0xa88f, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x479b, 0x8888, 0x8888, 0x6f8e, 0x8888, 0x6e8e, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xb788, 0xc68c, 0x8888, 0xa990, 0xcf88, 0x8888, 0x8888, 0x8888, 0x8888, 0x4b9b, 0x4c9b, 0x8888, 0x499b, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5789, 0xad8a, 0x8888, 0x489b, 0x8888, 0xc396, 0x5095, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa688, 0x8888, 0x8888, 0x8888, 0x8888, 0xf788, 0x8888, 0x8888, 0x8888, 0x708e,
-  0x8888, 0xd088, 0x8888, 0xa188, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x519b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x4f9b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xba96, 0x8888, 0x529b, 0x8888, 0x509b, 0x8888, 0x8888, 0x4e9b,
-  0x5090, 0x8888, 0x8888, 0x8888, 0x8888, 0x4d9b, 0x8888, 0x8888, 0x8888, 0xd895, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe28c,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x569b, 0x579b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa98f, 0x8888, 0x8888, 0x8888,
-  0x539b, 0x4b98, 0x8888, 0x8888, 0x8888, 0x8888, 0x6b94, 0x8888, 0x8888, 0x559b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa58d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x589b, 0x8888, 0x8888, 0x8888, 0x7795, 0x8888, 0x8888, 0x8888, 0x599b, 0x8888, 0x549b, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb996,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x7d94, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5a9b, 0x5195, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5b9b, 0x5f9b, 0x5c9b, 0x8888,
-  0x8888, 0xc589, 0x5e9b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb98e, 0x8888, 0x5d9b, 0x998c, 0x8888, 0x8888, 0x8888,
-  0x6b9b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x649b, 0x619b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8492, 0x8888, 0x609b, 0x8888, 0x8888, 0x629b, 0x8888, 0x8888, 0x639b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x659b, 0x669b, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf08a, 0x8888, 0x689b, 0x679b, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x699b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xec8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6c9b, 0x8888, 0xda92, 0x8888, 0x8888, 0x8888,
-  0x6489, 0x8888, 0x6a9b, 0x8888, 0x8888, 0x8888, 0x6d9b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6e9b, 0x8888,
-  0x719b, 0x8888, 0x8888, 0x6f9b, 0x8888, 0x709b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x718e, 0x729b, 0x8888, 0x8888, 0x458d, 0x739b, 0xa6fa, 0x9a8e, 0xb691, 0x8888, 0x749b, 0x759b, 0x798e, 0x468d, 0x8888, 0xd096,
-  0x8888, 0x8888, 0x8888, 0x478b, 0xc78c, 0x769b, 0x778a, 0x8888, 0x8888, 0x779b, 0x8888, 0xb791, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x789b, 0xa19b, 0x8888, 0x799b, 0x8888, 0x7a9b, 0x8888, 0x8888, 0x7b9b, 0x8888, 0x7d9b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x7e9b, 0x8888, 0x8888, 0x809b, 0x8888, 0xee91, 0x8888, 0x4689, 0xe78e, 0xc088, 0x8888, 0x7691, 0xae8a, 0xb38e, 0x8888, 0x478d,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8693, 0x8888, 0x408f, 0xaf8a, 0x8892, 0xe892, 0xb688, 0x588b, 0xf395, 0x8888, 0xc08e,
-  0x8888, 0x8888, 0x718b, 0xe990, 0xba8e, 0x4797, 0x819b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7b8b, 0x8888,
-  0xc98d, 0x8888, 0x8888, 0x518a, 0x8389, 0xaa8f, 0xc689, 0x8888, 0x829b, 0x6597, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x688f,
-  0xa7fa, 0x8888, 0xe28e, 0x839b, 0xf18a, 0xd093, 0xa796, 0x849b, 0x8888, 0x859b, 0x8888, 0x8888, 0x7895, 0x8888, 0x8888, 0x8888,
-  0x879b, 0x8888, 0xa68a, 0xf58b, 0x869b, 0x8888, 0x8888, 0x8888, 0xa9fa, 0x8888, 0x8888, 0xb08a, 0x8888, 0x5190, 0x8b9b, 0x408e,
-  0x8888, 0xc789, 0x8a9b, 0x8888, 0x889b, 0x8c9b, 0x899b, 0x4a94, 0xcb9e, 0x5290, 0x8888, 0x8d9b, 0xaafa, 0x8888, 0xbe97, 0x8888,
-  0x8e9b, 0x8888, 0x8888, 0x909b, 0x8888, 0x9e92, 0x8f9b, 0x8888, 0xa190, 0x8888, 0x9b8e, 0x8888, 0x8888, 0x8888, 0xce91, 0xf58e,
-  0x8888, 0x9595, 0xea90, 0x8888, 0xcb8e, 0x919b, 0xab8f, 0x929b, 0x939b, 0xd188, 0xb891, 0x7190, 0x8888, 0x949b, 0xb193, 0xac8f,
-  0x8888, 0xad8f, 0x8888, 0x959b, 0x8888, 0x8888, 0xeb90, 0x8888, 0x8888, 0x8888, 0xae8f, 0x8888, 0x8888, 0x8888, 0xabfa, 0x8888,
-  0x969b, 0x8888, 0x979b, 0x8888, 0xde96, 0x8888, 0x8888, 0x8888, 0x989b, 0x8888, 0x8888, 0x8888, 0x8888, 0xc48b, 0x8888, 0x8888,
-  0x8888, 0x418f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x999b, 0x9a9b, 0xda8e, 0x4b90, 0xf293, 0x7390, 0xf694, 0x4194,
-  0xc78b, 0x9b9b, 0x8888, 0x8888, 0x8888, 0x8f8b, 0x9c9b, 0x8888, 0xfc8b, 0x8888, 0xcd93, 0xae89, 0x8888, 0x728e, 0x9d9b, 0xa09b,
-  0x9f9b, 0xfb8b, 0x8888, 0x9e9b, 0x8888, 0x5793, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xae91, 0x8888,
-  0x6a93, 0xc68e, 0x8888, 0x8888, 0x7791, 0x9a97, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa29b, 0x8888, 0xa39b, 0xd493,
-  0x8888, 0x528e, 0x8888, 0x8888, 0x8888, 0x8888, 0xa59b, 0x8888, 0x8888, 0xa69b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa79b, 0x8888, 0x8888, 0x8888,
-  0xf28a, 0xa89b, 0x8888, 0x8888, 0xa99b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xaa89, 0x8888, 0x8888, 0x8888, 0x8888, 0xacfa, 0x8888, 0x5a91, 0xe28a, 0x8888, 0xab9b, 0xa696, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xd091, 0x8888, 0x788a, 0x8888, 0x8888, 0xad9b, 0xaf9b, 0xdd8a, 0x8888, 0xadfa, 0xac9b, 0xae9b, 0x8888, 0xb19b, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb09b, 0x8888, 0xb29b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb39b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xbb93, 0xac8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe389, 0xb49b, 0xb99b, 0x8888, 0x8888, 0xb79b, 0x8888, 0xf595,
-  0xf495, 0x8888, 0x8888, 0x8888, 0x8888, 0xaefa, 0x8793, 0x8888, 0x8888, 0x8888, 0xb69b, 0x738f, 0x8888, 0xb59b, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9290, 0x8888, 0x8888, 0x8888, 0xba9b, 0x8888, 0x8888, 0xe88d, 0x8888,
-  0x8888, 0xc09b, 0x8888, 0x8888, 0xc19b, 0xbb9b, 0x528a, 0xbc9b, 0xc59b, 0xc49b, 0xc39b, 0xbf9b, 0x8888, 0x8888, 0x8888, 0xbe9b,
-  0x8888, 0x8888, 0xc29b, 0x8888, 0x8888, 0x8888, 0x8888, 0xaffa, 0x8888, 0xf695, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xb2fa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc99b, 0xc69b, 0x8888, 0xc89b, 0x8888,
-  0x9297, 0x8888, 0xc79b, 0xb0fa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbd9b, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9390, 0x8888, 0x8888, 0xca9b, 0xb3fa, 0x8888, 0xb58d,
-  0x8888, 0x8888, 0x8888, 0xcb9b, 0x8888, 0x8888, 0xcc9b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xcf9b, 0x8888, 0xce9b, 0x8888, 0x8888, 0xcd9b, 0x8888, 0x8888, 0x8888, 0x8893, 0xb89b, 0x8888, 0x8888, 0x8888,
-  0xd59b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd19b, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xd09b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd29b, 0x8888, 0xd39b, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd69b, 0xb4fa, 0xb5fa, 0xe497, 0x8888, 0xd79b, 0xd49b, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd89b, 0x8888, 0x8888, 0xde8a, 0xd99b, 0x8888, 0x8888,
-  0xb6fa, 0x8888, 0xdb9b, 0xda9b, 0x8888, 0x8888, 0xdc9b, 0x8888, 0x8888, 0x8888, 0x8888, 0xdd9b, 0x8888, 0xec90, 0x428f, 0x8888,
-  0x8888, 0x848f, 0x8888, 0x8391, 0x8888, 0x488d, 0xb68d, 0x498d, 0x908b, 0x8888, 0x8888, 0xde9b, 0x8888, 0x8888, 0xb78d, 0x8888,
-  0x8888, 0xc88c, 0xdf9b, 0xa496, 0x6294, 0xe09b, 0x8888, 0x4a8d, 0x8888, 0x8888, 0x8888, 0xaa8a, 0x8888, 0x4692, 0xd08b, 0x8888,
-  0x8888, 0x8888, 0x738e, 0x7a95, 0x8888, 0x8888, 0xbf94, 0x8888, 0x8888, 0x8888, 0x8888, 0xe19b, 0xf38a, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xe49b, 0x8888, 0x8888, 0x8888, 0x8888, 0x9f92, 0x8888, 0x8888, 0xe39b, 0xe29b, 0xe59b, 0x8888, 0xe992, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8390, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x748e, 0x8888, 0xc890, 0x8888, 0xd191,
-  0x418b, 0x8888, 0x8888, 0xa092, 0x8888, 0x8888, 0xe69b, 0xe79b, 0xed8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x5896, 0x8888, 0x8888,
-  0xea9b, 0x8888, 0x8888, 0xe99b, 0xe89b, 0x9d95, 0x8888, 0xf19b, 0x8888, 0x8888, 0x8888, 0x8888, 0x7996, 0x8888, 0xeb9b, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xed9b, 0x8b96, 0x8888, 0xec9b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xee9b,
-  0x8888, 0xa694, 0xef9b, 0xbc95, 0xf09b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xb18a, 0xbd95, 0x4e94, 0xf29b, 0xf39b, 0x8888, 0x4b8d, 0xb28a, 0xf49b, 0xb68c, 0x6397, 0x4897, 0xf48a, 0xf69b,
-  0x8888, 0xa192, 0x8888, 0x4c8d, 0xaf8f, 0x8888, 0x8888, 0xdd94, 0x8888, 0x8888, 0xb08f, 0x8888, 0x8888, 0x8888, 0x8888, 0x988f,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xea92, 0xf795, 0x5893, 0x8888, 0x8888, 0x4d8d, 0x8888, 0x7b95, 0x8888, 0x8888, 0x8888,
-  0xf79b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7893, 0xc08d, 0x8888, 0x8888, 0x8888, 0xc98c, 0x8888, 0xeb92, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc188, 0x8e8f, 0x4e8d, 0x6697, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xf89b, 0xf99b, 0x7094, 0x8888, 0x8888, 0x8888, 0x8888, 0xfa9b, 0xf597, 0x4c98, 0x8888, 0x8888, 0x8888, 0x8888, 0xfc9b,
-  0xfb9b, 0x8888, 0x8888, 0x668a, 0x8888, 0x8888, 0x409c, 0x8888, 0x8888, 0x8888, 0x439c, 0x449c, 0x8888, 0x429c, 0x8888, 0x5f95,
-  0xb18f, 0x469c, 0x459c, 0x419c, 0x8888, 0x8888, 0x8888, 0x8888, 0x479c, 0x489c, 0x8888, 0x8888, 0x499c, 0x8888, 0x8888, 0x8888,
-  0x4c9c, 0x4a9c, 0x8888, 0x4b9c, 0x4d9c, 0x8888, 0x8489, 0xec92, 0x4e9c, 0x8888, 0x9a8c, 0xf489, 0x5594, 0x8888, 0x4f9c, 0xf993,
-  0x8888, 0xd995, 0x8888, 0x509c, 0x4d98, 0x8888, 0x8888, 0x8888, 0x8888, 0x519c, 0xbe95, 0x549c, 0x9f98, 0xaf98, 0x8888, 0xae8e,
-  0xf393, 0x559c, 0x8888, 0x7c8b, 0xa292, 0xf888, 0x569c, 0xa495, 0x4f8d, 0x8888, 0x8888, 0x6f92, 0x8888, 0x8888, 0x8888, 0xed92,
-  0x8888, 0xb7fa, 0x8888, 0x8888, 0x8888, 0xed96, 0xb78c, 0xca8c, 0x8888, 0x579c, 0x8888, 0x8888, 0x8888, 0x589c, 0x8888, 0x5e9c,
-  0x8888, 0xe38e, 0x8888, 0x8888, 0xb8fa, 0xa392, 0x8888, 0xad8b, 0x599c, 0x8888, 0x8888, 0x8888, 0x4a95, 0x8888, 0x6592, 0x8888,
-  0x8888, 0x5a9c, 0x8888, 0x8888, 0x8888, 0x67fa, 0x8888, 0x8888, 0x5b9c, 0x8888, 0xae8b, 0x8888, 0x5c9c, 0x8888, 0x5d9c, 0x8888,
-  0x8888, 0x5f9c, 0x8888, 0x9693, 0x8888, 0x8888, 0x609c, 0x619c, 0x8888, 0x629c, 0x8888, 0x8888, 0x539c, 0x529c, 0x8888, 0x8888,
-  0x8888, 0x639c, 0x608c, 0x8888, 0x8888, 0x8888, 0x4695, 0xb9fa, 0x8888, 0xca8d, 0x5695, 0xa492, 0x6a95, 0x649c, 0x8888, 0x8888,
-  0xb28f, 0x6589, 0x8888, 0x659c, 0x8888, 0x8888, 0x8888, 0x669c, 0x8888, 0xf096, 0x8888, 0x8888, 0xde94, 0x8888, 0x8888, 0x699c,
-  0x9d89, 0xaa90, 0x689c, 0x679c, 0x618c, 0xd291, 0x8888, 0x6d9c, 0x6b9c, 0x8888, 0x6a9c, 0xa597, 0xe38c, 0x8888, 0x8888, 0x8888,
-  0x998f, 0x6c9c, 0x6b93, 0x5d8f, 0x8888, 0x8888, 0x8888, 0xbe93, 0x709c, 0x6f9c, 0x8888, 0x8888, 0x8888, 0x8888, 0x6e9c, 0x8888,
-  0x719c, 0xe48c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x729c, 0x9c95, 0x7a8f, 0x8888, 0x8888, 0x739c, 0xf794, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xbf93, 0xa592, 0x8888, 0x8888, 0xbafa, 0x8888, 0x4f93, 0x8888, 0x8888, 0x749c, 0x4a8b, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x5390, 0x8888, 0x4b95, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf58a, 0x4594, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x759c, 0x758e, 0x5996, 0x5a96, 0x8888, 0x8888, 0x9e89, 0x7a9c, 0xbbfa, 0x8888,
-  0x8992, 0x8888, 0x8888, 0x8888, 0x779c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf589, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xab9c, 0x799c, 0x8888, 0x8888, 0x8888, 0x4f94, 0x8888, 0x8888, 0x789c, 0x8888, 0x8888, 0x769c, 0x8888, 0x9a8d, 0x8888, 0x7c9c,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x839c, 0x899c,
-  0x819c, 0x8888, 0x7b93, 0x8888, 0x8888, 0x869c, 0x7c95, 0x8888, 0x8888, 0x809c, 0x8888, 0x859c, 0xe597, 0x768e, 0x8888, 0x8888,
-  0xd391, 0x7d9c, 0x8888, 0x8888, 0x8888, 0x7d8b, 0x889c, 0xab90, 0x8589, 0x829c, 0xf689, 0x879c, 0x8888, 0x8888, 0x8888, 0xaf8b,
-  0x8888, 0x849c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8a9c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8c9c, 0x969c, 0x949c, 0x8888, 0x8888, 0x919c, 0x8888, 0x8888, 0x8888, 0x909c, 0xf697, 0x8888, 0x929c, 0x8888, 0x8888,
-  0xb08b, 0x8888, 0x508d, 0x8888, 0x8888, 0x9a8f, 0x8888, 0x8888, 0x8888, 0x999c, 0x8b9c, 0x8888, 0x8888, 0xbcfa, 0x8888, 0x8f9c,
-  0x7e9c, 0x8888, 0xf889, 0x939c, 0x959c, 0x7092, 0x8888, 0x8888, 0xa68d, 0xb689, 0x8d9c, 0x989c, 0x979c, 0xb18b, 0x8888, 0xa791,
-  0x868a, 0x8888, 0x8888, 0x8888, 0x8888, 0x628c, 0x8888, 0x8e9c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x9a9c, 0x8888, 0x9d9c, 0x9f9c, 0xbdfa, 0x8888, 0x8888, 0x8888, 0xbb8e, 0xbefa, 0xa59c, 0xee92, 0x9b9c, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xa39c, 0x8888, 0xf789, 0x8888, 0xa19c, 0xa29c, 0x8888, 0x8888, 0x9e9c, 0xa09c, 0x8888, 0x8888, 0x8888, 0xe58c,
-  0x4997, 0x8888, 0x8888, 0xb38a, 0x8888, 0x8888, 0x7889, 0xa49c, 0x8888, 0x5994, 0xab88, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xdf94, 0x7b9c, 0xaa9c, 0xae9c, 0xe396, 0x8888, 0xa79c, 0x8888, 0x8888, 0x8888, 0x8993, 0xac9c, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xee8f, 0xad9c, 0xd593, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x6698, 0x8888, 0xa99c, 0x8888, 0xc0fa, 0x8888, 0x8888, 0xaf9c, 0x8888, 0x9b8d, 0x8888, 0xc990, 0x8888, 0xbffa, 0xd288,
-  0xa89c, 0xa69c, 0x8888, 0x7991, 0x8888, 0x8888, 0x8888, 0x9c9c, 0x538e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xc491, 0xbb9c, 0xc2fa, 0x7a91, 0xb69c, 0x8888, 0xb39c, 0xb49c, 0x8888, 0xe48e, 0xb79c, 0xba9c, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xb59c, 0x448f, 0x8888, 0xb89c, 0x8888, 0x8888, 0xb29c, 0x8888, 0xfa96, 0xf996, 0x8888, 0x8888, 0x8888, 0xbc9c, 0xbd9c, 0xd388,
-  0x8888, 0xc3fa, 0x8888, 0x8888, 0x8888, 0xb19c, 0x8888, 0x8888, 0x8888, 0x8888, 0xf08b, 0xa488, 0x8888, 0x8888, 0x8888, 0xb48a,
-  0xc1fa, 0xb99c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc19c, 0xc09c, 0x8888, 0x8888, 0x8888, 0xc59c, 0x8888, 0x8888, 0x8888,
-  0xc5fa, 0x8888, 0x8888, 0x8888, 0xc69c, 0x8888, 0x8888, 0xc4fa, 0x8888, 0x8888, 0x8888, 0x8888, 0xc49c, 0xc79c, 0xbf9c, 0xc39c,
-  0x8888, 0x8888, 0xc89c, 0x8888, 0xc99c, 0x8888, 0x8888, 0xbe9c, 0x9c8e, 0x8888, 0xc29c, 0xd491, 0x518d, 0xb09c, 0x5490, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xd69c, 0x8888, 0xe795, 0x8888, 0x8888, 0xcc9c, 0xcd9c, 0xce9c, 0x8888, 0x8888, 0xd59c, 0x8888, 0xd49c,
-  0x8888, 0x8888, 0x9d96, 0xb58a, 0x8888, 0xd29c, 0x8888, 0x648c, 0x538a, 0x8888, 0x8888, 0xcf9c, 0x8888, 0x8888, 0xb697, 0xd19c,
-  0xd488, 0xd39c, 0x8888, 0xca9c, 0xd09c, 0xd79c, 0x638c, 0xcb9c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7c97, 0x8888,
-  0x8888, 0x8888, 0x4a97, 0x8888, 0x8888, 0x8888, 0x8888, 0xda9c, 0x8888, 0x8888, 0xde9c, 0x8888, 0x8888, 0x8888, 0x9e91, 0x8888,
-  0xf797, 0xdf9c, 0x8888, 0x8888, 0xdc9c, 0x8888, 0xd99c, 0x8888, 0xc6fa, 0xd89c, 0xdd9c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xae95, 0x8888, 0x8888, 0xb293, 0x8888, 0x658c, 0x8888, 0xe09c, 0xdb9c, 0x8888, 0xe19c, 0x8888,
-  0x8888, 0x8888, 0x9b8c, 0x8888, 0x8888, 0x8888, 0xaf89, 0x8888, 0x8888, 0x8888, 0xe99c, 0x8888, 0x8888, 0x8888, 0xb68a, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xe79c, 0x8888, 0x8888, 0xe89c, 0xa78d, 0xe69c, 0xe49c, 0xe39c, 0xea9c, 0xe29c, 0xec9c, 0x8888, 0x8888,
-  0xf989, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xee9c, 0x8888, 0x8888, 0xed9c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xa692, 0x8888, 0xf19c, 0x8888, 0xef9c, 0xe59c, 0x9c8c, 0x8888, 0xf09c, 0x8888, 0xf49c, 0xf39c, 0xf59c, 0xf29c,
-  0xf69c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf79c, 0xf89c, 0xe895, 0x8888, 0xfa9c, 0xf99c, 0x5e8f, 0x8888,
-  0xac90, 0xe489, 0xfa89, 0xc7fa, 0xfb9c, 0x8888, 0xbd88, 0x8888, 0x8888, 0x8888, 0xca90, 0xfc9c, 0x8888, 0xc1e6, 0x409d, 0x818c,
-  0x8888, 0x419d, 0x8888, 0x8888, 0x8888, 0x8888, 0xed90, 0x8888, 0x8888, 0x8888, 0x429d, 0x8888, 0x8888, 0x8888, 0x439d, 0x598b,
-  0x449d, 0x8888, 0x459d, 0x469d, 0xd591, 0x8888, 0x8888, 0x8888, 0xcb8c, 0x8888, 0x8888, 0xdf96, 0x8888, 0x8888, 0x8888, 0x5b96,
-  0x8a8f, 0x479d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xee90, 0xbbe7, 0xe094, 0x8888, 0xe88e, 0x8888, 0xcb8d, 0x489d, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xc591, 0x8888, 0xa595, 0x8888, 0x8888, 0xef91, 0x8888, 0x8888, 0x4b9d, 0x8888, 0x8888, 0x499d, 0x8888,
-  0x4c9d, 0x8888, 0x8888, 0x4a9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x4d9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xaf95, 0x8888,
-  0x8888, 0xb588, 0x8888, 0x8888, 0x8888, 0x8888, 0x7d95, 0x8888, 0x8888, 0xe194, 0x8888, 0x8888, 0x4e9d, 0x8888, 0x519d, 0xb38f,
-  0x5a8b, 0x8888, 0x4f9d, 0x569d, 0xb48f, 0x8888, 0x8888, 0x8888, 0x8888, 0x509d, 0x6394, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x7d97, 0x529d, 0x539d, 0x579d, 0x8a93, 0x549d, 0x528d, 0xdc90, 0x8888, 0x8888, 0x659d, 0xb294, 0x8888, 0xf091, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc8fa, 0x8888, 0x8888, 0x8888, 0x8888, 0xe294, 0xab9d, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xf895, 0x8888, 0x8888, 0x8888, 0xef92, 0x8888, 0x8888, 0x8888, 0x9596, 0x8888, 0x5a9d, 0x9f89, 0x8a92, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x639d, 0x8888, 0x8888, 0x5392, 0x5d9d, 0x649d, 0x5f9d, 0x669d, 0x629d, 0x8888, 0x619d, 0x8f94, 0x8888, 0x5b9d,
-  0xfb89, 0x599d, 0x918b, 0xf191, 0x559d, 0x8888, 0x8888, 0x589d, 0x538d, 0xd990, 0x8888, 0xb58f, 0x609d, 0x7194, 0x8888, 0x8888,
-  0x928b, 0x678a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x878a, 0x4090, 0x689d, 0x6d9d,
-  0x8888, 0x699d, 0x8888, 0x9d8c, 0x8888, 0x6e9d, 0x418e, 0x898d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x458f, 0x5c9d,
-  0x8888, 0x9d8e, 0x6b9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x778e, 0x6c9d, 0xc288, 0x8888, 0x8888, 0x679d, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xa792, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x938b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb28b,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6a9d, 0xa588, 0x8888, 0x8888, 0xc18d, 0x8888, 0x8888, 0x8888, 0x5590,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf092, 0x8888, 0x8888, 0xd294, 0x709d, 0x7d91,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa891, 0x8888, 0x8888, 0x4a8e, 0x719d, 0x8888, 0x739d,
-  0x6f9d, 0x8888, 0x8888, 0x8888, 0x8888, 0xdf95, 0x8888, 0xbb92, 0x8888, 0x8888, 0x8888, 0x8888, 0x7b91, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf995, 0xcc8e, 0x809d, 0x8888, 0x7e9d, 0x8888, 0x8888, 0x9890, 0x8888,
-  0x8888, 0x8888, 0x9e8c, 0x8888, 0x8888, 0x8888, 0x789d, 0xb78f, 0x8888, 0x8888, 0xe693, 0x5094, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x769d, 0x8888, 0x8888, 0x7c91, 0x8888, 0x8888, 0x8888, 0x8888, 0xf68e, 0x7b9d, 0x8888, 0x8888, 0xb68f, 0x8888, 0x759d, 0x7a9d,
-  0x8888, 0x8888, 0x7294, 0x8888, 0x8888, 0x8888, 0x749d, 0x8888, 0x408c, 0x8888, 0x8888, 0x7c8a, 0x8888, 0x8888, 0x8888, 0x7c9d,
-  0xa997, 0xcc8d, 0x5492, 0x799d, 0x8888, 0xda90, 0x8888, 0x548d, 0x8490, 0x8689, 0x5b91, 0x779d, 0x648b, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x668c, 0x8888, 0xcd92, 0x7d9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7e91, 0x8888, 0x8888, 0x819d, 0x8888,
-  0x839d, 0x8888, 0x8888, 0xb591, 0x899d, 0x8888, 0x849d, 0x8888, 0x8888, 0x869d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6095,
-  0xf192, 0x8888, 0x879d, 0x8888, 0x8888, 0x8888, 0x4b97, 0x8888, 0x8888, 0x8888, 0x6797, 0xb78a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xac88, 0x8888, 0x859d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x829d, 0x8888, 0x8888, 0x8888, 0x8888, 0xf68a, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8789, 0xc9fa, 0x889d, 0x8888, 0x8888, 0x8888, 0x6897, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8c9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb991, 0x8888, 0x939d,
-  0x8888, 0x8888, 0x8888, 0x8d9d, 0x8888, 0x8888, 0x8a9d, 0x919d, 0x8888, 0x8888, 0x8888, 0x8888, 0x729d, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8e9d, 0x8888, 0x929d, 0x8888, 0x8888, 0x8888, 0xc094, 0x8b93, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8b9d, 0x8888, 0x8f9d, 0x8888, 0x8888, 0x8888, 0x678c, 0x8888, 0x8888, 0x8888, 0xef8d, 0x8888,
-  0x8888, 0x8888, 0xdb90, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x979d, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4593, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xcafa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x949d, 0x8888, 0x8096, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x959d,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x969d, 0x8888, 0xcc96, 0x8888, 0xa090, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x828c, 0x8888, 0x8888, 0x8888, 0x8888, 0x9d9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x548e, 0x9a9d, 0x8888, 0x999d, 0x8888, 0x8888, 0x8888, 0x8888, 0x5194, 0x8888, 0x8888, 0xcbfa, 0xb393, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x5093, 0x9b9d, 0x8888, 0x8888, 0x8888, 0x9c9d, 0x8888, 0x8f95, 0x8888, 0x6494, 0x428e, 0x8888,
-  0xef90, 0x8888, 0x6f96, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x688a, 0x8888, 0xa39d, 0x9e9d, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x6997, 0xa59d, 0x8888, 0x8888, 0xa19d, 0x8888, 0xa29d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8091, 0xccfa, 0x8888,
-  0x8888, 0x8888, 0xa09d, 0x8888, 0x5e9d, 0x8888, 0x8888, 0x8888, 0xa49d, 0x8888, 0x9f9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xa99d, 0xaa9d, 0x4693, 0xac9d, 0x8888, 0x8888, 0x438e, 0xa79d, 0x8888, 0x8888, 0x8888, 0x8888, 0x5b8b, 0x8888, 0x8888, 0xad9d,
-  0x8888, 0xa69d, 0xb19d, 0x8888, 0xb09d, 0x8888, 0xaf9d, 0x8888, 0x8888, 0x8888, 0xb29d, 0x8888, 0x8888, 0xb49d, 0xef8f, 0x8888,
-  0xb39d, 0x8888, 0x8888, 0x8888, 0x8888, 0xb79d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb59d, 0x8888, 0x8888, 0x8888, 0xb69d, 0x909d, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xb99d, 0xb89d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x989d, 0xba9d, 0xae9d, 0x8888, 0x8888, 0x788e,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xbb9d, 0xbc9d, 0xbe9d, 0xbd9d, 0xbf9d, 0xfc89, 0x8888, 0x558d, 0x8888, 0x8888, 0xfa95, 0xad90,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcc8c, 0x8888, 0x8888, 0xc19d, 0x8888, 0x8888, 0x8888, 0x8888, 0xc49d, 0xcdfa, 0x7195,
-  0x8888, 0x7e8b, 0x8888, 0x8888, 0x8888, 0xc39d, 0xc29d, 0x7394, 0xc59d, 0xb38b, 0x8888, 0x8888, 0x8888, 0xc79d, 0xc69d, 0x8888,
-  0x8888, 0x8888, 0xb88a, 0x558e, 0x8888, 0x8888, 0xd693, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x688c, 0x8888, 0x8888, 0x8888,
-  0x9490, 0x8888, 0xc89d, 0x8888, 0xae90, 0x4793, 0x8888, 0x7e95, 0xc99d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xca9d, 0xcb9d, 0x8888, 0x8888, 0x8888, 0xb695, 0x7c9b, 0xc490, 0x8888, 0x8888, 0x6b95, 0x8888, 0xd68d, 0x8888,
-  0xe394, 0xc194, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6c93, 0x8888, 0xbf97, 0x8888, 0xcd9d, 0xce8e, 0x8888, 0x8888, 0xce9d,
-  0x8888, 0xb488, 0x8888, 0x8888, 0xd28b, 0xcb90, 0x8888, 0x8095, 0x8888, 0x8888, 0x8888, 0xcf9d, 0x618e, 0x6692, 0x8888, 0x7a8e,
-  0x5690, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd09d, 0x8888, 0xfb95, 0x8888, 0x8888, 0x9789, 0x7b8e, 0x8888, 0x8888,
-  0x8888, 0xd39d, 0x8888, 0xd19d, 0xd49d, 0xb797, 0xd29d, 0x8888, 0x8888, 0x8888, 0x8888, 0xf990, 0xd59d, 0x8888, 0x8888, 0xb091,
-  0x8888, 0x8888, 0xd69d, 0x8888, 0x8888, 0x8888, 0x8888, 0xf88a, 0x8888, 0xd89d, 0x8888, 0xd79d, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xd99d, 0xda9d, 0xf98a, 0x8888, 0x8888, 0xfa93, 0x5592, 0x8c8b, 0x7c8e, 0x8191, 0x8888, 0x8888, 0x7b8f, 0xae88, 0x8888, 0x8888,
-  0x8888, 0xdb9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa089, 0xdf9d, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xcefa, 0x8888, 0x568d, 0xde9d, 0x8888, 0x8888, 0xa98d, 0xb88f, 0x8888, 0xd1fa, 0xdd9d, 0x8888, 0xb98f, 0x8888, 0xbe96, 0xa88d,
-  0x8888, 0x8888, 0x8888, 0xd588, 0xcc90, 0xcffa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe49d, 0x8888, 0xd3fa, 0xaf90,
-  0x6689, 0x8888, 0x8888, 0x8888, 0xd4fa, 0x748f, 0x8888, 0x8696, 0xf08d, 0x8888, 0x8888, 0x8888, 0x8888, 0xba8f, 0xd2fa, 0xa590,
-  0x8888, 0x63fa, 0x8888, 0x8888, 0xe39d, 0xe19d, 0xe29d, 0x8888, 0x8888, 0x8888, 0x8888, 0xd0fa, 0x8b92, 0x8888, 0x8888, 0x459e,
-  0x8888, 0xe89d, 0x9e8e, 0x578d, 0xe69d, 0x8888, 0x8888, 0x8888, 0x8888, 0xe79d, 0x8888, 0x5790, 0x8888, 0x8888, 0x8888, 0xe59d,
-  0x8888, 0x8888, 0x4e8e, 0x8888, 0x8888, 0x8888, 0x8888, 0xd6fa, 0x8888, 0xd7fa, 0x8888, 0x8888, 0x8888, 0xea9d, 0xe99d, 0xee9d,
-  0x8888, 0x8888, 0xef9d, 0x8888, 0xeb9d, 0xd5fa, 0x418a, 0xec9d, 0xed9d, 0xd394, 0x8888, 0x8888, 0x8888, 0x8888, 0x8195, 0x698c,
-  0xf09d, 0x8888, 0x8888, 0xd9fa, 0xb090, 0x8888, 0xbb8f, 0x8888, 0x8888, 0x8888, 0x7192, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xc58b, 0x8888, 0xf19d, 0xf59d, 0x8888, 0x8888, 0xc989, 0xf29d, 0xf49d, 0x8888, 0x8888, 0x8888, 0x8888, 0xf39d, 0x8888,
-  0x8888, 0x8b8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x6792, 0xc388, 0xf69d, 0xdafa, 0x8888, 0x8888, 0x8888, 0xf79d, 0x8888, 0x8888,
-  0xdbfa, 0x8888, 0xa892, 0x8888, 0x8888, 0x8888, 0xef97, 0x8888, 0x8888, 0x8888, 0x8888, 0x628e, 0x8888, 0x8888, 0xe995, 0x8888,
-  0x8888, 0x8888, 0xdcfa, 0x8888, 0x5c96, 0x8888, 0x8888, 0x8888, 0x419e, 0xf99d, 0x8888, 0x8888, 0xfc9d, 0x8888, 0xfb9d, 0xddfa,
-  0x8888, 0xf89d, 0x8888, 0x8888, 0x409e, 0x8888, 0x8888, 0xdc93, 0x8888, 0xfa9d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x429e, 0x8888, 0x8888, 0x8c8f, 0x439e, 0x8888, 0x6a97, 0x9894, 0x8888, 0x8888,
-  0x449e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x469e, 0x8888, 0x8888, 0x479e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x489e, 0x8888, 0xc88b, 0x6789, 0x588d, 0x499e, 0x8888, 0x4a9e, 0x918f, 0x8291, 0xdefa, 0x66fa, 0xd699, 0x5d91, 0x5c91, 0xd691,
-  0xc58d, 0x8888, 0x8888, 0xf098, 0x8888, 0x8888, 0x8888, 0x8888, 0x8e8c, 0x4c97, 0x8888, 0xfc95, 0x8888, 0x9e95, 0xdffa, 0x4b9e,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xf18d, 0xbd92, 0x4c9e, 0x4e98, 0x8888, 0x8888, 0x8888, 0x5d96, 0x8888, 0xa992, 0x4d9e, 0xfa8a,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4e9e, 0x4f9e, 0xd896, 0x8888, 0xa296, 0x9696, 0x7b96, 0x448e, 0x519e, 0x8888,
-  0x8888, 0xe98e, 0x8888, 0x8888, 0x7096, 0x8888, 0x539e, 0x569e, 0x559e, 0x8888, 0xf78a, 0x8888, 0x8888, 0x808b, 0x8888, 0x529e,
-  0x8888, 0x549e, 0x8888, 0x8888, 0x8888, 0x8888, 0x579e, 0x8888, 0x8888, 0x9990, 0x8888, 0x8888, 0x8888, 0x8888, 0x9b97, 0xc788,
-  0xde8d, 0xba91, 0x8888, 0xdb8e, 0x8888, 0x8888, 0xf18f, 0x8888, 0x8888, 0x5a9e, 0x8888, 0x8888, 0x6d93, 0x8888, 0x589e, 0xa991,
-  0x599e, 0xf08f, 0xdb96, 0x5b9e, 0x5c9e, 0x8897, 0xe1fa, 0x8888, 0x8888, 0x8888, 0x619e, 0x8888, 0x8888, 0x598d, 0x8888, 0x7494,
-  0x5e9e, 0x8c93, 0xdc9d, 0xe09d, 0x8888, 0x6e8b, 0x8888, 0x6694, 0x8888, 0x8888, 0x8888, 0x8888, 0x609e, 0x8888, 0xbc8f, 0xc294,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x669e, 0x8888, 0xf894, 0x8888, 0x5d9e, 0x8888, 0x639e, 0x629e, 0x8888, 0x8888, 0x8888,
-  0xcd90, 0x8888, 0x8888, 0x8888, 0x8888, 0x8d96, 0x8888, 0xd197, 0x8888, 0x8888, 0x8796, 0x8888, 0xca89, 0x7d8e, 0x8888, 0x8888,
-  0x6798, 0x659e, 0x9590, 0x8888, 0x8888, 0x8888, 0x649e, 0x8888, 0x8888, 0x5f9e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcd8c,
-  0x8888, 0x8888, 0x8888, 0x6b9e, 0x699e, 0x8888, 0xcb89, 0x679e, 0x6d9e, 0x739e, 0x8888, 0xe2fa, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xe4fa, 0xc691, 0x8888, 0x8888, 0xbf95, 0x8888, 0x759e, 0x8888, 0x8888, 0x8888, 0x4195, 0x8888, 0x8888, 0x8888, 0x749e, 0x9094,
-  0x5e96, 0xb98a, 0x8888, 0xf590, 0x5f8f, 0x8888, 0x8888, 0x8888, 0xd192, 0x8888, 0x4d97, 0x8888, 0x8888, 0x709e, 0x6f9e, 0x8888,
-  0x8888, 0x8888, 0x719e, 0x8888, 0x6e9e, 0x8888, 0x8888, 0x769e, 0x8888, 0x6c9e, 0x8888, 0x8888, 0x6a9e, 0x8888, 0x729e, 0x689e,
-  0x8888, 0x8c92, 0x8888, 0xf696, 0xc48e, 0xf28d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb88d, 0x8888, 0x8888, 0x8f96, 0x608a,
-  0x8888, 0xe5fa, 0xcc92, 0xc893, 0x6889, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xf090, 0x8888, 0x8888, 0xb290, 0x498c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x789e, 0x8888,
-  0x8888, 0x5a8d, 0x9c8a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7a9e, 0x948a, 0x819e, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x7d9e, 0x8888, 0xf190, 0x8888, 0x8888, 0x8888, 0x6a8a, 0xaa8d, 0x8888, 0x8888, 0x698a, 0xcd8d, 0x8888, 0x8888,
-  0x7b9e, 0x858c, 0x6a8c, 0x8d93, 0xe6fa, 0x8888, 0x799e, 0x8888, 0xc488, 0x8888, 0x8888, 0x8888, 0x8888, 0x7c9e, 0x7e9e, 0x8888,
-  0xcb8b, 0x4b8c, 0xe3fa, 0xba8a, 0x6a8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x829e, 0x8888, 0x8888, 0xf78d, 0x9196, 0x8888, 0x568e,
-  0x8888, 0x8888, 0x8888, 0x839e, 0x8888, 0x8888, 0x8888, 0x4f95, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8f9e, 0x8888, 0xb189, 0x849e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x959e, 0x859e,
-  0x8888, 0xc097, 0x8888, 0x8c9e, 0x8888, 0x7e94, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x949e, 0x8888, 0x879e,
-  0x8888, 0x8888, 0x8888, 0xb288, 0x899e, 0x8888, 0x8888, 0x5b8d, 0x8888, 0x8888, 0x8888, 0x8b9e, 0x8888, 0x8a9e, 0x8888, 0x869e,
-  0x919e, 0x8888, 0xbd8f, 0x8888, 0x8888, 0x8888, 0xeb9a, 0xe68c, 0x9c97, 0x8888, 0x8888, 0x8888, 0x8888, 0x889e, 0x8888, 0xf292,
-  0x428a, 0xab8d, 0x8888, 0x809e, 0x8888, 0x909e, 0x818a, 0x8888, 0x8888, 0x8e9e, 0x929e, 0x8888, 0x8e93, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xfc8a, 0x8888, 0xb09e, 0x8888, 0x64fa, 0xc796, 0x979e, 0xfb8a, 0x8888, 0x9e9e, 0x8888, 0xe7fa,
-  0x8888, 0x8888, 0x5f96, 0x8888, 0x9f9e, 0xa19e, 0x8888, 0xa59e, 0x999e, 0x8888, 0x4992, 0x8888, 0x8888, 0x8888, 0x8888, 0x8f93,
-  0xa99e, 0x9c9e, 0x8888, 0xa69e, 0x8888, 0x8888, 0x8888, 0xa09e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5890, 0xaa9e,
-  0x8888, 0x8888, 0xb190, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa89e, 0xbb8a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x6f98, 0x969e, 0x8888, 0x8888, 0xa49e, 0xd688, 0x8888, 0x8888, 0x989e, 0x8888, 0x8888, 0xb896, 0x9d9e, 0x4190, 0xc592, 0x939e,
-  0x8888, 0x8888, 0xa39e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9a90, 0xad9e, 0x918a, 0x9f8c, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xaf9e, 0x9a9e, 0xae9e, 0x8888, 0xa79e, 0x9b9e, 0x8888, 0xab9e, 0x8888, 0xac9e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xbd9e, 0x8888, 0x8888, 0x8888, 0xcc93, 0x8888, 0xa29e, 0x8888, 0x8888, 0xb99e, 0x8888, 0x8888, 0x8888, 0xbb9e, 0x8888, 0xd692,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6b97, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x9695, 0xb69e, 0xc891, 0x8888, 0x8888, 0x8888, 0xbc9e, 0x5e91, 0x8888, 0xb39e, 0xc09e, 0xbf9e, 0x8888,
-  0xed93, 0xbe9e, 0xe893, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe9fa, 0x8888, 0xc29e, 0xb59e, 0x8888, 0xc68b, 0xb89e, 0x7c8f,
-  0x8888, 0x8888, 0x8888, 0x8094, 0xba9e, 0xc98b, 0x8888, 0xb29e, 0xb49e, 0xb19e, 0x8888, 0x8888, 0x4f98, 0x798a, 0xb79e, 0x8888,
-  0x8888, 0xc19e, 0x548a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe58d, 0x8888, 0x8888, 0x8888, 0x7c89, 0x8888,
-  0x8888, 0xd29e, 0x8888, 0x8888, 0x5098, 0xd59e, 0x8888, 0x8888, 0xebfa, 0x8888, 0x8888, 0x5990, 0xd49e, 0x8888, 0x8888, 0x8888,
-  0xd39e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd09e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc49e, 0x8888,
-  0x8888, 0xe19e, 0xc39e, 0x8888, 0xd69e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xce9e, 0x8888, 0x8888, 0xc99e, 0xc69e,
-  0x8888, 0xc79e, 0x8888, 0xcf9e, 0x8888, 0x8888, 0x8888, 0xa0ea, 0x8888, 0x8888, 0xcc9e, 0x5c8d, 0xc692, 0x8491, 0xca9e, 0x8888,
-  0xc59e, 0x8888, 0x8888, 0xc89e, 0x8888, 0x8888, 0x8888, 0x8888, 0x6c97, 0x8a96, 0x8888, 0x8888, 0x8888, 0xcd9e, 0xd79e, 0x8888,
-  0x8888, 0x8888, 0xecfa, 0x8888, 0x8888, 0x8888, 0x8888, 0xdf9e, 0xd89e, 0x8888, 0x8888, 0xe59e, 0x8888, 0xe39e, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xde9e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdd9e, 0x8888, 0xce92, 0x8888, 0x8591, 0x8888, 0xdb9e,
-  0x8888, 0x8888, 0xd99e, 0x8888, 0x8888, 0xe09e, 0x8888, 0x8888, 0x8888, 0x8888, 0xe69e, 0xf394, 0xec9e, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xe79e, 0xea9e, 0xe49e, 0x8888, 0x8888, 0x9492, 0x8888, 0x5795, 0x8888, 0xda9e, 0x8888, 0x8888, 0xe29e, 0xbe8f,
-  0x8888, 0xcd96, 0xf69e, 0xe99e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa08c, 0xa189, 0x7e8a, 0x8888, 0x8888, 0xd19e, 0x8888,
-  0xedfa, 0x8888, 0x8888, 0x8888, 0x8888, 0xbf8f, 0xee9e, 0x8888, 0xf59e, 0xf78e, 0x928a, 0x8888, 0x8888, 0x4d92, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xeb9e, 0x8888, 0xeffa, 0xf09e, 0xf49e, 0x8888, 0x8888, 0xb48b, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6b8b, 0xf29e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x408b,
-  0x8888, 0xc993, 0xf19e, 0x8888, 0x8888, 0x8888, 0xf39e, 0x8888, 0x8888, 0x8888, 0x8888, 0xeefa, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xed9e, 0xf0fa, 0x8888, 0x8888, 0x8888, 0x8888, 0xef9e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf1fa, 0x808a,
-  0x6892, 0x8888, 0x8888, 0x8888, 0xfa9e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf89e, 0xe78c, 0x8888,
-  0xf79e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x409f, 0x8888, 0x8888, 0x8888, 0x8888, 0x779e, 0x8888, 0x8888, 0x8888,
-  0xf99e, 0x8888, 0xfb9e, 0xfc9e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4b9f, 0x8888, 0x479f, 0x8888, 0x8d9e, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x469f, 0x8888, 0x8888, 0x8888, 0x8888, 0x459f, 0x8888, 0x8888, 0x429f, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xe89e, 0x449f, 0x439f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x499f, 0x8888, 0x4598, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4c9f, 0xf98b, 0x8888, 0x8888, 0x489f, 0x4a9f,
-  0x8888, 0x8888, 0xf2fa, 0x8888, 0xf3fa, 0x8888, 0x8888, 0x8888, 0xa594, 0x8888, 0x4d9f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x519f, 0x4e9f, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x9397, 0x4f9f, 0x8888, 0x8888, 0x8888, 0x8888, 0xdc9e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x529f, 0x8888, 0x8888, 0x8888, 0x539f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5489, 0x8888, 0x559f,
-  0x878c, 0x9f8e, 0x8888, 0xd38b, 0x8888, 0x8888, 0x8888, 0xa289, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x7e97, 0x8888, 0x8888, 0x8888, 0x8888, 0x579f, 0x569f, 0x599f, 0x5c8b, 0x8888, 0x8888, 0xd48b, 0xbc8a, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x5c9f, 0x8888, 0x8888, 0x8888, 0x5b9f, 0x8888, 0x5d9f, 0x8888, 0x8888, 0xcc89, 0x8888, 0x5692, 0x8888,
-  0x5e9f, 0x8888, 0x8888, 0xbd8a, 0x609f, 0x8888, 0x8888, 0x8888, 0x8888, 0x5f9f, 0x8888, 0x619f, 0x8888, 0x8888, 0x8888, 0x629f,
-  0x8888, 0x639f, 0x7e8e, 0xb390, 0x9f8d, 0x8888, 0x9095, 0x8888, 0x8888, 0xe095, 0x6398, 0x8888, 0x8888, 0x8888, 0x8888, 0x958e,
-  0x8888, 0x8888, 0x8888, 0xce8d, 0xf097, 0x8888, 0x8888, 0x8888, 0x649f, 0x659f, 0x8888, 0x808e, 0x8888, 0x8888, 0x8888, 0x669f,
-  0x679f, 0x8888, 0x8888, 0x699f, 0x689f, 0x8888, 0x7796, 0x8888, 0x8888, 0x7d8f, 0xea8e, 0x638e, 0x8888, 0x6a9f, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6c9f, 0x4290, 0x8888, 0x6b9f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6d9f, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x6e9f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6f9f, 0x709f, 0x8888, 0x8888, 0x8888, 0x719f,
-  0x8888, 0x739f, 0x729f, 0x749f, 0xa389, 0x6992, 0x8888, 0x759f, 0x8888, 0x8888, 0x458e, 0x6b8a, 0x769f, 0x8888, 0x8888, 0x6193,
-  0xca9a, 0x8888, 0x8888, 0x8888, 0x8888, 0x428b, 0x779f, 0x8888, 0x8888, 0x8888, 0x8888, 0x789f, 0x8888, 0xea95, 0x8896, 0x8888,
-  0x8888, 0x8888, 0xc593, 0x799f, 0xe494, 0x8888, 0xf4fa, 0x8888, 0xf994, 0x8888, 0x8888, 0xd196, 0x8888, 0x8888, 0x8888, 0x7a9f,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7c9f, 0x7b9f, 0x8888, 0x8888, 0x7e9f,
-  0x8888, 0x8888, 0x8888, 0x7d9f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x819f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x818e,
-  0x8888, 0xaf96, 0x8888, 0x829f, 0x839f, 0x8888, 0x8888, 0x438b, 0x8888, 0x8888, 0x8888, 0x849f, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x869f, 0x859f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8590, 0x8888, 0x8888, 0x5895, 0x6989, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc394, 0xf5fa,
-  0xf392, 0x608f, 0x818b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc494, 0x8888,
-  0xac8e, 0x8888, 0x8888, 0x8888, 0x8888, 0x889f, 0x8888, 0xbe8a, 0x8888, 0x8888, 0x9889, 0x8888, 0xf6fa, 0xf093, 0x879f, 0x5d8d,
-  0x7292, 0x8888, 0x899f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x919f, 0x8888, 0x8a9f, 0x8888, 0x8888, 0x8888, 0x8888, 0xf8fa,
-  0xbf91, 0x8888, 0x828b, 0x929f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x888c, 0x8888, 0x8888, 0x448b, 0x909f, 0x8888,
-  0x8888, 0x8e9f, 0x8b9f, 0x8097, 0x8888, 0x8888, 0xf7fa, 0x8888, 0xbe92, 0x8888, 0x8888, 0x8888, 0xd793, 0x8c9f, 0x8888, 0x8888,
-  0x949f, 0x8888, 0x939f, 0x428c, 0x8888, 0x8888, 0xab89, 0x8888, 0x8888, 0xb98d, 0x8d9f, 0x8f9f, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x7696, 0xf291, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9796, 0x8888, 0x8888, 0x9c9f, 0x8888,
-  0x8888, 0x9d9f, 0x8888, 0xcd89, 0x8888, 0x8888, 0x8888, 0x8888, 0xa695, 0xfb96, 0x9f9f, 0xa18e, 0xc08f, 0x989f, 0x9e9f, 0x8889,
-  0x8888, 0xb58b, 0x8888, 0x8888, 0x959f, 0x9a9f, 0x8888, 0x8888, 0x8888, 0xf290, 0x9194, 0x8888, 0xe594, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x979f, 0x8888, 0x4096, 0x8888, 0x999f, 0x8888, 0xa29f, 0xf9fa, 0xa09f, 0x8888, 0x9b9f, 0x8888, 0x8888,
-  0x8888, 0x4196, 0x6794, 0x838b, 0x8888, 0x4493, 0x8888, 0x8888, 0x8d92, 0x8888, 0xa39f, 0x8888, 0x8888, 0x8888, 0x8888, 0xa19f,
-  0xd791, 0x969f, 0x8888, 0x6a89, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xfafa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6d97, 0xae9f, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xad9f, 0x8888, 0x8888, 0x8888, 0x8888, 0xf490, 0x8888, 0xaa9f, 0x8888, 0x8c97, 0x8888, 0x8888, 0xb493, 0xa49f,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc392, 0x8888, 0x8888, 0x8888, 0x6b89, 0x5e8d, 0xa79f, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x468f, 0xac9f, 0x8888, 0xab9f, 0xa69f, 0x8888, 0xa99f, 0x8888, 0x8888, 0x888a, 0x8888, 0xa89f, 0x6894, 0x8888,
-  0x8888, 0xac97, 0x8888, 0x8888, 0xf28f, 0xf390, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb49f, 0xb29f, 0x8888, 0x6c95, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xaf9f, 0xb19f, 0x8888, 0x5989, 0x8888, 0x8888, 0x5f8d, 0x5198, 0x8888, 0x5c8a, 0x8888, 0x8295, 0xfcfa,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8197, 0x8888, 0x8888, 0x438a, 0x5a90, 0xb39f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb89f, 0x8888, 0xfbfa, 0xc18f, 0x8888, 0x8888, 0x8888, 0x4f97, 0x8888, 0xb59f, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xb09f, 0x8888, 0xb69f, 0x40fb, 0x8888, 0x8888, 0xdc97, 0x8888, 0x9393, 0xc093, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x41fb, 0x8888, 0x8888, 0x558a,
-  0x8888, 0x8888, 0x7489, 0x8888, 0x8888, 0xbc9f, 0x8888, 0x8888, 0xbf9f, 0x8888, 0x8888, 0x8888, 0xc197, 0x8888, 0x8888, 0x8888,
-  0x8497, 0x8888, 0x8888, 0x8888, 0x8888, 0xc69f, 0xc09f, 0xbd9f, 0x8888, 0x8888, 0x8888, 0xd297, 0xc39f, 0x8888, 0x8888, 0x42fb,
-  0x8888, 0x698f, 0xc59f, 0x8888, 0x8888, 0xca9f, 0x8888, 0x8888, 0x9193, 0xc89f, 0x8888, 0x8888, 0x8888, 0x8888, 0xc29f, 0x8888,
-  0x8888, 0x5792, 0x8888, 0x8888, 0xc99f, 0x8888, 0xbe9f, 0x8888, 0xc49f, 0x8888, 0xcb9f, 0xfa88, 0xc19f, 0x8888, 0xcc9f, 0x8888,
-  0x8888, 0x5b90, 0x44fb, 0x7e8f, 0x8888, 0xa395, 0x8888, 0xac8d, 0x43fb, 0xb99f, 0xc79f, 0x5993, 0x45fb, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb490, 0x8888, 0x898a, 0xcf8d, 0xc28f, 0xbb9f, 0x618f, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x6b8c, 0x8888, 0xba9f, 0x8888, 0x8888, 0x8888, 0xd09f, 0x8d8f, 0xb88c, 0x8888, 0xdf9f, 0x8888, 0xd99f,
-  0x948b, 0x6e93, 0x8888, 0xd49f, 0xdd9f, 0xad88, 0x5189, 0x48fb, 0x8888, 0xb789, 0x8888, 0xd69f, 0xaa91, 0xcd9f, 0xcf9f, 0x608d,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe09f, 0x46fb, 0xdb9f, 0x8888, 0x49fb, 0x8888, 0xd39f, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xda9f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa996, 0x8888, 0x8888, 0xd89f, 0xdc9f, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xce8c, 0x8888, 0xc38f, 0x8888, 0x8888, 0x5892, 0x47fb, 0x8888, 0x8888, 0xd29f,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4e97, 0x8888, 0x8888, 0x8888, 0xd59f, 0x8888, 0x8888, 0xce9f, 0x9293,
-  0x8888, 0x8888, 0xd19f, 0x8888, 0x8888, 0x8888, 0xd79f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7098, 0xbc8e,
-  0x9e96, 0x8888, 0xe19f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xac94, 0x8888, 0x8888, 0xed9f,
-  0xb98c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x808f, 0x8888, 0xe39f, 0x8888, 0x8888, 0x8888, 0xad97, 0x618d, 0x8888, 0xf09f,
-  0x8888, 0x8888, 0xec88, 0x8888, 0x8888, 0xee9f, 0x8888, 0x8888, 0x8888, 0x8888, 0xe29f, 0x8888, 0x8888, 0x8888, 0x8888, 0xe89f,
-  0x8888, 0x8888, 0xea9f, 0x8888, 0x8888, 0x8888, 0x6e97, 0xe59f, 0x8888, 0x8888, 0x4d93, 0x8888, 0x8888, 0xe79f, 0x8888, 0x4afb,
-  0x8888, 0x8888, 0xef9f, 0x8888, 0xe99f, 0xc596, 0x8888, 0x8888, 0x8888, 0xe49f, 0x8888, 0xa08e, 0xfc9f, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8a8a, 0x8888, 0xe69f, 0xeb9f, 0xec9f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xea91, 0xd891, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf49f, 0x8888, 0x8888, 0xfa9f,
-  0x8888, 0x8888, 0xf89f, 0x8888, 0x4893, 0x8888, 0x8888, 0x42e0, 0xf59f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf69f, 0xde9f,
-  0x8888, 0x998b, 0x5995, 0x8888, 0x8888, 0x8888, 0xbd8e, 0x8888, 0x8888, 0x978d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5298,
-  0x8888, 0xf29f, 0x8888, 0x41e0, 0x8989, 0x8691, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x9994, 0x8888, 0xbf8a, 0xf897, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9f96, 0xd092, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xf99f, 0xfb9f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5191, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x40e0, 0xf79f,
-  0x8888, 0xf19f, 0x8888, 0x8888, 0x8888, 0xc18a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x898c, 0x8888, 0x8888, 0x8888, 0x4ee0, 0x8888, 0x8888, 0x49e0, 0xf690, 0x8888, 0x8888, 0x838a,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x818f, 0x8888, 0x52e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4be0, 0xaa92, 0x48e0,
-  0xd792, 0x8888, 0x8888, 0x8888, 0x6be0, 0x8888, 0x8888, 0x8888, 0x45e0, 0x8888, 0x44e0, 0x8888, 0x4de0, 0x8888, 0x8888, 0x8888,
-  0x47e0, 0x46e0, 0x4ce0, 0x8888, 0x9f90, 0x8888, 0x43e0, 0x8888, 0x4bfb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4fe0, 0x8888,
-  0x8888, 0x50e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc08a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x55e0, 0x8888, 0x54e0, 0x56e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x59e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x6293, 0x8888, 0x53e0, 0x8888, 0x4cfb, 0x8888, 0x8888, 0x8888, 0x57e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x838c, 0xf791, 0x51e0, 0x5a94, 0x8888, 0x8888, 0x58e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x5de0, 0x5be0, 0x8888, 0x8888, 0x5ee0, 0x8888, 0x8888, 0x61e0, 0x8888, 0x8888, 0x8888, 0x5ae0,
-  0x8a8d, 0x4794, 0x8888, 0x8888, 0xb79f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9497, 0x5ce0, 0x8888, 0x60e0, 0xf391,
-  0x8888, 0x5fe0, 0x8888, 0x4ae0, 0x8888, 0x4dfb, 0x89e8, 0x8888, 0x8888, 0x8888, 0x64e0, 0x8888, 0x8888, 0x8888, 0x68e0, 0x8888,
-  0x8888, 0x66e0, 0x8888, 0x8888, 0x8888, 0x4efb, 0x8888, 0x4ffb, 0x8888, 0x62e0, 0x8888, 0x63e0, 0x8888, 0x8888, 0x8888, 0x67e0,
-  0x8888, 0x65e0, 0x8888, 0x8888, 0x8888, 0x6d95, 0x8888, 0x8888, 0x6de0, 0x8888, 0x6ae0, 0x69e0, 0x8888, 0x6ce0, 0xd293, 0x6ee0,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9592, 0xeb91, 0x50fb, 0x8888, 0x8888, 0x8888, 0xa390, 0x8888, 0x8888, 0x8888,
-  0x6fe0, 0x8888, 0x71e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x70e0, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf39f, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x72e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe593, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x73e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xce89, 0x8888, 0x8888, 0x8888, 0x9493,
-  0x448a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x848b, 0x8888, 0x8888, 0x8888, 0xdc8e, 0xd08d, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x51fb, 0x8888, 0x8888, 0x8888, 0x4698, 0x8690, 0x8888, 0x8888, 0x8888, 0x8a89, 0x8888,
-  0x8888, 0x8888, 0x75e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x74e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x52fb, 0x78e0, 0x5992, 0x7be0, 0x76e0,
-  0x8888, 0x8888, 0x8888, 0x7ae0, 0x8888, 0x8888, 0x8888, 0x8888, 0x79e0, 0x5f93, 0xd788, 0x62fa, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf397, 0x8888, 0x8888, 0x7de0, 0x8888, 0x8888, 0x8888, 0x4789,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x80e0, 0x8888, 0x8888, 0x8888, 0x7ee0, 0x8888, 0x7ce0,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x77e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4296, 0x8888, 0x8888, 0x8888, 0x82e0, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x54fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x81e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x53fb,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8b89, 0x8888, 0x8888, 0x8888, 0x8888, 0x84e0, 0xb095, 0x8888, 0x83e0, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xb396, 0x8888, 0x8888, 0x8888, 0x8888, 0xc58f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5291, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc48f, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x56fb, 0x57fb, 0x8888, 0xf997, 0x8888, 0x8888, 0x8ae0, 0x8888, 0xf790, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x86e0, 0x8be0, 0x8888, 0x8888, 0x8c89, 0x8888, 0x8888, 0x55fb, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x89e0, 0x8888, 0x8194, 0x85e0, 0x88e0, 0xc68f, 0x8888, 0xcf94, 0x8888, 0x8888, 0x8ce0, 0x8888, 0xcf8e, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf890, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8fe0, 0x8888, 0x8888, 0x8888, 0x87e0, 0x8888, 0x468c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8de0,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x6f97, 0x90e0, 0x8888, 0x8888, 0x8888, 0xa4ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6e8f,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x91e0, 0x8888, 0x8888, 0x8888, 0x92e0, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x4d94, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x94e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x95e0, 0x8888,
-  0x8888, 0x59fb, 0x8888, 0x5294, 0x8888, 0x8888, 0x8888, 0x8888, 0x9593, 0x97e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x99e0, 0x8888,
-  0xd397, 0x8888, 0x96e0, 0x8888, 0x98e0, 0x8d89, 0x8888, 0x93e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7a9a,
-  0x9ae0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8791, 0x578e, 0x9ce0, 0x8888, 0x8888, 0x8888, 0x8888, 0x9be0, 0x4390, 0xd799, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9de0, 0x8888, 0x8888, 0x8888, 0x9fe0, 0x8888, 0x8ee0, 0x9ee0, 0x8888, 0x5afb, 0xa0e0,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9a94, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa1e0, 0x8888, 0x8888,
-  0xa2e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa3e0, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa4e0, 0x8888, 0xdc92, 0x8888, 0xa6e0, 0xa5e0, 0x8888, 0x8888,
-  0xa7e0, 0x8888, 0xa8e0, 0x8888, 0x8888, 0xdd8e, 0x8395, 0x8888, 0x8888, 0x8888, 0xea96, 0xa9e0, 0xaae0, 0x7591, 0xa28e, 0xabe0,
-  0xace0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xade0, 0xd095, 0xc594, 0x8888, 0x8888, 0xaee0, 0x7694, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xab92, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xafe0, 0xe589, 0x8888, 0x8d8b, 0x8888, 0xc496, 0x8888, 0xb496,
-  0x8888, 0xb289, 0x5398, 0x8888, 0x8888, 0x8888, 0x8888, 0x7196, 0x8888, 0xa895, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xb590, 0x8888, 0xb0e0, 0x8888, 0x8888, 0x8888, 0x8888, 0xc193, 0x8888, 0x8888, 0x8888, 0xa18c, 0xb1e0, 0x8888,
-  0xd28d, 0xb3e0, 0xb2e0, 0x8888, 0x8888, 0x8888, 0x8888, 0xb4e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xb5e0, 0x8888, 0x8888, 0x8888, 0xb6e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x5d8b, 0x8888, 0xb7e0, 0x8888, 0x8888, 0x8888, 0x8888, 0xb8e0, 0x8888, 0x8888, 0x8888, 0x8888, 0xa28c, 0x8888, 0x8888, 0xc694,
-  0x8888, 0x5bfb, 0xbae0, 0x8888, 0x8888, 0x8888, 0xf38f, 0x8888, 0x8888, 0xb9e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x5cfb, 0x8888,
-  0x8888, 0x8888, 0xb68b, 0xbbe0, 0xbde0, 0x8888, 0xbce0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbee0, 0x8888,
-  0xcf8c, 0x8888, 0xbfe0, 0x8888, 0x8888, 0x8888, 0x8888, 0xe78b, 0x8888, 0x5f91, 0x8888, 0x9d8d, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xc1e0, 0xc2e0, 0xc0e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xeb8e, 0x8888, 0x8888, 0xc693, 0xb78b, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc4e0, 0x4b92, 0xc3e0, 0x8888, 0x8888, 0x5498, 0x8294, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc7e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc9e0, 0xc6e0, 0x8888, 0x8888, 0x8888, 0xd296, 0xc8e0, 0xcae0, 0x8888, 0xc297,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x5dfb, 0xcee0, 0x8888, 0x8888, 0x8888, 0xcde0, 0x9692, 0x4c94, 0x8888, 0x8888, 0xa38c, 0xcce0,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xcbe0, 0x8888, 0x5097, 0x5197, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcfe0, 0x8e89,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x968d, 0x828e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd0e0, 0xd1e0,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd3e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x628f, 0x8888, 0x8888, 0x8888, 0x8888, 0xd5e0, 0x8888, 0xd4e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xd6e0, 0x8888, 0x6c8a, 0x8888, 0x8888, 0xd8e0, 0x8888, 0x5ffb, 0xd7e0, 0x8888, 0xdae0, 0xd9e0, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xba8c, 0x8888, 0x8888, 0xa697, 0x8888, 0xca8b, 0x8888, 0xa489, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe88b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdf8a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xe697, 0xdce0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdee0, 0x8888, 0x60fb, 0x8888, 0x8888,
-  0xdfe0, 0x8888, 0xcf89, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdbe0, 0x61fb, 0x588e, 0x8888, 0x8888, 0xbf92, 0xdde0, 0x8888,
-  0x8888, 0x8888, 0x64fb, 0x8888, 0x8888, 0x8888, 0x62fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe2e0, 0x8888,
-  0xec8e, 0x8888, 0x8888, 0x63fb, 0x8888, 0xe0e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x5d8c, 0x8888, 0x8888, 0xc794, 0xe1e0, 0x8888,
-  0x8888, 0xfce0, 0x8888, 0x8888, 0x8888, 0x66fb, 0x8888, 0x8888, 0xe7e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbb8c, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x858b, 0x8888, 0xe4e0, 0x9d97, 0x65fb, 0x8888, 0xae97, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xf491, 0x8888, 0x8888, 0xe6e0, 0x67fb, 0x8888, 0x8888, 0x69fb, 0x68fb, 0x8888, 0x8888, 0x8888, 0x6afb, 0x8888,
-  0x8888, 0x8888, 0xe8e0, 0xd497, 0xd58b, 0xfa94, 0x6994, 0x8888, 0x8888, 0x8888, 0xe9e0, 0x8888, 0x8888, 0x8888, 0x8888, 0xebe0,
-  0x8888, 0xeee0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xeae0, 0x8888, 0x8888, 0x8888, 0xede0, 0xe88c, 0x6c89, 0xefe0, 0x8888, 0x9090, 0xece0,
-  0xda97, 0x8888, 0x6bfb, 0xf2e0, 0xa2ea, 0x8888, 0x8888, 0x8888, 0x8888, 0xf0e0, 0xf3e0, 0x8888, 0x8888, 0x8888, 0x8888, 0xe5e0,
-  0xf1e0, 0x8888, 0x8888, 0xba8d, 0x8888, 0x8888, 0xf4e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf5e0, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x9e97, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6cfb, 0x8888, 0xf6e0, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf7e0, 0x6dfb,
-  0x8888, 0x8888, 0xe3e0, 0x8888, 0x8888, 0x8888, 0x8888, 0xf8e0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xc28a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa38e, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf9e0, 0x8888, 0x8888, 0x8888, 0x8888, 0xfae0,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xfbe0, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5a89, 0x8888, 0x8888, 0x8888,
-  0x40e1, 0x8888, 0x5a95, 0x41e1, 0x8888, 0x8888, 0xa28a, 0x42e1, 0x8888, 0x43e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x44e1, 0x8888,
-  0x46e1, 0x47e1, 0x45e1, 0x8888, 0x8888, 0x8888, 0x7295, 0x49e1, 0x48e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x6efb, 0x8888, 0x4be1, 0x4ae1, 0x4ce1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4de1, 0x4fe1, 0x4ee1, 0x8888,
-  0x8888, 0x998d, 0x8888, 0x51e1, 0x8888, 0x50e1, 0x8888, 0x8888, 0xc38a, 0x8888, 0x7290, 0x8888, 0x5b93, 0x8888, 0x52e1, 0xb690,
-  0x8888, 0x8888, 0x8888, 0x598e, 0x8888, 0x9989, 0x53e1, 0x8888, 0x7097, 0x8888, 0x8888, 0xe195, 0x54e1, 0x8888, 0x8888, 0xa8fa,
-  0x6393, 0x5297, 0x628d, 0x5c90, 0x8888, 0x8888, 0x8888, 0x6a92, 0xb299, 0x8888, 0xac92, 0xe689, 0x55e1, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x56e1, 0x8888, 0x5be1, 0x8888, 0x8888, 0x59e1, 0x58e1, 0xc09d, 0x458a, 0x57e1, 0x8888, 0xd888,
-  0x8888, 0xa894, 0x8888, 0x8888, 0xc894, 0x8888, 0x8888, 0x8888, 0x8888, 0xaf97, 0x5ce1, 0x5ae1, 0x7b92, 0xa490, 0x8888, 0x8888,
-  0xa994, 0x8888, 0x4c95, 0x8888, 0x5ee1, 0xaa97, 0x6c8c, 0x5fe1, 0x8888, 0x5de1, 0xd494, 0x60e1, 0x8888, 0x61e1, 0x8888, 0x6ffb,
-  0xd988, 0x8888, 0x8888, 0xf48f, 0x66e1, 0x8888, 0x63e1, 0xeb93, 0x62e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x458b,
-  0x8888, 0x8888, 0x69e1, 0x8888, 0x8888, 0x8888, 0x64e1, 0x65e1, 0x8888, 0x68e1, 0x67e1, 0x4495, 0x8888, 0x8888, 0x6191, 0x6091,
-  0x8888, 0x5e8b, 0x8888, 0x8888, 0x6ae1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6be1, 0x8888, 0x8888, 0x6ce1, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x6ee1, 0x8888, 0x6de1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7589, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x76e1, 0xe694, 0x70e1, 0x8888, 0x72e1, 0x8888, 0x8888, 0x74e1, 0x5d90, 0x8888, 0x8888, 0x75e1, 0x73e1, 0xbe8e, 0x8888,
-  0x8888, 0x8888, 0x6fe1, 0x71e1, 0x8888, 0x6195, 0x8888, 0xc78f, 0x8888, 0x8888, 0x78e1, 0x8888, 0x8888, 0x77e1, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x79e1, 0x8888, 0xa48e, 0xad8d, 0x8888, 0x8888, 0x9793, 0x7ae1, 0x8888, 0xc992, 0x8888, 0x8888, 0x7ce1, 0x8888,
-  0x8888, 0x8888, 0x9f97, 0x7be1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8991, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x82e1, 0x8888, 0x84e1, 0x85e1, 0x7392, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x83e1, 0x8888, 0x80e1, 0x8888, 0x7de1, 0x7ee1,
-  0x8888, 0x81e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x88e1, 0x8888, 0x86e1, 0x8888, 0x87e1, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x89e1,
-  0x8be1, 0x8ce1, 0x8de1, 0x8888, 0x8ee1, 0x8888, 0x8888, 0x8ae1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x90e1, 0x8888, 0x8888, 0x8888, 0x8fe1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x91e1, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xc397, 0x8888, 0x8888, 0x8888, 0x94e1, 0x92e1, 0x93e1, 0x8888, 0x8888, 0x8888, 0xe08a, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xfc96, 0x8888, 0x8888, 0x8888, 0xc895, 0x8888, 0x96e1, 0x8888, 0x8888, 0x8888, 0x95e1, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x97e1, 0x98e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x9ce1, 0x99e1, 0x9ae1, 0x9be1, 0x8888, 0x9de1, 0x8888, 0x8888, 0x8888,
-  0x9ee1, 0x8888, 0x9fe1, 0x8888, 0x8888, 0x8888, 0xa0e1, 0x8888, 0xa1e1, 0x8888, 0xad94, 0x6f93, 0xa2e1, 0x9294, 0x5395, 0x8888,
-  0xa3e1, 0x8888, 0x70fb, 0xa4e1, 0x4993, 0x8888, 0x468a, 0x638d, 0xa5e1, 0x8888, 0x8888, 0xa6e1, 0x8888, 0x8888, 0xa7e1, 0x8888,
-  0x488e, 0x8888, 0x8888, 0xa9e1, 0x8888, 0x8888, 0xa8e1, 0x8888, 0x8888, 0xaae1, 0xabe1, 0x73fb, 0x71fb, 0x8888, 0x72fb, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x74fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe794, 0x8888,
-  0xace1, 0x8888, 0x8888, 0x8888, 0xade1, 0x8888, 0x8888, 0x89ea, 0xaee1, 0xafe1, 0xb0e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x4d8e,
-  0x8888, 0x8888, 0xb1e1, 0x7594, 0x8888, 0x8888, 0x7e96, 0x8888, 0x6d89, 0x8888, 0x7689, 0x8888, 0x8888, 0xb2e1, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xb4e1, 0x8888, 0x8888, 0x8888, 0xb3e1, 0x9093, 0x8888, 0x8888, 0x8888, 0xb790, 0x589f, 0x8888, 0xb5e1, 0xbf96,
-  0x8888, 0xb6e1, 0x8888, 0xc48a, 0xd594, 0xb7e1, 0x8888, 0xb8e1, 0x8888, 0x8888, 0xb9e1, 0x8888, 0x8888, 0x8888, 0xda96, 0x8888,
-  0x8888, 0x8888, 0xd396, 0x8888, 0xbc92, 0x8888, 0x8888, 0x8888, 0x8a91, 0x8888, 0x8888, 0xbbe1, 0x8888, 0x8888, 0x828f, 0x8888,
-  0x8888, 0xc88f, 0x8888, 0x8888, 0xbee1, 0x8888, 0x8888, 0xbde1, 0xbce1, 0xfb94, 0x8888, 0xc58a, 0xa78c, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc4e1, 0x8888, 0x8888, 0xc1e1, 0x5e90,
-  0xb096, 0x8888, 0x8888, 0x8888, 0xc0e1, 0xc2e1, 0xc3e1, 0x8888, 0x8888, 0xbfe1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc5e1, 0xc6e1, 0x8888, 0xad92, 0x8888, 0xe18a, 0x8888, 0x8888, 0x8888,
-  0x8592, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x76fb, 0xc7e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc8e1, 0xcbe1, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8790, 0x8888, 0xc293, 0x8888, 0xcce1, 0x7296, 0x8888, 0xc9e1, 0x8888, 0x8888, 0xcae1, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcfe1, 0x8888, 0x8888, 0x8888, 0x8888, 0xcee1, 0xcde1,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd1e1, 0x8888, 0x8888, 0xd0e1, 0x8888,
-  0x8888, 0xd2e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd4e1, 0x8888,
-  0xd3e1, 0x8888, 0x8888, 0x8888, 0x8888, 0xcb95, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x758f, 0xc497, 0x8888, 0x8888,
-  0xd5e1, 0x8888, 0x8888, 0xb593, 0x8888, 0x8888, 0xd6e1, 0x8888, 0x8888, 0xd7e1, 0x8888, 0xdbe1, 0xd9e1, 0xdae1, 0x8888, 0xd8e1,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdce1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdde1, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdee1, 0x8888, 0x8888, 0xdfe1, 0xb596, 0xe0e1, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xee96, 0xe1e1, 0x8888, 0x6d92, 0x8888, 0x8a94, 0x8888, 0xe98b, 0x8888, 0x8888, 0x8888, 0x5a92, 0xe2e1, 0xb88b,
-  0x8888, 0x8888, 0x8888, 0xce90, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe3e1, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xbb8d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe4e1, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xe5e1, 0x8888, 0xa48c, 0xd38d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xe7e1, 0x78fb, 0x8888, 0x8888, 0x8888, 0x7593, 0xd48d, 0x6d8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x4396, 0x8888, 0x6a94, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7693, 0x8888, 0x8888, 0x8888, 0x8888, 0x7b8d,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe9e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x79fb, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc98f, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x7afb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb097, 0x648d, 0x8888, 0x8888, 0xa58c,
-  0x8888, 0x8888, 0xa194, 0x8888, 0xebe1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7bfb, 0x8888, 0xede1, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xe98c, 0x8888, 0x8888, 0x8888, 0x8888, 0xece1, 0xf492, 0x8888, 0x8888, 0x8888, 0x8888, 0xefe1, 0x568a, 0xeae1, 0x8888,
-  0x8888, 0xe894, 0x8888, 0x4f89, 0x8888, 0xea8d, 0x8888, 0x7198, 0x8888, 0x8888, 0xeee1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xf0e1, 0x8888, 0x8888, 0x8888, 0xc995, 0x8888, 0xd790, 0xf2e1, 0x8888, 0x8888, 0x8888, 0x8888, 0xf3e1,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf1e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x6d8a, 0x8888, 0xf9e1, 0x8888, 0xf8e1, 0x8888,
-  0x8888, 0xa58e, 0x8888, 0x8888, 0x8888, 0xfae1, 0xf5e1, 0x8888, 0x8888, 0x8888, 0xfbe1, 0xf6e1, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xd694, 0xf4e1, 0x8888, 0x8888, 0xf7e1, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x41e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x40e2, 0x8196, 0x8888, 0x8888, 0x8888, 0xfce1, 0x8888, 0x8888, 0xe988,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x43e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x42e2, 0x8888, 0x8888,
-  0x8888, 0xca8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x44e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6291, 0x8888,
-  0x8888, 0x46e2, 0x45e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x47e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe6e1, 0x8888, 0x8888, 0x8888, 0xe8e1, 0x49e2, 0x48e2, 0x8888, 0x8888, 0x8888,
-  0x7cfb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa68e, 0x8888, 0xe797, 0x8888, 0xd08e, 0x8888,
-  0x4ae2, 0x568c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5f8b, 0x468b, 0x838e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x5397, 0x8888, 0x8888, 0x50e2, 0x8888, 0x4fe2, 0x6391, 0x4ce2, 0x8888, 0x8888, 0x4ee2, 0x8888, 0x8888, 0x6a8f, 0x5f90, 0x4de2,
-  0x4be2, 0x8888, 0x4994, 0x8888, 0x8888, 0xcb8f, 0x8888, 0x8888, 0x5b95, 0x8888, 0x8888, 0x8888, 0x8888, 0xd58d, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9893, 0x8888, 0x8888, 0x51e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x52e2,
-  0x68e2, 0xd68b, 0x8888, 0x8888, 0x5c98, 0x5491, 0x8888, 0x8888, 0x8888, 0x8888, 0x53e2, 0x8888, 0x8888, 0xd089, 0xf592, 0x9f95,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x81fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x83fb, 0x8888, 0x54e2, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9a8b, 0x55e2, 0x8888, 0x8888, 0x57e2, 0x8888, 0x8888, 0x8888, 0x58e2, 0x8888,
-  0x4894, 0x8888, 0x8888, 0x59e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5ae2, 0x5be2, 0x8888, 0x8888, 0xd78b, 0xd189, 0xc393,
-  0x478f, 0x848e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5ce2, 0x8888, 0x488f, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xc889, 0x6295, 0x8888, 0x8888, 0x5de2, 0x8888, 0x8888, 0xe994, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6491,
-  0x8888, 0x60e2, 0x8888, 0x61e2, 0x8994, 0x8888, 0x6090, 0x5ee2, 0x8888, 0x8192, 0x8888, 0x8888, 0x5fe2, 0x8888, 0x8888, 0x8888,
-  0xcc8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xda88, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x488b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x62e2, 0x8888, 0x8888, 0xf692, 0x8888, 0x63e2, 0xc590, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xab96, 0x8888, 0x8888, 0x4295, 0x64e2, 0x65e2, 0x7492, 0x8888, 0xc597, 0x8888, 0x8888, 0x67e2,
-  0x66e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xed8e, 0x8888,
-  0x8888, 0x69e2, 0xee88, 0x8888, 0x8888, 0x8888, 0x8888, 0x6ce2, 0x8888, 0x8888, 0x8888, 0x6ae2, 0xd289, 0x6d8c, 0x6be2, 0x658d,
-  0x928d, 0x8888, 0xe495, 0x6de2, 0x8888, 0x8888, 0x7396, 0x8888, 0x8888, 0x6fe2, 0x8888, 0x8888, 0x8888, 0xcf90, 0x6e89, 0xb889,
-  0xaa88, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6ee2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x70e2, 0x71e2, 0xf58f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x72e2, 0x8888, 0x6e8a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x74e2, 0x8888, 0x8888, 0x8888, 0x8a8c, 0x8888, 0x868b, 0x8888, 0x8888, 0x75e2, 0xf38b, 0x8888, 0x8888, 0x76e2, 0x8888, 0xfa90,
-  0x8888, 0xcb93, 0x8888, 0xde90, 0xf38d, 0x8888, 0x8888, 0x8888, 0x77e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8292, 0x8b91, 0x8888, 0x79e2, 0x7be2, 0x78e2, 0x7ae2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x418c,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7ce2, 0x458c, 0x8888, 0x8888, 0x8888, 0x878b, 0x7197,
-  0x7ee2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x80e2, 0x8888, 0x8888, 0x8888, 0x4d89, 0x8888, 0x8888, 0x8888, 0x8888, 0x83e2,
-  0x8888, 0x8888, 0x8888, 0x968a, 0x82e2, 0x81e2, 0x8888, 0x85e2, 0x7de2, 0x8888, 0x86e2, 0xa797, 0x8888, 0x87e2, 0x8888, 0x88e2,
-  0x8888, 0x84fb, 0xf29a, 0x8ae2, 0x8888, 0x89e2, 0x8888, 0x8888, 0x8888, 0x8be2, 0x8ce2, 0x8888, 0xb397, 0x8de2, 0x8888, 0xede8,
-  0xcd8f, 0x8ee2, 0x8fe2, 0x768f, 0x8888, 0xb693, 0x90e2, 0x85fb, 0x8888, 0x8888, 0x4792, 0x87fb, 0x8888, 0x91e2, 0x8888, 0x5b92,
-  0x92e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa38b, 0x8888, 0x5e99, 0x7c92, 0xb18e, 0x8888, 0x8888, 0x8888, 0x8888, 0xc68a,
-  0x8888, 0x8888, 0x93e2, 0x8888, 0xa0e2, 0x8888, 0x96e2, 0x8888, 0x888b, 0x8888, 0x95e2, 0xa2e2, 0x8888, 0x8888, 0x8888, 0x94e2,
-  0x8888, 0xce8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x98e2, 0x99e2, 0x8888, 0x4a93, 0x8888, 0x8888, 0x9ae2, 0x8888,
-  0x7d8a, 0x8888, 0x8888, 0x8888, 0x8888, 0x7990, 0x8495, 0x8888, 0x9ce2, 0x8888, 0x8888, 0x8888, 0xe691, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x97e2, 0x8888, 0x9be2, 0x9de2, 0x8888, 0x8888, 0xf98d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa4e2, 0x4d95, 0x8888, 0xa494, 0x9993, 0x8888, 0xd88b, 0xa3e2, 0xa1e2, 0x8888, 0xb394,
-  0x9ee2, 0x7d92, 0x9b93, 0x8888, 0x9a93, 0x8888, 0xf48d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb6e2, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa6e2, 0x8888, 0xa8e2, 0x8888, 0x8888, 0x8888, 0x8888, 0xabe2, 0x8888, 0xace2, 0x8888,
-  0xa9e2, 0xaae2, 0x8888, 0x8888, 0xa7e2, 0xa5e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x9fe2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcd95, 0xd389, 0x8888, 0x8888, 0x8888, 0xb3e2, 0x8888, 0xb0e2, 0x8888, 0xb5e2,
-  0x8888, 0x8888, 0xb4e2, 0x8888, 0x9394, 0xa596, 0x8888, 0x5a8e, 0xaee2, 0xb7e2, 0xb2e2, 0x8888, 0xb1e2, 0xade2, 0x88fb, 0xafe2,
-  0x8888, 0xc78a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5c92, 0x8888, 0x8888, 0xfb90, 0x8888, 0x8888,
-  0x8888, 0xa094, 0x8888, 0x8888, 0xbce2, 0x8888, 0x8888, 0x8888, 0xa294, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xdf90, 0xb9e2, 0x8888, 0x8888, 0xcd94, 0x8888, 0xbde2, 0xd195, 0x8888, 0x7a92, 0x8888, 0xb8e2, 0xbae2, 0x8888, 0x8888, 0xbbe2,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbee2, 0x8888, 0x8888,
-  0xc28e, 0x8888, 0x8888, 0x8888, 0xc493, 0xc3e2, 0xc2e2, 0x8888, 0x8888, 0xbfe2, 0x8888, 0x8888, 0x8888, 0x5598, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xc8e2, 0x8888, 0x8888, 0xcce2, 0xc9e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xc5e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc6e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcbe2, 0x8888, 0x8888,
-  0x8888, 0xc0e2, 0xd399, 0xc7e2, 0xc1e2, 0x8888, 0x8888, 0xcae2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd0e2,
-  0x8888, 0xc88a, 0x8888, 0xcde2, 0x8888, 0x8888, 0x8888, 0xcee2, 0x8888, 0x8888, 0xcfe2, 0xd2e2, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd1e2, 0xf494, 0x8888, 0x8888, 0x8888, 0x8888, 0xd3e2, 0xfa97, 0xeb95,
-  0xd8e2, 0x8888, 0x8888, 0xd5e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd4e2, 0xd090, 0x8888, 0xd7e2,
-  0xd9e2, 0x8888, 0x8888, 0x8888, 0xd6e2, 0x8888, 0xdde2, 0x8888, 0xdae2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdbe2,
-  0xc4e2, 0x8888, 0x8888, 0x8888, 0xdce2, 0xdee2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdfe2, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xc495, 0x8888, 0xe0e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe096, 0x8888,
-  0x8888, 0xcc8b, 0x488c, 0xe1e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb295, 0x8888, 0x8890, 0x8888, 0xae96, 0x8888, 0x8888,
-  0xe2e2, 0x8888, 0xb197, 0x8888, 0x8888, 0x9494, 0x8888, 0x6591, 0x5394, 0x8888, 0x8888, 0x6c8f, 0x8888, 0x8888, 0x8888, 0xbe88,
-  0x8888, 0xe7e2, 0xe5e2, 0x8888, 0xe3e2, 0x9f8a, 0x8888, 0xcf8f, 0xe8e2, 0x8888, 0x8888, 0xe6e2, 0x8888, 0xe4e2, 0xece2, 0x8888,
-  0x8888, 0xebe2, 0xeae2, 0xe9e2, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xede2, 0x8888, 0x8888, 0x8888, 0xeee2, 0xb890, 0x8888,
-  0xefe2, 0x8888, 0xf1e2, 0x8888, 0x8888, 0xf0e2, 0x8888, 0x8888, 0x8888, 0x8888, 0xd08c, 0x8888, 0x8888, 0x8888, 0x5791, 0x8888,
-  0x8888, 0x8888, 0xf3e2, 0x8888, 0x8888, 0x8888, 0x9c93, 0x8888, 0xf2e2, 0x8888, 0x8888, 0x8888, 0xf4e2, 0x8888, 0xb395, 0x8c91,
-  0x668d, 0x8888, 0xf5e2, 0x8888, 0x8888, 0x8888, 0x8888, 0xc697, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf7e2,
-  0x8888, 0x8888, 0xf8e2, 0x8888, 0xf9e2, 0x8888, 0xfae2, 0x8888, 0x858e, 0x8888, 0xfbe2, 0x6e8c, 0x8888, 0x8888, 0x8a8b, 0x8888,
-  0x498b, 0x8888, 0x40e3, 0x8888, 0xf196, 0x678d, 0xfce2, 0x8888, 0x8888, 0x8888, 0x43e3, 0xe496, 0x8888, 0x5b94, 0x8888, 0x8888,
-  0x5295, 0x8888, 0x8888, 0x8888, 0x838f, 0x42e3, 0x8888, 0xd18e, 0x688d, 0x868e, 0x898b, 0xb495, 0x41e3, 0x8888, 0x8888, 0x8888,
-  0x6691, 0x6196, 0xf58d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x878e, 0xdb92, 0x8888, 0x46e3, 0xdd97,
-  0xd78d, 0x8888, 0x47e3, 0x6190, 0x8888, 0x49e3, 0x8888, 0x8888, 0x8888, 0xd08f, 0xae8d, 0x8888, 0x8888, 0x8888, 0x8888, 0x48e3,
-  0x8888, 0x8888, 0x498f, 0xbc8c, 0x6791, 0x44e3, 0x4ae3, 0x8888, 0x8afb, 0x8888, 0x8888, 0x45e3, 0x6f8c, 0x8888, 0x4de3, 0x51e3,
-  0x8b8c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4ce3, 0x8888, 0x8888, 0x8888, 0x8888, 0x55e3, 0x8bfb, 0x8888, 0x698d, 0x8888,
-  0x8888, 0x8d97, 0xba88, 0x52e3, 0x8888, 0x8888, 0x8b8b, 0x8888, 0x4fe3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x50e3, 0x8888,
-  0x8888, 0x9d93, 0x4ee3, 0x4be3, 0x8888, 0x478a, 0xe290, 0x8888, 0x8888, 0xa68c, 0x8888, 0x8888, 0x8888, 0x57e3, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x54e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x56e3,
-  0x8888, 0x8888, 0x8888, 0x53e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x708c, 0xb191, 0x58e3, 0x8e91, 0x8888, 0x8888, 0x65e3,
-  0x8dfb, 0x8888, 0x61e3, 0x5be3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5fe3, 0xf88e, 0xdb88, 0x5ae3, 0x62e3,
-  0x66e3, 0x6a8d, 0xd496, 0x8888, 0xd492, 0x5ce3, 0x8888, 0x8cfb, 0x64e3, 0x8888, 0x59e3, 0x5d92, 0x8888, 0x5ee3, 0xbb88, 0xc896,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5de3, 0x8888, 0x8888, 0xd98b, 0xea94, 0x8888, 0x8888, 0x8888, 0x8d91,
-  0x8888, 0xce97, 0x8f8f, 0x8888, 0x8888, 0x8ee3, 0x8efb, 0x8888, 0x67e3, 0x8888, 0xfc90, 0x8888, 0x63e3, 0x68e3, 0x6ae3, 0x8888,
-  0xf792, 0x6de3, 0x8888, 0x8888, 0x69e3, 0x8888, 0x8888, 0x8888, 0xd295, 0xc98a, 0x8888, 0x8888, 0xc996, 0x8888, 0x8888, 0xdc88,
-  0x8888, 0x8888, 0x6ce3, 0x8888, 0xfb97, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6be3, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8f89, 0x8888, 0x8888, 0xea93, 0x6ee3, 0x8888, 0x8888, 0x8888, 0x75e3, 0x6fe3, 0x76e3, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x72e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9b94, 0x8888, 0x8888, 0xc88e, 0x74e3,
-  0x8888, 0x71e3, 0x77e3, 0x70e3, 0x8888, 0x8888, 0x638f, 0x8888, 0x8888, 0x8888, 0x8888, 0x4496, 0x8888, 0x8888, 0x6b8f, 0x8888,
-  0x8888, 0x73e3, 0x80e3, 0x8888, 0x8888, 0x7be3, 0x8888, 0x7ee3, 0x8888, 0x7ce3, 0x81e3, 0x7ae3, 0x8888, 0x60e3, 0xd190, 0x8888,
-  0x8888, 0xc994, 0x8888, 0x7de3, 0x8888, 0x8888, 0x78e3, 0x8888, 0x8888, 0x8888, 0x4091, 0x718c, 0x8888, 0x4a8f, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8ffb, 0x8888, 0x4490, 0x5591, 0x84e3, 0x8888, 0x8888, 0x86e3, 0x87e3, 0x8888, 0x8888, 0x83e3, 0x85e3, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x79e3, 0x82e3, 0x8888, 0x8ae3, 0x89e3, 0x8888, 0x8888, 0x9a96, 0x8888, 0x8888,
-  0x4a8c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x88e3, 0x8888, 0x8ce3, 0x8be3, 0x8fe3, 0x8888, 0x91e3,
-  0x8888, 0x8888, 0x5b8e, 0x8de3, 0x8888, 0x8888, 0x8888, 0x8888, 0x92e3, 0x93e3, 0x5cfa, 0x8888, 0x94e3, 0x8888, 0x9ae3, 0x5a93,
-  0x96e3, 0x8888, 0x95e3, 0x97e3, 0x98e3, 0x8888, 0x99e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x9be3, 0x9ce3, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xca8a, 0x8888, 0x9de3, 0x8888, 0x9ee3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9fe3, 0x8888, 0x90fb, 0x8888, 0x8888, 0x8888, 0x8888, 0xa0e3, 0xa1e3, 0xa2e3, 0x8888,
-  0xa3e3, 0xa4e3, 0x8888, 0x8888, 0xa6e3, 0xa5e3, 0x8888, 0x8888, 0xa7e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa8e3,
-  0xa9e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xace3, 0xaae3, 0xabe3, 0xdf8d, 0x728c, 0x8888, 0x8888, 0x7592, 0x8888,
-  0xb194, 0x8888, 0x908f, 0x8888, 0x8888, 0x6c94, 0x8888, 0xeb94, 0xade3, 0xeb9c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xaee3, 0xb0e3, 0x8888, 0x8597, 0xafe3, 0xb2e3, 0xb1e3, 0x8888, 0x7297, 0x8888, 0xb3e3, 0x8888, 0xfc94, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xb4e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb7e3, 0x8888, 0x8888, 0xb6e3, 0xb5e3, 0x8888,
-  0x8888, 0x91fb, 0x8888, 0xb8e3, 0x518c, 0x8888, 0x8888, 0x8888, 0x4191, 0x608b, 0x8888, 0x8888, 0x8888, 0x8888, 0xbce3, 0xb9e3,
-  0x8888, 0x8888, 0xbae3, 0x8888, 0x8888, 0x8888, 0xbde3, 0x8888, 0xbee3, 0xbbe3, 0x8888, 0x8888, 0x8888, 0x4889, 0x8888, 0x8888,
-  0x8888, 0xa589, 0x8888, 0x8888, 0x8888, 0xc0e3, 0xc1e3, 0x8888, 0x8888, 0x8888, 0xc2e3, 0x8888, 0x8297, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x4b8f, 0x8888, 0xc4e3, 0xc3e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8990, 0xc5e3, 0x8888, 0x8888, 0x8888, 0x8888, 0xc6e3, 0x8888, 0x8888, 0xc7e3, 0x8888, 0xe38a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xcb8a, 0x8888, 0x8888, 0xc8e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc9e3, 0x8888, 0x7c96, 0x8397, 0x8888, 0x8888, 0x8888,
-  0x7397, 0x5698, 0x8888, 0x6c8d, 0xcce3, 0xd28e, 0xcbe3, 0x8888, 0x8888, 0x8888, 0x8888, 0xcde3, 0xa78e, 0x8888, 0x8888, 0x8888,
-  0xcf91, 0x8888, 0xcee3, 0x8888, 0x8888, 0x6b8d, 0x8888, 0xd596, 0xcfe3, 0xd0e3, 0x8888, 0x8888, 0xd1e3, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xd2e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd3e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xa88e, 0x8888, 0x8888, 0xeb96, 0x8888, 0x8888, 0x8888, 0x8888, 0xd5e3, 0x8888, 0x5e92, 0x8888, 0xd4e3,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd7e3, 0x8888, 0x8888, 0x8888, 0xd6e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xd8e3, 0x8888, 0x8888, 0x8888, 0xb990, 0x8888, 0xd9e3, 0x8888, 0xdae3, 0x8888, 0x8888, 0x8888, 0xb795, 0xdbe3,
-  0x8888, 0x8f91, 0xdce3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdde3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xfc97,
-  0xe0e3, 0x8888, 0xdfe3, 0xdee3, 0xae92, 0x8888, 0xe1e3, 0x4590, 0x8888, 0xe2e3, 0x8888, 0x8888, 0x8888, 0xe3e3, 0x5798, 0xe4e3,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xe5e3, 0xe7e3, 0xe6e3, 0xa394, 0x8888, 0xf793, 0x8888, 0x5d98, 0xa794, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xe9e3, 0x8888, 0x8888, 0xd18f, 0x8888, 0x4995, 0x8888, 0xeae3, 0xe8e3, 0x8888, 0xcc8a, 0x8888, 0x8888,
-  0x8888, 0xd28c, 0x888e, 0x8888, 0x8888, 0xec94, 0x8888, 0x8888, 0x8888, 0xa88c, 0x6296, 0x8888, 0xede3, 0xebe3, 0x8888, 0x6d8d,
-  0x8888, 0x6e8d, 0xe788, 0x8888, 0xe68d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7894, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xdd88, 0xf2e3, 0x8888, 0x5f92, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7794, 0x8888, 0xd991, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf4e3, 0x8888, 0x8888, 0xf0e3, 0xf3e3, 0xeee3, 0x8888, 0xf1e3, 0x4596, 0x8888,
-  0x8888, 0xd38c, 0x8888, 0x8888, 0xfb88, 0xefe3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf6e3,
-  0x8888, 0xf7e3, 0x8888, 0x8888, 0xb793, 0x8888, 0x8888, 0x8888, 0xb98b, 0x8888, 0x8888, 0x8888, 0x45e4, 0x5c94, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x898e, 0x8888, 0x8888, 0xba8b, 0xc690, 0x6598, 0xac96, 0xf5e3, 0xd290, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x728b, 0xf8e3, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xfae3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf9e3, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xfbe3,
-  0x8888, 0x4592, 0x8888, 0x5d94, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xaf92, 0x8888, 0x8888, 0x8888, 0x8888, 0x42e4, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x41e4, 0x8888, 0x8888, 0x8888, 0x8888, 0xfce3, 0x8888, 0x8888, 0x7490, 0x8888,
-  0x8595, 0x44e4, 0x8888, 0x43e4, 0x6f8d, 0x7298, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x54e4,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x48e4, 0x49e4, 0x8888, 0x8888, 0x8888, 0x8888, 0xee8e, 0x8888, 0x8888, 0x47e4, 0x8888,
-  0x988d, 0x46e4, 0x8888, 0x8888, 0x4ae4, 0x8888, 0x8888, 0x8888, 0xb092, 0xa095, 0x4291, 0x8888, 0x8888, 0x8888, 0x8888, 0xda91,
-  0x4ee4, 0x8888, 0x4fe4, 0x4be4, 0x8888, 0x8888, 0x8888, 0x8888, 0x4ce4, 0x8888, 0x4de4, 0x8888, 0x8888, 0x8888, 0x8888, 0x708d,
-  0x8888, 0x8888, 0x8888, 0x55e4, 0x8888, 0x51e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8695, 0x8888, 0x8c96, 0x4795, 0x8888, 0x8888,
-  0x50e4, 0x8888, 0x8888, 0x53e4, 0x52e4, 0x8888, 0x8888, 0x8888, 0x6396, 0x56e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x57e4, 0x8888, 0x8888, 0x5691, 0x8888, 0x58e4, 0x8888, 0x8888, 0x5ae4, 0x8888, 0x5ee4, 0x8888, 0x8888, 0x5be4, 0x59e4, 0x5e94,
-  0x5ce4, 0x8888, 0x5de4, 0x8888, 0x8888, 0x8888, 0xb089, 0x8888, 0x64e4, 0x5fe4, 0x8888, 0x8888, 0x8888, 0x60e4, 0x8888, 0x8888,
-  0x8888, 0x61e4, 0x8888, 0x9f91, 0x8888, 0x8888, 0x8888, 0x8888, 0x63e4, 0x62e4, 0x65e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x66e4,
-  0x67e4, 0x8888, 0x8888, 0x6290, 0x8888, 0xe789, 0x8888, 0x68e4, 0xd597, 0x8888, 0xa98e, 0x8888, 0x8888, 0x4c8f, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8a8e, 0x7692, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x69e4, 0x6ae4, 0x5089, 0x8888, 0x6be4, 0x8888,
-  0x8888, 0x6ce4, 0x6de4, 0x8888, 0x8888, 0x6ee4, 0x8888, 0x6fe4, 0xbb8b, 0xa89d, 0x70e4, 0x8888, 0xe390, 0x71e4, 0xc98e, 0x8888,
-  0x72e4, 0x8888, 0xae98, 0x8888, 0x8888, 0x8888, 0x73e4, 0xdc95, 0xda8a, 0x8888, 0x8888, 0x4391, 0x778f, 0x8888, 0x9195, 0x4d8f,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x74e4, 0x718d, 0x75e4, 0xca94, 0x8888, 0x84e4, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x77e4, 0x8888, 0xc791, 0x9594, 0xbd8c, 0x76e4, 0x4491, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x78e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf892, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7ae4, 0x79e4, 0x7ce4, 0x8888, 0x8888, 0x7be4, 0x8888, 0x7de4,
-  0x8888, 0x8888, 0x80e4, 0x8888, 0x7ee4, 0x8888, 0xcd8a, 0x8888, 0x81e4, 0x8888, 0x82e4, 0x83e4, 0x8888, 0x8888, 0xaf8d, 0xc797,
-  0x8888, 0x85e4, 0x4690, 0x8888, 0x8888, 0x8888, 0x9089, 0x86e4, 0x87e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x88e4, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf088, 0x8888, 0x89e4, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8ae4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8795, 0x8888, 0x8888, 0x8888, 0xc58e, 0x8888, 0x8ce4,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x488a, 0xb088, 0x8888, 0x8888, 0x8888, 0x8888, 0x8be4, 0x8ee4, 0x6d94, 0x8888, 0x6390,
-  0x8888, 0xd489, 0x8888, 0x4696, 0x8888, 0x8888, 0x8888, 0x8888, 0x7c8c, 0xda8b, 0x8888, 0x8de4, 0x8888, 0xe889, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa18a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x9189, 0x92e4, 0xe897, 0xdb91, 0x8888, 0x8888, 0x6395, 0x8888, 0x9ee4, 0x8888, 0xd589, 0x9ce4, 0x8888, 0x9ae4, 0x91e4,
-  0x8888, 0x8fe4, 0x8888, 0x90e4, 0x8888, 0xe18e, 0xea8b, 0x9792, 0x8888, 0x8888, 0x8888, 0xcf93, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x7089, 0x8888, 0x94e4, 0x93e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x99e4, 0x95e4, 0x98e4, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x93fb, 0xce96, 0x97e4, 0xd689, 0x9d8a, 0x9be4, 0x8888, 0x8888, 0x9de4, 0x8888, 0x8888, 0x8888, 0x8888, 0x738c, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa1e4, 0xaae4, 0xabe4, 0x8888, 0x8888, 0x8888, 0xa988, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xb2e4, 0x8888, 0x8888, 0x8888, 0x8888, 0xef88, 0x8888, 0x8888, 0xa9e4, 0x8888, 0x8888, 0x8888, 0xa8e4,
-  0x8888, 0xa3e4, 0xa2e4, 0x8888, 0xa0e4, 0x9fe4, 0x8392, 0x8888, 0xf991, 0xa5e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xa4e4, 0x8888, 0x8888, 0x8888, 0x8888, 0xa7e4, 0x8888, 0x8888, 0x8888, 0x9091, 0x748c, 0x8888, 0x8888, 0x8888, 0x8888, 0x6089,
-  0xa6e4, 0x8888, 0x728d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9191, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x94fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xb8e4, 0x8888, 0xb9e4, 0x8888, 0xd789, 0x8888, 0x8888, 0x8888, 0xac89, 0xb6e4, 0x8888, 0x8888, 0x95fb,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xace4, 0x8888, 0xb4e4, 0x8888, 0xbbe4, 0xb5e4, 0x8888, 0x8888, 0x8888, 0xb3e4, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x96e4, 0x8888, 0x8888, 0xb1e4, 0x8888, 0x8888, 0x8888, 0xade4, 0x8888, 0x8888, 0x8888, 0xce8a, 0xafe4,
-  0xbae4, 0x8888, 0xb0e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbce4, 0x8888, 0xaee4, 0x9c94, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8997, 0x8888, 0x8888, 0x8888, 0xb7e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcde4, 0x8888, 0x8888,
-  0x8888, 0xc5e4, 0x8888, 0x8888, 0x8888, 0x9b90, 0x8888, 0x96fb, 0x8888, 0x8888, 0x658b, 0x8888, 0xdb8b, 0x8888, 0xc0e4, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xd989, 0x8888, 0x8888, 0xd28f, 0x8888, 0xc3e4, 0x8888, 0x8888, 0x8888, 0xd88d, 0x8888, 0x8888, 0x7093,
-  0xc8e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xec95, 0x8888, 0xbfe4, 0x8888, 0x8888, 0x8888, 0xd889,
-  0xd48c, 0x4895, 0xc9e4, 0x8888, 0xbde4, 0x8888, 0x97fb, 0xc6e4, 0x8888, 0x8888, 0x8888, 0xd0e4, 0x8888, 0xc1e4, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xc2e4, 0xb893, 0x8888, 0x8888, 0xc7e4, 0x8888, 0x8888, 0x8888, 0xc4e4, 0x4796, 0xcae4, 0xde88, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xbee4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xcce4, 0x8888, 0xcbe4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8b94, 0xd2e4, 0x8888, 0xdde4, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x9e8a, 0x8888, 0x8888, 0x8888, 0xe0e4, 0x8888, 0x8888, 0xcee4, 0x8888, 0x8888, 0x8888, 0xd3e4, 0x8e97, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdce4, 0x8888, 0x98fb, 0x7497, 0x8888, 0x8888, 0x8888, 0x8888, 0xa897, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9892, 0x8888, 0x8888, 0x8888, 0x8b8a, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x9295, 0xe2e4, 0x9f93, 0x8888, 0x8888, 0xaf88, 0x8888, 0x8888, 0xdbe4, 0x8888, 0xd7e4, 0x9291, 0xd1e4, 0xd9e4, 0xdee4,
-  0x8888, 0x4b94, 0x8888, 0x8888, 0x8888, 0xa888, 0x8888, 0xd6e4, 0x8888, 0xdfe4, 0x9895, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xdae4, 0x8888, 0xd5e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd38f, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x4e8f, 0x8888, 0x8888, 0x8888, 0xaa8e, 0x8888, 0x8888, 0x8888, 0x8888, 0xd696, 0x8888, 0x8888, 0x6695, 0x8888, 0x8888, 0xe5e4,
-  0x8888, 0xeee4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd8e4, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x978a, 0x8888, 0x99fb, 0x8888, 0x8888, 0x8888, 0xf68f, 0xe3e4, 0x8888, 0xe8e4, 0x9391, 0x8888, 0x8888, 0xe4e4,
-  0x8888, 0xebe4, 0x8888, 0x8888, 0x7e92, 0x8888, 0xece4, 0x8888, 0x8888, 0x7597, 0xe1e4, 0x578a, 0x8888, 0xe7e4, 0x8888, 0x8888,
-  0xeae4, 0xaa96, 0x8888, 0x8888, 0x8888, 0x8888, 0xede4, 0x8888, 0x8888, 0xe6e4, 0xe9e4, 0x8888, 0x60fa, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4896, 0x8888, 0x4098, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xf1e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf8e4, 0x8888, 0x8888, 0xf0e4,
-  0xc18e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcfe4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xcc95, 0x8888, 0xa096, 0xf7e4, 0xf6e4, 0x8888, 0xf2e4, 0xf3e4, 0x8888, 0x5589, 0x8888, 0x8888, 0x8888, 0x8888, 0xf5e4,
-  0x8888, 0xefe4, 0x8888, 0x8888, 0x8888, 0x8888, 0xd392, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf4e4, 0xfc88, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa091, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc195, 0x8888, 0x8888,
-  0xf9e4, 0x40e5, 0x8888, 0xd794, 0x8888, 0x8888, 0x8888, 0x8888, 0xfce4, 0xd48f, 0xc78e, 0x42e5, 0x8888, 0x8888, 0xbc8b, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x9afb, 0x8888, 0x43e5, 0x8888, 0x9995, 0xfbe4, 0x9bfb, 0xd4e4, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xfae4, 0x8888, 0x8888, 0x8888, 0x8888, 0x6e98, 0xa093, 0x9395, 0x9cfb, 0x8888, 0x4ae5, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x50e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x51e5, 0x8888,
-  0x44e5, 0x8888, 0x8888, 0x8888, 0x9694, 0x8888, 0x8888, 0x4ee5, 0x46e5, 0x8888, 0x48e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x52e5, 0x47e5, 0x8888, 0x8888, 0x4be5, 0x8888, 0x8888, 0x9289, 0x8888, 0xe393, 0x8888, 0x4ce5, 0x4fe5, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x45e5, 0x8888, 0x4591, 0x8888, 0x49e5, 0x468e, 0x6490, 0x4f8c, 0xf296, 0x8888, 0xf796, 0x928f,
-  0x9efb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x56e5, 0x54e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x6d98, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x53e5, 0x8888, 0x8888, 0x8888, 0x9597, 0x8888, 0x55e5,
-  0x57e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x58e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5be5, 0x59e5, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xa193, 0x5ae5, 0x8888, 0x8888, 0x8888, 0xcb94, 0x4de5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x938f, 0x8888, 0x5ce5, 0x61e5, 0x9491, 0x8888, 0x8888, 0x60e5, 0x8888,
-  0x8888, 0x8888, 0x41e5, 0x8888, 0x8888, 0x8888, 0x62e5, 0x6891, 0x8888, 0x8888, 0x5de5, 0x5fe5, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x5ee5, 0x8888, 0x8888, 0x509f, 0x419f, 0x8888, 0x8888, 0x64e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x63e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9697, 0x8888, 0xbae1,
-  0x65e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x66e5,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x67e5, 0xd58c, 0x8888,
-  0x738b, 0x8888, 0x8888, 0x8888, 0x69e5, 0x7c99, 0x8888, 0x8888, 0x8888, 0x8888, 0x958b, 0x8888, 0xb897, 0x8888, 0xf18b, 0x6ae5,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6be5, 0x8888, 0x8888, 0x8888, 0x8e92, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x6ce5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf893, 0x8888, 0xb888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe189, 0x71e5, 0x72e5, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x6de5, 0x8888, 0x5c8e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x6ee5, 0x6194, 0x8888, 0x8888, 0x8888, 0x8888, 0x6fe5, 0x70e5, 0x7ae5, 0x8888, 0x8888, 0x8888, 0x74e5,
-  0x77e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x73e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x75e5, 0x8888, 0x76e5, 0xd68e, 0x8888, 0x78e5, 0x8888, 0x6092, 0x8888, 0x758c, 0x618a, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x7be5, 0x8888, 0x8888, 0x8888, 0x8888, 0x5e8a, 0x8888, 0x81e5, 0x8888, 0x8888, 0x7ce5, 0x80e5,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xb894, 0x8888, 0x8888, 0x8888, 0x8888, 0x7de5, 0x8888, 0x8888, 0x7ee5, 0x6795, 0xd894, 0x82e5,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xfb91, 0x8ce5, 0x8888, 0x88e5, 0x8888, 0x8888, 0xe989, 0x8888,
-  0x86e5, 0x8888, 0x4996, 0x87e5, 0x8888, 0x8888, 0x84e5, 0x8888, 0x85e5, 0x8ae5, 0x8de5, 0x8888, 0x8888, 0x8be5, 0x8888, 0x8888,
-  0x8888, 0x89e5, 0x83e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7792, 0x8888, 0x94e5, 0x8888, 0xa896, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x92e5, 0x8888, 0x8888, 0x8888, 0x93e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8ee5, 0x8888, 0x8888, 0x90e5, 0x8888, 0x8888, 0x8888, 0x91e5, 0x8888, 0x8888, 0x8888, 0x8fe5,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe490, 0x8888, 0x5898, 0x98e5, 0x8888, 0x99e5, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x9fe5, 0x8888, 0x4990, 0x8888, 0x9be5, 0x8888, 0x9ee5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x96e5,
-  0x95e5, 0x8888, 0x8888, 0xa0e5, 0x8888, 0x8888, 0xda89, 0x8888, 0x9ce5, 0x8888, 0xa1e5, 0x8888, 0x8888, 0x8888, 0x9de5, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x9ae5, 0x8888, 0xb192, 0x8888, 0x97e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8894,
-  0x8888, 0x8888, 0xa5e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5a97, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa4e5,
-  0x8888, 0x8888, 0xa3e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xace5, 0x8888, 0x8888, 0x8888, 0xa6e5,
-  0x8888, 0x8888, 0x8888, 0xaee5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8697, 0xb1e5, 0x8888, 0xa8e5, 0x8888, 0x8888,
-  0xa9e5, 0x8888, 0x8888, 0x8888, 0xade5, 0x8888, 0xb0e5, 0xafe5, 0x8888, 0x8888, 0x8888, 0xa7e5, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xaae5, 0x8888, 0xbbe5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xb4e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb2e5,
-  0x8888, 0x8888, 0xb3e5, 0x8888, 0x8888, 0x8888, 0xb8e5, 0xb9e5, 0x8888, 0x498a, 0x8888, 0x618b, 0x8888, 0x8888, 0xb7e5, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa2e5, 0x8888, 0xa1fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb6e5, 0xbae5, 0xb5e5,
-  0x8888, 0xbce5, 0x8888, 0x8888, 0x8888, 0xbee5, 0xbde5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xc0e5, 0xbfe5, 0x79e5, 0x8888, 0x8888, 0x8888, 0xc4e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xc1e5, 0x8888, 0x8888, 0x8888, 0x8888, 0xc2e5, 0x8888, 0x8888, 0xc3e5, 0x8888, 0xc5e5, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8c8c, 0x8888, 0xc7e5, 0x8888, 0xc6e5, 0x8888, 0x4f8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x738d, 0xa59f, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xc8e5, 0x708f, 0x8888, 0x8888, 0x8888, 0x588a, 0x8888, 0xc9e5, 0x8888, 0x7189, 0x8888, 0xd58f, 0xcae5, 0x8888,
-  0x8888, 0x748d, 0xcbe5, 0xdf88, 0x8888, 0x8888, 0x8888, 0x8888, 0x5c95, 0x8888, 0x8888, 0xcce5, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8a90, 0x8888, 0xd3e5, 0x8888, 0x8888, 0xd0e5, 0x8888, 0x8f92, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd1e5, 0xcee5, 0xdc8b,
-  0x8888, 0xcde5, 0xd4e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x558c, 0x8888, 0x8888, 0xdc91, 0x8888, 0xdae5, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xd6e5, 0x8888, 0x8888, 0x8888, 0xb391, 0xd5e5, 0x8888, 0xd8e5, 0x8888, 0x8888, 0x8888, 0x8888, 0xcfe5, 0x8888,
-  0x8888, 0x8888, 0xd9e5, 0x8888, 0xdbe5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xed94, 0x8888, 0x8888, 0xd7e5, 0x8888,
-  0xdce5, 0xdee5, 0x8888, 0x8888, 0xd18c, 0xd2e5, 0x8888, 0xbf88, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdde5,
-  0x8888, 0xd98d, 0xf497, 0xdfe5, 0xe0e5, 0x9591, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa097,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xe1e5, 0x5497, 0x8888, 0x8888, 0xe2e5, 0xe3e5, 0x8888, 0x8888, 0xe295, 0xe4e5, 0x8888, 0xbe8d,
-  0x8888, 0xa197, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe9e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xeae5, 0xd68f, 0xe8e5, 0xa2fb, 0x8888, 0x8888, 0x8797, 0xe5e5, 0x8888, 0x8888, 0xe7e5, 0xbb90, 0x9e90, 0x8888,
-  0x8888, 0x8888, 0xe6e5, 0x8888, 0xebe5, 0x8888, 0x8888, 0xa195, 0x8888, 0x8888, 0xede5, 0x8888, 0xece5, 0x8888, 0x8888, 0x8888,
-  0x8c8a, 0x8888, 0x4a96, 0xeee5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5dfa, 0xfae5, 0xf0e5, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf1e5, 0x8888, 0x8888, 0x8888, 0x8888, 0xf2e5, 0xf3e5, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf7e5, 0x8888, 0xf8e5, 0x8888, 0x8888, 0xf6e5, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xf4e5, 0x8888, 0xefe5, 0xf5e5, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf9e5, 0xb5e8, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa689, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xfce5, 0xdd8b,
-  0xfbe5, 0x8888, 0x8888, 0x8888, 0x41e6, 0x8888, 0x40e6, 0x8888, 0x8888, 0x8888, 0x43e6, 0x8888, 0x8888, 0x42e6, 0x8888, 0x44e6,
-  0x8888, 0x8888, 0x508f, 0x8888, 0x45e6, 0x8888, 0x8888, 0x46e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x47e6, 0xbc90,
-  0x8888, 0x7697, 0x8888, 0x48e6, 0x8888, 0x8888, 0xa295, 0x6594, 0x49e6, 0x8888, 0x4ae6, 0xa98c, 0x8888, 0x8888, 0x8888, 0x4b8b,
-  0x8888, 0x8888, 0x8888, 0x4be6, 0x8888, 0x8888, 0x8b8e, 0x6094, 0x4ce6, 0x8888, 0x6f8a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x4de6, 0x8888, 0x8888, 0x8888, 0x8888, 0x4fe6, 0x9797, 0x8888, 0x4ee6, 0x6590, 0x8888, 0x50e6, 0x8888, 0x8888, 0x51e6,
-  0x8888, 0x8888, 0x52e6, 0xcf8a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x53e6, 0x8888, 0x8888, 0x54e6, 0x8888, 0x55e6,
-  0x56e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x708a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x57e6, 0x8888, 0x58e6, 0x59e6, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xf089, 0x8888, 0x8888, 0x4790, 0x5ae6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x5be6, 0x8888, 0x8888, 0x8888, 0x5ce6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xbe8c, 0x8888, 0xf992, 0x5de6, 0x8888, 0x8888, 0x8888, 0x8888, 0x768c, 0x8888, 0x7590, 0x8888, 0x60e6, 0x8888, 0xa293, 0x8888,
-  0x5fe6, 0x8888, 0xa3fb, 0x508c, 0x8888, 0x8888, 0x5ee6, 0xf591, 0x4c8b, 0x8888, 0x8888, 0x61e6, 0x8888, 0x62e6, 0x8888, 0xd78f,
-  0x8888, 0x8888, 0x8888, 0x8d8c, 0x8888, 0x63e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x4b96, 0x8888, 0x8888, 0xdd90, 0x8888, 0x8888,
-  0x8888, 0x968b, 0x8888, 0xf396, 0x6991, 0x8888, 0x64e6, 0xa4fb, 0x8888, 0x8888, 0x6690, 0x9092, 0xd88f, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x65e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x68e6, 0x8888, 0x69e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xbc8d, 0xc091, 0x67e6, 0x8888, 0xd98f, 0x5d95, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x66e6, 0x8888, 0x8888, 0x8c8e, 0x8888,
-  0x7289, 0x8888, 0x6de6, 0x778c, 0x8888, 0x8888, 0x8e8e, 0x8888, 0x8888, 0x8d8e, 0x8888, 0x6c98, 0x6ce6, 0x6be6, 0x4691, 0x8888,
-  0x6c8b, 0x6298, 0x598a, 0xda8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa5fb, 0x8888, 0x8888, 0x6ae6, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x6fe6, 0x8888, 0x70e6, 0x6ee6, 0x8888, 0xd68c, 0x8888, 0x5f97, 0x8888, 0x8888, 0x8f8e, 0x4694, 0x8888, 0x8888,
-  0x8888, 0x73e6, 0x8888, 0xbe90, 0x8888, 0x6192, 0x8888, 0x8888, 0x5597, 0x8888, 0x76e6, 0x8888, 0x8888, 0x8888, 0xea8c, 0x8888,
-  0xbd90, 0x72e6, 0x8888, 0x77e6, 0xeb8c, 0x74e6, 0x75e6, 0xa6fb, 0x71e6, 0x8888, 0x8888, 0x8888, 0xe090, 0xc793, 0x8888, 0x8888,
-  0x4e92, 0x8888, 0xdb89, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xee94, 0x8888, 0x8888, 0x628b, 0x8888, 0xa7fb, 0xb292,
-  0x8888, 0x8888, 0x7ae6, 0x8888, 0x78e6, 0x8888, 0x8888, 0x6b92, 0x8888, 0x8888, 0x8888, 0xbf90, 0xd08a, 0x79e6, 0x8888, 0x7a90,
-  0x8888, 0x8888, 0xc897, 0x8888, 0x8888, 0x8888, 0x5f98, 0x8888, 0x8888, 0x8888, 0x7be6, 0x87e6, 0xb392, 0x8888, 0x86e6, 0xa8fb,
-  0x83e6, 0x8be6, 0x84e6, 0x8888, 0x80e6, 0x8888, 0xfa92, 0x7ee6, 0x8888, 0x8888, 0x8888, 0x7ce6, 0x8888, 0x4097, 0x908e, 0x8888,
-  0x8888, 0x81e6, 0x8888, 0x7de6, 0x8888, 0x8888, 0xaafb, 0x85e6, 0x948f, 0x8888, 0xbf8c, 0x8888, 0x8888, 0x8888, 0xf891, 0x8888,
-  0x6496, 0x7989, 0xe088, 0x8888, 0xa393, 0x8888, 0x8888, 0x89e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x88e6, 0x8888, 0xe493, 0x8888,
-  0x8de6, 0x8888, 0x8888, 0x8888, 0x82e6, 0x8888, 0x8ce6, 0x8ee6, 0x8888, 0xaa8c, 0x8ae6, 0x758d, 0x8888, 0xd38e, 0x8888, 0x8888,
-  0x8fe6, 0x7797, 0x8888, 0x8888, 0x8888, 0x8888, 0x92e6, 0x8888, 0x95e6, 0x8888, 0x8888, 0x93e6, 0x5495, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x90e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xde8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x94e6, 0x8888,
-  0x8888, 0x96e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9ae6, 0x8888, 0x8888, 0x97e6, 0x8888, 0x99e6, 0x98e6,
-  0x8888, 0x8888, 0x8888, 0xabfb, 0x8888, 0x8888, 0x9be6, 0x8888, 0xaf8e, 0x8888, 0x9de6, 0x9ce6, 0x8895, 0x8888, 0x8888, 0x9fe6,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x788c, 0x8888, 0x8888, 0x8888, 0x8888, 0x9ee6, 0xa0e6, 0x8888, 0x8888, 0xa1e6,
-  0x638b, 0xbfe3, 0xf78f, 0x8888, 0xa2e6, 0x8888, 0x8888, 0xec8c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa3e6, 0x8888, 0xacfb,
-  0xa4e6, 0x8888, 0x8888, 0x5d8e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcc9d, 0x8888, 0xa5e6, 0x8888, 0xa6e6, 0x8888,
-  0x518f, 0x8888, 0xa7e6, 0xa8e6, 0x8888, 0x8888, 0xa9e6, 0x8888, 0x8888, 0xaae6, 0xabe6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4a92, 0x8888, 0x8888, 0xace6, 0x8888, 0x8888, 0x8888, 0x8888, 0xaee6,
-  0x8888, 0xade6, 0x8888, 0x8888, 0x8888, 0x8888, 0xa493, 0x8888, 0xafe6, 0x8888, 0x4c96, 0x8888, 0xb0e6, 0x8888, 0xb1e6, 0x8888,
-  0xb2e6, 0x8888, 0x8888, 0x8888, 0x8888, 0xb3e6, 0x8888, 0x8888, 0x8888, 0x8888, 0xd893, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xdb8f, 0xb4e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8b8d, 0xac98, 0xb5e6, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb6e6, 0x5e95, 0xb7e6, 0x8888, 0xbfe6, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xb8e6, 0x8888, 0x8888, 0xbae6, 0x8888, 0x8888, 0x8888, 0xb9e6, 0xbbe6, 0x8888, 0x6596, 0xbce6, 0xbde6, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xbee6, 0x8888, 0x8888, 0x8888, 0xc0e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x4c8a, 0xe592, 0x8888,
-  0x8995, 0xe08d, 0x768d, 0x8888, 0x8888, 0x8888, 0x8888, 0x6e95, 0xdd89, 0xcc94, 0xc3e6, 0xd18a, 0xd390, 0xc2e6, 0xc7e6, 0x9992,
-  0xe196, 0x8888, 0xc5e6, 0xc6e6, 0x4d8b, 0x8888, 0xc8e6, 0x8394, 0xdd91, 0x8888, 0x8888, 0xef94, 0x5c93, 0xc4e6, 0x8888, 0x6696,
-  0xea89, 0xcae6, 0x4798, 0xc092, 0x6498, 0x8888, 0x8888, 0x918e, 0xc9e6, 0x8888, 0xaf91, 0x8888, 0x8888, 0xdae6, 0x4791, 0x8888,
-  0x8888, 0xf693, 0x8888, 0x6f95, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcde6, 0x5e8e, 0x928e, 0x8888, 0xdc8f, 0x8888,
-  0x8594, 0x8888, 0xab8c, 0xcce6, 0xcbe6, 0x8888, 0x8a95, 0x8888, 0x8888, 0x8888, 0xbf8e, 0x8888, 0x8888, 0x7193, 0x8888, 0x8888,
-  0xadfb, 0x8888, 0x8888, 0x8888, 0xaefb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcfe6, 0xd0e6, 0x778d, 0xcee6, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xd1e6, 0xd2e6, 0x8888, 0xd4e6, 0xa191, 0x8888, 0xd3e6, 0xe48a, 0x8888, 0xd6e6, 0x8888, 0xd5e6,
-  0xd7e6, 0x8888, 0xaffb, 0xd9e6, 0xdbe6, 0x8888, 0xdce6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xd490, 0x8888, 0xcd8e, 0xdde6, 0x8888, 0x8888, 0x8888, 0x718a, 0x8888, 0xdee6, 0x8888, 0x8888,
-  0x9691, 0xdfe6, 0x8888, 0xe0e6, 0x8b95, 0x8888, 0xb0fb, 0x4e8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xe1e6, 0x8888, 0x8888, 0x8888, 0xb492, 0x8888, 0x8888, 0x8888, 0x8888, 0x7a89, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe2e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xef8e, 0x8888, 0x8888, 0x8888, 0x8888, 0x9690, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xab91, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe5e6, 0x8888, 0x8888, 0x8888, 0xe4e6, 0x8888,
-  0x8888, 0x8888, 0xe3e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xebe6, 0xe9e6, 0x8888, 0x8888, 0xe6e6,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe8e6, 0x8888, 0x8888, 0x8888, 0xe7e6, 0xeae6, 0x8888, 0x978b, 0x8888, 0xeee6,
-  0x8888, 0xd590, 0x8888, 0xefe6, 0x8888, 0x8888, 0x8888, 0x8888, 0xd78c, 0x8888, 0xece6, 0xede6, 0x8888, 0x8888, 0x8888, 0x4898,
-  0x8888, 0x8888, 0x8888, 0xb592, 0x8888, 0x4891, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf0e6, 0x8888, 0x8888, 0xf3e6,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf1e6, 0xf2e6, 0x7897, 0x8888, 0x8888, 0x8888, 0x8888, 0xa593,
-  0xf6e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf4e6, 0xf5e6, 0xf7e6,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x48e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xfae6, 0x8888, 0x8888, 0x8888, 0xfbe6, 0xf9e6, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xf8e6, 0x8888, 0xfb92, 0x8888, 0x8888, 0x40e7, 0x44e7, 0x41e7, 0xfce6, 0x8888, 0x42e7, 0x8888, 0x8888, 0x8888,
-  0x43e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x4ae7, 0x8888, 0x8888, 0x8888, 0x45e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd690,
-  0x47e7, 0x8888, 0x8888, 0x49e7, 0x46e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x4ce7, 0x8888, 0x528f, 0x8888, 0x4be7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4de7, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x4ee7, 0x8888, 0x8888, 0x51e7, 0x50e7, 0x8888, 0x4fe7, 0x8888, 0x8888, 0x53e7, 0x52e7, 0x8888, 0xf496, 0x8888, 0x8888,
-  0x8888, 0x55e7, 0x8888, 0x54e7, 0x56e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x57e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x59e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x58e7, 0x6790, 0x5ae7, 0x8888, 0x8888, 0xeb8b,
-  0x5be7, 0x5de7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5ee7, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5fe7, 0x5ce7, 0x8888, 0x60e7, 0x8888, 0xd48e, 0x61e7, 0x4f8b, 0x528c, 0x8888, 0xb2fb,
-  0x8888, 0x8888, 0xac8c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x62e7, 0x8888, 0x8888, 0x8888, 0xee93,
-  0x8888, 0x8888, 0x5d93, 0x63e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x66e7, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb28e, 0x8888, 0x8888, 0x65e7, 0x64e7, 0x798c, 0x67e7, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x728a, 0x8888, 0x69e7, 0x8888, 0x8888, 0x8888, 0xda8d, 0x68e7, 0x8888, 0x71e7, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x6be7, 0x6de7, 0xe395, 0x6ae7, 0x8888, 0x8888, 0x8888, 0x6ce7, 0x8888, 0x70e7, 0x6ee7, 0x508b, 0x8888, 0x6fe7,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x72e7, 0x8888, 0x8888, 0x7994, 0xd697, 0x8888, 0x8888, 0x8888, 0x8888, 0x538f,
-  0x8888, 0x8888, 0x8888, 0x73e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x4197, 0x75e7, 0x8888, 0x74e7, 0x8888, 0x8888, 0x78e7, 0x6097,
-  0x8888, 0x8888, 0x77e7, 0x8888, 0x8d8a, 0x76e7, 0x7be7, 0x8888, 0x8888, 0x7ae7, 0x8888, 0x8888, 0x79e7, 0x5193, 0x7ce7, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7de7, 0x8888, 0x8888, 0x8888, 0x8888, 0x7ee7, 0x8888, 0x8888, 0x8c8d,
-  0x8888, 0x448c, 0x80e7, 0x81e7, 0x82e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6890, 0x83e7, 0x8888, 0xab8e, 0x84e7,
-  0x8888, 0x8888, 0x8888, 0x85e7, 0x8888, 0x8888, 0x8888, 0x9f99, 0x9e99, 0x8888, 0x8888, 0x8888, 0x8888, 0x86e7, 0x90e3, 0x87e7,
-  0x4392, 0x4a90, 0x5f94, 0x8888, 0x8888, 0x8888, 0x8888, 0x88e7, 0x8888, 0x8888, 0xd395, 0xd292, 0x9e8d, 0x8888, 0x8888, 0x4892,
-  0x8888, 0x8888, 0x4989, 0x8888, 0x9896, 0x7690, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7d8c, 0x8888,
-  0x8888, 0xdf8b, 0x8888, 0x8888, 0xd495, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x89e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8be7, 0x8888, 0x8888, 0x8ae7, 0xde89, 0x8888, 0x8888, 0xf493, 0x8ce7, 0x9794, 0x8888, 0x5293, 0x8888, 0x8de7,
-  0x718f, 0x8888, 0x8888, 0x8888, 0x8fe7, 0x8888, 0x8888, 0xc096, 0x9ee7, 0x91e7, 0x92e7, 0x8888, 0x8888, 0xc792, 0x8888, 0x8888,
-  0xde91, 0x9791, 0x8888, 0xa693, 0x8888, 0x90e7, 0x748b, 0x8888, 0x8888, 0x8888, 0x8888, 0x99e7, 0x8888, 0x96e7, 0xa3e7, 0xa793,
-  0x8092, 0x93e7, 0x8888, 0xfc92, 0x7293, 0x94e7, 0x98e7, 0x8090, 0x8888, 0x8794, 0xca92, 0x8888, 0x8888, 0xc090, 0x97e7, 0xac91,
-  0xa291, 0x95e7, 0xa788, 0x4198, 0x8888, 0x8888, 0x8888, 0x9ae7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdf91, 0x8888,
-  0x8888, 0x548f, 0x6990, 0x8888, 0x8888, 0x9ce7, 0x9be7, 0x8888, 0xed88, 0x9de7, 0x8888, 0x8888, 0x4e95, 0x8888, 0xa5e7, 0x8888,
-  0x8888, 0xd993, 0x8b90, 0x8888, 0x8888, 0x7892, 0x8888, 0xf68b, 0x8888, 0xa4e7, 0x5697, 0x5e89, 0x8888, 0xd595, 0xdf89, 0x9fe7,
-  0xa0e7, 0xa1e7, 0xa2e7, 0xb993, 0x4292, 0xe188, 0xa6e7, 0x8888, 0xa7e7, 0xa1ea, 0x8888, 0x8888, 0xbb91, 0x8888, 0xa8e7, 0x8888,
-  0x9389, 0x6b91, 0x8888, 0xad8c, 0x8888, 0x7997, 0x8888, 0xb5fb, 0xa9e7, 0x4b93, 0x8888, 0x8888, 0x8888, 0x9891, 0xd58e, 0xaae7,
-  0x8888, 0x8888, 0xade7, 0x8888, 0x8888, 0x858f, 0xabe7, 0x4a91, 0x4991, 0x8888, 0xe288, 0x8888, 0xc997, 0xafe7, 0x8888, 0xf094,
-  0xb1e7, 0xb0e7, 0xaee7, 0x84e2, 0xd28a, 0x8888, 0x8888, 0x8ee7, 0x8888, 0xb3e7, 0xb2e7, 0x8888, 0x8888, 0x8888, 0x8888, 0xb4e7,
-  0x8888, 0x5797, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xdf93, 0x8888, 0x8888, 0x4d96, 0x8888, 0xb5e7, 0x8888, 0xd78e, 0x8888, 0x8888, 0x8888, 0x8888, 0xb6e7,
-  0x8888, 0xb7e7, 0x8888, 0x8888, 0x8888, 0xb8e7, 0x8888, 0x8888, 0x4093, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xe888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x788d, 0x8888, 0x8888, 0x8888, 0x5998, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbce7, 0x8888, 0x8888, 0xb6fb, 0x8888,
-  0x8888, 0x538c, 0xb9e7, 0x8888, 0xbae7, 0x8888, 0x8888, 0x8888, 0x9495, 0x8888, 0x8888, 0x8888, 0x8888, 0x738a, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5897, 0x8888, 0xbd8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7393, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xbde7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xbee7, 0x8888, 0x8888, 0xb8fb, 0x8888, 0x8888, 0x8888, 0xbfe7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb9fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4193, 0x8888, 0x8888,
-  0xc1e7, 0x8888, 0xc0e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd193, 0xc2e7, 0x558f, 0xde8e, 0x7a94, 0x9192, 0x8888,
-  0x8888, 0x8888, 0xf08e, 0x8888, 0x8c90, 0x8888, 0xc3e7, 0x8888, 0xc4e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x7c90, 0xc5e7, 0x8888, 0xc6e7, 0x8888, 0x8888, 0x8888, 0xc7e7, 0x8f97, 0x8888, 0x568f, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xc9e7, 0xc8e7, 0x8888, 0x798d, 0x8888, 0x938d, 0x5f8e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xcce7, 0x8888, 0x8888, 0x8888, 0x8888, 0x868f, 0x8888, 0xcbe7, 0x8888, 0xcae7, 0x8888, 0xe791, 0x8888, 0x8888,
-  0xed8c, 0x8888, 0xc190, 0x8888, 0x8888, 0x8888, 0x8888, 0xae94, 0x8888, 0x8888, 0x8888, 0x8888, 0x588f, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xcde7, 0x8888, 0xdd8f, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xd0e7, 0xcee7, 0x8888, 0x8888, 0x8888, 0xcfe7,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xd2e7, 0xd1e7, 0x8888, 0x8888, 0xf88f, 0x8888, 0xd3e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xd4e7, 0xd5e7, 0x8888, 0x8888, 0x8888, 0x8888, 0xce94, 0xd18d, 0xdf8e, 0xd6e7, 0x8888, 0xd7e7, 0xa297, 0x648f, 0xec96, 0xca97,
-  0xd8e7, 0xe08b, 0x8888, 0x8888, 0x8888, 0x8888, 0xd9e7, 0xbbfb, 0x4293, 0x8888, 0xbafb, 0xdce7, 0x988a, 0x6a90, 0xbcfb, 0xdae7,
-  0x8888, 0xdbe7, 0x8888, 0xde92, 0xbffb, 0xc0fb, 0x7496, 0xfa8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbdfb, 0xbefb, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdee7, 0xdfe7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdde7, 0x8888, 0x8888, 0xe1e7,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc1fb, 0x8888, 0x8888, 0x8888, 0xc3fb, 0x8888, 0x8888, 0xdd93, 0x628a, 0x8888,
-  0xc2fb, 0xe5e7, 0x8888, 0x8888, 0xe2e7, 0xe4e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe0e7, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6ee8, 0x8888, 0x8888, 0xe3e7, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xe997, 0x8888, 0x8888, 0xd88c, 0x8888, 0xcafb, 0xc4fb, 0x8888, 0xc6fb, 0x8888, 0x8888, 0xede7,
-  0xc5fb, 0x8888, 0x8888, 0x8888, 0x5393, 0xe8e7, 0x8888, 0x8888, 0xebe7, 0xe9e7, 0x8888, 0xeee7, 0x8888, 0x8888, 0xc7fb, 0x8888,
-  0xefe7, 0xc9fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe7e7, 0x8888, 0xc8fb, 0xf4e7, 0x9489, 0x8888, 0x8888, 0xe6e7, 0x8888,
-  0x8888, 0x8888, 0xab94, 0x8888, 0xeae7, 0x8888, 0xde8f, 0xcbfb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x7a8d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcdfb, 0xcefb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6796, 0x8888,
-  0xe28b, 0x8888, 0x8888, 0x658f, 0x8888, 0xba93, 0x8888, 0x8888, 0x5ffa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x4c91, 0x8888, 0xf2e7, 0x8888, 0xece7, 0xf1e7, 0x8888, 0xc196, 0x8888, 0xb692, 0xf3e7, 0xf0e7, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xccfb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4b91, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf7e7, 0x8888, 0xf6e7, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf5e7,
-  0xd2fb, 0x8888, 0x4e96, 0xd6fb, 0x8888, 0xd4fb, 0x8888, 0xd0fb, 0x8888, 0xd1fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xd5fb, 0x8888, 0x8888, 0x8888, 0x9b8f, 0x8888, 0x8888, 0xcffb, 0x8888, 0xf8e7, 0xdd95, 0x8888, 0x8888, 0x7389, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x6595, 0x9292, 0x8888, 0x8888, 0x8888, 0x8888, 0x988b, 0x65fa, 0xfae7, 0xd9fb, 0x7c8d, 0x8888, 0x8888, 0xdcfb,
-  0x8888, 0x8888, 0xdefb, 0x8888, 0x8888, 0x8888, 0x4b8e, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf9e7,
-  0x8d90, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8e90, 0x40e8, 0x42e8, 0x8888, 0x8888, 0xddfb, 0xdbfb, 0x8888,
-  0xf98f, 0xd8fb, 0x41e8, 0x43e8, 0x8888, 0xd7fb, 0xd18b, 0x8888, 0x6495, 0x8888, 0x8888, 0xe08e, 0x4298, 0x8888, 0xfce7, 0xf68d,
-  0x8888, 0x8888, 0x5e98, 0x8888, 0x8888, 0x45e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x44e8, 0x46e8, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xfbe7, 0x8888, 0x8888, 0x8888, 0x5efa, 0x8888, 0x8888, 0xe793, 0x8888, 0x7493, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xd592, 0x8888, 0x4be8, 0xe0fb, 0x8888, 0x8888, 0x8888, 0x6292, 0x47e8, 0x8888, 0x8888, 0x8888,
-  0x48e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4c8c, 0x8888, 0x4ae8, 0x8888,
-  0xdffb, 0x8888, 0x8888, 0x8888, 0x8888, 0xae8c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x49e8, 0x8888, 0xdf8f, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x998a, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x4fe8, 0x8888, 0xbd8d, 0x9991, 0x8888, 0x8888, 0xc892, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xe1fb, 0x8888, 0x8888, 0x5a8a, 0x8888, 0x8888, 0x8888, 0x8888, 0x4de8, 0x4ee8, 0xc192, 0x8888,
-  0x4ce8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x50e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x56e8, 0x8888, 0x8888, 0xe2fb, 0x8888, 0x59e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x58e8, 0x4c93, 0x8888, 0x8888, 0x8888, 0x8888, 0x51e8, 0x52e8, 0x55e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x57e8, 0xe3fb, 0x8888,
-  0x8888, 0xbe8b, 0x8888, 0x8888, 0x5ae8, 0x54e8, 0x8888, 0x8888, 0x53e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe4fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x5ee8, 0x8888, 0x8888, 0x8888, 0x5fe8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x60e8, 0x8888, 0x8888, 0x5de8, 0x5ce8, 0x8888, 0x8888, 0x8888, 0xe08f, 0xa893, 0x5be8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x64e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x62e8, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xe5fb, 0x8888, 0x8888, 0x8888, 0x63e8, 0x61e8, 0x8888, 0xf691, 0x8888, 0x65e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x66e8, 0x8888, 0x8888, 0x68e8, 0xe6fb, 0x8888, 0x8888, 0xe7fb, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xd38a, 0x67e8, 0xf896, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x73e8, 0x69e8, 0x8888, 0x8888, 0x6ce8, 0x8888,
-  0x6ae8, 0x8888, 0x6be8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6de8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x6fe8, 0x8888, 0x8888, 0x8888, 0x8888, 0x70e8, 0x8888, 0x71e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x74e8, 0x72e8, 0x75e8, 0x77e8,
-  0x8888, 0x76e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb792, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xe596, 0x8888, 0x78e8, 0x4d91, 0x8888, 0x8888, 0x8888, 0x79e8, 0x8888, 0xc295, 0x7ae8, 0x4a8a, 0x8888, 0x8888, 0x8888, 0x5b89,
-  0x8888, 0xd58a, 0xe8fb, 0xd48a, 0x7be8, 0x8888, 0x7ce8, 0x8888, 0x7de8, 0x7ee8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x80e8, 0x8888, 0xd68a, 0x748a, 0x7d8d, 0xb494, 0x8888, 0x82e8, 0x81e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x83e8, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x7b89, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x86e8, 0x8888, 0x85e8, 0x84e8, 0x8888, 0x87e8, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8ae8, 0x8888, 0x8888, 0x8888, 0xc588, 0x8888, 0x8888, 0x88e8, 0x8888, 0x8ce8, 0x8be8, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8ee8, 0x8de8, 0x8fe8, 0x8888, 0xac93, 0x8888, 0x8888, 0x8888, 0x90e8, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x91e8, 0x93e8, 0x8888, 0x8888, 0x92e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8c95, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x94e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x95e8, 0x8888, 0xe38d, 0x8888, 0x8888, 0x8888, 0x96e8, 0x97e8,
-  0x8888, 0x8888, 0x6896, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6a91, 0x8888, 0x8888, 0x8888, 0xa288,
-  0xc991, 0x8888, 0x98e8, 0x8888, 0x8d95, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9be8, 0x99e8, 0x7e8d, 0x8888, 0x9ae8,
-  0xc08c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc395, 0x9de8, 0x9fe8, 0x9ee8, 0xa0e8,
-  0x8888, 0x8888, 0x4089, 0x7790, 0x9c8f, 0xd78a, 0xa1e8, 0x8888, 0x8888, 0x8888, 0x8694, 0x8888, 0xa3e8, 0x8888, 0x8888, 0x8888,
-  0x4189, 0x8888, 0xa2e8, 0xc292, 0x8888, 0xcb97, 0xa993, 0x9ce8, 0xa497, 0x8888, 0xaf8c, 0x8888, 0x8888, 0x7a97, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf78b, 0xb297, 0x8888, 0x478c, 0x8888, 0xe091, 0x40e4, 0x8888, 0xa4e8, 0x4b8a, 0x8f90,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x758a, 0xa6e8, 0x8888, 0xa7e8, 0xa5e8, 0x848c, 0x8888, 0xdb8d, 0xe18f, 0xebfb, 0x8888, 0x8888,
-  0x4289, 0x8888, 0x8888, 0xd797, 0x8888, 0x8888, 0x8888, 0xa9e8, 0xace7, 0x8888, 0xa8e8, 0x8888, 0x8888, 0x8888, 0x8888, 0xecfb,
-  0xace8, 0xaae8, 0xabe8, 0x8888, 0xade8, 0x8888, 0xaee8, 0xea97, 0xafe8, 0xb0e8, 0x8888, 0xc790, 0xb994, 0x8888, 0x8888, 0x8888,
-  0x9d90, 0xe58a, 0x8888, 0x8888, 0x5997, 0xeb89, 0x578f, 0xd98c, 0x8888, 0xb3e8, 0x8888, 0xb2e8, 0x938e, 0xb4e8, 0xb1e8, 0x8888,
-  0x8888, 0x478e, 0x8888, 0x8888, 0x8888, 0xb8e8, 0xabe5, 0x8888, 0x8888, 0xd499, 0x8888, 0x9790, 0xb6e8, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0xa397, 0xef93, 0x8888, 0x8888, 0x8888, 0x8888, 0x4a89, 0x8888, 0xe190, 0xb48e, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xb595, 0x8888, 0x5f89, 0x8888, 0x8888, 0x8888, 0xeb97, 0x8b97, 0x8888, 0xb9e8, 0x8888, 0x6493, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xf98e, 0x8888, 0x8888, 0x8888, 0xbae8, 0x8888, 0xbbe8, 0x6b90, 0xbce8, 0x8888, 0xec97, 0x8888, 0x8888, 0xb7e8, 0xbee8, 0xc0e8,
-  0x8888, 0xbfe8, 0x8888, 0xbde8, 0x8888, 0x8888, 0xc1e8, 0x8888, 0x8888, 0xc2e8, 0x8888, 0x8888, 0x9a91, 0x8888, 0xe089, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xc3e8, 0x8888, 0x8888, 0xb696, 0x8888, 0x8888, 0xc4e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xc5e8, 0x8888, 0x4998, 0xedfb, 0x8888, 0x8888, 0x8888, 0x8888, 0x509e, 0xc6e8, 0x8888, 0xeefb, 0x8888, 0xc7e8, 0xc8e8, 0x8888,
-  0x8888, 0x8888, 0xcce8, 0xeffb, 0xc9e8, 0x8888, 0xcae8, 0x8888, 0xcbe8, 0xcde8, 0x8888, 0x8888, 0x8888, 0xf0fb, 0x8888, 0xf1fb,
-  0x8888, 0xf2fb, 0xc290, 0x8888, 0x8888, 0xf3fb, 0xf596, 0x8888, 0x8888, 0xc390, 0x8888, 0x8888, 0xcee8, 0x8888, 0xf194, 0x8888,
-  0xcfe8, 0x72ea, 0xca96, 0x8888, 0xd0e8, 0x8888, 0xd1e8, 0x8888, 0xd2e8, 0x768a, 0x8888, 0xd4e8, 0x8888, 0x7890, 0x8888, 0x8888,
-  0x8888, 0xd5e8, 0x8888, 0x8888, 0x438c, 0x8888, 0x8888, 0x8888, 0x8888, 0xd6e8, 0xdae8, 0x8888, 0xd8e8, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xd9e8, 0x8888, 0x8888, 0x938a, 0xd7e8, 0xdbe8, 0x8888, 0x8888, 0x8888, 0x8888, 0xdce8, 0x8888, 0xc688, 0x8888, 0xdde8,
-  0xdee8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe28f, 0x8888, 0x8888, 0x8888, 0xdfe8, 0x8888, 0x8888, 0x8888,
-  0x668b, 0x8888, 0x8888, 0xe2e8, 0x8888, 0x8888, 0xe1e8, 0x8888, 0xe0e8, 0x8888, 0x8888, 0x91e6, 0x8888, 0xda95, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xe3e8, 0xe4e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xe5e8, 0x8888, 0x8888, 0xe6e8, 0x8888, 0xe7e8, 0x8888, 0x8888, 0xe8e8, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xd88a, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe9e8, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xeae8, 0x4294, 0x8888,
-  0x8888, 0x8888, 0xece8, 0xb989, 0x8888, 0xefe8, 0xeee8, 0x8888, 0x8888, 0x8888, 0x8888, 0x4389, 0x8888, 0x8888, 0x8888, 0xbf8b,
-  0x8888, 0xc595, 0xb892, 0xa08d, 0x8888, 0x808d, 0x878f, 0x8888, 0x7b90, 0x8888, 0x8888, 0x8888, 0xf1e8, 0x8888, 0x8888, 0xf0e8,
-  0x6197, 0xe68a, 0xd094, 0xda93, 0x8888, 0x8888, 0x8888, 0x9c90, 0xcc97, 0x8888, 0x7a8c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xf4e8, 0x8888, 0x8888, 0xf3e8, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6a96, 0xaa93, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x6f89, 0x8888, 0x8888, 0xf5e8, 0xf2e8, 0x8888, 0x8888, 0x7095, 0x8a97, 0xf6e8, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf7e8, 0x8888, 0x8888, 0x8888, 0x8888, 0xf9e8, 0xe891, 0x7a8a, 0x7b8a, 0xf8e8,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xe78a, 0xb08c, 0x8888, 0xf4fb, 0xe88a, 0x8888, 0x8888, 0x5e93, 0x8888, 0x8888, 0xde97, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf5fb, 0x8888, 0xda8c, 0x8888, 0x8888, 0x8888, 0xfae8, 0x8888, 0x8888, 0x8888, 0xfbe8,
-  0xfce8, 0x40e9, 0x8888, 0x42e9, 0x41e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9795, 0x8888, 0x43e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x44e9,
-  0x8888, 0x45e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x46e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x48e9, 0x47e9, 0x8888, 0x49e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf294, 0xcae3, 0x8888, 0x8888, 0x4890,
-  0x8888, 0x8888, 0x518b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4ae9, 0x8888, 0x4be9, 0x8888, 0xaa99, 0x5a9f, 0xd194,
-  0x8888, 0x8888, 0xf988, 0x8888, 0xb988, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x948e, 0x4f96, 0xfc8f, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x4ce9, 0x8888, 0xdd96, 0x8888, 0x8888, 0x8888, 0x4de9, 0x7b97, 0x8888, 0x6189, 0x8888, 0x8888, 0x8888,
-  0x608e, 0x8888, 0x4ee9, 0xec89, 0x4fe9, 0x8888, 0x8888, 0x8888, 0x50e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x52e9, 0x53e9, 0x8888,
-  0x55e9, 0x51e9, 0x8888, 0x8888, 0x54e9, 0x8888, 0x8888, 0xf8fb, 0xd98a, 0x8888, 0x8888, 0x8888, 0x56e9, 0x8888, 0x57e9, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x58e9, 0x59e9, 0x8888,
-  0x8888, 0x8888, 0x5ae9, 0x8888, 0x8888, 0x5ce9, 0x8888, 0x8888, 0x8888, 0x5be9, 0x8888, 0x5ee9, 0x61e9, 0x8888, 0x8888, 0x8888,
-  0x5de9, 0x5fe9, 0x60e9, 0x8888, 0x8888, 0x62e9, 0x8888, 0xc08b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf18e, 0x63e9, 0x64e9, 0x818d, 0x8888, 0x8888, 0x8888, 0x8888, 0xfafb, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x65e9, 0x8888, 0x8888, 0x5d8a, 0x8888, 0x8888, 0x8888, 0x6e94, 0x66e9, 0x67e9, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x7992, 0xe993, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x68e9, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x9d94, 0x8888, 0x8888, 0xca91, 0x7789, 0xec8b, 0x8888, 0xed8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x9392, 0x6de9, 0xee8b, 0x8888, 0x8888, 0xed89, 0x8888, 0x8888, 0x6ce9, 0x8888, 0x8888, 0x6ae9, 0x8888, 0x6be9, 0x8888, 0x69e9,
-  0x8888, 0x8888, 0x77e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6ee9, 0x6fe9, 0x8888,
-  0x8888, 0x70e9, 0x71e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x73e9, 0x8888, 0x8888, 0x72e9, 0x8888, 0x8888, 0x8888, 0x788f,
-  0x8888, 0x74e9, 0x8888, 0x8888, 0x8888, 0x76e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x528b, 0x75e9,
-  0x8888, 0x8888, 0x9b91, 0xb18c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x78e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xcb91, 0x8888, 0x8888, 0x79e9, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xab93, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7ae9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x80e9, 0x8888,
-  0x7de9, 0x8888, 0x7ce9, 0x7ee9, 0x8888, 0x7be9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x82e9, 0xfbfb, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x81e9, 0x8888, 0x84e9, 0x8888, 0x8888, 0xc18b, 0x83e9, 0x8888, 0x8888, 0x8888, 0x85e9,
-  0x8888, 0x8888, 0x86e9, 0x8888, 0x88e9, 0x87e9, 0x8888, 0x8888, 0x8888, 0x89e9, 0x8be9, 0x8ae9, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9c8d, 0x8888, 0x8888, 0x8888, 0x8888, 0x8ce9, 0x8888, 0x8888,
-  0x8de9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5b8a, 0x8888, 0x8888, 0x8888, 0x8ee9, 0x8888, 0x8888, 0x8888,
-  0x8fe9, 0x8888, 0x8888, 0x8888, 0x9190, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x90e9,
-  0x8888, 0x91e9, 0x8888, 0x92e9, 0x93e9, 0x8888, 0x8888, 0x8888, 0x828d, 0xfcfb, 0x8888, 0x8888, 0x40fc, 0x8888, 0x94e9, 0x95e9,
-  0x8888, 0x8888, 0x96e9, 0x97e9, 0x8888, 0x8888, 0x98e9, 0x8888, 0x8888, 0x8888, 0xaf94, 0x9ae9, 0x8888, 0x4595, 0x9be9, 0x99e9,
-  0x8888, 0x9de9, 0x8888, 0x8888, 0x9ce9, 0x8888, 0x8888, 0x9ee9, 0x8888, 0x8888, 0x8888, 0x9fe9, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa0e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xa1e9, 0x8888, 0xa2e9, 0x8888, 0x8888, 0x8888, 0x8888, 0xa3e9,
-  0x8888, 0x8888, 0xa4e9, 0xa5e9, 0x8888, 0xa6e9, 0x8888, 0xa7e9, 0xa8e9, 0xa9e9, 0xaae9, 0x8888, 0x8888, 0x8888, 0xabe9, 0xace9,
-  0x8888, 0x549f, 0xade9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xf6e2, 0x538b, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x408a, 0xb08d, 0xafe9, 0xaee9, 0xa396, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb1e9, 0xb2e9, 0xb0e9,
-  0x8888, 0xb3e9, 0x8888, 0x8888, 0x8296, 0x8888, 0x8888, 0x8888, 0xb4e9, 0x8888, 0x9b8b, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4498,
-  0x8888, 0x8888, 0x42fc, 0x8888, 0xb5e9, 0x41fc, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xb7e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbc88, 0x43fc,
-  0x8888, 0xb8e9, 0xa995, 0xb6e9, 0x8888, 0x8888, 0xb9e9, 0xbae9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbbe9,
-  0xbce9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xbde9, 0x8888, 0x8e96, 0x4c8e, 0x8888, 0xf88d, 0x4e91, 0x8888,
-  0x8888, 0x44fc, 0x8888, 0x8888, 0xbee9, 0x8888, 0x8888, 0x8888, 0x8888, 0xc1e9, 0x8888, 0x45fc, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xbfe9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xc2e9, 0x8888, 0x8888, 0xef8c, 0xc0e9, 0x8888, 0x8888, 0x8888, 0x8888, 0xc3e9,
-  0x8888, 0xc4e9, 0xc5e9, 0x8888, 0xc9e9, 0x8888, 0x498e, 0x8888, 0x8888, 0x8888, 0x8888, 0xe291, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xcae9, 0xc7e9, 0xc6e9, 0xc8e9, 0x8888, 0x8888, 0x8888, 0x7e8c, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xcee9, 0xcde9, 0xcce9, 0x8888, 0x8888, 0xb188, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x46fc, 0x8888, 0x8888, 0x8888, 0xd8e9, 0x8888, 0xd4e9, 0x8888, 0xd5e9, 0xd1e9, 0xd7e9, 0x8888, 0xd3e9, 0x828a, 0x8888, 0x8888,
-  0x6b98, 0x8888, 0xd6e9, 0xd2e9, 0xd0e9, 0xcfe9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xdae9, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0xdde9, 0x8888, 0x8888, 0xdce9, 0xdbe9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6895, 0xd9e9, 0xf188,
-  0xdee9, 0x8888, 0xe0e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8f8a, 0xcbe9, 0x5689, 0x8888, 0x8888, 0xe2e9, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe1e9, 0xdfe9, 0x4c92, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x9096, 0x8888, 0x8888, 0x8888, 0x8888, 0xd897, 0x8888, 0x8888, 0xe3e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0xe4e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe5e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe6e9, 0x8888, 0xe7e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb992, 0x8888, 0xe8e9, 0x8888, 0xb594, 0x8888, 0xede9, 0xe9e9, 0x8888, 0x8888, 0x8888,
-  0xeae9, 0x8888, 0x8888, 0x5096, 0xc296, 0x8888, 0xce93, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xeee9, 0x8888, 0x8888, 0xefe9, 0xbc93, 0xece9, 0xebe9, 0x8888, 0x8888, 0x8888, 0x8888, 0xa889, 0x8888,
-  0x8888, 0x8888, 0xf7e9, 0x8888, 0x8888, 0xf6e9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9589, 0x8888, 0x8888, 0x8888, 0xf4e9,
-  0x8888, 0x8888, 0x8888, 0xf3e9, 0x8888, 0x8888, 0xf1e9, 0x8888, 0x9b8a, 0x8888, 0xf0e9, 0xb08e, 0xa789, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x838d, 0x8888, 0x8888, 0xfae9, 0xf9e9,
-  0x8888, 0xf8e9, 0x8888, 0x8888, 0xf5e9, 0x8888, 0xfbe9, 0x8888, 0xfce9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x44ea, 0x43ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x45ea, 0x8888, 0x8888, 0x4c89, 0x40ea, 0x41ea, 0x8888,
-  0x948d, 0xb796, 0x8888, 0x8888, 0x42ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x48fc, 0x5196, 0x8888, 0x8888, 0x4aea,
-  0x47fc, 0x8888, 0x46ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4bea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x48ea, 0x8888, 0x47ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7b8c,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4cea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x4dea, 0x8888, 0x8888, 0x8888, 0x8888, 0x4eea, 0x8888, 0x49ea, 0x8888, 0x8888, 0x8888, 0xf2e9,
-  0x8888, 0x8888, 0x4fea, 0x8888, 0xdf92, 0x8888, 0x8888, 0x8888, 0x53ea, 0x8888, 0x54ea, 0x52ea, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x51ea, 0x57ea, 0x8888, 0x50ea, 0x8888, 0x55ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x56ea,
-  0x8888, 0x8888, 0x8888, 0x59ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x58ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5bea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5cea, 0x8888, 0x5dea,
-  0x8888, 0x8888, 0x6898, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x5aea, 0xe991, 0xeb8d, 0x8888, 0x8888, 0x5eea, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4afc, 0x5fea, 0x60ea, 0x8888, 0x8888, 0x61ea, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x62ea, 0x8888, 0x8888, 0xb28c, 0x63ea, 0x8888, 0x8888, 0x8888, 0x64ea, 0x8888, 0xad8e,
-  0x8888, 0x65ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x66ea, 0x8888, 0x8888, 0x67ea, 0x68ea, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x6bea, 0x69ea, 0x5b98, 0x8888, 0x6aea, 0x8888, 0xed97, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6cea, 0x8888, 0xd997,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6dea, 0x9e94, 0x8888, 0x8888, 0x6eea, 0x70ea, 0x8888, 0x8888, 0x71ea, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x6fea, 0x8d8d, 0xcb96, 0x8396, 0xf59b, 0x8888, 0x809f, 0x9b96,
-  0x8888, 0x8888, 0x8888, 0x8888, 0xa989, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x73ea, 0x6f8b, 0x74ea, 0x75ea,
-  0x76ea, 0x4bfc, 0x958d, 0x8888, 0x77ea, 0x8888, 0x8888, 0x8888, 0xd2e0, 0xd996, 0x8888, 0xe191, 0x78ea, 0x7aea, 0x79ea, 0x8888,
-  0x7bea, 0x8888, 0x8888, 0x8888, 0x8888, 0x7cea, 0x8888, 0x8888, 0x7dea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x7eea,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x80ea, 0x8888, 0x81ea, 0x82ea, 0x8888, 0x83ea, 0x8888, 0x84ea, 0x85ea, 0x86ea, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x87ea, 0x88ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4393, 0x8888,
-  0x8888, 0x8888, 0x8888, 0xdb8c, 0x8888, 0x8aea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x6c91, 0x8bea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8cea, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x4095, 0x8888, 0x8888, 0x8dea, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8eea, 0x56e2, 0x8888, 0x8888, 0xd8e6, 0xebe8,
-  0x8888, 0x8888, 0x8fea, 0x8888, 0x90ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x92ea,
-  0x93ea, 0x94ea, 0xee97, 0x91ea, 0x8888, 0x8888, 0x95ea, 0x96ea, 0x8888, 0x8888, 0x98ea, 0x8888, 0x97ea, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x9aea, 0x8888, 0x8888, 0x8888, 0x9bea, 0x99ea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xb497, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9cea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x9dea, 0x73e2, 0x8888, 0x8888,
-  0x9eea, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, };
-static_assert(arraysize(_unicode_table_4e00_9fb0) == 0x9fb0 - 0x4e00);
-
-inline constexpr cat2 _unicode_table_e000_e760[]{
-  0x40f0, 0x41f0, 0x42f0, 0x43f0, 0x44f0, 0x45f0, 0x46f0, 0x47f0, 0x48f0, 0x49f0, 0x4af0, 0x4bf0, 0x4cf0, 0x4df0, 0x4ef0, 0x4ff0,
-  0x50f0, 0x51f0, 0x52f0, 0x53f0, 0x54f0, 0x55f0, 0x56f0, 0x57f0, 0x58f0, 0x59f0, 0x5af0, 0x5bf0, 0x5cf0, 0x5df0, 0x5ef0, 0x5ff0,
-  0x60f0, 0x61f0, 0x62f0, 0x63f0, 0x64f0, 0x65f0, 0x66f0, 0x67f0, 0x68f0, 0x69f0, 0x6af0, 0x6bf0, 0x6cf0, 0x6df0, 0x6ef0, 0x6ff0,
-  0x70f0, 0x71f0, 0x72f0, 0x73f0, 0x74f0, 0x75f0, 0x76f0, 0x77f0, 0x78f0, 0x79f0, 0x7af0, 0x7bf0, 0x7cf0, 0x7df0, 0x7ef0, 0x80f0,
-  0x81f0, 0x82f0, 0x83f0, 0x84f0, 0x85f0, 0x86f0, 0x87f0, 0x88f0, 0x89f0, 0x8af0, 0x8bf0, 0x8cf0, 0x8df0, 0x8ef0, 0x8ff0, 0x90f0,
-  0x91f0, 0x92f0, 0x93f0, 0x94f0, 0x95f0, 0x96f0, 0x97f0, 0x98f0, 0x99f0, 0x9af0, 0x9bf0, 0x9cf0, 0x9df0, 0x9ef0, 0x9ff0, 0xa0f0,
-  0xa1f0, 0xa2f0, 0xa3f0, 0xa4f0, 0xa5f0, 0xa6f0, 0xa7f0, 0xa8f0, 0xa9f0, 0xaaf0, 0xabf0, 0xacf0, 0xadf0, 0xaef0, 0xaff0, 0xb0f0,
-  0xb1f0, 0xb2f0, 0xb3f0, 0xb4f0, 0xb5f0, 0xb6f0, 0xb7f0, 0xb8f0, 0xb9f0, 0xbaf0, 0xbbf0, 0xbcf0, 0xbdf0, 0xbef0, 0xbff0, 0xc0f0,
-  0xc1f0, 0xc2f0, 0xc3f0, 0xc4f0, 0xc5f0, 0xc6f0, 0xc7f0, 0xc8f0, 0xc9f0, 0xcaf0, 0xcbf0, 0xccf0, 0xcdf0, 0xcef0, 0xcff0, 0xd0f0,
-  0xd1f0, 0xd2f0, 0xd3f0, 0xd4f0, 0xd5f0, 0xd6f0, 0xd7f0, 0xd8f0, 0xd9f0, 0xdaf0, 0xdbf0, 0xdcf0, 0xddf0, 0xdef0, 0xdff0, 0xe0f0,
-  0xe1f0, 0xe2f0, 0xe3f0, 0xe4f0, 0xe5f0, 0xe6f0, 0xe7f0, 0xe8f0, 0xe9f0, 0xeaf0, 0xebf0, 0xecf0, 0xedf0, 0xeef0, 0xeff0, 0xf0f0,
-  0xf1f0, 0xf2f0, 0xf3f0, 0xf4f0, 0xf5f0, 0xf6f0, 0xf7f0, 0xf8f0, 0xf9f0, 0xfaf0, 0xfbf0, 0xfcf0, 0x40f1, 0x41f1, 0x42f1, 0x43f1,
-  0x44f1, 0x45f1, 0x46f1, 0x47f1, 0x48f1, 0x49f1, 0x4af1, 0x4bf1, 0x4cf1, 0x4df1, 0x4ef1, 0x4ff1, 0x50f1, 0x51f1, 0x52f1, 0x53f1,
-  0x54f1, 0x55f1, 0x56f1, 0x57f1, 0x58f1, 0x59f1, 0x5af1, 0x5bf1, 0x5cf1, 0x5df1, 0x5ef1, 0x5ff1, 0x60f1, 0x61f1, 0x62f1, 0x63f1,
-  0x64f1, 0x65f1, 0x66f1, 0x67f1, 0x68f1, 0x69f1, 0x6af1, 0x6bf1, 0x6cf1, 0x6df1, 0x6ef1, 0x6ff1, 0x70f1, 0x71f1, 0x72f1, 0x73f1,
-  0x74f1, 0x75f1, 0x76f1, 0x77f1, 0x78f1, 0x79f1, 0x7af1, 0x7bf1, 0x7cf1, 0x7df1, 0x7ef1, 0x80f1, 0x81f1, 0x82f1, 0x83f1, 0x84f1,
-  0x85f1, 0x86f1, 0x87f1, 0x88f1, 0x89f1, 0x8af1, 0x8bf1, 0x8cf1, 0x8df1, 0x8ef1, 0x8ff1, 0x90f1, 0x91f1, 0x92f1, 0x93f1, 0x94f1,
-  0x95f1, 0x96f1, 0x97f1, 0x98f1, 0x99f1, 0x9af1, 0x9bf1, 0x9cf1, 0x9df1, 0x9ef1, 0x9ff1, 0xa0f1, 0xa1f1, 0xa2f1, 0xa3f1, 0xa4f1,
-  0xa5f1, 0xa6f1, 0xa7f1, 0xa8f1, 0xa9f1, 0xaaf1, 0xabf1, 0xacf1, 0xadf1, 0xaef1, 0xaff1, 0xb0f1, 0xb1f1, 0xb2f1, 0xb3f1, 0xb4f1,
-  0xb5f1, 0xb6f1, 0xb7f1, 0xb8f1, 0xb9f1, 0xbaf1, 0xbbf1, 0xbcf1, 0xbdf1, 0xbef1, 0xbff1, 0xc0f1, 0xc1f1, 0xc2f1, 0xc3f1, 0xc4f1,
-  0xc5f1, 0xc6f1, 0xc7f1, 0xc8f1, 0xc9f1, 0xcaf1, 0xcbf1, 0xccf1, 0xcdf1, 0xcef1, 0xcff1, 0xd0f1, 0xd1f1, 0xd2f1, 0xd3f1, 0xd4f1,
-  0xd5f1, 0xd6f1, 0xd7f1, 0xd8f1, 0xd9f1, 0xdaf1, 0xdbf1, 0xdcf1, 0xddf1, 0xdef1, 0xdff1, 0xe0f1, 0xe1f1, 0xe2f1, 0xe3f1, 0xe4f1,
-  0xe5f1, 0xe6f1, 0xe7f1, 0xe8f1, 0xe9f1, 0xeaf1, 0xebf1, 0xecf1, 0xedf1, 0xeef1, 0xeff1, 0xf0f1, 0xf1f1, 0xf2f1, 0xf3f1, 0xf4f1,
-  0xf5f1, 0xf6f1, 0xf7f1, 0xf8f1, 0xf9f1, 0xfaf1, 0xfbf1, 0xfcf1, 0x40f2, 0x41f2, 0x42f2, 0x43f2, 0x44f2, 0x45f2, 0x46f2, 0x47f2,
-  0x48f2, 0x49f2, 0x4af2, 0x4bf2, 0x4cf2, 0x4df2, 0x4ef2, 0x4ff2, 0x50f2, 0x51f2, 0x52f2, 0x53f2, 0x54f2, 0x55f2, 0x56f2, 0x57f2,
-  0x58f2, 0x59f2, 0x5af2, 0x5bf2, 0x5cf2, 0x5df2, 0x5ef2, 0x5ff2, 0x60f2, 0x61f2, 0x62f2, 0x63f2, 0x64f2, 0x65f2, 0x66f2, 0x67f2,
-  0x68f2, 0x69f2, 0x6af2, 0x6bf2, 0x6cf2, 0x6df2, 0x6ef2, 0x6ff2, 0x70f2, 0x71f2, 0x72f2, 0x73f2, 0x74f2, 0x75f2, 0x76f2, 0x77f2,
-  0x78f2, 0x79f2, 0x7af2, 0x7bf2, 0x7cf2, 0x7df2, 0x7ef2, 0x80f2, 0x81f2, 0x82f2, 0x83f2, 0x84f2, 0x85f2, 0x86f2, 0x87f2, 0x88f2,
-  0x89f2, 0x8af2, 0x8bf2, 0x8cf2, 0x8df2, 0x8ef2, 0x8ff2, 0x90f2, 0x91f2, 0x92f2, 0x93f2, 0x94f2, 0x95f2, 0x96f2, 0x97f2, 0x98f2,
-  0x99f2, 0x9af2, 0x9bf2, 0x9cf2, 0x9df2, 0x9ef2, 0x9ff2, 0xa0f2, 0xa1f2, 0xa2f2, 0xa3f2, 0xa4f2, 0xa5f2, 0xa6f2, 0xa7f2, 0xa8f2,
-  0xa9f2, 0xaaf2, 0xabf2, 0xacf2, 0xadf2, 0xaef2, 0xaff2, 0xb0f2, 0xb1f2, 0xb2f2, 0xb3f2, 0xb4f2, 0xb5f2, 0xb6f2, 0xb7f2, 0xb8f2,
-  0xb9f2, 0xbaf2, 0xbbf2, 0xbcf2, 0xbdf2, 0xbef2, 0xbff2, 0xc0f2, 0xc1f2, 0xc2f2, 0xc3f2, 0xc4f2, 0xc5f2, 0xc6f2, 0xc7f2, 0xc8f2,
-  0xc9f2, 0xcaf2, 0xcbf2, 0xccf2, 0xcdf2, 0xcef2, 0xcff2, 0xd0f2, 0xd1f2, 0xd2f2, 0xd3f2, 0xd4f2, 0xd5f2, 0xd6f2, 0xd7f2, 0xd8f2,
-  0xd9f2, 0xdaf2, 0xdbf2, 0xdcf2, 0xddf2, 0xdef2, 0xdff2, 0xe0f2, 0xe1f2, 0xe2f2, 0xe3f2, 0xe4f2, 0xe5f2, 0xe6f2, 0xe7f2, 0xe8f2,
-  0xe9f2, 0xeaf2, 0xebf2, 0xecf2, 0xedf2, 0xeef2, 0xeff2, 0xf0f2, 0xf1f2, 0xf2f2, 0xf3f2, 0xf4f2, 0xf5f2, 0xf6f2, 0xf7f2, 0xf8f2,
-  0xf9f2, 0xfaf2, 0xfbf2, 0xfcf2, 0x40f3, 0x41f3, 0x42f3, 0x43f3, 0x44f3, 0x45f3, 0x46f3, 0x47f3, 0x48f3, 0x49f3, 0x4af3, 0x4bf3,
-  0x4cf3, 0x4df3, 0x4ef3, 0x4ff3, 0x50f3, 0x51f3, 0x52f3, 0x53f3, 0x54f3, 0x55f3, 0x56f3, 0x57f3, 0x58f3, 0x59f3, 0x5af3, 0x5bf3,
-  0x5cf3, 0x5df3, 0x5ef3, 0x5ff3, 0x60f3, 0x61f3, 0x62f3, 0x63f3, 0x64f3, 0x65f3, 0x66f3, 0x67f3, 0x68f3, 0x69f3, 0x6af3, 0x6bf3,
-  0x6cf3, 0x6df3, 0x6ef3, 0x6ff3, 0x70f3, 0x71f3, 0x72f3, 0x73f3, 0x74f3, 0x75f3, 0x76f3, 0x77f3, 0x78f3, 0x79f3, 0x7af3, 0x7bf3,
-  0x7cf3, 0x7df3, 0x7ef3, 0x80f3, 0x81f3, 0x82f3, 0x83f3, 0x84f3, 0x85f3, 0x86f3, 0x87f3, 0x88f3, 0x89f3, 0x8af3, 0x8bf3, 0x8cf3,
-  0x8df3, 0x8ef3, 0x8ff3, 0x90f3, 0x91f3, 0x92f3, 0x93f3, 0x94f3, 0x95f3, 0x96f3, 0x97f3, 0x98f3, 0x99f3, 0x9af3, 0x9bf3, 0x9cf3,
-  0x9df3, 0x9ef3, 0x9ff3, 0xa0f3, 0xa1f3, 0xa2f3, 0xa3f3, 0xa4f3, 0xa5f3, 0xa6f3, 0xa7f3, 0xa8f3, 0xa9f3, 0xaaf3, 0xabf3, 0xacf3,
-  0xadf3, 0xaef3, 0xaff3, 0xb0f3, 0xb1f3, 0xb2f3, 0xb3f3, 0xb4f3, 0xb5f3, 0xb6f3, 0xb7f3, 0xb8f3, 0xb9f3, 0xbaf3, 0xbbf3, 0xbcf3,
-  0xbdf3, 0xbef3, 0xbff3, 0xc0f3, 0xc1f3, 0xc2f3, 0xc3f3, 0xc4f3, 0xc5f3, 0xc6f3, 0xc7f3, 0xc8f3, 0xc9f3, 0xcaf3, 0xcbf3, 0xccf3,
-  0xcdf3, 0xcef3, 0xcff3, 0xd0f3, 0xd1f3, 0xd2f3, 0xd3f3, 0xd4f3, 0xd5f3, 0xd6f3, 0xd7f3, 0xd8f3, 0xd9f3, 0xdaf3, 0xdbf3, 0xdcf3,
-  0xddf3, 0xdef3, 0xdff3, 0xe0f3, 0xe1f3, 0xe2f3, 0xe3f3, 0xe4f3, 0xe5f3, 0xe6f3, 0xe7f3, 0xe8f3, 0xe9f3, 0xeaf3, 0xebf3, 0xecf3,
-  0xedf3, 0xeef3, 0xeff3, 0xf0f3, 0xf1f3, 0xf2f3, 0xf3f3, 0xf4f3, 0xf5f3, 0xf6f3, 0xf7f3, 0xf8f3, 0xf9f3, 0xfaf3, 0xfbf3, 0xfcf3,
-  0x40f4, 0x41f4, 0x42f4, 0x43f4, 0x44f4, 0x45f4, 0x46f4, 0x47f4, 0x48f4, 0x49f4, 0x4af4, 0x4bf4, 0x4cf4, 0x4df4, 0x4ef4, 0x4ff4,
-  0x50f4, 0x51f4, 0x52f4, 0x53f4, 0x54f4, 0x55f4, 0x56f4, 0x57f4, 0x58f4, 0x59f4, 0x5af4, 0x5bf4, 0x5cf4, 0x5df4, 0x5ef4, 0x5ff4,
-  0x60f4, 0x61f4, 0x62f4, 0x63f4, 0x64f4, 0x65f4, 0x66f4, 0x67f4, 0x68f4, 0x69f4, 0x6af4, 0x6bf4, 0x6cf4, 0x6df4, 0x6ef4, 0x6ff4,
-  0x70f4, 0x71f4, 0x72f4, 0x73f4, 0x74f4, 0x75f4, 0x76f4, 0x77f4, 0x78f4, 0x79f4, 0x7af4, 0x7bf4, 0x7cf4, 0x7df4, 0x7ef4, 0x80f4,
-  0x81f4, 0x82f4, 0x83f4, 0x84f4, 0x85f4, 0x86f4, 0x87f4, 0x88f4, 0x89f4, 0x8af4, 0x8bf4, 0x8cf4, 0x8df4, 0x8ef4, 0x8ff4, 0x90f4,
-  0x91f4, 0x92f4, 0x93f4, 0x94f4, 0x95f4, 0x96f4, 0x97f4, 0x98f4, 0x99f4, 0x9af4, 0x9bf4, 0x9cf4, 0x9df4, 0x9ef4, 0x9ff4, 0xa0f4,
-  0xa1f4, 0xa2f4, 0xa3f4, 0xa4f4, 0xa5f4, 0xa6f4, 0xa7f4, 0xa8f4, 0xa9f4, 0xaaf4, 0xabf4, 0xacf4, 0xadf4, 0xaef4, 0xaff4, 0xb0f4,
-  0xb1f4, 0xb2f4, 0xb3f4, 0xb4f4, 0xb5f4, 0xb6f4, 0xb7f4, 0xb8f4, 0xb9f4, 0xbaf4, 0xbbf4, 0xbcf4, 0xbdf4, 0xbef4, 0xbff4, 0xc0f4,
-  0xc1f4, 0xc2f4, 0xc3f4, 0xc4f4, 0xc5f4, 0xc6f4, 0xc7f4, 0xc8f4, 0xc9f4, 0xcaf4, 0xcbf4, 0xccf4, 0xcdf4, 0xcef4, 0xcff4, 0xd0f4,
-  0xd1f4, 0xd2f4, 0xd3f4, 0xd4f4, 0xd5f4, 0xd6f4, 0xd7f4, 0xd8f4, 0xd9f4, 0xdaf4, 0xdbf4, 0xdcf4, 0xddf4, 0xdef4, 0xdff4, 0xe0f4,
-  0xe1f4, 0xe2f4, 0xe3f4, 0xe4f4, 0xe5f4, 0xe6f4, 0xe7f4, 0xe8f4, 0xe9f4, 0xeaf4, 0xebf4, 0xecf4, 0xedf4, 0xeef4, 0xeff4, 0xf0f4,
-  0xf1f4, 0xf2f4, 0xf3f4, 0xf4f4, 0xf5f4, 0xf6f4, 0xf7f4, 0xf8f4, 0xf9f4, 0xfaf4, 0xfbf4, 0xfcf4, 0x40f5, 0x41f5, 0x42f5, 0x43f5,
-  0x44f5, 0x45f5, 0x46f5, 0x47f5, 0x48f5, 0x49f5, 0x4af5, 0x4bf5, 0x4cf5, 0x4df5, 0x4ef5, 0x4ff5, 0x50f5, 0x51f5, 0x52f5, 0x53f5,
-  0x54f5, 0x55f5, 0x56f5, 0x57f5, 0x58f5, 0x59f5, 0x5af5, 0x5bf5, 0x5cf5, 0x5df5, 0x5ef5, 0x5ff5, 0x60f5, 0x61f5, 0x62f5, 0x63f5,
-  0x64f5, 0x65f5, 0x66f5, 0x67f5, 0x68f5, 0x69f5, 0x6af5, 0x6bf5, 0x6cf5, 0x6df5, 0x6ef5, 0x6ff5, 0x70f5, 0x71f5, 0x72f5, 0x73f5,
-  0x74f5, 0x75f5, 0x76f5, 0x77f5, 0x78f5, 0x79f5, 0x7af5, 0x7bf5, 0x7cf5, 0x7df5, 0x7ef5, 0x80f5, 0x81f5, 0x82f5, 0x83f5, 0x84f5,
-  0x85f5, 0x86f5, 0x87f5, 0x88f5, 0x89f5, 0x8af5, 0x8bf5, 0x8cf5, 0x8df5, 0x8ef5, 0x8ff5, 0x90f5, 0x91f5, 0x92f5, 0x93f5, 0x94f5,
-  0x95f5, 0x96f5, 0x97f5, 0x98f5, 0x99f5, 0x9af5, 0x9bf5, 0x9cf5, 0x9df5, 0x9ef5, 0x9ff5, 0xa0f5, 0xa1f5, 0xa2f5, 0xa3f5, 0xa4f5,
-  0xa5f5, 0xa6f5, 0xa7f5, 0xa8f5, 0xa9f5, 0xaaf5, 0xabf5, 0xacf5, 0xadf5, 0xaef5, 0xaff5, 0xb0f5, 0xb1f5, 0xb2f5, 0xb3f5, 0xb4f5,
-  0xb5f5, 0xb6f5, 0xb7f5, 0xb8f5, 0xb9f5, 0xbaf5, 0xbbf5, 0xbcf5, 0xbdf5, 0xbef5, 0xbff5, 0xc0f5, 0xc1f5, 0xc2f5, 0xc3f5, 0xc4f5,
-  0xc5f5, 0xc6f5, 0xc7f5, 0xc8f5, 0xc9f5, 0xcaf5, 0xcbf5, 0xccf5, 0xcdf5, 0xcef5, 0xcff5, 0xd0f5, 0xd1f5, 0xd2f5, 0xd3f5, 0xd4f5,
-  0xd5f5, 0xd6f5, 0xd7f5, 0xd8f5, 0xd9f5, 0xdaf5, 0xdbf5, 0xdcf5, 0xddf5, 0xdef5, 0xdff5, 0xe0f5, 0xe1f5, 0xe2f5, 0xe3f5, 0xe4f5,
-  0xe5f5, 0xe6f5, 0xe7f5, 0xe8f5, 0xe9f5, 0xeaf5, 0xebf5, 0xecf5, 0xedf5, 0xeef5, 0xeff5, 0xf0f5, 0xf1f5, 0xf2f5, 0xf3f5, 0xf4f5,
-  0xf5f5, 0xf6f5, 0xf7f5, 0xf8f5, 0xf9f5, 0xfaf5, 0xfbf5, 0xfcf5, 0x40f6, 0x41f6, 0x42f6, 0x43f6, 0x44f6, 0x45f6, 0x46f6, 0x47f6,
-  0x48f6, 0x49f6, 0x4af6, 0x4bf6, 0x4cf6, 0x4df6, 0x4ef6, 0x4ff6, 0x50f6, 0x51f6, 0x52f6, 0x53f6, 0x54f6, 0x55f6, 0x56f6, 0x57f6,
-  0x58f6, 0x59f6, 0x5af6, 0x5bf6, 0x5cf6, 0x5df6, 0x5ef6, 0x5ff6, 0x60f6, 0x61f6, 0x62f6, 0x63f6, 0x64f6, 0x65f6, 0x66f6, 0x67f6,
-  0x68f6, 0x69f6, 0x6af6, 0x6bf6, 0x6cf6, 0x6df6, 0x6ef6, 0x6ff6, 0x70f6, 0x71f6, 0x72f6, 0x73f6, 0x74f6, 0x75f6, 0x76f6, 0x77f6,
-  0x78f6, 0x79f6, 0x7af6, 0x7bf6, 0x7cf6, 0x7df6, 0x7ef6, 0x80f6, 0x81f6, 0x82f6, 0x83f6, 0x84f6, 0x85f6, 0x86f6, 0x87f6, 0x88f6,
-  0x89f6, 0x8af6, 0x8bf6, 0x8cf6, 0x8df6, 0x8ef6, 0x8ff6, 0x90f6, 0x91f6, 0x92f6, 0x93f6, 0x94f6, 0x95f6, 0x96f6, 0x97f6, 0x98f6,
-  0x99f6, 0x9af6, 0x9bf6, 0x9cf6, 0x9df6, 0x9ef6, 0x9ff6, 0xa0f6, 0xa1f6, 0xa2f6, 0xa3f6, 0xa4f6, 0xa5f6, 0xa6f6, 0xa7f6, 0xa8f6,
-  0xa9f6, 0xaaf6, 0xabf6, 0xacf6, 0xadf6, 0xaef6, 0xaff6, 0xb0f6, 0xb1f6, 0xb2f6, 0xb3f6, 0xb4f6, 0xb5f6, 0xb6f6, 0xb7f6, 0xb8f6,
-  0xb9f6, 0xbaf6, 0xbbf6, 0xbcf6, 0xbdf6, 0xbef6, 0xbff6, 0xc0f6, 0xc1f6, 0xc2f6, 0xc3f6, 0xc4f6, 0xc5f6, 0xc6f6, 0xc7f6, 0xc8f6,
-  0xc9f6, 0xcaf6, 0xcbf6, 0xccf6, 0xcdf6, 0xcef6, 0xcff6, 0xd0f6, 0xd1f6, 0xd2f6, 0xd3f6, 0xd4f6, 0xd5f6, 0xd6f6, 0xd7f6, 0xd8f6,
-  0xd9f6, 0xdaf6, 0xdbf6, 0xdcf6, 0xddf6, 0xdef6, 0xdff6, 0xe0f6, 0xe1f6, 0xe2f6, 0xe3f6, 0xe4f6, 0xe5f6, 0xe6f6, 0xe7f6, 0xe8f6,
-  0xe9f6, 0xeaf6, 0xebf6, 0xecf6, 0xedf6, 0xeef6, 0xeff6, 0xf0f6, 0xf1f6, 0xf2f6, 0xf3f6, 0xf4f6, 0xf5f6, 0xf6f6, 0xf7f6, 0xf8f6,
-  0xf9f6, 0xfaf6, 0xfbf6, 0xfcf6, 0x40f7, 0x41f7, 0x42f7, 0x43f7, 0x44f7, 0x45f7, 0x46f7, 0x47f7, 0x48f7, 0x49f7, 0x4af7, 0x4bf7,
-  0x4cf7, 0x4df7, 0x4ef7, 0x4ff7, 0x50f7, 0x51f7, 0x52f7, 0x53f7, 0x54f7, 0x55f7, 0x56f7, 0x57f7, 0x58f7, 0x59f7, 0x5af7, 0x5bf7,
-  0x5cf7, 0x5df7, 0x5ef7, 0x5ff7, 0x60f7, 0x61f7, 0x62f7, 0x63f7, 0x64f7, 0x65f7, 0x66f7, 0x67f7, 0x68f7, 0x69f7, 0x6af7, 0x6bf7,
-  0x6cf7, 0x6df7, 0x6ef7, 0x6ff7, 0x70f7, 0x71f7, 0x72f7, 0x73f7, 0x74f7, 0x75f7, 0x76f7, 0x77f7, 0x78f7, 0x79f7, 0x7af7, 0x7bf7,
-  0x7cf7, 0x7df7, 0x7ef7, 0x80f7, 0x81f7, 0x82f7, 0x83f7, 0x84f7, 0x85f7, 0x86f7, 0x87f7, 0x88f7, 0x89f7, 0x8af7, 0x8bf7, 0x8cf7,
-  0x8df7, 0x8ef7, 0x8ff7, 0x90f7, 0x91f7, 0x92f7, 0x93f7, 0x94f7, 0x95f7, 0x96f7, 0x97f7, 0x98f7, 0x99f7, 0x9af7, 0x9bf7, 0x9cf7,
-  0x9df7, 0x9ef7, 0x9ff7, 0xa0f7, 0xa1f7, 0xa2f7, 0xa3f7, 0xa4f7, 0xa5f7, 0xa6f7, 0xa7f7, 0xa8f7, 0xa9f7, 0xaaf7, 0xabf7, 0xacf7,
-  0xadf7, 0xaef7, 0xaff7, 0xb0f7, 0xb1f7, 0xb2f7, 0xb3f7, 0xb4f7, 0xb5f7, 0xb6f7, 0xb7f7, 0xb8f7, 0xb9f7, 0xbaf7, 0xbbf7, 0xbcf7,
-  0xbdf7, 0xbef7, 0xbff7, 0xc0f7, 0xc1f7, 0xc2f7, 0xc3f7, 0xc4f7, 0xc5f7, 0xc6f7, 0xc7f7, 0xc8f7, 0xc9f7, 0xcaf7, 0xcbf7, 0xccf7,
-  0xcdf7, 0xcef7, 0xcff7, 0xd0f7, 0xd1f7, 0xd2f7, 0xd3f7, 0xd4f7, 0xd5f7, 0xd6f7, 0xd7f7, 0xd8f7, 0xd9f7, 0xdaf7, 0xdbf7, 0xdcf7,
-  0xddf7, 0xdef7, 0xdff7, 0xe0f7, 0xe1f7, 0xe2f7, 0xe3f7, 0xe4f7, 0xe5f7, 0xe6f7, 0xe7f7, 0xe8f7, 0xe9f7, 0xeaf7, 0xebf7, 0xecf7,
-  0xedf7, 0xeef7, 0xeff7, 0xf0f7, 0xf1f7, 0xf2f7, 0xf3f7, 0xf4f7, 0xf5f7, 0xf6f7, 0xf7f7, 0xf8f7, 0xf9f7, 0xfaf7, 0xfbf7, 0xfcf7,
-  0x40f8, 0x41f8, 0x42f8, 0x43f8, 0x44f8, 0x45f8, 0x46f8, 0x47f8, 0x48f8, 0x49f8, 0x4af8, 0x4bf8, 0x4cf8, 0x4df8, 0x4ef8, 0x4ff8,
-  0x50f8, 0x51f8, 0x52f8, 0x53f8, 0x54f8, 0x55f8, 0x56f8, 0x57f8, 0x58f8, 0x59f8, 0x5af8, 0x5bf8, 0x5cf8, 0x5df8, 0x5ef8, 0x5ff8,
-  0x60f8, 0x61f8, 0x62f8, 0x63f8, 0x64f8, 0x65f8, 0x66f8, 0x67f8, 0x68f8, 0x69f8, 0x6af8, 0x6bf8, 0x6cf8, 0x6df8, 0x6ef8, 0x6ff8,
-  0x70f8, 0x71f8, 0x72f8, 0x73f8, 0x74f8, 0x75f8, 0x76f8, 0x77f8, 0x78f8, 0x79f8, 0x7af8, 0x7bf8, 0x7cf8, 0x7df8, 0x7ef8, 0x80f8,
-  0x81f8, 0x82f8, 0x83f8, 0x84f8, 0x85f8, 0x86f8, 0x87f8, 0x88f8, 0x89f8, 0x8af8, 0x8bf8, 0x8cf8, 0x8df8, 0x8ef8, 0x8ff8, 0x90f8,
-  0x91f8, 0x92f8, 0x93f8, 0x94f8, 0x95f8, 0x96f8, 0x97f8, 0x98f8, 0x99f8, 0x9af8, 0x9bf8, 0x9cf8, 0x9df8, 0x9ef8, 0x9ff8, 0xa0f8,
-  0xa1f8, 0xa2f8, 0xa3f8, 0xa4f8, 0xa5f8, 0xa6f8, 0xa7f8, 0xa8f8, 0xa9f8, 0xaaf8, 0xabf8, 0xacf8, 0xadf8, 0xaef8, 0xaff8, 0xb0f8,
-  0xb1f8, 0xb2f8, 0xb3f8, 0xb4f8, 0xb5f8, 0xb6f8, 0xb7f8, 0xb8f8, 0xb9f8, 0xbaf8, 0xbbf8, 0xbcf8, 0xbdf8, 0xbef8, 0xbff8, 0xc0f8,
-  0xc1f8, 0xc2f8, 0xc3f8, 0xc4f8, 0xc5f8, 0xc6f8, 0xc7f8, 0xc8f8, 0xc9f8, 0xcaf8, 0xcbf8, 0xccf8, 0xcdf8, 0xcef8, 0xcff8, 0xd0f8,
-  0xd1f8, 0xd2f8, 0xd3f8, 0xd4f8, 0xd5f8, 0xd6f8, 0xd7f8, 0xd8f8, 0xd9f8, 0xdaf8, 0xdbf8, 0xdcf8, 0xddf8, 0xdef8, 0xdff8, 0xe0f8,
-  0xe1f8, 0xe2f8, 0xe3f8, 0xe4f8, 0xe5f8, 0xe6f8, 0xe7f8, 0xe8f8, 0xe9f8, 0xeaf8, 0xebf8, 0xecf8, 0xedf8, 0xeef8, 0xeff8, 0xf0f8,
-  0xf1f8, 0xf2f8, 0xf3f8, 0xf4f8, 0xf5f8, 0xf6f8, 0xf7f8, 0xf8f8, 0xf9f8, 0xfaf8, 0xfbf8, 0xfcf8, 0x40f9, 0x41f9, 0x42f9, 0x43f9,
-  0x44f9, 0x45f9, 0x46f9, 0x47f9, 0x48f9, 0x49f9, 0x4af9, 0x4bf9, 0x4cf9, 0x4df9, 0x4ef9, 0x4ff9, 0x50f9, 0x51f9, 0x52f9, 0x53f9,
-  0x54f9, 0x55f9, 0x56f9, 0x57f9, 0x58f9, 0x59f9, 0x5af9, 0x5bf9, 0x5cf9, 0x5df9, 0x5ef9, 0x5ff9, 0x60f9, 0x61f9, 0x62f9, 0x63f9,
-  0x64f9, 0x65f9, 0x66f9, 0x67f9, 0x68f9, 0x69f9, 0x6af9, 0x6bf9, 0x6cf9, 0x6df9, 0x6ef9, 0x6ff9, 0x70f9, 0x71f9, 0x72f9, 0x73f9,
-  0x74f9, 0x75f9, 0x76f9, 0x77f9, 0x78f9, 0x79f9, 0x7af9, 0x7bf9, 0x7cf9, 0x7df9, 0x7ef9, 0x80f9, 0x81f9, 0x82f9, 0x83f9, 0x84f9,
-  0x85f9, 0x86f9, 0x87f9, 0x88f9, 0x89f9, 0x8af9, 0x8bf9, 0x8cf9, 0x8df9, 0x8ef9, 0x8ff9, 0x90f9, 0x91f9, 0x92f9, 0x93f9, 0x94f9,
-  0x95f9, 0x96f9, 0x97f9, 0x98f9, 0x99f9, 0x9af9, 0x9bf9, 0x9cf9, 0x9df9, 0x9ef9, 0x9ff9, 0xa0f9, 0xa1f9, 0xa2f9, 0xa3f9, 0xa4f9,
-  0xa5f9, 0xa6f9, 0xa7f9, 0xa8f9, 0xa9f9, 0xaaf9, 0xabf9, 0xacf9, 0xadf9, 0xaef9, 0xaff9, 0xb0f9, 0xb1f9, 0xb2f9, 0xb3f9, 0xb4f9,
-  0xb5f9, 0xb6f9, 0xb7f9, 0xb8f9, 0xb9f9, 0xbaf9, 0xbbf9, 0xbcf9, 0xbdf9, 0xbef9, 0xbff9, 0xc0f9, 0xc1f9, 0xc2f9, 0xc3f9, 0xc4f9,
-  0xc5f9, 0xc6f9, 0xc7f9, 0xc8f9, 0xc9f9, 0xcaf9, 0xcbf9, 0xccf9, 0xcdf9, 0xcef9, 0xcff9, 0xd0f9, 0xd1f9, 0xd2f9, 0xd3f9, 0xd4f9,
-  0xd5f9, 0xd6f9, 0xd7f9, 0xd8f9, 0xd9f9, 0xdaf9, 0xdbf9, 0xdcf9, 0xddf9, 0xdef9, 0xdff9, 0xe0f9, 0xe1f9, 0xe2f9, 0xe3f9, 0xe4f9,
-  0xe5f9, 0xe6f9, 0xe7f9, 0xe8f9, 0xe9f9, 0xeaf9, 0xebf9, 0xecf9, 0xedf9, 0xeef9, 0xeff9, 0xf0f9, 0xf1f9, 0xf2f9, 0xf3f9, 0xf4f9,
-  0xf5f9, 0xf6f9, 0xf7f9, 0xf8f9, 0xf9f9, 0xfaf9, 0xfbf9, 0xfcf9, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, };
-static_assert(arraysize(_unicode_table_e000_e760) == 0xe760 - 0xe000);
-
-inline constexpr cat2 _unicode_table_f8f0_fa30[]{
-  0x00a0, 0x00fd, 0x00fe, 0x00ff, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe0fa, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0xe9fb, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x90fa, 0x9bfa,
-  0x9cfa, 0xb1fa, 0xd8fa, 0xe8fa, 0xeafa, 0x58fb, 0x5efb, 0x75fb, 0x7dfb, 0x7efb, 0x80fb, 0x82fb, 0x86fb, 0x89fb, 0x92fb, 0x9dfb,
-  0x9ffb, 0xa0fb, 0xa9fb, 0xb1fb, 0xb3fb, 0xb4fb, 0xb7fb, 0xd3fb, 0xdafb, 0xeafb, 0xf6fb, 0xf7fb, 0xf9fb, 0x49fc, 0x8888, 0x8888, };
-static_assert(arraysize(_unicode_table_f8f0_fa30) == 0xfa30 - 0xf8f0);
-
-inline constexpr cat2 _unicode_table_ff00_10000[]{
-  0x8888, 0x4981, 0x57fa, 0x9481, 0x9081, 0x9381, 0x9581, 0x56fa, 0x6981, 0x6a81, 0x9681, 0x7b81, 0x4381, 0x7c81, 0x4481, 0x5e81,
-  0x4f82, 0x5082, 0x5182, 0x5282, 0x5382, 0x5482, 0x5582, 0x5682, 0x5782, 0x5882, 0x4681, 0x4781, 0x8381, 0x8181, 0x8481, 0x4881,
-  0x9781, 0x6082, 0x6182, 0x6282, 0x6382, 0x6482, 0x6582, 0x6682, 0x6782, 0x6882, 0x6982, 0x6a82, 0x6b82, 0x6c82, 0x6d82, 0x6e82,
-  0x6f82, 0x7082, 0x7182, 0x7282, 0x7382, 0x7482, 0x7582, 0x7682, 0x7782, 0x7882, 0x7982, 0x6d81, 0x5f81, 0x6e81, 0x4f81, 0x5181,
-  0x4d81, 0x8182, 0x8282, 0x8382, 0x8482, 0x8582, 0x8682, 0x8782, 0x8882, 0x8982, 0x8a82, 0x8b82, 0x8c82, 0x8d82, 0x8e82, 0x8f82,
-  0x9082, 0x9182, 0x9282, 0x9382, 0x9482, 0x9582, 0x9682, 0x9782, 0x9882, 0x9982, 0x9a82, 0x6f81, 0x6281, 0x7081, 0x6081, 0x8888,
-  0x8888, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6, 0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af,
-  0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6, 0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf,
-  0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6, 0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf,
-  0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6, 0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x9181, 0x9281, 0xca81, 0x5081, 0x55fa, 0x8f81, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888,
-  0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x8888, 0x0080, 0x0080, };
-static_assert(arraysize(_unicode_table_ff00_10000) == 0x10000 - 0xff00);
+  0x0080, 0x0021, 0x9181, 0x9281, 0x005c, 0x007c, 0x9881, 0x4e81, 0x0063, 0x0061, 0xe181, 0xca81, 0x002d, 0x0052, 0x5081, 0x8b81,
+  0x7d81, 0x0032, 0x0033, 0x4c81, 0xca83, 0xf781, 0x4581, 0x4381, 0x0031, 0x006f, 0xe281, 0x0041, 0x0041, 0x0041, 0x0041, 0x0041,
+  0x0041, 0x0041, 0x0043, 0x0045, 0x0045, 0x0045, 0x0045, 0x0049, 0x0049, 0x0049, 0x0049, 0x0044, 0x004e, 0x004f, 0x004f, 0x004f,
+  0x004f, 0x004f, 0x7e81, 0x004f, 0x0055, 0x0055, 0x0055, 0x0055, 0x0059, 0x0054, 0x0073, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061,
+  0x0061, 0x0061, 0x0063, 0x0065, 0x0065, 0x0065, 0x0065, 0x0069, 0x0069, 0x0069, 0x0069, 0x0064, 0x006e, 0x006f, 0x006f, 0x006f,
+  0x006f, 0x006f, 0x8081, 0x006f, 0x0075, 0x0075, 0x0075, 0x0075, 0x0079, 0x0074, 0x0079, 0x9f83, 0xa083, 0xa183, 0xa283, 0xa383,
+  0xa483, 0xa583, 0xa683, 0xa783, 0xa883, 0xa983, 0xaa83, 0xab83, 0xac83, 0xad83, 0xae83, 0xaf83, 0xb083, 0xb183, 0xb283, 0xb383,
+  0xb483, 0xb583, 0xb683, 0xbf83, 0xc083, 0xc183, 0xc283, 0xc383, 0xc483, 0xc583, 0xc683, 0xc783, 0xc883, 0xc983, 0xca83, 0xcb83,
+  0xcc83, 0xcd83, 0xce83, 0xcf83, 0xd083, 0xd183, 0xd283, 0xd383, 0xd483, 0xd583, 0xd683, 0x4684, 0x4084, 0x4184, 0x4284, 0x4384,
+  0x4484, 0x4584, 0x4784, 0x4884, 0x4984, 0x4a84, 0x4b84, 0x4c84, 0x4d84, 0x4e84, 0x4f84, 0x5084, 0x5184, 0x5284, 0x5384, 0x5484,
+  0x5584, 0x5684, 0x5784, 0x5884, 0x5984, 0x5a84, 0x5b84, 0x5c84, 0x5d84, 0x5e84, 0x5f84, 0x6084, 0x7084, 0x7184, 0x7284, 0x7384,
+  0x7484, 0x7584, 0x7784, 0x7884, 0x7984, 0x7a84, 0x7b84, 0x7c84, 0x7d84, 0x7e84, 0x8084, 0x8184, 0x8284, 0x8384, 0x8484, 0x8584,
+  0x8684, 0x8784, 0x8884, 0x8984, 0x8a84, 0x8b84, 0x8c84, 0x8d84, 0x8e84, 0x8f84, 0x9084, 0x9184, 0x7684, 0x5d81, 0x5c81, 0x6581,
+  0x6681, 0x6781, 0x6881, 0xf581, 0xf681, 0x6481, 0x6381, 0xf181, 0x8c81, 0x8d81, 0xa681, 0x8e81, 0x8287, 0x8487, 0xf081, 0x5487,
+  0x5587, 0x5687, 0x5787, 0x5887, 0x5987, 0x5a87, 0x5b87, 0x5c87, 0x5d87, 0x40fa, 0x41fa, 0x42fa, 0x43fa, 0x44fa, 0x45fa, 0x46fa,
+  0x47fa, 0x48fa, 0x49fa, 0xa981, 0xaa81, 0xa881, 0xab81, 0xcb81, 0xcc81, 0xcd81, 0xdd81, 0xce81, 0xde81, 0xb881, 0xb981, 0x9487,
+  0xe381, 0xe581, 0x8781, 0x9887, 0xda81, 0x6181, 0xc881, 0xc981, 0xbf81, 0xbe81, 0xe781, 0xe881, 0x9387, 0x8881, 0xe681, 0xe481,
+  0xe081, 0x8281, 0xdf81, 0x8581, 0x8681, 0xe181, 0xe281, 0xbc81, 0xbd81, 0xba81, 0xbb81, 0xdb81, 0x9987, 0xdc81, 0x4087, 0x4187,
+  0x4287, 0x4387, 0x4487, 0x4587, 0x4687, 0x4787, 0x4887, 0x4987, 0x4a87, 0x4b87, 0x4c87, 0x4d87, 0x4e87, 0x4f87, 0x5087, 0x5187,
+  0x5287, 0x5387, 0x9f84, 0xaa84, 0xa084, 0xab84, 0xa184, 0xac84, 0xa284, 0xad84, 0xa484, 0xaf84, 0xa384, 0xae84, 0xa584, 0xba84,
+  0xb584, 0xb084, 0xa784, 0xbc84, 0xb784, 0xb284, 0xa684, 0xb684, 0xbb84, 0xb184, 0xa884, 0xb884, 0xbd84, 0xb384, 0xa984, 0xb984,
+  0xbe84, 0xb484, 0xa181, 0xa081, 0xa381, 0xa281, 0xa581, 0xa481, 0x9f81, 0x9e81, 0x9b81, 0x9d81, 0x9c81, 0xfc81, 0x9a81, 0x9981,
+  0x8a81, 0x8981, 0xf481, 0xf381, 0xf281, 0x4081, 0x4181, 0x4281, 0x5681, 0x5881, 0x5981, 0x5a81, 0x7181, 0x7281, 0x7381, 0x7481,
+  0x7581, 0x7681, 0x7781, 0x7881, 0x7981, 0x7a81, 0xa781, 0xac81, 0x6b81, 0x6c81, 0x8087, 0x8187, 0x9f82, 0xa082, 0xa182, 0xa282,
+  0xa382, 0xa482, 0xa582, 0xa682, 0xa782, 0xa882, 0xa982, 0xaa82, 0xab82, 0xac82, 0xad82, 0xae82, 0xaf82, 0xb082, 0xb182, 0xb282,
+  0xb382, 0xb482, 0xb582, 0xb682, 0xb782, 0xb882, 0xb982, 0xba82, 0xbb82, 0xbc82, 0xbd82, 0xbe82, 0xbf82, 0xc082, 0xc182, 0xc282,
+  0xc382, 0xc482, 0xc582, 0xc682, 0xc782, 0xc882, 0xc982, 0xca82, 0xcb82, 0xcc82, 0xcd82, 0xce82, 0xcf82, 0xd082, 0xd182, 0xd282,
+  0xd382, 0xd482, 0xd582, 0xd682, 0xd782, 0xd882, 0xd982, 0xda82, 0xdb82, 0xdc82, 0xdd82, 0xde82, 0xdf82, 0xe082, 0xe182, 0xe282,
+  0xe382, 0xe482, 0xe582, 0xe682, 0xe782, 0xe882, 0xe982, 0xea82, 0xeb82, 0xec82, 0xed82, 0xee82, 0xef82, 0xf082, 0xf182, 0x9483,
+  0x4a81, 0x4b81, 0x4a81, 0x4b81, 0x5481, 0x5581, 0x4083, 0x4183, 0x4283, 0x4383, 0x4483, 0x4583, 0x4683, 0x4783, 0x4883, 0x4983,
+  0x4a83, 0x4b83, 0x4c83, 0x4d83, 0x4e83, 0x4f83, 0x5083, 0x5183, 0x5283, 0x5383, 0x5483, 0x5583, 0x5683, 0x5783, 0x5883, 0x5983,
+  0x5a83, 0x5b83, 0x5c83, 0x5d83, 0x5e83, 0x5f83, 0x6083, 0x6183, 0x6283, 0x6383, 0x6483, 0x6583, 0x6683, 0x6783, 0x6883, 0x6983,
+  0x6a83, 0x6b83, 0x6c83, 0x6d83, 0x6e83, 0x6f83, 0x7083, 0x7183, 0x7283, 0x7383, 0x7483, 0x7583, 0x7683, 0x7783, 0x7883, 0x7983,
+  0x7a83, 0x7b83, 0x7c83, 0x7d83, 0x7e83, 0x8083, 0x8183, 0x8283, 0x8383, 0x8483, 0x8583, 0x8683, 0x8783, 0x8883, 0x8983, 0x8a83,
+  0x8b83, 0x8c83, 0x8d83, 0x8e83, 0x8f83, 0x9083, 0x9183, 0x9283, 0x9383, 0x9483, 0x9583, 0x9683, 0x4581, 0x5b81, 0x5281, 0x5381,
+  0x8a87, 0x8b87, 0x8c87, 0x8587, 0x8687, 0x8787, 0x8887, 0x8987, 0x6587, 0x6987, 0x6087, 0x6387, 0x6187, 0x6b87, 0x6a87, 0x6487,
+  0x6c87, 0x6687, 0x6e87, 0x5f87, 0x6d87, 0x6287, 0x6787, 0x6887, 0x7e87, 0x8f87, 0x8e87, 0x8d87, 0x7287, 0x7387, 0x6f87, 0x7087,
+  0x7187, 0x7587, 0x7487, 0x8387, 0xea88, 0x9a92, 0xb58e, 0x9c96, 0xe48f, 0x4f8e, 0xe38f, 0xba89, 0x7395, 0x5e97, 0xa098, 0x4e89,
+  0x8e8a, 0xa198, 0xa290, 0xc099, 0x758b, 0xb895, 0xe58f, 0xbc97, 0xc095, 0x68fa, 0xa298, 0x8692, 0xa398, 0xf88b, 0xa498, 0xdb8a,
+  0x4f92, 0xe58e, 0xa598, 0xa698, 0xa798, 0x5494, 0x768b, 0x5694, 0xe193, 0xc18c, 0x5296, 0x68e5, 0xa898, 0xe68f, 0xa998, 0xb389,
+  0xe38b, 0xee8c, 0xe796, 0xa49b, 0x9097, 0xfb93, 0xa38a, 0x548b, 0xaa98, 0xab98, 0xb997, 0x5c97, 0x8891, 0xad98, 0x968e, 0xf193,
+  0xb098, 0x5d89, 0xdd8c, 0xdc8c, 0xe488, 0x6a98, 0x6998, 0xb18d, 0x9f88, 0xb198, 0xb298, 0xb398, 0x5396, 0xb498, 0xf08c, 0xe588,
+  0x9296, 0x9c8b, 0x9d8b, 0x9e8b, 0xe092, 0xba97, 0xb598, 0xb698, 0xb798, 0x6c90, 0x598f, 0x6d90, 0xbc98, 0xba98, 0xbb98, 0x778b,
+  0xa18d, 0xee89, 0xb998, 0xb898, 0xa795, 0x658e, 0x648e, 0xbc91, 0xbd98, 0x7495, 0xe590, 0x5781, 0xbe98, 0xc098, 0x69fa, 0xe391,
+  0xdf97, 0xc888, 0xbf98, 0xbc89, 0xc28b, 0x8792, 0x8f8c, 0xc198, 0x4394, 0x6afa, 0x6bfa, 0xe98a, 0x6cfa, 0xc298, 0xc988, 0xde8c,
+  0xea8a, 0x9a95, 0xb094, 0x788b, 0xef89, 0xe598, 0x6093, 0x8c94, 0xc498, 0xba94, 0xe097, 0x4c90, 0x6dfa, 0x668e, 0x978e, 0xbe89,
+  0xcf92, 0x4192, 0xc898, 0xca88, 0xe192, 0x5a8f, 0xb28d, 0x4397, 0xcc91, 0xbd89, 0x6efa, 0xc798, 0x5d97, 0xc398, 0xc598, 0xec8d,
+  0xc698, 0x439b, 0xce98, 0xd198, 0xcf98, 0xc089, 0xb995, 0xc998, 0xcd98, 0xf18c, 0x678e, 0xa48a, 0xd298, 0xca98, 0x70fa, 0xe197,
+  0x988e, 0xcb98, 0xd098, 0x6ffa, 0x72fa, 0xd398, 0xcc98, 0x71fa, 0x9f8b, 0xcb88, 0xa08b, 0xbf89, 0x449b, 0x9996, 0x8e95, 0xf28c,
+  0x4e90, 0xb597, 0xd695, 0x578c, 0xa391, 0xe289, 0x61fa, 0x728f, 0x73fa, 0xd798, 0xdc98, 0xda98, 0xd598, 0xad91, 0xd898, 0xdb98,
+  0xd998, 0xdb95, 0xd698, 0x4d90, 0x9396, 0xdd98, 0xde98, 0x438f, 0xeb98, 0x6f94, 0x5595, 0xe698, 0xee95, 0xb489, 0xea98, 0x76fa,
+  0xe498, 0xed98, 0x7191, 0xc28c, 0x7b94, 0xc5e0, 0xec98, 0x7c93, 0xe198, 0xf48c, 0xf38c, 0xdf98, 0x77fa, 0xd88e, 0xe798, 0x75fa,
+  0xed95, 0x6c92, 0xe398, 0x918c, 0xe098, 0xe898, 0xe298, 0xcf97, 0xe998, 0x6098, 0xe48b, 0x908c, 0x74fa, 0x7afa, 0xee98, 0x78fa,
+  0xef98, 0xf398, 0xcc88, 0xce95, 0xf298, 0xf198, 0xf598, 0xf498, 0xe292, 0x928c, 0xf698, 0x79fa, 0xc38e, 0xa491, 0xe392, 0xf48b,
+  0xf798, 0x558b, 0xf898, 0xfa98, 0x5496, 0x868c, 0x7bfa, 0x508e, 0xf594, 0xf998, 0xc38d, 0x6297, 0xfc98, 0x4299, 0xfb98, 0xc28d,
+  0x9d8f, 0x588c, 0x4399, 0xcd8b, 0x4099, 0x4199, 0xad93, 0x9c91, 0xa18b, 0x6c96, 0x4499, 0x7dfa, 0xbb97, 0x4599, 0x4899, 0x4699,
+  0x6d91, 0x4799, 0x4999, 0x7cfa, 0x4b99, 0x4a99, 0xc695, 0x568b, 0x4d99, 0x4e99, 0xad89, 0x4c99, 0xf28e, 0x5199, 0x5099, 0x4f99,
+  0xd498, 0x5299, 0x9e8f, 0x5399, 0x4497, 0xd796, 0x5599, 0x5499, 0x5799, 0x5699, 0x5899, 0x5999, 0xf288, 0xb38c, 0x5a8c, 0x5b8f,
+  0x9b92, 0xa28b, 0xe690, 0xf58c, 0x7efa, 0x8e8d, 0x5b99, 0xc696, 0x6593, 0x998e, 0x5a99, 0x5c99, 0x7d93, 0x958a, 0x5d99, 0x80fa,
+  0xfc93, 0x5391, 0x5f99, 0x6099, 0xaa94, 0xf68c, 0x5a98, 0x6199, 0xa48b, 0xba95, 0xb491, 0xef8b, 0x5493, 0x938c, 0x6299, 0x6399,
+  0xe093, 0x7e89, 0x6699, 0xfb8d, 0x6599, 0xc48d, 0x6799, 0xece3, 0x6899, 0x6096, 0x6999, 0x6a99, 0x6b99, 0xe78f, 0xca8e, 0x81fa,
+  0xa58a, 0x6e99, 0x6c99, 0xbb96, 0x6d99, 0x7995, 0x6f99, 0x7099, 0x7199, 0x7e93, 0x7599, 0x7399, 0x7499, 0x7299, 0xe18d, 0x7699,
+  0xe896, 0xe297, 0x7799, 0x82fa, 0xa690, 0x7899, 0x798f, 0x7999, 0x9c92, 0xbd97, 0x8093, 0xc399, 0x7a99, 0xa3ea, 0xc38b, 0x7b99,
+  0x7d96, 0x888f, 0xfa91, 0x7d99, 0xe293, 0x83fa, 0x7e99, 0x8099, 0x4d8a, 0x8199, 0xa58b, 0xca93, 0x9a89, 0x6f8f, 0x9f94, 0x8299,
+  0x8193, 0x6e90, 0x8399, 0xaa95, 0xd890, 0xa08a, 0xa78a, 0x8499, 0x8699, 0x598c, 0x8599, 0x84fa, 0xf197, 0x898f, 0xbb94, 0xca95,
+  0x8799, 0x9897, 0x8899, 0x8999, 0x9e93, 0x8a99, 0xa790, 0xfc8d, 0x948c, 0x8b99, 0x688e, 0x8f8d, 0xe492, 0x8d99, 0xa591, 0xed8d,
+  0x8e99, 0x8f99, 0x4f91, 0x8c99, 0x9199, 0x5596, 0x848d, 0x9099, 0x958c, 0xdc8d, 0x8d94, 0x9499, 0x9299, 0x9b95, 0xe88f, 0x9b99,
+  0x848a, 0x9599, 0x9399, 0x6e91, 0x9799, 0x9699, 0x638a, 0x808c, 0x9c99, 0xab97, 0x9899, 0x9d99, 0x9a99, 0x9999, 0xcd97, 0x85fa,
+  0xf78c, 0xc189, 0xf297, 0x86fa, 0x958f, 0x7793, 0x858d, 0xa099, 0xa199, 0x77fb, 0xe397, 0x4a98, 0xa399, 0xf88c, 0xa299, 0x4e8a,
+  0x87fa, 0xa499, 0x7596, 0xba92, 0x4597, 0xd795, 0xa599, 0xd3e8, 0xae93, 0xa699, 0xa88a, 0xb196, 0x88fa, 0x9f8f, 0xa799, 0xe595,
+  0xab99, 0xa890, 0xa899, 0xce8b, 0xa999, 0xa98a, 0x4d8c, 0xac99, 0xad99, 0xae99, 0xaf99, 0xd98e, 0xf98c, 0xdc96, 0x89fa, 0xe696,
+  0xf593, 0xef95, 0xb099, 0x8afa, 0xb199, 0xb399, 0xb599, 0xb499, 0xb699, 0xbb89, 0x6b96, 0xfa8d, 0xb799, 0x7891, 0xa08f, 0xa78b,
+  0xb899, 0x8bfa, 0xd994, 0xb999, 0xba99, 0xbb99, 0xbc99, 0x4395, 0xe68b, 0xe388, 0xbd93, 0xbd99, 0x5c8f, 0xe790, 0xbf99, 0xbe99,
+  0xa18f, 0xdf8c, 0xc199, 0xbc94, 0xc299, 0xda94, 0xb291, 0xec91, 0xa68b, 0xec93, 0x5092, 0x8e94, 0x6d96, 0xc499, 0xe890, 0x548c,
+  0xc599, 0xc699, 0x4b89, 0xf388, 0xeb8a, 0x8cfa, 0xa691, 0x708b, 0x9197, 0xc999, 0xb589, 0xc899, 0xa88b, 0xca99, 0xef96, 0x8dfa,
+  0xcb99, 0xd097, 0xfa8c, 0xb48c, 0xcc99, 0xce99, 0xcd99, 0x7e90, 0x5889, 0x7d89, 0xcf99, 0xd099, 0x8efa, 0xb58c, 0xd199, 0x8e8b,
+  0x518e, 0xd299, 0x9496, 0xb38d, 0x798b, 0x4697, 0x6f91, 0xbd94, 0xfb8e, 0x668f, 0xe68e, 0xf38e, 0x968f, 0xbe94, 0x8ffa, 0xd599,
+  0x6289, 0x7091, 0xfb8c, 0xc38c, 0xe58b, 0xd999, 0x4092, 0xfc91, 0xa98b, 0xa28f, 0xda99, 0xd899, 0xc289, 0xe491, 0xb68e, 0x6a8e,
+  0x4589, 0x908a, 0x868d, 0x698e, 0xdb99, 0xdc99, 0x688b, 0x658a, 0x878d, 0x678b, 0xdd92, 0x4489, 0xaf93, 0xbc96, 0x408d, 0x9997,
+  0x6693, 0xfc8c, 0x4e8c, 0xe599, 0xe18b, 0x6996, 0xdb94, 0xe499, 0xdc8a, 0xdf99, 0xe099, 0xe299, 0xe399, 0x7a8b, 0x8190, 0xab95,
+  0xe199, 0xdd99, 0xe18c, 0xde99, 0x4398, 0xf095, 0xe692, 0xe08c, 0x908d, 0xe699, 0xdb93, 0xea99, 0xfc8e, 0xf48e, 0xed99, 0xeb99,
+  0xa196, 0xe899, 0xf199, 0xec99, 0xef99, 0xc48c, 0xbd96, 0xf099, 0xf299, 0xf499, 0x92fa, 0xee8d, 0x6198, 0xe999, 0xe799, 0xf399,
+  0xee99, 0x91fa, 0xf699, 0x429a, 0xf899, 0xfc99, 0x93fa, 0x409a, 0xf999, 0x5d9a, 0xe78d, 0x508a, 0xf799, 0x449a, 0xf488, 0x439a,
+  0xa388, 0x6995, 0x419a, 0xfa99, 0xf599, 0xfb99, 0xc68d, 0x459a, 0xf588, 0x4e9a, 0x469a, 0x479a, 0xa38f, 0x8996, 0x4c9a, 0x4b9a,
+  0x4e93, 0x4d9a, 0x4a9a, 0x94fa, 0x5389, 0xb48d, 0x4f90, 0x489a, 0x8293, 0x499a, 0xa088, 0x539a, 0x4297, 0xa58f, 0x599a, 0x589a,
+  0x4f9a, 0xc191, 0x509a, 0xed91, 0x559a, 0xa48f, 0x529a, 0xe296, 0x5b8c, 0x569a, 0x579a, 0x549a, 0x5a9a, 0x519a, 0x609a, 0x659a,
+  0x619a, 0x5c9a, 0x669a, 0x5091, 0x95fa, 0x689a, 0x418d, 0x5e9a, 0x9d92, 0x629a, 0x5b9a, 0xab8a, 0xec8a, 0x858a, 0x639a, 0x5f9a,
+  0x968c, 0x699a, 0x679a, 0x7291, 0x698b, 0xaa8b, 0x649a, 0xf28b, 0x6389, 0x6d9a, 0x6b9a, 0xa59a, 0x709a, 0x6a9a, 0x6e9a, 0x6c9a,
+  0x6b8e, 0x6f9a, 0x729a, 0x779a, 0x759a, 0x749a, 0x5192, 0xc389, 0x719a, 0x739a, 0xa68f, 0x5289, 0x769a, 0xdc89, 0x829a, 0xfa8f,
+  0x7d9a, 0x7b9a, 0x7c9a, 0x7e9a, 0x5c89, 0x5891, 0x789a, 0x799a, 0x9a8a, 0x819a, 0xed8a, 0x849a, 0x809a, 0x839a, 0xac95, 0xd393,
+  0xb694, 0x869a, 0x859a, 0x648a, 0x879a, 0x8a9a, 0x899a, 0x889a, 0x5894, 0x8b9a, 0x8c9a, 0x8e9a, 0x8d9a, 0x909a, 0x939a, 0x919a,
+  0x8f9a, 0x929a, 0x949a, 0x959a, 0x969a, 0x979a, 0x989a, 0x6499, 0xfa8e, 0x6c8e, 0xf189, 0xf688, 0x6392, 0x999a, 0xa28d, 0xcd88,
+  0x7d90, 0x9a9a, 0xc58c, 0x918d, 0x9c9a, 0x9b9a, 0xde95, 0x9d9a, 0x9f9a, 0x9e9a, 0xa09a, 0xa19a, 0x978c, 0x8089, 0xa29a, 0xa49a,
+  0xa39a, 0xa69a, 0x7993, 0xa79a, 0xb388, 0xdd8d, 0x5c8c, 0x6e92, 0xa89a, 0xa99a, 0xab9a, 0xac9a, 0xe28d, 0xcf8b, 0x5696, 0xaa9a,
+  0xad9a, 0xbf8d, 0x428d, 0x96fa, 0xb19a, 0xa38d, 0x97fa, 0x5292, 0xae9a, 0xd892, 0xb29a, 0x8290, 0xb09a, 0xb39a, 0x5e8c, 0xb49a,
+  0xb59a, 0x438d, 0x5f8a, 0xb79a, 0xb89a, 0x98fa, 0xb99a, 0xb69a, 0xaf9a, 0xba9a, 0xbb9a, 0x9afa, 0x99fa, 0x8496, 0xe98f, 0xbd9a,
+  0xbe9a, 0xbc9a, 0xc09a, 0x5794, 0xe688, 0x7595, 0xc19a, 0xfb8f, 0xb78e, 0x7c94, 0xee8a, 0xe98d, 0x7896, 0xb093, 0x988c, 0xcd91,
+  0xbf9a, 0xc29a, 0xc291, 0xc39a, 0xc49a, 0xc69a, 0xe792, 0xac8a, 0x9fea, 0x8189, 0xf195, 0xea8f, 0x6793, 0xe48d, 0xcc9a, 0xbb95,
+  0xdb97, 0xf289, 0xc89a, 0x5991, 0xcb9a, 0x8393, 0x6893, 0x8493, 0xb794, 0xcb92, 0xc78d, 0xc79a, 0x9689, 0x5593, 0xc99a, 0xc59a,
+  0x6f90, 0xcd9a, 0x6d8f, 0xab8b, 0xce9a, 0xe695, 0x9d91, 0xc492, 0x9dfa, 0xd09a, 0x6e96, 0xd19a, 0xd69a, 0x9efa, 0xad95, 0xd59a,
+  0xcf9a, 0xd29a, 0xd49a, 0xa48d, 0xc795, 0xd79a, 0x6492, 0xf389, 0xeb8f, 0xd99a, 0xd89a, 0x888d, 0xda9a, 0xdc9a, 0xdb9a, 0xde9a,
+  0xd39a, 0xe09a, 0xdf9a, 0xdd9a, 0x6d8e, 0x7090, 0x7391, 0xe19a, 0xba90, 0xeb88, 0x8494, 0xd992, 0xe39a, 0xe29a, 0xe49a, 0xe59a,
+  0xe69a, 0xe79a, 0xcf95, 0xe89a, 0x9ffa, 0xc489, 0xe99a, 0x5b97, 0x4f8a, 0xc799, 0x678f, 0xbd91, 0xea9a, 0xe996, 0xb296, 0xec9a,
+  0xe591, 0x5693, 0xbe91, 0x7695, 0xed9a, 0xee9a, 0x9b89, 0xb88e, 0xef9a, 0xce88, 0xf09a, 0xf19a, 0x8289, 0xef8a, 0xde93, 0xf295,
+  0xf59a, 0x7491, 0xf49a, 0x5f8c, 0xa0fa, 0x7a96, 0xf39a, 0x8593, 0xf79a, 0xf69a, 0xa1fa, 0xa2fa, 0xf99a, 0xf89a, 0xa3fa, 0x9c89,
+  0xfa9a, 0xa78f, 0xfc9a, 0x4492, 0xfb9a, 0xb195, 0x978f, 0x7a93, 0x409b, 0x448d, 0x419b, 0x4094, 0xdc94, 0xcf96, 0x4494, 0x4a9b,
+  0x578b, 0x6497, 0xad96, 0xaa9b, 0x429b, 0x459b, 0xa4fa, 0xc391, 0x5796, 0x6993, 0x469b, 0x8596, 0xa5fa, 0xc88d, 0xa88f, 0x479b,
+  0x6f8e, 0x6e8e, 0xb788, 0xc68c, 0xa990, 0xcf88, 0x4b9b, 0x4c9b, 0x499b, 0x5789, 0xad8a, 0x489b, 0xc396, 0x5095, 0xa688, 0xf788,
+  0x708e, 0xd088, 0xa188, 0x519b, 0x4f9b, 0xba96, 0x529b, 0x509b, 0x4e9b, 0x5090, 0x4d9b, 0xd895, 0xe28c, 0x569b, 0x579b, 0xa98f,
+  0x539b, 0x4b98, 0x6b94, 0x559b, 0xa58d, 0x589b, 0x7795, 0x599b, 0x549b, 0xb996, 0x7d94, 0x5a9b, 0x5195, 0x5b9b, 0x5f9b, 0x5c9b,
+  0xc589, 0x5e9b, 0xb98e, 0x5d9b, 0x998c, 0x6b9b, 0x649b, 0x619b, 0x8492, 0x609b, 0x629b, 0x639b, 0x659b, 0x669b, 0xf08a, 0x689b,
+  0x679b, 0x699b, 0xec8f, 0x6c9b, 0xda92, 0x6489, 0x6a9b, 0x6d9b, 0x6e9b, 0x719b, 0x6f9b, 0x709b, 0x718e, 0x729b, 0x458d, 0x739b,
+  0xa6fa, 0x9a8e, 0xb691, 0x749b, 0x759b, 0x798e, 0x468d, 0xd096, 0x478b, 0xc78c, 0x769b, 0x778a, 0x779b, 0xb791, 0x789b, 0xa19b,
+  0x799b, 0x7a9b, 0x7b9b, 0x7d9b, 0x7e9b, 0x809b, 0xee91, 0x4689, 0xe78e, 0xc088, 0x7691, 0xae8a, 0xb38e, 0x478d, 0x8693, 0x408f,
+  0xaf8a, 0x8892, 0xe892, 0xb688, 0x588b, 0xf395, 0xc08e, 0x718b, 0xe990, 0xba8e, 0x4797, 0x819b, 0x7b8b, 0xc98d, 0x518a, 0x8389,
+  0xaa8f, 0xc689, 0x829b, 0x6597, 0x688f, 0xa7fa, 0xe28e, 0x839b, 0xf18a, 0xd093, 0xa796, 0x849b, 0x859b, 0x7895, 0x879b, 0xa68a,
+  0xf58b, 0x869b, 0xa9fa, 0xb08a, 0x5190, 0x8b9b, 0x408e, 0xc789, 0x8a9b, 0x889b, 0x8c9b, 0x899b, 0x4a94, 0xcb9e, 0x5290, 0x8d9b,
+  0xaafa, 0xbe97, 0x8e9b, 0x909b, 0x9e92, 0x8f9b, 0xa190, 0x9b8e, 0xce91, 0xf58e, 0x9595, 0xea90, 0xcb8e, 0x919b, 0xab8f, 0x929b,
+  0x939b, 0xd188, 0xb891, 0x7190, 0x949b, 0xb193, 0xac8f, 0xad8f, 0x959b, 0xeb90, 0xae8f, 0xabfa, 0x969b, 0x979b, 0xde96, 0x989b,
+  0xc48b, 0x418f, 0x999b, 0x9a9b, 0xda8e, 0x4b90, 0xf293, 0x7390, 0xf694, 0x4194, 0xc78b, 0x9b9b, 0x8f8b, 0x9c9b, 0xfc8b, 0xcd93,
+  0xae89, 0x728e, 0x9d9b, 0xa09b, 0x9f9b, 0xfb8b, 0x9e9b, 0x5793, 0xae91, 0x6a93, 0xc68e, 0x7791, 0x9a97, 0xa29b, 0xa39b, 0xd493,
+  0x528e, 0xa59b, 0xa69b, 0xa79b, 0xf28a, 0xa89b, 0xa99b, 0xaa89, 0xacfa, 0x5a91, 0xe28a, 0xab9b, 0xa696, 0xd091, 0x788a, 0xad9b,
+  0xaf9b, 0xdd8a, 0xadfa, 0xac9b, 0xae9b, 0xb19b, 0xb09b, 0xb29b, 0xb39b, 0xbb93, 0xac8b, 0xe389, 0xb49b, 0xb99b, 0xb79b, 0xf595,
+  0xf495, 0xaefa, 0x8793, 0xb69b, 0x738f, 0xb59b, 0x9290, 0xba9b, 0xe88d, 0xc09b, 0xc19b, 0xbb9b, 0x528a, 0xbc9b, 0xc59b, 0xc49b,
+  0xc39b, 0xbf9b, 0xbe9b, 0xc29b, 0xaffa, 0xf695, 0xb2fa, 0xc99b, 0xc69b, 0xc89b, 0x9297, 0xc79b, 0xb0fa, 0xbd9b, 0x9390, 0xca9b,
+  0xb3fa, 0xb58d, 0xcb9b, 0xcc9b, 0xcf9b, 0xce9b, 0xcd9b, 0x8893, 0xb89b, 0xd59b, 0xd19b, 0xd09b, 0xd29b, 0xd39b, 0xd69b, 0xb4fa,
+  0xb5fa, 0xe497, 0xd79b, 0xd49b, 0xd89b, 0xde8a, 0xd99b, 0xb6fa, 0xdb9b, 0xda9b, 0xdc9b, 0xdd9b, 0xec90, 0x428f, 0x848f, 0x8391,
+  0x488d, 0xb68d, 0x498d, 0x908b, 0xde9b, 0xb78d, 0xc88c, 0xdf9b, 0xa496, 0x6294, 0xe09b, 0x4a8d, 0xaa8a, 0x4692, 0xd08b, 0x738e,
+  0x7a95, 0xbf94, 0xe19b, 0xf38a, 0xe49b, 0x9f92, 0xe39b, 0xe29b, 0xe59b, 0xe992, 0x8390, 0x748e, 0xc890, 0xd191, 0x418b, 0xa092,
+  0xe69b, 0xe79b, 0xed8f, 0x5896, 0xea9b, 0xe99b, 0xe89b, 0x9d95, 0xf19b, 0x7996, 0xeb9b, 0xed9b, 0x8b96, 0xec9b, 0xee9b, 0xa694,
+  0xef9b, 0xbc95, 0xf09b, 0xb18a, 0xbd95, 0x4e94, 0xf29b, 0xf39b, 0x4b8d, 0xb28a, 0xf49b, 0xb68c, 0x6397, 0x4897, 0xf48a, 0xf69b,
+  0xa192, 0x4c8d, 0xaf8f, 0xdd94, 0xb08f, 0x988f, 0xea92, 0xf795, 0x5893, 0x4d8d, 0x7b95, 0xf79b, 0x7893, 0xc08d, 0xc98c, 0xeb92,
+  0xc188, 0x8e8f, 0x4e8d, 0x6697, 0xf89b, 0xf99b, 0x7094, 0xfa9b, 0xf597, 0x4c98, 0xfc9b, 0xfb9b, 0x668a, 0x409c, 0x439c, 0x449c,
+  0x429c, 0x5f95, 0xb18f, 0x469c, 0x459c, 0x419c, 0x479c, 0x489c, 0x499c, 0x4c9c, 0x4a9c, 0x4b9c, 0x4d9c, 0x8489, 0xec92, 0x4e9c,
+  0x9a8c, 0xf489, 0x5594, 0x4f9c, 0xf993, 0xd995, 0x509c, 0x4d98, 0x519c, 0xbe95, 0x549c, 0x9f98, 0xaf98, 0xae8e, 0xf393, 0x559c,
+  0x7c8b, 0xa292, 0xf888, 0x569c, 0xa495, 0x4f8d, 0x6f92, 0xed92, 0xb7fa, 0xed96, 0xb78c, 0xca8c, 0x579c, 0x589c, 0x5e9c, 0xe38e,
+  0xb8fa, 0xa392, 0xad8b, 0x599c, 0x4a95, 0x6592, 0x5a9c, 0x67fa, 0x5b9c, 0xae8b, 0x5c9c, 0x5d9c, 0x5f9c, 0x9693, 0x609c, 0x619c,
+  0x629c, 0x539c, 0x529c, 0x639c, 0x608c, 0x4695, 0xb9fa, 0xca8d, 0x5695, 0xa492, 0x6a95, 0x649c, 0xb28f, 0x6589, 0x659c, 0x669c,
+  0xf096, 0xde94, 0x699c, 0x9d89, 0xaa90, 0x689c, 0x679c, 0x618c, 0xd291, 0x6d9c, 0x6b9c, 0x6a9c, 0xa597, 0xe38c, 0x998f, 0x6c9c,
+  0x6b93, 0x5d8f, 0xbe93, 0x709c, 0x6f9c, 0x6e9c, 0x719c, 0xe48c, 0x729c, 0x9c95, 0x7a8f, 0x739c, 0xf794, 0xbf93, 0xa592, 0xbafa,
+  0x4f93, 0x749c, 0x4a8b, 0x5390, 0x4b95, 0xf58a, 0x4594, 0x759c, 0x758e, 0x5996, 0x5a96, 0x9e89, 0x7a9c, 0xbbfa, 0x8992, 0x779c,
+  0xf589, 0xab9c, 0x799c, 0x4f94, 0x789c, 0x769c, 0x9a8d, 0x7c9c, 0x839c, 0x899c, 0x819c, 0x7b93, 0x869c, 0x7c95, 0x809c, 0x859c,
+  0xe597, 0x768e, 0xd391, 0x7d9c, 0x7d8b, 0x889c, 0xab90, 0x8589, 0x829c, 0xf689, 0x879c, 0xaf8b, 0x849c, 0x8a9c, 0x8c9c, 0x969c,
+  0x949c, 0x919c, 0x909c, 0xf697, 0x929c, 0xb08b, 0x508d, 0x9a8f, 0x999c, 0x8b9c, 0xbcfa, 0x8f9c, 0x7e9c, 0xf889, 0x939c, 0x959c,
+  0x7092, 0xa68d, 0xb689, 0x8d9c, 0x989c, 0x979c, 0xb18b, 0xa791, 0x868a, 0x628c, 0x8e9c, 0x9a9c, 0x9d9c, 0x9f9c, 0xbdfa, 0xbb8e,
+  0xbefa, 0xa59c, 0xee92, 0x9b9c, 0xa39c, 0xf789, 0xa19c, 0xa29c, 0x9e9c, 0xa09c, 0xe58c, 0x4997, 0xb38a, 0x7889, 0xa49c, 0x5994,
+  0xab88, 0xdf94, 0x7b9c, 0xaa9c, 0xae9c, 0xe396, 0xa79c, 0x8993, 0xac9c, 0xee8f, 0xad9c, 0xd593, 0x6698, 0xa99c, 0xc0fa, 0xaf9c,
+  0x9b8d, 0xc990, 0xbffa, 0xd288, 0xa89c, 0xa69c, 0x7991, 0x9c9c, 0x538e, 0xc491, 0xbb9c, 0xc2fa, 0x7a91, 0xb69c, 0xb39c, 0xb49c,
+  0xe48e, 0xb79c, 0xba9c, 0xb59c, 0x448f, 0xb89c, 0xb29c, 0xfa96, 0xf996, 0xbc9c, 0xbd9c, 0xd388, 0xc3fa, 0xb19c, 0xf08b, 0xa488,
+  0xb48a, 0xc1fa, 0xb99c, 0xc19c, 0xc09c, 0xc59c, 0xc5fa, 0xc69c, 0xc4fa, 0xc49c, 0xc79c, 0xbf9c, 0xc39c, 0xc89c, 0xc99c, 0xbe9c,
+  0x9c8e, 0xc29c, 0xd491, 0x518d, 0xb09c, 0x5490, 0xd69c, 0xe795, 0xcc9c, 0xcd9c, 0xce9c, 0xd59c, 0xd49c, 0x9d96, 0xb58a, 0xd29c,
+  0x648c, 0x538a, 0xcf9c, 0xb697, 0xd19c, 0xd488, 0xd39c, 0xca9c, 0xd09c, 0xd79c, 0x638c, 0xcb9c, 0x7c97, 0x4a97, 0xda9c, 0xde9c,
+  0x9e91, 0xf797, 0xdf9c, 0xdc9c, 0xd99c, 0xc6fa, 0xd89c, 0xdd9c, 0xae95, 0xb293, 0x658c, 0xe09c, 0xdb9c, 0xe19c, 0x9b8c, 0xaf89,
+  0xe99c, 0xb68a, 0xe79c, 0xe89c, 0xa78d, 0xe69c, 0xe49c, 0xe39c, 0xea9c, 0xe29c, 0xec9c, 0xf989, 0xee9c, 0xed9c, 0xa692, 0xf19c,
+  0xef9c, 0xe59c, 0x9c8c, 0xf09c, 0xf49c, 0xf39c, 0xf59c, 0xf29c, 0xf69c, 0xf79c, 0xf89c, 0xe895, 0xfa9c, 0xf99c, 0x5e8f, 0xac90,
+  0xe489, 0xfa89, 0xc7fa, 0xfb9c, 0xbd88, 0xca90, 0xfc9c, 0xc1e6, 0x409d, 0x818c, 0x419d, 0xed90, 0x429d, 0x439d, 0x598b, 0x449d,
+  0x459d, 0x469d, 0xd591, 0xcb8c, 0xdf96, 0x5b96, 0x8a8f, 0x479d, 0xee90, 0xbbe7, 0xe094, 0xe88e, 0xcb8d, 0x489d, 0xc591, 0xa595,
+  0xef91, 0x4b9d, 0x499d, 0x4c9d, 0x4a9d, 0x4d9d, 0xaf95, 0xb588, 0x7d95, 0xe194, 0x4e9d, 0x519d, 0xb38f, 0x5a8b, 0x4f9d, 0x569d,
+  0xb48f, 0x509d, 0x6394, 0x7d97, 0x529d, 0x539d, 0x579d, 0x8a93, 0x549d, 0x528d, 0xdc90, 0x659d, 0xb294, 0xf091, 0xc8fa, 0xe294,
+  0xab9d, 0xf895, 0xef92, 0x9596, 0x5a9d, 0x9f89, 0x8a92, 0x639d, 0x5392, 0x5d9d, 0x649d, 0x5f9d, 0x669d, 0x629d, 0x619d, 0x8f94,
+  0x5b9d, 0xfb89, 0x599d, 0x918b, 0xf191, 0x559d, 0x589d, 0x538d, 0xd990, 0xb58f, 0x609d, 0x7194, 0x928b, 0x678a, 0x878a, 0x4090,
+  0x689d, 0x6d9d, 0x699d, 0x9d8c, 0x6e9d, 0x418e, 0x898d, 0x458f, 0x5c9d, 0x9d8e, 0x6b9d, 0x778e, 0x6c9d, 0xc288, 0x679d, 0xa792,
+  0x938b, 0xb28b, 0x6a9d, 0xa588, 0xc18d, 0x5590, 0xf092, 0xd294, 0x709d, 0x7d91, 0xa891, 0x4a8e, 0x719d, 0x739d, 0x6f9d, 0xdf95,
+  0xbb92, 0x7b91, 0xf995, 0xcc8e, 0x809d, 0x7e9d, 0x9890, 0x9e8c, 0x789d, 0xb78f, 0xe693, 0x5094, 0x769d, 0x7c91, 0xf68e, 0x7b9d,
+  0xb68f, 0x759d, 0x7a9d, 0x7294, 0x749d, 0x408c, 0x7c8a, 0x7c9d, 0xa997, 0xcc8d, 0x5492, 0x799d, 0xda90, 0x548d, 0x8490, 0x8689,
+  0x5b91, 0x779d, 0x648b, 0x668c, 0xcd92, 0x7d9d, 0x7e91, 0x819d, 0x839d, 0xb591, 0x899d, 0x849d, 0x869d, 0x6095, 0xf192, 0x879d,
+  0x4b97, 0x6797, 0xb78a, 0xac88, 0x859d, 0x829d, 0xf68a, 0x8789, 0xc9fa, 0x889d, 0x6897, 0x8c9d, 0xb991, 0x939d, 0x8d9d, 0x8a9d,
+  0x919d, 0x729d, 0x8e9d, 0x929d, 0xc094, 0x8b93, 0x8b9d, 0x8f9d, 0x678c, 0xef8d, 0xdb90, 0x979d, 0x4593, 0xcafa, 0x949d, 0x8096,
+  0x959d, 0x969d, 0xcc96, 0xa090, 0x828c, 0x9d9d, 0x548e, 0x9a9d, 0x999d, 0x5194, 0xcbfa, 0xb393, 0x5093, 0x9b9d, 0x9c9d, 0x8f95,
+  0x6494, 0x428e, 0xef90, 0x6f96, 0x688a, 0xa39d, 0x9e9d, 0x6997, 0xa59d, 0xa19d, 0xa29d, 0x8091, 0xccfa, 0xa09d, 0x5e9d, 0xa49d,
+  0x9f9d, 0xa99d, 0xaa9d, 0x4693, 0xac9d, 0x438e, 0xa79d, 0x5b8b, 0xad9d, 0xa69d, 0xb19d, 0xb09d, 0xaf9d, 0xb29d, 0xb49d, 0xef8f,
+  0xb39d, 0xb79d, 0xb59d, 0xb69d, 0x909d, 0xb99d, 0xb89d, 0x989d, 0xba9d, 0xae9d, 0x788e, 0xbb9d, 0xbc9d, 0xbe9d, 0xbd9d, 0xbf9d,
+  0xfc89, 0x558d, 0xfa95, 0xad90, 0xcc8c, 0xc19d, 0xc49d, 0xcdfa, 0x7195, 0x7e8b, 0xc39d, 0xc29d, 0x7394, 0xc59d, 0xb38b, 0xc79d,
+  0xc69d, 0xb88a, 0x558e, 0xd693, 0x688c, 0x9490, 0xc89d, 0xae90, 0x4793, 0x7e95, 0xc99d, 0xca9d, 0xcb9d, 0xb695, 0x7c9b, 0xc490,
+  0x6b95, 0xd68d, 0xe394, 0xc194, 0x6c93, 0xbf97, 0xcd9d, 0xce8e, 0xce9d, 0xb488, 0xd28b, 0xcb90, 0x8095, 0xcf9d, 0x618e, 0x6692,
+  0x7a8e, 0x5690, 0xd09d, 0xfb95, 0x9789, 0x7b8e, 0xd39d, 0xd19d, 0xd49d, 0xb797, 0xd29d, 0xf990, 0xd59d, 0xb091, 0xd69d, 0xf88a,
+  0xd89d, 0xd79d, 0xd99d, 0xda9d, 0xf98a, 0xfa93, 0x5592, 0x8c8b, 0x7c8e, 0x8191, 0x7b8f, 0xae88, 0xdb9d, 0xa089, 0xdf9d, 0xcefa,
+  0x568d, 0xde9d, 0xa98d, 0xb88f, 0xd1fa, 0xdd9d, 0xb98f, 0xbe96, 0xa88d, 0xd588, 0xcc90, 0xcffa, 0xe49d, 0xd3fa, 0xaf90, 0x6689,
+  0xd4fa, 0x748f, 0x8696, 0xf08d, 0xba8f, 0xd2fa, 0xa590, 0x63fa, 0xe39d, 0xe19d, 0xe29d, 0xd0fa, 0x8b92, 0x459e, 0xe89d, 0x9e8e,
+  0x578d, 0xe69d, 0xe79d, 0x5790, 0xe59d, 0x4e8e, 0xd6fa, 0xd7fa, 0xea9d, 0xe99d, 0xee9d, 0xef9d, 0xeb9d, 0xd5fa, 0x418a, 0xec9d,
+  0xed9d, 0xd394, 0x8195, 0x698c, 0xf09d, 0xd9fa, 0xb090, 0xbb8f, 0x7192, 0xc58b, 0xf19d, 0xf59d, 0xc989, 0xf29d, 0xf49d, 0xf39d,
+  0x8b8f, 0x6792, 0xc388, 0xf69d, 0xdafa, 0xf79d, 0xdbfa, 0xa892, 0xef97, 0x628e, 0xe995, 0xdcfa, 0x5c96, 0x419e, 0xf99d, 0xfc9d,
+  0xfb9d, 0xddfa, 0xf89d, 0x409e, 0xdc93, 0xfa9d, 0x429e, 0x8c8f, 0x439e, 0x6a97, 0x9894, 0x449e, 0x469e, 0x479e, 0x489e, 0xc88b,
+  0x6789, 0x588d, 0x499e, 0x4a9e, 0x918f, 0x8291, 0xdefa, 0x66fa, 0xd699, 0x5d91, 0x5c91, 0xd691, 0xc58d, 0xf098, 0x8e8c, 0x4c97,
+  0xfc95, 0x9e95, 0xdffa, 0x4b9e, 0xf18d, 0xbd92, 0x4c9e, 0x4e98, 0x5d96, 0xa992, 0x4d9e, 0xfa8a, 0x4e9e, 0x4f9e, 0xd896, 0xa296,
+  0x9696, 0x7b96, 0x448e, 0x519e, 0xe98e, 0x7096, 0x539e, 0x569e, 0x559e, 0xf78a, 0x808b, 0x529e, 0x549e, 0x579e, 0x9990, 0x9b97,
+  0xc788, 0xde8d, 0xba91, 0xdb8e, 0xf18f, 0x5a9e, 0x6d93, 0x589e, 0xa991, 0x599e, 0xf08f, 0xdb96, 0x5b9e, 0x5c9e, 0x8897, 0xe1fa,
+  0x619e, 0x598d, 0x7494, 0x5e9e, 0x8c93, 0xdc9d, 0xe09d, 0x6e8b, 0x6694, 0x609e, 0xbc8f, 0xc294, 0x669e, 0xf894, 0x5d9e, 0x639e,
+  0x629e, 0xcd90, 0x8d96, 0xd197, 0x8796, 0xca89, 0x7d8e, 0x6798, 0x659e, 0x9590, 0x649e, 0x5f9e, 0xcd8c, 0x6b9e, 0x699e, 0xcb89,
+  0x679e, 0x6d9e, 0x739e, 0xe2fa, 0xe4fa, 0xc691, 0xbf95, 0x759e, 0x4195, 0x749e, 0x9094, 0x5e96, 0xb98a, 0xf590, 0x5f8f, 0xd192,
+  0x4d97, 0x709e, 0x6f9e, 0x719e, 0x6e9e, 0x769e, 0x6c9e, 0x6a9e, 0x729e, 0x689e, 0x8c92, 0xf696, 0xc48e, 0xf28d, 0xb88d, 0x8f96,
+  0x608a, 0xe5fa, 0xcc92, 0xc893, 0x6889, 0xf090, 0xb290, 0x498c, 0x789e, 0x5a8d, 0x9c8a, 0x7a9e, 0x948a, 0x819e, 0x7d9e, 0xf190,
+  0x6a8a, 0xaa8d, 0x698a, 0xcd8d, 0x7b9e, 0x858c, 0x6a8c, 0x8d93, 0xe6fa, 0x799e, 0xc488, 0x7c9e, 0x7e9e, 0xcb8b, 0x4b8c, 0xe3fa,
+  0xba8a, 0x6a8b, 0x829e, 0xf78d, 0x9196, 0x568e, 0x839e, 0x4f95, 0x8f9e, 0xb189, 0x849e, 0x959e, 0x859e, 0xc097, 0x8c9e, 0x7e94,
+  0x949e, 0x879e, 0xb288, 0x899e, 0x5b8d, 0x8b9e, 0x8a9e, 0x869e, 0x919e, 0xbd8f, 0xeb9a, 0xe68c, 0x9c97, 0x889e, 0xf292, 0x428a,
+  0xab8d, 0x809e, 0x909e, 0x818a, 0x8e9e, 0x929e, 0x8e93, 0xfc8a, 0xb09e, 0x64fa, 0xc796, 0x979e, 0xfb8a, 0x9e9e, 0xe7fa, 0x5f96,
+  0x9f9e, 0xa19e, 0xa59e, 0x999e, 0x4992, 0x8f93, 0xa99e, 0x9c9e, 0xa69e, 0xa09e, 0x5890, 0xaa9e, 0xb190, 0xa89e, 0xbb8a, 0x6f98,
+  0x969e, 0xa49e, 0xd688, 0x989e, 0xb896, 0x9d9e, 0x4190, 0xc592, 0x939e, 0xa39e, 0x9a90, 0xad9e, 0x918a, 0x9f8c, 0xaf9e, 0x9a9e,
+  0xae9e, 0xa79e, 0x9b9e, 0xab9e, 0xac9e, 0xbd9e, 0xcc93, 0xa29e, 0xb99e, 0xbb9e, 0xd692, 0x6b97, 0x9695, 0xb69e, 0xc891, 0xbc9e,
+  0x5e91, 0xb39e, 0xc09e, 0xbf9e, 0xed93, 0xbe9e, 0xe893, 0xe9fa, 0xc29e, 0xb59e, 0xc68b, 0xb89e, 0x7c8f, 0x8094, 0xba9e, 0xc98b,
+  0xb29e, 0xb49e, 0xb19e, 0x4f98, 0x798a, 0xb79e, 0xc19e, 0x548a, 0xe58d, 0x7c89, 0xd29e, 0x5098, 0xd59e, 0xebfa, 0x5990, 0xd49e,
+  0xd39e, 0xd09e, 0xc49e, 0xe19e, 0xc39e, 0xd69e, 0xce9e, 0xc99e, 0xc69e, 0xc79e, 0xcf9e, 0xa0ea, 0xcc9e, 0x5c8d, 0xc692, 0x8491,
+  0xca9e, 0xc59e, 0xc89e, 0x6c97, 0x8a96, 0xcd9e, 0xd79e, 0xecfa, 0xdf9e, 0xd89e, 0xe59e, 0xe39e, 0xde9e, 0xdd9e, 0xce92, 0x8591,
+  0xdb9e, 0xd99e, 0xe09e, 0xe69e, 0xf394, 0xec9e, 0xe79e, 0xea9e, 0xe49e, 0x9492, 0x5795, 0xda9e, 0xe29e, 0xbe8f, 0xcd96, 0xf69e,
+  0xe99e, 0xa08c, 0xa189, 0x7e8a, 0xd19e, 0xedfa, 0xbf8f, 0xee9e, 0xf59e, 0xf78e, 0x928a, 0x4d92, 0xeb9e, 0xeffa, 0xf09e, 0xf49e,
+  0xb48b, 0x6b8b, 0xf29e, 0x408b, 0xc993, 0xf19e, 0xf39e, 0xeefa, 0xed9e, 0xf0fa, 0xef9e, 0xf1fa, 0x808a, 0x6892, 0xfa9e, 0xf89e,
+  0xe78c, 0xf79e, 0x409f, 0x779e, 0xf99e, 0xfb9e, 0xfc9e, 0x4b9f, 0x479f, 0x8d9e, 0x469f, 0x459f, 0x429f, 0xe89e, 0x449f, 0x439f,
+  0x499f, 0x4598, 0x4c9f, 0xf98b, 0x489f, 0x4a9f, 0xf2fa, 0xf3fa, 0xa594, 0x4d9f, 0x519f, 0x4e9f, 0x9397, 0x4f9f, 0xdc9e, 0x529f,
+  0x539f, 0x5489, 0x559f, 0x878c, 0x9f8e, 0xd38b, 0xa289, 0x7e97, 0x579f, 0x569f, 0x599f, 0x5c8b, 0xd48b, 0xbc8a, 0x5c9f, 0x5b9f,
+  0x5d9f, 0xcc89, 0x5692, 0x5e9f, 0xbd8a, 0x609f, 0x5f9f, 0x619f, 0x629f, 0x639f, 0x7e8e, 0xb390, 0x9f8d, 0x9095, 0xe095, 0x6398,
+  0x958e, 0xce8d, 0xf097, 0x649f, 0x659f, 0x808e, 0x669f, 0x679f, 0x699f, 0x689f, 0x7796, 0x7d8f, 0xea8e, 0x638e, 0x6a9f, 0x6c9f,
+  0x4290, 0x6b9f, 0x6d9f, 0x6e9f, 0x6f9f, 0x709f, 0x719f, 0x739f, 0x729f, 0x749f, 0xa389, 0x6992, 0x759f, 0x458e, 0x6b8a, 0x769f,
+  0x6193, 0xca9a, 0x428b, 0x779f, 0x789f, 0xea95, 0x8896, 0xc593, 0x799f, 0xe494, 0xf4fa, 0xf994, 0xd196, 0x7a9f, 0x7c9f, 0x7b9f,
+  0x7e9f, 0x7d9f, 0x819f, 0x818e, 0xaf96, 0x829f, 0x839f, 0x438b, 0x849f, 0x869f, 0x859f, 0x8590, 0x5895, 0x6989, 0xc394, 0xf5fa,
+  0xf392, 0x608f, 0x818b, 0xc494, 0xac8e, 0x889f, 0xbe8a, 0x9889, 0xf6fa, 0xf093, 0x879f, 0x5d8d, 0x7292, 0x899f, 0x919f, 0x8a9f,
+  0xf8fa, 0xbf91, 0x828b, 0x929f, 0x888c, 0x448b, 0x909f, 0x8e9f, 0x8b9f, 0x8097, 0xf7fa, 0xbe92, 0xd793, 0x8c9f, 0x949f, 0x939f,
+  0x428c, 0xab89, 0xb98d, 0x8d9f, 0x8f9f, 0x7696, 0xf291, 0x9796, 0x9c9f, 0x9d9f, 0xcd89, 0xa695, 0xfb96, 0x9f9f, 0xa18e, 0xc08f,
+  0x989f, 0x9e9f, 0x8889, 0xb58b, 0x959f, 0x9a9f, 0xf290, 0x9194, 0xe594, 0x979f, 0x4096, 0x999f, 0xa29f, 0xf9fa, 0xa09f, 0x9b9f,
+  0x4196, 0x6794, 0x838b, 0x4493, 0x8d92, 0xa39f, 0xa19f, 0xd791, 0x969f, 0x6a89, 0xfafa, 0x6d97, 0xae9f, 0xad9f, 0xf490, 0xaa9f,
+  0x8c97, 0xb493, 0xa49f, 0xc392, 0x6b89, 0x5e8d, 0xa79f, 0x468f, 0xac9f, 0xab9f, 0xa69f, 0xa99f, 0x888a, 0xa89f, 0x6894, 0xac97,
+  0xf28f, 0xf390, 0xb49f, 0xb29f, 0x6c95, 0xaf9f, 0xb19f, 0x5989, 0x5f8d, 0x5198, 0x5c8a, 0x8295, 0xfcfa, 0x8197, 0x438a, 0x5a90,
+  0xb39f, 0xb89f, 0xfbfa, 0xc18f, 0x4f97, 0xb59f, 0xb09f, 0xb69f, 0x40fb, 0xdc97, 0x9393, 0xc093, 0x41fb, 0x558a, 0x7489, 0xbc9f,
+  0xbf9f, 0xc197, 0x8497, 0xc69f, 0xc09f, 0xbd9f, 0xd297, 0xc39f, 0x42fb, 0x698f, 0xc59f, 0xca9f, 0x9193, 0xc89f, 0xc29f, 0x5792,
+  0xc99f, 0xbe9f, 0xc49f, 0xcb9f, 0xfa88, 0xc19f, 0xcc9f, 0x5b90, 0x44fb, 0x7e8f, 0xa395, 0xac8d, 0x43fb, 0xb99f, 0xc79f, 0x5993,
+  0x45fb, 0xb490, 0x898a, 0xcf8d, 0xc28f, 0xbb9f, 0x618f, 0x6b8c, 0xba9f, 0xd09f, 0x8d8f, 0xb88c, 0xdf9f, 0xd99f, 0x948b, 0x6e93,
+  0xd49f, 0xdd9f, 0xad88, 0x5189, 0x48fb, 0xb789, 0xd69f, 0xaa91, 0xcd9f, 0xcf9f, 0x608d, 0xe09f, 0x46fb, 0xdb9f, 0x49fb, 0xd39f,
+  0xda9f, 0xa996, 0xd89f, 0xdc9f, 0xce8c, 0xc38f, 0x5892, 0x47fb, 0xd29f, 0x4e97, 0xd59f, 0xce9f, 0x9293, 0xd19f, 0xd79f, 0x7098,
+  0xbc8e, 0x9e96, 0xe19f, 0xac94, 0xed9f, 0xb98c, 0x808f, 0xe39f, 0xad97, 0x618d, 0xf09f, 0xec88, 0xee9f, 0xe29f, 0xe89f, 0xea9f,
+  0x6e97, 0xe59f, 0x4d93, 0xe79f, 0x4afb, 0xef9f, 0xe99f, 0xc596, 0xe49f, 0xa08e, 0xfc9f, 0x8a8a, 0xe69f, 0xeb9f, 0xec9f, 0xea91,
+  0xd891, 0xf49f, 0xfa9f, 0xf89f, 0x4893, 0x42e0, 0xf59f, 0xf69f, 0xde9f, 0x998b, 0x5995, 0xbd8e, 0x978d, 0x5298, 0xf29f, 0x41e0,
+  0x8989, 0x8691, 0x9994, 0xbf8a, 0xf897, 0x9f96, 0xd092, 0xf99f, 0xfb9f, 0x5191, 0x40e0, 0xf79f, 0xf19f, 0xc18a, 0x898c, 0x4ee0,
+  0x49e0, 0xf690, 0x838a, 0x818f, 0x52e0, 0x4be0, 0xaa92, 0x48e0, 0xd792, 0x6be0, 0x45e0, 0x44e0, 0x4de0, 0x47e0, 0x46e0, 0x4ce0,
+  0x9f90, 0x43e0, 0x4bfb, 0x4fe0, 0x50e0, 0xc08a, 0x55e0, 0x54e0, 0x56e0, 0x59e0, 0x6293, 0x53e0, 0x4cfb, 0x57e0, 0x838c, 0xf791,
+  0x51e0, 0x5a94, 0x58e0, 0x5de0, 0x5be0, 0x5ee0, 0x61e0, 0x5ae0, 0x8a8d, 0x4794, 0xb79f, 0x9497, 0x5ce0, 0x60e0, 0xf391, 0x5fe0,
+  0x4ae0, 0x4dfb, 0x89e8, 0x64e0, 0x68e0, 0x66e0, 0x4efb, 0x4ffb, 0x62e0, 0x63e0, 0x67e0, 0x65e0, 0x6d95, 0x6de0, 0x6ae0, 0x69e0,
+  0x6ce0, 0xd293, 0x6ee0, 0x9592, 0xeb91, 0x50fb, 0xa390, 0x6fe0, 0x71e0, 0x70e0, 0xf39f, 0x72e0, 0xe593, 0x73e0, 0xce89, 0x9493,
+  0x448a, 0x848b, 0xdc8e, 0xd08d, 0x51fb, 0x4698, 0x8690, 0x8a89, 0x75e0, 0x74e0, 0x52fb, 0x78e0, 0x5992, 0x7be0, 0x76e0, 0x7ae0,
+  0x79e0, 0x5f93, 0xd788, 0x62fa, 0xf397, 0x7de0, 0x4789, 0x80e0, 0x7ee0, 0x7ce0, 0x77e0, 0x4296, 0x82e0, 0x54fb, 0x81e0, 0x53fb,
+  0x8b89, 0x84e0, 0xb095, 0x83e0, 0xb396, 0xc58f, 0x5291, 0xc48f, 0x56fb, 0x57fb, 0xf997, 0x8ae0, 0xf790, 0x86e0, 0x8be0, 0x8c89,
+  0x55fb, 0x89e0, 0x8194, 0x85e0, 0x88e0, 0xc68f, 0xcf94, 0x8ce0, 0xcf8e, 0xf890, 0x8fe0, 0x87e0, 0x468c, 0x8de0, 0x6f97, 0x90e0,
+  0xa4ea, 0x6e8f, 0x91e0, 0x92e0, 0x4d94, 0x94e0, 0x95e0, 0x59fb, 0x5294, 0x9593, 0x97e0, 0x99e0, 0xd397, 0x96e0, 0x98e0, 0x8d89,
+  0x93e0, 0x7a9a, 0x9ae0, 0x8791, 0x578e, 0x9ce0, 0x9be0, 0x4390, 0xd799, 0x9de0, 0x9fe0, 0x8ee0, 0x9ee0, 0x5afb, 0xa0e0, 0x9a94,
+  0xa1e0, 0xa2e0, 0xa3e0, 0xa4e0, 0xdc92, 0xa6e0, 0xa5e0, 0xa7e0, 0xa8e0, 0xdd8e, 0x8395, 0xea96, 0xa9e0, 0xaae0, 0x7591, 0xa28e,
+  0xabe0, 0xace0, 0xade0, 0xd095, 0xc594, 0xaee0, 0x7694, 0xab92, 0xafe0, 0xe589, 0x8d8b, 0xc496, 0xb496, 0xb289, 0x5398, 0x7196,
+  0xa895, 0xb590, 0xb0e0, 0xc193, 0xa18c, 0xb1e0, 0xd28d, 0xb3e0, 0xb2e0, 0xb4e0, 0xb5e0, 0xb6e0, 0x5d8b, 0xb7e0, 0xb8e0, 0xa28c,
+  0xc694, 0x5bfb, 0xbae0, 0xf38f, 0xb9e0, 0x5cfb, 0xb68b, 0xbbe0, 0xbde0, 0xbce0, 0xbee0, 0xcf8c, 0xbfe0, 0xe78b, 0x5f91, 0x9d8d,
+  0xc1e0, 0xc2e0, 0xc0e0, 0xeb8e, 0xc693, 0xb78b, 0xc4e0, 0x4b92, 0xc3e0, 0x5498, 0x8294, 0xc7e0, 0xc9e0, 0xc6e0, 0xd296, 0xc8e0,
+  0xcae0, 0xc297, 0x5dfb, 0xcee0, 0xcde0, 0x9692, 0x4c94, 0xa38c, 0xcce0, 0xcbe0, 0x5097, 0x5197, 0xcfe0, 0x8e89, 0x968d, 0x828e,
+  0xd0e0, 0xd1e0, 0xd3e0, 0x628f, 0xd5e0, 0xd4e0, 0xd6e0, 0x6c8a, 0xd8e0, 0x5ffb, 0xd7e0, 0xdae0, 0xd9e0, 0xba8c, 0xa697, 0xca8b,
+  0xa489, 0xe88b, 0xdf8a, 0xe697, 0xdce0, 0xdee0, 0x60fb, 0xdfe0, 0xcf89, 0xdbe0, 0x61fb, 0x588e, 0xbf92, 0xdde0, 0x64fb, 0x62fb,
+  0xe2e0, 0xec8e, 0x63fb, 0xe0e0, 0x5d8c, 0xc794, 0xe1e0, 0xfce0, 0x66fb, 0xe7e0, 0xbb8c, 0x858b, 0xe4e0, 0x9d97, 0x65fb, 0xae97,
+  0xf491, 0xe6e0, 0x67fb, 0x69fb, 0x68fb, 0x6afb, 0xe8e0, 0xd497, 0xd58b, 0xfa94, 0x6994, 0xe9e0, 0xebe0, 0xeee0, 0xeae0, 0xede0,
+  0xe88c, 0x6c89, 0xefe0, 0x9090, 0xece0, 0xda97, 0x6bfb, 0xf2e0, 0xa2ea, 0xf0e0, 0xf3e0, 0xe5e0, 0xf1e0, 0xba8d, 0xf4e0, 0xf5e0,
+  0x9e97, 0x6cfb, 0xf6e0, 0xf7e0, 0x6dfb, 0xe3e0, 0xf8e0, 0xc28a, 0xa38e, 0xf9e0, 0xfae0, 0xfbe0, 0x5a89, 0x40e1, 0x5a95, 0x41e1,
+  0xa28a, 0x42e1, 0x43e1, 0x44e1, 0x46e1, 0x47e1, 0x45e1, 0x7295, 0x49e1, 0x48e1, 0x6efb, 0x4be1, 0x4ae1, 0x4ce1, 0x4de1, 0x4fe1,
+  0x4ee1, 0x998d, 0x51e1, 0x50e1, 0xc38a, 0x7290, 0x5b93, 0x52e1, 0xb690, 0x598e, 0x9989, 0x53e1, 0x7097, 0xe195, 0x54e1, 0xa8fa,
+  0x6393, 0x5297, 0x628d, 0x5c90, 0x6a92, 0xb299, 0xac92, 0xe689, 0x55e1, 0x56e1, 0x5be1, 0x59e1, 0x58e1, 0xc09d, 0x458a, 0x57e1,
+  0xd888, 0xa894, 0xc894, 0xaf97, 0x5ce1, 0x5ae1, 0x7b92, 0xa490, 0xa994, 0x4c95, 0x5ee1, 0xaa97, 0x6c8c, 0x5fe1, 0x5de1, 0xd494,
+  0x60e1, 0x61e1, 0x6ffb, 0xd988, 0xf48f, 0x66e1, 0x63e1, 0xeb93, 0x62e1, 0x458b, 0x69e1, 0x64e1, 0x65e1, 0x68e1, 0x67e1, 0x4495,
+  0x6191, 0x6091, 0x5e8b, 0x6ae1, 0x6be1, 0x6ce1, 0x6ee1, 0x6de1, 0x7589, 0x76e1, 0xe694, 0x70e1, 0x72e1, 0x74e1, 0x5d90, 0x75e1,
+  0x73e1, 0xbe8e, 0x6fe1, 0x71e1, 0x6195, 0xc78f, 0x78e1, 0x77e1, 0x79e1, 0xa48e, 0xad8d, 0x9793, 0x7ae1, 0xc992, 0x7ce1, 0x9f97,
+  0x7be1, 0x8991, 0x82e1, 0x84e1, 0x85e1, 0x7392, 0x83e1, 0x80e1, 0x7de1, 0x7ee1, 0x81e1, 0x88e1, 0x86e1, 0x87e1, 0x89e1, 0x8be1,
+  0x8ce1, 0x8de1, 0x8ee1, 0x8ae1, 0x90e1, 0x8fe1, 0x91e1, 0xc397, 0x94e1, 0x92e1, 0x93e1, 0xe08a, 0xfc96, 0xc895, 0x96e1, 0x95e1,
+  0x97e1, 0x98e1, 0x9ce1, 0x99e1, 0x9ae1, 0x9be1, 0x9de1, 0x9ee1, 0x9fe1, 0xa0e1, 0xa1e1, 0xad94, 0x6f93, 0xa2e1, 0x9294, 0x5395,
+  0xa3e1, 0x70fb, 0xa4e1, 0x4993, 0x468a, 0x638d, 0xa5e1, 0xa6e1, 0xa7e1, 0x488e, 0xa9e1, 0xa8e1, 0xaae1, 0xabe1, 0x73fb, 0x71fb,
+  0x72fb, 0x74fb, 0xe794, 0xace1, 0xade1, 0x89ea, 0xaee1, 0xafe1, 0xb0e1, 0x4d8e, 0xb1e1, 0x7594, 0x7e96, 0x6d89, 0x7689, 0xb2e1,
+  0xb4e1, 0xb3e1, 0x9093, 0xb790, 0x589f, 0xb5e1, 0xbf96, 0xb6e1, 0xc48a, 0xd594, 0xb7e1, 0xb8e1, 0xb9e1, 0xda96, 0xd396, 0xbc92,
+  0x8a91, 0xbbe1, 0x828f, 0xc88f, 0xbee1, 0xbde1, 0xbce1, 0xfb94, 0xc58a, 0xa78c, 0xc4e1, 0xc1e1, 0x5e90, 0xb096, 0xc0e1, 0xc2e1,
+  0xc3e1, 0xbfe1, 0xc5e1, 0xc6e1, 0xad92, 0xe18a, 0x8592, 0x76fb, 0xc7e1, 0xc8e1, 0xcbe1, 0x8790, 0xc293, 0xcce1, 0x7296, 0xc9e1,
+  0xcae1, 0xcfe1, 0xcee1, 0xcde1, 0xd1e1, 0xd0e1, 0xd2e1, 0xd4e1, 0xd3e1, 0xcb95, 0x758f, 0xc497, 0xd5e1, 0xb593, 0xd6e1, 0xd7e1,
+  0xdbe1, 0xd9e1, 0xdae1, 0xd8e1, 0xdce1, 0xdde1, 0xdee1, 0xdfe1, 0xb596, 0xe0e1, 0xee96, 0xe1e1, 0x6d92, 0x8a94, 0xe98b, 0x5a92,
+  0xe2e1, 0xb88b, 0xce90, 0xe3e1, 0xbb8d, 0xe4e1, 0xe5e1, 0xa48c, 0xd38d, 0xe7e1, 0x78fb, 0x7593, 0xd48d, 0x6d8b, 0x4396, 0x6a94,
+  0x7693, 0x7b8d, 0xe9e1, 0x79fb, 0xc98f, 0x7afb, 0xb097, 0x648d, 0xa58c, 0xa194, 0xebe1, 0x7bfb, 0xede1, 0xe98c, 0xece1, 0xf492,
+  0xefe1, 0x568a, 0xeae1, 0xe894, 0x4f89, 0xea8d, 0x7198, 0xeee1, 0xf0e1, 0xc995, 0xd790, 0xf2e1, 0xf3e1, 0xf1e1, 0x6d8a, 0xf9e1,
+  0xf8e1, 0xa58e, 0xfae1, 0xf5e1, 0xfbe1, 0xf6e1, 0xd694, 0xf4e1, 0xf7e1, 0x41e2, 0x40e2, 0x8196, 0xfce1, 0xe988, 0x43e2, 0x42e2,
+  0xca8f, 0x44e2, 0x6291, 0x46e2, 0x45e2, 0x47e2, 0xe6e1, 0xe8e1, 0x49e2, 0x48e2, 0x7cfb, 0xa68e, 0xe797, 0xd08e, 0x4ae2, 0x568c,
+  0x5f8b, 0x468b, 0x838e, 0x5397, 0x50e2, 0x4fe2, 0x6391, 0x4ce2, 0x4ee2, 0x6a8f, 0x5f90, 0x4de2, 0x4be2, 0x4994, 0xcb8f, 0x5b95,
+  0xd58d, 0x9893, 0x51e2, 0x52e2, 0x68e2, 0xd68b, 0x5c98, 0x5491, 0x53e2, 0xd089, 0xf592, 0x9f95, 0x81fb, 0x83fb, 0x54e2, 0x9a8b,
+  0x55e2, 0x57e2, 0x58e2, 0x4894, 0x59e2, 0x5ae2, 0x5be2, 0xd78b, 0xd189, 0xc393, 0x478f, 0x848e, 0x5ce2, 0x488f, 0xc889, 0x6295,
+  0x5de2, 0xe994, 0x6491, 0x60e2, 0x61e2, 0x8994, 0x6090, 0x5ee2, 0x8192, 0x5fe2, 0xcc8f, 0xda88, 0x488b, 0x62e2, 0xf692, 0x63e2,
+  0xc590, 0xab96, 0x4295, 0x64e2, 0x65e2, 0x7492, 0xc597, 0x67e2, 0x66e2, 0xed8e, 0x69e2, 0xee88, 0x6ce2, 0x6ae2, 0xd289, 0x6d8c,
+  0x6be2, 0x658d, 0x928d, 0xe495, 0x6de2, 0x7396, 0x6fe2, 0xcf90, 0x6e89, 0xb889, 0xaa88, 0x6ee2, 0x70e2, 0x71e2, 0xf58f, 0x72e2,
+  0x6e8a, 0x74e2, 0x8a8c, 0x868b, 0x75e2, 0xf38b, 0x76e2, 0xfa90, 0xcb93, 0xde90, 0xf38d, 0x77e2, 0x8292, 0x8b91, 0x79e2, 0x7be2,
+  0x78e2, 0x7ae2, 0x418c, 0x7ce2, 0x458c, 0x878b, 0x7197, 0x7ee2, 0x80e2, 0x4d89, 0x83e2, 0x968a, 0x82e2, 0x81e2, 0x85e2, 0x7de2,
+  0x86e2, 0xa797, 0x87e2, 0x88e2, 0x84fb, 0xf29a, 0x8ae2, 0x89e2, 0x8be2, 0x8ce2, 0xb397, 0x8de2, 0xede8, 0xcd8f, 0x8ee2, 0x8fe2,
+  0x768f, 0xb693, 0x90e2, 0x85fb, 0x4792, 0x87fb, 0x91e2, 0x5b92, 0x92e2, 0xa38b, 0x5e99, 0x7c92, 0xb18e, 0xc68a, 0x93e2, 0xa0e2,
+  0x96e2, 0x888b, 0x95e2, 0xa2e2, 0x94e2, 0xce8f, 0x98e2, 0x99e2, 0x4a93, 0x9ae2, 0x7d8a, 0x7990, 0x8495, 0x9ce2, 0xe691, 0x97e2,
+  0x9be2, 0x9de2, 0xf98d, 0xa4e2, 0x4d95, 0xa494, 0x9993, 0xd88b, 0xa3e2, 0xa1e2, 0xb394, 0x9ee2, 0x7d92, 0x9b93, 0x9a93, 0xf48d,
+  0xb6e2, 0xa6e2, 0xa8e2, 0xabe2, 0xace2, 0xa9e2, 0xaae2, 0xa7e2, 0xa5e2, 0x9fe2, 0xcd95, 0xd389, 0xb3e2, 0xb0e2, 0xb5e2, 0xb4e2,
+  0x9394, 0xa596, 0x5a8e, 0xaee2, 0xb7e2, 0xb2e2, 0xb1e2, 0xade2, 0x88fb, 0xafe2, 0xc78a, 0x5c92, 0xfb90, 0xa094, 0xbce2, 0xa294,
+  0xdf90, 0xb9e2, 0xcd94, 0xbde2, 0xd195, 0x7a92, 0xb8e2, 0xbae2, 0xbbe2, 0xbee2, 0xc28e, 0xc493, 0xc3e2, 0xc2e2, 0xbfe2, 0x5598,
+  0xc8e2, 0xcce2, 0xc9e2, 0xc5e2, 0xc6e2, 0xcbe2, 0xc0e2, 0xd399, 0xc7e2, 0xc1e2, 0xcae2, 0xd0e2, 0xc88a, 0xcde2, 0xcee2, 0xcfe2,
+  0xd2e2, 0xd1e2, 0xf494, 0xd3e2, 0xfa97, 0xeb95, 0xd8e2, 0xd5e2, 0xd4e2, 0xd090, 0xd7e2, 0xd9e2, 0xd6e2, 0xdde2, 0xdae2, 0xdbe2,
+  0xc4e2, 0xdce2, 0xdee2, 0xdfe2, 0xc495, 0xe0e2, 0xe096, 0xcc8b, 0x488c, 0xe1e2, 0xb295, 0x8890, 0xae96, 0xe2e2, 0xb197, 0x9494,
+  0x6591, 0x5394, 0x6c8f, 0xbe88, 0xe7e2, 0xe5e2, 0xe3e2, 0x9f8a, 0xcf8f, 0xe8e2, 0xe6e2, 0xe4e2, 0xece2, 0xebe2, 0xeae2, 0xe9e2,
+  0xede2, 0xeee2, 0xb890, 0xefe2, 0xf1e2, 0xf0e2, 0xd08c, 0x5791, 0xf3e2, 0x9c93, 0xf2e2, 0xf4e2, 0xb395, 0x8c91, 0x668d, 0xf5e2,
+  0xc697, 0xf7e2, 0xf8e2, 0xf9e2, 0xfae2, 0x858e, 0xfbe2, 0x6e8c, 0x8a8b, 0x498b, 0x40e3, 0xf196, 0x678d, 0xfce2, 0x43e3, 0xe496,
+  0x5b94, 0x5295, 0x838f, 0x42e3, 0xd18e, 0x688d, 0x868e, 0x898b, 0xb495, 0x41e3, 0x6691, 0x6196, 0xf58d, 0x878e, 0xdb92, 0x46e3,
+  0xdd97, 0xd78d, 0x47e3, 0x6190, 0x49e3, 0xd08f, 0xae8d, 0x48e3, 0x498f, 0xbc8c, 0x6791, 0x44e3, 0x4ae3, 0x8afb, 0x45e3, 0x6f8c,
+  0x4de3, 0x51e3, 0x8b8c, 0x4ce3, 0x55e3, 0x8bfb, 0x698d, 0x8d97, 0xba88, 0x52e3, 0x8b8b, 0x4fe3, 0x50e3, 0x9d93, 0x4ee3, 0x4be3,
+  0x478a, 0xe290, 0xa68c, 0x57e3, 0x54e3, 0x56e3, 0x53e3, 0x708c, 0xb191, 0x58e3, 0x8e91, 0x65e3, 0x8dfb, 0x61e3, 0x5be3, 0x5fe3,
+  0xf88e, 0xdb88, 0x5ae3, 0x62e3, 0x66e3, 0x6a8d, 0xd496, 0xd492, 0x5ce3, 0x8cfb, 0x64e3, 0x59e3, 0x5d92, 0x5ee3, 0xbb88, 0xc896,
+  0x5de3, 0xd98b, 0xea94, 0x8d91, 0xce97, 0x8f8f, 0x8ee3, 0x8efb, 0x67e3, 0xfc90, 0x63e3, 0x68e3, 0x6ae3, 0xf792, 0x6de3, 0x69e3,
+  0xd295, 0xc98a, 0xc996, 0xdc88, 0x6ce3, 0xfb97, 0x6be3, 0x8f89, 0xea93, 0x6ee3, 0x75e3, 0x6fe3, 0x76e3, 0x72e3, 0x9b94, 0xc88e,
+  0x74e3, 0x71e3, 0x77e3, 0x70e3, 0x638f, 0x4496, 0x6b8f, 0x73e3, 0x80e3, 0x7be3, 0x7ee3, 0x7ce3, 0x81e3, 0x7ae3, 0x60e3, 0xd190,
+  0xc994, 0x7de3, 0x78e3, 0x4091, 0x718c, 0x4a8f, 0x8ffb, 0x4490, 0x5591, 0x84e3, 0x86e3, 0x87e3, 0x83e3, 0x85e3, 0x79e3, 0x82e3,
+  0x8ae3, 0x89e3, 0x9a96, 0x4a8c, 0x88e3, 0x8ce3, 0x8be3, 0x8fe3, 0x91e3, 0x5b8e, 0x8de3, 0x92e3, 0x93e3, 0x5cfa, 0x94e3, 0x9ae3,
+  0x5a93, 0x96e3, 0x95e3, 0x97e3, 0x98e3, 0x99e3, 0x9be3, 0x9ce3, 0xca8a, 0x9de3, 0x9ee3, 0x9fe3, 0x90fb, 0xa0e3, 0xa1e3, 0xa2e3,
+  0xa3e3, 0xa4e3, 0xa6e3, 0xa5e3, 0xa7e3, 0xa8e3, 0xa9e3, 0xace3, 0xaae3, 0xabe3, 0xdf8d, 0x728c, 0x7592, 0xb194, 0x908f, 0x6c94,
+  0xeb94, 0xade3, 0xeb9c, 0xaee3, 0xb0e3, 0x8597, 0xafe3, 0xb2e3, 0xb1e3, 0x7297, 0xb3e3, 0xfc94, 0xb4e3, 0xb7e3, 0xb6e3, 0xb5e3,
+  0x91fb, 0xb8e3, 0x518c, 0x4191, 0x608b, 0xbce3, 0xb9e3, 0xbae3, 0xbde3, 0xbee3, 0xbbe3, 0x4889, 0xa589, 0xc0e3, 0xc1e3, 0xc2e3,
+  0x8297, 0x4b8f, 0xc4e3, 0xc3e3, 0x8990, 0xc5e3, 0xc6e3, 0xc7e3, 0xe38a, 0xcb8a, 0xc8e3, 0xc9e3, 0x7c96, 0x8397, 0x7397, 0x5698,
+  0x6c8d, 0xcce3, 0xd28e, 0xcbe3, 0xcde3, 0xa78e, 0xcf91, 0xcee3, 0x6b8d, 0xd596, 0xcfe3, 0xd0e3, 0xd1e3, 0xd2e3, 0xd3e3, 0xa88e,
+  0xeb96, 0xd5e3, 0x5e92, 0xd4e3, 0xd7e3, 0xd6e3, 0xd8e3, 0xb990, 0xd9e3, 0xdae3, 0xb795, 0xdbe3, 0x8f91, 0xdce3, 0xdde3, 0xfc97,
+  0xe0e3, 0xdfe3, 0xdee3, 0xae92, 0xe1e3, 0x4590, 0xe2e3, 0xe3e3, 0x5798, 0xe4e3, 0xe5e3, 0xe7e3, 0xe6e3, 0xa394, 0xf793, 0x5d98,
+  0xa794, 0xe9e3, 0xd18f, 0x4995, 0xeae3, 0xe8e3, 0xcc8a, 0xd28c, 0x888e, 0xec94, 0xa88c, 0x6296, 0xede3, 0xebe3, 0x6d8d, 0x6e8d,
+  0xe788, 0xe68d, 0x7894, 0xdd88, 0xf2e3, 0x5f92, 0x7794, 0xd991, 0xf4e3, 0xf0e3, 0xf3e3, 0xeee3, 0xf1e3, 0x4596, 0xd38c, 0xfb88,
+  0xefe3, 0xf6e3, 0xf7e3, 0xb793, 0xb98b, 0x45e4, 0x5c94, 0x898e, 0xba8b, 0xc690, 0x6598, 0xac96, 0xf5e3, 0xd290, 0x728b, 0xf8e3,
+  0xfae3, 0xf9e3, 0xfbe3, 0x4592, 0x5d94, 0xaf92, 0x42e4, 0x41e4, 0xfce3, 0x7490, 0x8595, 0x44e4, 0x43e4, 0x6f8d, 0x7298, 0x54e4,
+  0x48e4, 0x49e4, 0xee8e, 0x47e4, 0x988d, 0x46e4, 0x4ae4, 0xb092, 0xa095, 0x4291, 0xda91, 0x4ee4, 0x4fe4, 0x4be4, 0x4ce4, 0x4de4,
+  0x708d, 0x55e4, 0x51e4, 0x8695, 0x8c96, 0x4795, 0x50e4, 0x53e4, 0x52e4, 0x6396, 0x56e4, 0x57e4, 0x5691, 0x58e4, 0x5ae4, 0x5ee4,
+  0x5be4, 0x59e4, 0x5e94, 0x5ce4, 0x5de4, 0xb089, 0x64e4, 0x5fe4, 0x60e4, 0x61e4, 0x9f91, 0x63e4, 0x62e4, 0x65e4, 0x66e4, 0x67e4,
+  0x6290, 0xe789, 0x68e4, 0xd597, 0xa98e, 0x4c8f, 0x8a8e, 0x7692, 0x69e4, 0x6ae4, 0x5089, 0x6be4, 0x6ce4, 0x6de4, 0x6ee4, 0x6fe4,
+  0xbb8b, 0xa89d, 0x70e4, 0xe390, 0x71e4, 0xc98e, 0x72e4, 0xae98, 0x73e4, 0xdc95, 0xda8a, 0x4391, 0x778f, 0x9195, 0x4d8f, 0x74e4,
+  0x718d, 0x75e4, 0xca94, 0x84e4, 0x77e4, 0xc791, 0x9594, 0xbd8c, 0x76e4, 0x4491, 0x78e4, 0xf892, 0x7ae4, 0x79e4, 0x7ce4, 0x7be4,
+  0x7de4, 0x80e4, 0x7ee4, 0xcd8a, 0x81e4, 0x82e4, 0x83e4, 0xaf8d, 0xc797, 0x85e4, 0x4690, 0x9089, 0x86e4, 0x87e4, 0x88e4, 0xf088,
+  0x89e4, 0x8ae4, 0x8795, 0xc58e, 0x8ce4, 0x488a, 0xb088, 0x8be4, 0x8ee4, 0x6d94, 0x6390, 0xd489, 0x4696, 0x7c8c, 0xda8b, 0x8de4,
+  0xe889, 0xa18a, 0x9189, 0x92e4, 0xe897, 0xdb91, 0x6395, 0x9ee4, 0xd589, 0x9ce4, 0x9ae4, 0x91e4, 0x8fe4, 0x90e4, 0xe18e, 0xea8b,
+  0x9792, 0xcf93, 0x7089, 0x94e4, 0x93e4, 0x99e4, 0x95e4, 0x98e4, 0x93fb, 0xce96, 0x97e4, 0xd689, 0x9d8a, 0x9be4, 0x9de4, 0x738c,
+  0xa1e4, 0xaae4, 0xabe4, 0xa988, 0xb2e4, 0xef88, 0xa9e4, 0xa8e4, 0xa3e4, 0xa2e4, 0xa0e4, 0x9fe4, 0x8392, 0xf991, 0xa5e4, 0xa4e4,
+  0xa7e4, 0x9091, 0x748c, 0x6089, 0xa6e4, 0x728d, 0x9191, 0x94fb, 0xb8e4, 0xb9e4, 0xd789, 0xac89, 0xb6e4, 0x95fb, 0xace4, 0xb4e4,
+  0xbbe4, 0xb5e4, 0xb3e4, 0x96e4, 0xb1e4, 0xade4, 0xce8a, 0xafe4, 0xbae4, 0xb0e4, 0xbce4, 0xaee4, 0x9c94, 0x8997, 0xb7e4, 0xcde4,
+  0xc5e4, 0x9b90, 0x96fb, 0x658b, 0xdb8b, 0xc0e4, 0xd989, 0xd28f, 0xc3e4, 0xd88d, 0x7093, 0xc8e4, 0xec95, 0xbfe4, 0xd889, 0xd48c,
+  0x4895, 0xc9e4, 0xbde4, 0x97fb, 0xc6e4, 0xd0e4, 0xc1e4, 0xc2e4, 0xb893, 0xc7e4, 0xc4e4, 0x4796, 0xcae4, 0xde88, 0xbee4, 0xcce4,
+  0xcbe4, 0x8b94, 0xd2e4, 0xdde4, 0x9e8a, 0xe0e4, 0xcee4, 0xd3e4, 0x8e97, 0xdce4, 0x98fb, 0x7497, 0xa897, 0x9892, 0x8b8a, 0x9295,
+  0xe2e4, 0x9f93, 0xaf88, 0xdbe4, 0xd7e4, 0x9291, 0xd1e4, 0xd9e4, 0xdee4, 0x4b94, 0xa888, 0xd6e4, 0xdfe4, 0x9895, 0xdae4, 0xd5e4,
+  0xd38f, 0x4e8f, 0xaa8e, 0xd696, 0x6695, 0xe5e4, 0xeee4, 0xd8e4, 0x978a, 0x99fb, 0xf68f, 0xe3e4, 0xe8e4, 0x9391, 0xe4e4, 0xebe4,
+  0x7e92, 0xece4, 0x7597, 0xe1e4, 0x578a, 0xe7e4, 0xeae4, 0xaa96, 0xede4, 0xe6e4, 0xe9e4, 0x60fa, 0x4896, 0x4098, 0xf1e4, 0xf8e4,
+  0xf0e4, 0xc18e, 0xcfe4, 0xcc95, 0xa096, 0xf7e4, 0xf6e4, 0xf2e4, 0xf3e4, 0x5589, 0xf5e4, 0xefe4, 0xd392, 0xf4e4, 0xfc88, 0xa091,
+  0xc195, 0xf9e4, 0x40e5, 0xd794, 0xfce4, 0xd48f, 0xc78e, 0x42e5, 0xbc8b, 0x9afb, 0x43e5, 0x9995, 0xfbe4, 0x9bfb, 0xd4e4, 0xfae4,
+  0x6e98, 0xa093, 0x9395, 0x9cfb, 0x4ae5, 0x50e5, 0x51e5, 0x44e5, 0x9694, 0x4ee5, 0x46e5, 0x48e5, 0x52e5, 0x47e5, 0x4be5, 0x9289,
+  0xe393, 0x4ce5, 0x4fe5, 0x45e5, 0x4591, 0x49e5, 0x468e, 0x6490, 0x4f8c, 0xf296, 0xf796, 0x928f, 0x9efb, 0x56e5, 0x54e5, 0x6d98,
+  0x53e5, 0x9597, 0x55e5, 0x57e5, 0x58e5, 0x5be5, 0x59e5, 0xa193, 0x5ae5, 0xcb94, 0x4de5, 0x938f, 0x5ce5, 0x61e5, 0x9491, 0x60e5,
+  0x41e5, 0x62e5, 0x6891, 0x5de5, 0x5fe5, 0x5ee5, 0x509f, 0x419f, 0x64e5, 0x63e5, 0x9697, 0xbae1, 0x65e5, 0x66e5, 0x67e5, 0xd58c,
+  0x738b, 0x69e5, 0x7c99, 0x958b, 0xb897, 0xf18b, 0x6ae5, 0x6be5, 0x8e92, 0x6ce5, 0xf893, 0xb888, 0xe189, 0x71e5, 0x72e5, 0x6de5,
+  0x5c8e, 0x6ee5, 0x6194, 0x6fe5, 0x70e5, 0x7ae5, 0x74e5, 0x77e5, 0x73e5, 0x75e5, 0x76e5, 0xd68e, 0x78e5, 0x6092, 0x758c, 0x618a,
+  0x7be5, 0x5e8a, 0x81e5, 0x7ce5, 0x80e5, 0xb894, 0x7de5, 0x7ee5, 0x6795, 0xd894, 0x82e5, 0xfb91, 0x8ce5, 0x88e5, 0xe989, 0x86e5,
+  0x4996, 0x87e5, 0x84e5, 0x85e5, 0x8ae5, 0x8de5, 0x8be5, 0x89e5, 0x83e5, 0x7792, 0x94e5, 0xa896, 0x92e5, 0x93e5, 0x8ee5, 0x90e5,
+  0x91e5, 0x8fe5, 0xe490, 0x5898, 0x98e5, 0x99e5, 0x9fe5, 0x4990, 0x9be5, 0x9ee5, 0x96e5, 0x95e5, 0xa0e5, 0xda89, 0x9ce5, 0xa1e5,
+  0x9de5, 0x9ae5, 0xb192, 0x97e5, 0x8894, 0xa5e5, 0x5a97, 0xa4e5, 0xa3e5, 0xace5, 0xa6e5, 0xaee5, 0x8697, 0xb1e5, 0xa8e5, 0xa9e5,
+  0xade5, 0xb0e5, 0xafe5, 0xa7e5, 0xaae5, 0xbbe5, 0xb4e5, 0xb2e5, 0xb3e5, 0xb8e5, 0xb9e5, 0x498a, 0x618b, 0xb7e5, 0xa2e5, 0xa1fb,
+  0xb6e5, 0xbae5, 0xb5e5, 0xbce5, 0xbee5, 0xbde5, 0xc0e5, 0xbfe5, 0x79e5, 0xc4e5, 0xc1e5, 0xc2e5, 0xc3e5, 0xc5e5, 0x8c8c, 0xc7e5,
+  0xc6e5, 0x4f8f, 0x738d, 0xa59f, 0xc8e5, 0x708f, 0x588a, 0xc9e5, 0x7189, 0xd58f, 0xcae5, 0x748d, 0xcbe5, 0xdf88, 0x5c95, 0xcce5,
+  0x8a90, 0xd3e5, 0xd0e5, 0x8f92, 0xd1e5, 0xcee5, 0xdc8b, 0xcde5, 0xd4e5, 0x558c, 0xdc91, 0xdae5, 0xd6e5, 0xb391, 0xd5e5, 0xd8e5,
+  0xcfe5, 0xd9e5, 0xdbe5, 0xed94, 0xd7e5, 0xdce5, 0xdee5, 0xd18c, 0xd2e5, 0xbf88, 0xdde5, 0xd98d, 0xf497, 0xdfe5, 0xe0e5, 0x9591,
+  0xa097, 0xe1e5, 0x5497, 0xe2e5, 0xe3e5, 0xe295, 0xe4e5, 0xbe8d, 0xa197, 0xe9e5, 0xeae5, 0xd68f, 0xe8e5, 0xa2fb, 0x8797, 0xe5e5,
+  0xe7e5, 0xbb90, 0x9e90, 0xe6e5, 0xebe5, 0xa195, 0xede5, 0xece5, 0x8c8a, 0x4a96, 0xeee5, 0x5dfa, 0xfae5, 0xf0e5, 0xf1e5, 0xf2e5,
+  0xf3e5, 0xf7e5, 0xf8e5, 0xf6e5, 0xf4e5, 0xefe5, 0xf5e5, 0xf9e5, 0xb5e8, 0xa689, 0xfce5, 0xdd8b, 0xfbe5, 0x41e6, 0x40e6, 0x43e6,
+  0x42e6, 0x44e6, 0x508f, 0x45e6, 0x46e6, 0x47e6, 0xbc90, 0x7697, 0x48e6, 0xa295, 0x6594, 0x49e6, 0x4ae6, 0xa98c, 0x4b8b, 0x4be6,
+  0x8b8e, 0x6094, 0x4ce6, 0x6f8a, 0x4de6, 0x4fe6, 0x9797, 0x4ee6, 0x6590, 0x50e6, 0x51e6, 0x52e6, 0xcf8a, 0x53e6, 0x54e6, 0x55e6,
+  0x56e6, 0x708a, 0x57e6, 0x58e6, 0x59e6, 0xf089, 0x4790, 0x5ae6, 0x5be6, 0x5ce6, 0xbe8c, 0xf992, 0x5de6, 0x768c, 0x7590, 0x60e6,
+  0xa293, 0x5fe6, 0xa3fb, 0x508c, 0x5ee6, 0xf591, 0x4c8b, 0x61e6, 0x62e6, 0xd78f, 0x8d8c, 0x63e6, 0x4b96, 0xdd90, 0x968b, 0xf396,
+  0x6991, 0x64e6, 0xa4fb, 0x6690, 0x9092, 0xd88f, 0x65e6, 0x68e6, 0x69e6, 0xbc8d, 0xc091, 0x67e6, 0xd98f, 0x5d95, 0x66e6, 0x8c8e,
+  0x7289, 0x6de6, 0x778c, 0x8e8e, 0x8d8e, 0x6c98, 0x6ce6, 0x6be6, 0x4691, 0x6c8b, 0x6298, 0x598a, 0xda8f, 0xa5fb, 0x6ae6, 0x6fe6,
+  0x70e6, 0x6ee6, 0xd68c, 0x5f97, 0x8f8e, 0x4694, 0x73e6, 0xbe90, 0x6192, 0x5597, 0x76e6, 0xea8c, 0xbd90, 0x72e6, 0x77e6, 0xeb8c,
+  0x74e6, 0x75e6, 0xa6fb, 0x71e6, 0xe090, 0xc793, 0x4e92, 0xdb89, 0xee94, 0x628b, 0xa7fb, 0xb292, 0x7ae6, 0x78e6, 0x6b92, 0xbf90,
+  0xd08a, 0x79e6, 0x7a90, 0xc897, 0x5f98, 0x7be6, 0x87e6, 0xb392, 0x86e6, 0xa8fb, 0x83e6, 0x8be6, 0x84e6, 0x80e6, 0xfa92, 0x7ee6,
+  0x7ce6, 0x4097, 0x908e, 0x81e6, 0x7de6, 0xaafb, 0x85e6, 0x948f, 0xbf8c, 0xf891, 0x6496, 0x7989, 0xe088, 0xa393, 0x89e6, 0x88e6,
+  0xe493, 0x8de6, 0x82e6, 0x8ce6, 0x8ee6, 0xaa8c, 0x8ae6, 0x758d, 0xd38e, 0x8fe6, 0x7797, 0x92e6, 0x95e6, 0x93e6, 0x5495, 0x90e6,
+  0xde8b, 0x94e6, 0x96e6, 0x9ae6, 0x97e6, 0x99e6, 0x98e6, 0xabfb, 0x9be6, 0xaf8e, 0x9de6, 0x9ce6, 0x8895, 0x9fe6, 0x788c, 0x9ee6,
+  0xa0e6, 0xa1e6, 0x638b, 0xbfe3, 0xf78f, 0xa2e6, 0xec8c, 0xa3e6, 0xacfb, 0xa4e6, 0x5d8e, 0xcc9d, 0xa5e6, 0xa6e6, 0x518f, 0xa7e6,
+  0xa8e6, 0xa9e6, 0xaae6, 0xabe6, 0x4a92, 0xace6, 0xaee6, 0xade6, 0xa493, 0xafe6, 0x4c96, 0xb0e6, 0xb1e6, 0xb2e6, 0xb3e6, 0xd893,
+  0xdb8f, 0xb4e6, 0x8b8d, 0xac98, 0xb5e6, 0xb6e6, 0x5e95, 0xb7e6, 0xbfe6, 0xb8e6, 0xbae6, 0xb9e6, 0xbbe6, 0x6596, 0xbce6, 0xbde6,
+  0xbee6, 0xc0e6, 0x4c8a, 0xe592, 0x8995, 0xe08d, 0x768d, 0x6e95, 0xdd89, 0xcc94, 0xc3e6, 0xd18a, 0xd390, 0xc2e6, 0xc7e6, 0x9992,
+  0xe196, 0xc5e6, 0xc6e6, 0x4d8b, 0xc8e6, 0x8394, 0xdd91, 0xef94, 0x5c93, 0xc4e6, 0x6696, 0xea89, 0xcae6, 0x4798, 0xc092, 0x6498,
+  0x918e, 0xc9e6, 0xaf91, 0xdae6, 0x4791, 0xf693, 0x6f95, 0xcde6, 0x5e8e, 0x928e, 0xdc8f, 0x8594, 0xab8c, 0xcce6, 0xcbe6, 0x8a95,
+  0xbf8e, 0x7193, 0xadfb, 0xaefb, 0xcfe6, 0xd0e6, 0x778d, 0xcee6, 0xd1e6, 0xd2e6, 0xd4e6, 0xa191, 0xd3e6, 0xe48a, 0xd6e6, 0xd5e6,
+  0xd7e6, 0xaffb, 0xd9e6, 0xdbe6, 0xdce6, 0xd490, 0xcd8e, 0xdde6, 0x718a, 0xdee6, 0x9691, 0xdfe6, 0xe0e6, 0x8b95, 0xb0fb, 0x4e8b,
+  0xe1e6, 0xb492, 0x7a89, 0xe2e6, 0xef8e, 0x9690, 0xab91, 0xe5e6, 0xe4e6, 0xe3e6, 0xebe6, 0xe9e6, 0xe6e6, 0xe8e6, 0xe7e6, 0xeae6,
+  0x978b, 0xeee6, 0xd590, 0xefe6, 0xd78c, 0xece6, 0xede6, 0x4898, 0xb592, 0x4891, 0xf0e6, 0xf3e6, 0xf1e6, 0xf2e6, 0x7897, 0xa593,
+  0xf6e6, 0xf4e6, 0xf5e6, 0xf7e6, 0x48e7, 0xfae6, 0xfbe6, 0xf9e6, 0xf8e6, 0xfb92, 0x40e7, 0x44e7, 0x41e7, 0xfce6, 0x42e7, 0x43e7,
+  0x4ae7, 0x45e7, 0xd690, 0x47e7, 0x49e7, 0x46e7, 0x4ce7, 0x528f, 0x4be7, 0x4de7, 0x4ee7, 0x51e7, 0x50e7, 0x4fe7, 0x53e7, 0x52e7,
+  0xf496, 0x55e7, 0x54e7, 0x56e7, 0x57e7, 0x59e7, 0x58e7, 0x6790, 0x5ae7, 0xeb8b, 0x5be7, 0x5de7, 0x5ee7, 0x5fe7, 0x5ce7, 0x60e7,
+  0xd48e, 0x61e7, 0x4f8b, 0x528c, 0xb2fb, 0xac8c, 0x62e7, 0xee93, 0x5d93, 0x63e7, 0x66e7, 0xb28e, 0x65e7, 0x64e7, 0x798c, 0x67e7,
+  0x728a, 0x69e7, 0xda8d, 0x68e7, 0x71e7, 0x6be7, 0x6de7, 0xe395, 0x6ae7, 0x6ce7, 0x70e7, 0x6ee7, 0x508b, 0x6fe7, 0x72e7, 0x7994,
+  0xd697, 0x538f, 0x73e7, 0x4197, 0x75e7, 0x74e7, 0x78e7, 0x6097, 0x77e7, 0x8d8a, 0x76e7, 0x7be7, 0x7ae7, 0x79e7, 0x5193, 0x7ce7,
+  0x7de7, 0x7ee7, 0x8c8d, 0x448c, 0x80e7, 0x81e7, 0x82e7, 0x6890, 0x83e7, 0xab8e, 0x84e7, 0x85e7, 0x9f99, 0x9e99, 0x86e7, 0x90e3,
+  0x87e7, 0x4392, 0x4a90, 0x5f94, 0x88e7, 0xd395, 0xd292, 0x9e8d, 0x4892, 0x4989, 0x9896, 0x7690, 0x7d8c, 0xdf8b, 0xd495, 0x89e7,
+  0x8be7, 0x8ae7, 0xde89, 0xf493, 0x8ce7, 0x9794, 0x5293, 0x8de7, 0x718f, 0x8fe7, 0xc096, 0x9ee7, 0x91e7, 0x92e7, 0xc792, 0xde91,
+  0x9791, 0xa693, 0x90e7, 0x748b, 0x99e7, 0x96e7, 0xa3e7, 0xa793, 0x8092, 0x93e7, 0xfc92, 0x7293, 0x94e7, 0x98e7, 0x8090, 0x8794,
+  0xca92, 0xc090, 0x97e7, 0xac91, 0xa291, 0x95e7, 0xa788, 0x4198, 0x9ae7, 0xdf91, 0x548f, 0x6990, 0x9ce7, 0x9be7, 0xed88, 0x9de7,
+  0x4e95, 0xa5e7, 0xd993, 0x8b90, 0x7892, 0xf68b, 0xa4e7, 0x5697, 0x5e89, 0xd595, 0xdf89, 0x9fe7, 0xa0e7, 0xa1e7, 0xa2e7, 0xb993,
+  0x4292, 0xe188, 0xa6e7, 0xa7e7, 0xa1ea, 0xbb91, 0xa8e7, 0x9389, 0x6b91, 0xad8c, 0x7997, 0xb5fb, 0xa9e7, 0x4b93, 0x9891, 0xd58e,
+  0xaae7, 0xade7, 0x858f, 0xabe7, 0x4a91, 0x4991, 0xe288, 0xc997, 0xafe7, 0xf094, 0xb1e7, 0xb0e7, 0xaee7, 0x84e2, 0xd28a, 0x8ee7,
+  0xb3e7, 0xb2e7, 0xb4e7, 0x5797, 0xdf93, 0x4d96, 0xb5e7, 0xd78e, 0xb6e7, 0xb7e7, 0xb8e7, 0x4093, 0xe888, 0x788d, 0x5998, 0xbce7,
+  0xb6fb, 0x538c, 0xb9e7, 0xbae7, 0x9495, 0x738a, 0x5897, 0xbd8b, 0x7393, 0xbde7, 0xbee7, 0xb8fb, 0xbfe7, 0xb9fb, 0x4193, 0xc1e7,
+  0xc0e7, 0xd193, 0xc2e7, 0x558f, 0xde8e, 0x7a94, 0x9192, 0xf08e, 0x8c90, 0xc3e7, 0xc4e7, 0x7c90, 0xc5e7, 0xc6e7, 0xc7e7, 0x8f97,
+  0x568f, 0xc9e7, 0xc8e7, 0x798d, 0x938d, 0x5f8e, 0xcce7, 0x868f, 0xcbe7, 0xcae7, 0xe791, 0xed8c, 0xc190, 0xae94, 0x588f, 0xcde7,
+  0xdd8f, 0xd0e7, 0xcee7, 0xcfe7, 0xd2e7, 0xd1e7, 0xf88f, 0xd3e7, 0xd4e7, 0xd5e7, 0xce94, 0xd18d, 0xdf8e, 0xd6e7, 0xd7e7, 0xa297,
+  0x648f, 0xec96, 0xca97, 0xd8e7, 0xe08b, 0xd9e7, 0xbbfb, 0x4293, 0xbafb, 0xdce7, 0x988a, 0x6a90, 0xbcfb, 0xdae7, 0xdbe7, 0xde92,
+  0xbffb, 0xc0fb, 0x7496, 0xfa8b, 0xbdfb, 0xbefb, 0xdee7, 0xdfe7, 0xdde7, 0xe1e7, 0xc1fb, 0xc3fb, 0xdd93, 0x628a, 0xc2fb, 0xe5e7,
+  0xe2e7, 0xe4e7, 0xe0e7, 0x6ee8, 0xe3e7, 0xe997, 0xd88c, 0xcafb, 0xc4fb, 0xc6fb, 0xede7, 0xc5fb, 0x5393, 0xe8e7, 0xebe7, 0xe9e7,
+  0xeee7, 0xc7fb, 0xefe7, 0xc9fb, 0xe7e7, 0xc8fb, 0xf4e7, 0x9489, 0xe6e7, 0xab94, 0xeae7, 0xde8f, 0xcbfb, 0x7a8d, 0xcdfb, 0xcefb,
+  0x6796, 0xe28b, 0x658f, 0xba93, 0x5ffa, 0x4c91, 0xf2e7, 0xece7, 0xf1e7, 0xc196, 0xb692, 0xf3e7, 0xf0e7, 0xccfb, 0x4b91, 0xf7e7,
+  0xf6e7, 0xf5e7, 0xd2fb, 0x4e96, 0xd6fb, 0xd4fb, 0xd0fb, 0xd1fb, 0xd5fb, 0x9b8f, 0xcffb, 0xf8e7, 0xdd95, 0x7389, 0x6595, 0x9292,
+  0x988b, 0x65fa, 0xfae7, 0xd9fb, 0x7c8d, 0xdcfb, 0xdefb, 0x4b8e, 0xf9e7, 0x8d90, 0x8e90, 0x40e8, 0x42e8, 0xddfb, 0xdbfb, 0xf98f,
+  0xd8fb, 0x41e8, 0x43e8, 0xd7fb, 0xd18b, 0x6495, 0xe08e, 0x4298, 0xfce7, 0xf68d, 0x5e98, 0x45e8, 0x44e8, 0x46e8, 0xfbe7, 0x5efa,
+  0xe793, 0x7493, 0xd592, 0x4be8, 0xe0fb, 0x6292, 0x47e8, 0x48e8, 0x4c8c, 0x4ae8, 0xdffb, 0xae8c, 0x49e8, 0xdf8f, 0x998a, 0x4fe8,
+  0xbd8d, 0x9991, 0xc892, 0xe1fb, 0x5a8a, 0x4de8, 0x4ee8, 0xc192, 0x4ce8, 0x50e8, 0x56e8, 0xe2fb, 0x59e8, 0x58e8, 0x4c93, 0x51e8,
+  0x52e8, 0x55e8, 0x57e8, 0xe3fb, 0xbe8b, 0x5ae8, 0x54e8, 0x53e8, 0xe4fb, 0x5ee8, 0x5fe8, 0x60e8, 0x5de8, 0x5ce8, 0xe08f, 0xa893,
+  0x5be8, 0x64e8, 0x62e8, 0xe5fb, 0x63e8, 0x61e8, 0xf691, 0x65e8, 0x66e8, 0x68e8, 0xe6fb, 0xe7fb, 0xd38a, 0x67e8, 0xf896, 0x73e8,
+  0x69e8, 0x6ce8, 0x6ae8, 0x6be8, 0x6de8, 0x6fe8, 0x70e8, 0x71e8, 0x74e8, 0x72e8, 0x75e8, 0x77e8, 0x76e8, 0xb792, 0xe596, 0x78e8,
+  0x4d91, 0x79e8, 0xc295, 0x7ae8, 0x4a8a, 0x5b89, 0xd58a, 0xe8fb, 0xd48a, 0x7be8, 0x7ce8, 0x7de8, 0x7ee8, 0x80e8, 0xd68a, 0x748a,
+  0x7d8d, 0xb494, 0x82e8, 0x81e8, 0x83e8, 0x7b89, 0x86e8, 0x85e8, 0x84e8, 0x87e8, 0x8ae8, 0xc588, 0x88e8, 0x8ce8, 0x8be8, 0x8ee8,
+  0x8de8, 0x8fe8, 0xac93, 0x90e8, 0x91e8, 0x93e8, 0x92e8, 0x8c95, 0x94e8, 0x95e8, 0xe38d, 0x96e8, 0x97e8, 0x6896, 0x6a91, 0xa288,
+  0xc991, 0x98e8, 0x8d95, 0x9be8, 0x99e8, 0x7e8d, 0x9ae8, 0xc08c, 0xc395, 0x9de8, 0x9fe8, 0x9ee8, 0xa0e8, 0x4089, 0x7790, 0x9c8f,
+  0xd78a, 0xa1e8, 0x8694, 0xa3e8, 0x4189, 0xa2e8, 0xc292, 0xcb97, 0xa993, 0x9ce8, 0xa497, 0xaf8c, 0x7a97, 0xf78b, 0xb297, 0x478c,
+  0xe091, 0x40e4, 0xa4e8, 0x4b8a, 0x8f90, 0x758a, 0xa6e8, 0xa7e8, 0xa5e8, 0x848c, 0xdb8d, 0xe18f, 0xebfb, 0x4289, 0xd797, 0xa9e8,
+  0xace7, 0xa8e8, 0xecfb, 0xace8, 0xaae8, 0xabe8, 0xade8, 0xaee8, 0xea97, 0xafe8, 0xb0e8, 0xc790, 0xb994, 0x9d90, 0xe58a, 0x5997,
+  0xeb89, 0x578f, 0xd98c, 0xb3e8, 0xb2e8, 0x938e, 0xb4e8, 0xb1e8, 0x478e, 0xb8e8, 0xabe5, 0xd499, 0x9790, 0xb6e8, 0xa397, 0xef93,
+  0x4a89, 0xe190, 0xb48e, 0xb595, 0x5f89, 0xeb97, 0x8b97, 0xb9e8, 0x6493, 0xf98e, 0xbae8, 0xbbe8, 0x6b90, 0xbce8, 0xec97, 0xb7e8,
+  0xbee8, 0xc0e8, 0xbfe8, 0xbde8, 0xc1e8, 0xc2e8, 0x9a91, 0xe089, 0xc3e8, 0xb696, 0xc4e8, 0xc5e8, 0x4998, 0xedfb, 0x509e, 0xc6e8,
+  0xeefb, 0xc7e8, 0xc8e8, 0xcce8, 0xeffb, 0xc9e8, 0xcae8, 0xcbe8, 0xcde8, 0xf0fb, 0xf1fb, 0xf2fb, 0xc290, 0xf3fb, 0xf596, 0xc390,
+  0xcee8, 0xf194, 0xcfe8, 0x72ea, 0xca96, 0xd0e8, 0xd1e8, 0xd2e8, 0x768a, 0xd4e8, 0x7890, 0xd5e8, 0x438c, 0xd6e8, 0xdae8, 0xd8e8,
+  0xd9e8, 0x938a, 0xd7e8, 0xdbe8, 0xdce8, 0xc688, 0xdde8, 0xdee8, 0xe28f, 0xdfe8, 0x668b, 0xe2e8, 0xe1e8, 0xe0e8, 0x91e6, 0xda95,
+  0xe3e8, 0xe4e8, 0xe5e8, 0xe6e8, 0xe7e8, 0xe8e8, 0xd88a, 0xe9e8, 0xeae8, 0x4294, 0xece8, 0xb989, 0xefe8, 0xeee8, 0x4389, 0xbf8b,
+  0xc595, 0xb892, 0xa08d, 0x808d, 0x878f, 0x7b90, 0xf1e8, 0xf0e8, 0x6197, 0xe68a, 0xd094, 0xda93, 0x9c90, 0xcc97, 0x7a8c, 0xf4e8,
+  0xf3e8, 0x6a96, 0xaa93, 0x6f89, 0xf5e8, 0xf2e8, 0x7095, 0x8a97, 0xf6e8, 0xf7e8, 0xf9e8, 0xe891, 0x7a8a, 0x7b8a, 0xf8e8, 0xe78a,
+  0xb08c, 0xf4fb, 0xe88a, 0x5e93, 0xde97, 0xf5fb, 0xda8c, 0xfae8, 0xfbe8, 0xfce8, 0x40e9, 0x42e9, 0x41e9, 0x9795, 0x43e9, 0x44e9,
+  0x45e9, 0x46e9, 0x48e9, 0x47e9, 0x49e9, 0xf294, 0xcae3, 0x4890, 0x518b, 0x4ae9, 0x4be9, 0xaa99, 0x5a9f, 0xd194, 0xf988, 0xb988,
+  0x948e, 0x4f96, 0xfc8f, 0x4ce9, 0xdd96, 0x4de9, 0x7b97, 0x6189, 0x608e, 0x4ee9, 0xec89, 0x4fe9, 0x50e9, 0x52e9, 0x53e9, 0x55e9,
+  0x51e9, 0x54e9, 0xf8fb, 0xd98a, 0x56e9, 0x57e9, 0x58e9, 0x59e9, 0x5ae9, 0x5ce9, 0x5be9, 0x5ee9, 0x61e9, 0x5de9, 0x5fe9, 0x60e9,
+  0x62e9, 0xc08b, 0xf18e, 0x63e9, 0x64e9, 0x818d, 0xfafb, 0x65e9, 0x5d8a, 0x6e94, 0x66e9, 0x67e9, 0x7992, 0xe993, 0x68e9, 0x9d94,
+  0xca91, 0x7789, 0xec8b, 0xed8b, 0x9392, 0x6de9, 0xee8b, 0xed89, 0x6ce9, 0x6ae9, 0x6be9, 0x69e9, 0x77e9, 0x6ee9, 0x6fe9, 0x70e9,
+  0x71e9, 0x73e9, 0x72e9, 0x788f, 0x74e9, 0x76e9, 0x528b, 0x75e9, 0x9b91, 0xb18c, 0x78e9, 0xcb91, 0x79e9, 0xab93, 0x7ae9, 0x80e9,
+  0x7de9, 0x7ce9, 0x7ee9, 0x7be9, 0x82e9, 0xfbfb, 0x81e9, 0x84e9, 0xc18b, 0x83e9, 0x85e9, 0x86e9, 0x88e9, 0x87e9, 0x89e9, 0x8be9,
+  0x8ae9, 0x9c8d, 0x8ce9, 0x8de9, 0x5b8a, 0x8ee9, 0x8fe9, 0x9190, 0x90e9, 0x91e9, 0x92e9, 0x93e9, 0x828d, 0xfcfb, 0x40fc, 0x94e9,
+  0x95e9, 0x96e9, 0x97e9, 0x98e9, 0xaf94, 0x9ae9, 0x4595, 0x9be9, 0x99e9, 0x9de9, 0x9ce9, 0x9ee9, 0x9fe9, 0xa0e9, 0xa1e9, 0xa2e9,
+  0xa3e9, 0xa4e9, 0xa5e9, 0xa6e9, 0xa7e9, 0xa8e9, 0xa9e9, 0xaae9, 0xabe9, 0xace9, 0x549f, 0xade9, 0xf6e2, 0x538b, 0x408a, 0xb08d,
+  0xafe9, 0xaee9, 0xa396, 0xb1e9, 0xb2e9, 0xb0e9, 0xb3e9, 0x8296, 0xb4e9, 0x9b8b, 0x4498, 0x42fc, 0xb5e9, 0x41fc, 0xb7e9, 0xbc88,
+  0x43fc, 0xb8e9, 0xa995, 0xb6e9, 0xb9e9, 0xbae9, 0xbbe9, 0xbce9, 0xbde9, 0x8e96, 0x4c8e, 0xf88d, 0x4e91, 0x44fc, 0xbee9, 0xc1e9,
+  0x45fc, 0xbfe9, 0xc2e9, 0xef8c, 0xc0e9, 0xc3e9, 0xc4e9, 0xc5e9, 0xc9e9, 0x498e, 0xe291, 0xcae9, 0xc7e9, 0xc6e9, 0xc8e9, 0x7e8c,
+  0xcee9, 0xcde9, 0xcce9, 0xb188, 0x46fc, 0xd8e9, 0xd4e9, 0xd5e9, 0xd1e9, 0xd7e9, 0xd3e9, 0x828a, 0x6b98, 0xd6e9, 0xd2e9, 0xd0e9,
+  0xcfe9, 0xdae9, 0xdde9, 0xdce9, 0xdbe9, 0x6895, 0xd9e9, 0xf188, 0xdee9, 0xe0e9, 0x8f8a, 0xcbe9, 0x5689, 0xe2e9, 0xe1e9, 0xdfe9,
+  0x4c92, 0x9096, 0xd897, 0xe3e9, 0xe4e9, 0xe5e9, 0xe6e9, 0xe7e9, 0xb992, 0xe8e9, 0xb594, 0xede9, 0xe9e9, 0xeae9, 0x5096, 0xc296,
+  0xce93, 0xeee9, 0xefe9, 0xbc93, 0xece9, 0xebe9, 0xa889, 0xf7e9, 0xf6e9, 0x9589, 0xf4e9, 0xf3e9, 0xf1e9, 0x9b8a, 0xf0e9, 0xb08e,
+  0xa789, 0x838d, 0xfae9, 0xf9e9, 0xf8e9, 0xf5e9, 0xfbe9, 0xfce9, 0x44ea, 0x43ea, 0x45ea, 0x4c89, 0x40ea, 0x41ea, 0x948d, 0xb796,
+  0x42ea, 0x48fc, 0x5196, 0x4aea, 0x47fc, 0x46ea, 0x4bea, 0x48ea, 0x47ea, 0x7b8c, 0x4cea, 0x4dea, 0x4eea, 0x49ea, 0xf2e9, 0x4fea,
+  0xdf92, 0x53ea, 0x54ea, 0x52ea, 0x51ea, 0x57ea, 0x50ea, 0x55ea, 0x56ea, 0x59ea, 0x58ea, 0x5bea, 0x5cea, 0x5dea, 0x6898, 0x5aea,
+  0xe991, 0xeb8d, 0x5eea, 0x4afc, 0x5fea, 0x60ea, 0x61ea, 0x62ea, 0xb28c, 0x63ea, 0x64ea, 0xad8e, 0x65ea, 0x66ea, 0x67ea, 0x68ea,
+  0x6bea, 0x69ea, 0x5b98, 0x6aea, 0xed97, 0x6cea, 0xd997, 0x6dea, 0x9e94, 0x6eea, 0x70ea, 0x71ea, 0x6fea, 0x8d8d, 0xcb96, 0x8396,
+  0xf59b, 0x809f, 0x9b96, 0xa989, 0x73ea, 0x6f8b, 0x74ea, 0x75ea, 0x76ea, 0x4bfc, 0x958d, 0x77ea, 0xd2e0, 0xd996, 0xe191, 0x78ea,
+  0x7aea, 0x79ea, 0x7bea, 0x7cea, 0x7dea, 0x7eea, 0x80ea, 0x81ea, 0x82ea, 0x83ea, 0x84ea, 0x85ea, 0x86ea, 0x87ea, 0x88ea, 0x4393,
+  0xdb8c, 0x8aea, 0x6c91, 0x8bea, 0x8cea, 0x4095, 0x8dea, 0x8eea, 0x56e2, 0xd8e6, 0xebe8, 0x8fea, 0x90ea, 0x92ea, 0x93ea, 0x94ea,
+  0xee97, 0x91ea, 0x95ea, 0x96ea, 0x98ea, 0x97ea, 0x9aea, 0x9bea, 0x99ea, 0xb497, 0x9cea, 0x9dea, 0x73e2, 0x9eea, 0x40f0, 0x41f0,
+  0x42f0, 0x43f0, 0x44f0, 0x45f0, 0x46f0, 0x47f0, 0x48f0, 0x49f0, 0x4af0, 0x4bf0, 0x4cf0, 0x4df0, 0x4ef0, 0x4ff0, 0x50f0, 0x51f0,
+  0x52f0, 0x53f0, 0x54f0, 0x55f0, 0x56f0, 0x57f0, 0x58f0, 0x59f0, 0x5af0, 0x5bf0, 0x5cf0, 0x5df0, 0x5ef0, 0x5ff0, 0x60f0, 0x61f0,
+  0x62f0, 0x63f0, 0x64f0, 0x65f0, 0x66f0, 0x67f0, 0x68f0, 0x69f0, 0x6af0, 0x6bf0, 0x6cf0, 0x6df0, 0x6ef0, 0x6ff0, 0x70f0, 0x71f0,
+  0x72f0, 0x73f0, 0x74f0, 0x75f0, 0x76f0, 0x77f0, 0x78f0, 0x79f0, 0x7af0, 0x7bf0, 0x7cf0, 0x7df0, 0x7ef0, 0x80f0, 0x81f0, 0x82f0,
+  0x83f0, 0x84f0, 0x85f0, 0x86f0, 0x87f0, 0x88f0, 0x89f0, 0x8af0, 0x8bf0, 0x8cf0, 0x8df0, 0x8ef0, 0x8ff0, 0x90f0, 0x91f0, 0x92f0,
+  0x93f0, 0x94f0, 0x95f0, 0x96f0, 0x97f0, 0x98f0, 0x99f0, 0x9af0, 0x9bf0, 0x9cf0, 0x9df0, 0x9ef0, 0x9ff0, 0xa0f0, 0xa1f0, 0xa2f0,
+  0xa3f0, 0xa4f0, 0xa5f0, 0xa6f0, 0xa7f0, 0xa8f0, 0xa9f0, 0xaaf0, 0xabf0, 0xacf0, 0xadf0, 0xaef0, 0xaff0, 0xb0f0, 0xb1f0, 0xb2f0,
+  0xb3f0, 0xb4f0, 0xb5f0, 0xb6f0, 0xb7f0, 0xb8f0, 0xb9f0, 0xbaf0, 0xbbf0, 0xbcf0, 0xbdf0, 0xbef0, 0xbff0, 0xc0f0, 0xc1f0, 0xc2f0,
+  0xc3f0, 0xc4f0, 0xc5f0, 0xc6f0, 0xc7f0, 0xc8f0, 0xc9f0, 0xcaf0, 0xcbf0, 0xccf0, 0xcdf0, 0xcef0, 0xcff0, 0xd0f0, 0xd1f0, 0xd2f0,
+  0xd3f0, 0xd4f0, 0xd5f0, 0xd6f0, 0xd7f0, 0xd8f0, 0xd9f0, 0xdaf0, 0xdbf0, 0xdcf0, 0xddf0, 0xdef0, 0xdff0, 0xe0f0, 0xe1f0, 0xe2f0,
+  0xe3f0, 0xe4f0, 0xe5f0, 0xe6f0, 0xe7f0, 0xe8f0, 0xe9f0, 0xeaf0, 0xebf0, 0xecf0, 0xedf0, 0xeef0, 0xeff0, 0xf0f0, 0xf1f0, 0xf2f0,
+  0xf3f0, 0xf4f0, 0xf5f0, 0xf6f0, 0xf7f0, 0xf8f0, 0xf9f0, 0xfaf0, 0xfbf0, 0xfcf0, 0x40f1, 0x41f1, 0x42f1, 0x43f1, 0x44f1, 0x45f1,
+  0x46f1, 0x47f1, 0x48f1, 0x49f1, 0x4af1, 0x4bf1, 0x4cf1, 0x4df1, 0x4ef1, 0x4ff1, 0x50f1, 0x51f1, 0x52f1, 0x53f1, 0x54f1, 0x55f1,
+  0x56f1, 0x57f1, 0x58f1, 0x59f1, 0x5af1, 0x5bf1, 0x5cf1, 0x5df1, 0x5ef1, 0x5ff1, 0x60f1, 0x61f1, 0x62f1, 0x63f1, 0x64f1, 0x65f1,
+  0x66f1, 0x67f1, 0x68f1, 0x69f1, 0x6af1, 0x6bf1, 0x6cf1, 0x6df1, 0x6ef1, 0x6ff1, 0x70f1, 0x71f1, 0x72f1, 0x73f1, 0x74f1, 0x75f1,
+  0x76f1, 0x77f1, 0x78f1, 0x79f1, 0x7af1, 0x7bf1, 0x7cf1, 0x7df1, 0x7ef1, 0x80f1, 0x81f1, 0x82f1, 0x83f1, 0x84f1, 0x85f1, 0x86f1,
+  0x87f1, 0x88f1, 0x89f1, 0x8af1, 0x8bf1, 0x8cf1, 0x8df1, 0x8ef1, 0x8ff1, 0x90f1, 0x91f1, 0x92f1, 0x93f1, 0x94f1, 0x95f1, 0x96f1,
+  0x97f1, 0x98f1, 0x99f1, 0x9af1, 0x9bf1, 0x9cf1, 0x9df1, 0x9ef1, 0x9ff1, 0xa0f1, 0xa1f1, 0xa2f1, 0xa3f1, 0xa4f1, 0xa5f1, 0xa6f1,
+  0xa7f1, 0xa8f1, 0xa9f1, 0xaaf1, 0xabf1, 0xacf1, 0xadf1, 0xaef1, 0xaff1, 0xb0f1, 0xb1f1, 0xb2f1, 0xb3f1, 0xb4f1, 0xb5f1, 0xb6f1,
+  0xb7f1, 0xb8f1, 0xb9f1, 0xbaf1, 0xbbf1, 0xbcf1, 0xbdf1, 0xbef1, 0xbff1, 0xc0f1, 0xc1f1, 0xc2f1, 0xc3f1, 0xc4f1, 0xc5f1, 0xc6f1,
+  0xc7f1, 0xc8f1, 0xc9f1, 0xcaf1, 0xcbf1, 0xccf1, 0xcdf1, 0xcef1, 0xcff1, 0xd0f1, 0xd1f1, 0xd2f1, 0xd3f1, 0xd4f1, 0xd5f1, 0xd6f1,
+  0xd7f1, 0xd8f1, 0xd9f1, 0xdaf1, 0xdbf1, 0xdcf1, 0xddf1, 0xdef1, 0xdff1, 0xe0f1, 0xe1f1, 0xe2f1, 0xe3f1, 0xe4f1, 0xe5f1, 0xe6f1,
+  0xe7f1, 0xe8f1, 0xe9f1, 0xeaf1, 0xebf1, 0xecf1, 0xedf1, 0xeef1, 0xeff1, 0xf0f1, 0xf1f1, 0xf2f1, 0xf3f1, 0xf4f1, 0xf5f1, 0xf6f1,
+  0xf7f1, 0xf8f1, 0xf9f1, 0xfaf1, 0xfbf1, 0xfcf1, 0x40f2, 0x41f2, 0x42f2, 0x43f2, 0x44f2, 0x45f2, 0x46f2, 0x47f2, 0x48f2, 0x49f2,
+  0x4af2, 0x4bf2, 0x4cf2, 0x4df2, 0x4ef2, 0x4ff2, 0x50f2, 0x51f2, 0x52f2, 0x53f2, 0x54f2, 0x55f2, 0x56f2, 0x57f2, 0x58f2, 0x59f2,
+  0x5af2, 0x5bf2, 0x5cf2, 0x5df2, 0x5ef2, 0x5ff2, 0x60f2, 0x61f2, 0x62f2, 0x63f2, 0x64f2, 0x65f2, 0x66f2, 0x67f2, 0x68f2, 0x69f2,
+  0x6af2, 0x6bf2, 0x6cf2, 0x6df2, 0x6ef2, 0x6ff2, 0x70f2, 0x71f2, 0x72f2, 0x73f2, 0x74f2, 0x75f2, 0x76f2, 0x77f2, 0x78f2, 0x79f2,
+  0x7af2, 0x7bf2, 0x7cf2, 0x7df2, 0x7ef2, 0x80f2, 0x81f2, 0x82f2, 0x83f2, 0x84f2, 0x85f2, 0x86f2, 0x87f2, 0x88f2, 0x89f2, 0x8af2,
+  0x8bf2, 0x8cf2, 0x8df2, 0x8ef2, 0x8ff2, 0x90f2, 0x91f2, 0x92f2, 0x93f2, 0x94f2, 0x95f2, 0x96f2, 0x97f2, 0x98f2, 0x99f2, 0x9af2,
+  0x9bf2, 0x9cf2, 0x9df2, 0x9ef2, 0x9ff2, 0xa0f2, 0xa1f2, 0xa2f2, 0xa3f2, 0xa4f2, 0xa5f2, 0xa6f2, 0xa7f2, 0xa8f2, 0xa9f2, 0xaaf2,
+  0xabf2, 0xacf2, 0xadf2, 0xaef2, 0xaff2, 0xb0f2, 0xb1f2, 0xb2f2, 0xb3f2, 0xb4f2, 0xb5f2, 0xb6f2, 0xb7f2, 0xb8f2, 0xb9f2, 0xbaf2,
+  0xbbf2, 0xbcf2, 0xbdf2, 0xbef2, 0xbff2, 0xc0f2, 0xc1f2, 0xc2f2, 0xc3f2, 0xc4f2, 0xc5f2, 0xc6f2, 0xc7f2, 0xc8f2, 0xc9f2, 0xcaf2,
+  0xcbf2, 0xccf2, 0xcdf2, 0xcef2, 0xcff2, 0xd0f2, 0xd1f2, 0xd2f2, 0xd3f2, 0xd4f2, 0xd5f2, 0xd6f2, 0xd7f2, 0xd8f2, 0xd9f2, 0xdaf2,
+  0xdbf2, 0xdcf2, 0xddf2, 0xdef2, 0xdff2, 0xe0f2, 0xe1f2, 0xe2f2, 0xe3f2, 0xe4f2, 0xe5f2, 0xe6f2, 0xe7f2, 0xe8f2, 0xe9f2, 0xeaf2,
+  0xebf2, 0xecf2, 0xedf2, 0xeef2, 0xeff2, 0xf0f2, 0xf1f2, 0xf2f2, 0xf3f2, 0xf4f2, 0xf5f2, 0xf6f2, 0xf7f2, 0xf8f2, 0xf9f2, 0xfaf2,
+  0xfbf2, 0xfcf2, 0x40f3, 0x41f3, 0x42f3, 0x43f3, 0x44f3, 0x45f3, 0x46f3, 0x47f3, 0x48f3, 0x49f3, 0x4af3, 0x4bf3, 0x4cf3, 0x4df3,
+  0x4ef3, 0x4ff3, 0x50f3, 0x51f3, 0x52f3, 0x53f3, 0x54f3, 0x55f3, 0x56f3, 0x57f3, 0x58f3, 0x59f3, 0x5af3, 0x5bf3, 0x5cf3, 0x5df3,
+  0x5ef3, 0x5ff3, 0x60f3, 0x61f3, 0x62f3, 0x63f3, 0x64f3, 0x65f3, 0x66f3, 0x67f3, 0x68f3, 0x69f3, 0x6af3, 0x6bf3, 0x6cf3, 0x6df3,
+  0x6ef3, 0x6ff3, 0x70f3, 0x71f3, 0x72f3, 0x73f3, 0x74f3, 0x75f3, 0x76f3, 0x77f3, 0x78f3, 0x79f3, 0x7af3, 0x7bf3, 0x7cf3, 0x7df3,
+  0x7ef3, 0x80f3, 0x81f3, 0x82f3, 0x83f3, 0x84f3, 0x85f3, 0x86f3, 0x87f3, 0x88f3, 0x89f3, 0x8af3, 0x8bf3, 0x8cf3, 0x8df3, 0x8ef3,
+  0x8ff3, 0x90f3, 0x91f3, 0x92f3, 0x93f3, 0x94f3, 0x95f3, 0x96f3, 0x97f3, 0x98f3, 0x99f3, 0x9af3, 0x9bf3, 0x9cf3, 0x9df3, 0x9ef3,
+  0x9ff3, 0xa0f3, 0xa1f3, 0xa2f3, 0xa3f3, 0xa4f3, 0xa5f3, 0xa6f3, 0xa7f3, 0xa8f3, 0xa9f3, 0xaaf3, 0xabf3, 0xacf3, 0xadf3, 0xaef3,
+  0xaff3, 0xb0f3, 0xb1f3, 0xb2f3, 0xb3f3, 0xb4f3, 0xb5f3, 0xb6f3, 0xb7f3, 0xb8f3, 0xb9f3, 0xbaf3, 0xbbf3, 0xbcf3, 0xbdf3, 0xbef3,
+  0xbff3, 0xc0f3, 0xc1f3, 0xc2f3, 0xc3f3, 0xc4f3, 0xc5f3, 0xc6f3, 0xc7f3, 0xc8f3, 0xc9f3, 0xcaf3, 0xcbf3, 0xccf3, 0xcdf3, 0xcef3,
+  0xcff3, 0xd0f3, 0xd1f3, 0xd2f3, 0xd3f3, 0xd4f3, 0xd5f3, 0xd6f3, 0xd7f3, 0xd8f3, 0xd9f3, 0xdaf3, 0xdbf3, 0xdcf3, 0xddf3, 0xdef3,
+  0xdff3, 0xe0f3, 0xe1f3, 0xe2f3, 0xe3f3, 0xe4f3, 0xe5f3, 0xe6f3, 0xe7f3, 0xe8f3, 0xe9f3, 0xeaf3, 0xebf3, 0xecf3, 0xedf3, 0xeef3,
+  0xeff3, 0xf0f3, 0xf1f3, 0xf2f3, 0xf3f3, 0xf4f3, 0xf5f3, 0xf6f3, 0xf7f3, 0xf8f3, 0xf9f3, 0xfaf3, 0xfbf3, 0xfcf3, 0x40f4, 0x41f4,
+  0x42f4, 0x43f4, 0x44f4, 0x45f4, 0x46f4, 0x47f4, 0x48f4, 0x49f4, 0x4af4, 0x4bf4, 0x4cf4, 0x4df4, 0x4ef4, 0x4ff4, 0x50f4, 0x51f4,
+  0x52f4, 0x53f4, 0x54f4, 0x55f4, 0x56f4, 0x57f4, 0x58f4, 0x59f4, 0x5af4, 0x5bf4, 0x5cf4, 0x5df4, 0x5ef4, 0x5ff4, 0x60f4, 0x61f4,
+  0x62f4, 0x63f4, 0x64f4, 0x65f4, 0x66f4, 0x67f4, 0x68f4, 0x69f4, 0x6af4, 0x6bf4, 0x6cf4, 0x6df4, 0x6ef4, 0x6ff4, 0x70f4, 0x71f4,
+  0x72f4, 0x73f4, 0x74f4, 0x75f4, 0x76f4, 0x77f4, 0x78f4, 0x79f4, 0x7af4, 0x7bf4, 0x7cf4, 0x7df4, 0x7ef4, 0x80f4, 0x81f4, 0x82f4,
+  0x83f4, 0x84f4, 0x85f4, 0x86f4, 0x87f4, 0x88f4, 0x89f4, 0x8af4, 0x8bf4, 0x8cf4, 0x8df4, 0x8ef4, 0x8ff4, 0x90f4, 0x91f4, 0x92f4,
+  0x93f4, 0x94f4, 0x95f4, 0x96f4, 0x97f4, 0x98f4, 0x99f4, 0x9af4, 0x9bf4, 0x9cf4, 0x9df4, 0x9ef4, 0x9ff4, 0xa0f4, 0xa1f4, 0xa2f4,
+  0xa3f4, 0xa4f4, 0xa5f4, 0xa6f4, 0xa7f4, 0xa8f4, 0xa9f4, 0xaaf4, 0xabf4, 0xacf4, 0xadf4, 0xaef4, 0xaff4, 0xb0f4, 0xb1f4, 0xb2f4,
+  0xb3f4, 0xb4f4, 0xb5f4, 0xb6f4, 0xb7f4, 0xb8f4, 0xb9f4, 0xbaf4, 0xbbf4, 0xbcf4, 0xbdf4, 0xbef4, 0xbff4, 0xc0f4, 0xc1f4, 0xc2f4,
+  0xc3f4, 0xc4f4, 0xc5f4, 0xc6f4, 0xc7f4, 0xc8f4, 0xc9f4, 0xcaf4, 0xcbf4, 0xccf4, 0xcdf4, 0xcef4, 0xcff4, 0xd0f4, 0xd1f4, 0xd2f4,
+  0xd3f4, 0xd4f4, 0xd5f4, 0xd6f4, 0xd7f4, 0xd8f4, 0xd9f4, 0xdaf4, 0xdbf4, 0xdcf4, 0xddf4, 0xdef4, 0xdff4, 0xe0f4, 0xe1f4, 0xe2f4,
+  0xe3f4, 0xe4f4, 0xe5f4, 0xe6f4, 0xe7f4, 0xe8f4, 0xe9f4, 0xeaf4, 0xebf4, 0xecf4, 0xedf4, 0xeef4, 0xeff4, 0xf0f4, 0xf1f4, 0xf2f4,
+  0xf3f4, 0xf4f4, 0xf5f4, 0xf6f4, 0xf7f4, 0xf8f4, 0xf9f4, 0xfaf4, 0xfbf4, 0xfcf4, 0x40f5, 0x41f5, 0x42f5, 0x43f5, 0x44f5, 0x45f5,
+  0x46f5, 0x47f5, 0x48f5, 0x49f5, 0x4af5, 0x4bf5, 0x4cf5, 0x4df5, 0x4ef5, 0x4ff5, 0x50f5, 0x51f5, 0x52f5, 0x53f5, 0x54f5, 0x55f5,
+  0x56f5, 0x57f5, 0x58f5, 0x59f5, 0x5af5, 0x5bf5, 0x5cf5, 0x5df5, 0x5ef5, 0x5ff5, 0x60f5, 0x61f5, 0x62f5, 0x63f5, 0x64f5, 0x65f5,
+  0x66f5, 0x67f5, 0x68f5, 0x69f5, 0x6af5, 0x6bf5, 0x6cf5, 0x6df5, 0x6ef5, 0x6ff5, 0x70f5, 0x71f5, 0x72f5, 0x73f5, 0x74f5, 0x75f5,
+  0x76f5, 0x77f5, 0x78f5, 0x79f5, 0x7af5, 0x7bf5, 0x7cf5, 0x7df5, 0x7ef5, 0x80f5, 0x81f5, 0x82f5, 0x83f5, 0x84f5, 0x85f5, 0x86f5,
+  0x87f5, 0x88f5, 0x89f5, 0x8af5, 0x8bf5, 0x8cf5, 0x8df5, 0x8ef5, 0x8ff5, 0x90f5, 0x91f5, 0x92f5, 0x93f5, 0x94f5, 0x95f5, 0x96f5,
+  0x97f5, 0x98f5, 0x99f5, 0x9af5, 0x9bf5, 0x9cf5, 0x9df5, 0x9ef5, 0x9ff5, 0xa0f5, 0xa1f5, 0xa2f5, 0xa3f5, 0xa4f5, 0xa5f5, 0xa6f5,
+  0xa7f5, 0xa8f5, 0xa9f5, 0xaaf5, 0xabf5, 0xacf5, 0xadf5, 0xaef5, 0xaff5, 0xb0f5, 0xb1f5, 0xb2f5, 0xb3f5, 0xb4f5, 0xb5f5, 0xb6f5,
+  0xb7f5, 0xb8f5, 0xb9f5, 0xbaf5, 0xbbf5, 0xbcf5, 0xbdf5, 0xbef5, 0xbff5, 0xc0f5, 0xc1f5, 0xc2f5, 0xc3f5, 0xc4f5, 0xc5f5, 0xc6f5,
+  0xc7f5, 0xc8f5, 0xc9f5, 0xcaf5, 0xcbf5, 0xccf5, 0xcdf5, 0xcef5, 0xcff5, 0xd0f5, 0xd1f5, 0xd2f5, 0xd3f5, 0xd4f5, 0xd5f5, 0xd6f5,
+  0xd7f5, 0xd8f5, 0xd9f5, 0xdaf5, 0xdbf5, 0xdcf5, 0xddf5, 0xdef5, 0xdff5, 0xe0f5, 0xe1f5, 0xe2f5, 0xe3f5, 0xe4f5, 0xe5f5, 0xe6f5,
+  0xe7f5, 0xe8f5, 0xe9f5, 0xeaf5, 0xebf5, 0xecf5, 0xedf5, 0xeef5, 0xeff5, 0xf0f5, 0xf1f5, 0xf2f5, 0xf3f5, 0xf4f5, 0xf5f5, 0xf6f5,
+  0xf7f5, 0xf8f5, 0xf9f5, 0xfaf5, 0xfbf5, 0xfcf5, 0x40f6, 0x41f6, 0x42f6, 0x43f6, 0x44f6, 0x45f6, 0x46f6, 0x47f6, 0x48f6, 0x49f6,
+  0x4af6, 0x4bf6, 0x4cf6, 0x4df6, 0x4ef6, 0x4ff6, 0x50f6, 0x51f6, 0x52f6, 0x53f6, 0x54f6, 0x55f6, 0x56f6, 0x57f6, 0x58f6, 0x59f6,
+  0x5af6, 0x5bf6, 0x5cf6, 0x5df6, 0x5ef6, 0x5ff6, 0x60f6, 0x61f6, 0x62f6, 0x63f6, 0x64f6, 0x65f6, 0x66f6, 0x67f6, 0x68f6, 0x69f6,
+  0x6af6, 0x6bf6, 0x6cf6, 0x6df6, 0x6ef6, 0x6ff6, 0x70f6, 0x71f6, 0x72f6, 0x73f6, 0x74f6, 0x75f6, 0x76f6, 0x77f6, 0x78f6, 0x79f6,
+  0x7af6, 0x7bf6, 0x7cf6, 0x7df6, 0x7ef6, 0x80f6, 0x81f6, 0x82f6, 0x83f6, 0x84f6, 0x85f6, 0x86f6, 0x87f6, 0x88f6, 0x89f6, 0x8af6,
+  0x8bf6, 0x8cf6, 0x8df6, 0x8ef6, 0x8ff6, 0x90f6, 0x91f6, 0x92f6, 0x93f6, 0x94f6, 0x95f6, 0x96f6, 0x97f6, 0x98f6, 0x99f6, 0x9af6,
+  0x9bf6, 0x9cf6, 0x9df6, 0x9ef6, 0x9ff6, 0xa0f6, 0xa1f6, 0xa2f6, 0xa3f6, 0xa4f6, 0xa5f6, 0xa6f6, 0xa7f6, 0xa8f6, 0xa9f6, 0xaaf6,
+  0xabf6, 0xacf6, 0xadf6, 0xaef6, 0xaff6, 0xb0f6, 0xb1f6, 0xb2f6, 0xb3f6, 0xb4f6, 0xb5f6, 0xb6f6, 0xb7f6, 0xb8f6, 0xb9f6, 0xbaf6,
+  0xbbf6, 0xbcf6, 0xbdf6, 0xbef6, 0xbff6, 0xc0f6, 0xc1f6, 0xc2f6, 0xc3f6, 0xc4f6, 0xc5f6, 0xc6f6, 0xc7f6, 0xc8f6, 0xc9f6, 0xcaf6,
+  0xcbf6, 0xccf6, 0xcdf6, 0xcef6, 0xcff6, 0xd0f6, 0xd1f6, 0xd2f6, 0xd3f6, 0xd4f6, 0xd5f6, 0xd6f6, 0xd7f6, 0xd8f6, 0xd9f6, 0xdaf6,
+  0xdbf6, 0xdcf6, 0xddf6, 0xdef6, 0xdff6, 0xe0f6, 0xe1f6, 0xe2f6, 0xe3f6, 0xe4f6, 0xe5f6, 0xe6f6, 0xe7f6, 0xe8f6, 0xe9f6, 0xeaf6,
+  0xebf6, 0xecf6, 0xedf6, 0xeef6, 0xeff6, 0xf0f6, 0xf1f6, 0xf2f6, 0xf3f6, 0xf4f6, 0xf5f6, 0xf6f6, 0xf7f6, 0xf8f6, 0xf9f6, 0xfaf6,
+  0xfbf6, 0xfcf6, 0x40f7, 0x41f7, 0x42f7, 0x43f7, 0x44f7, 0x45f7, 0x46f7, 0x47f7, 0x48f7, 0x49f7, 0x4af7, 0x4bf7, 0x4cf7, 0x4df7,
+  0x4ef7, 0x4ff7, 0x50f7, 0x51f7, 0x52f7, 0x53f7, 0x54f7, 0x55f7, 0x56f7, 0x57f7, 0x58f7, 0x59f7, 0x5af7, 0x5bf7, 0x5cf7, 0x5df7,
+  0x5ef7, 0x5ff7, 0x60f7, 0x61f7, 0x62f7, 0x63f7, 0x64f7, 0x65f7, 0x66f7, 0x67f7, 0x68f7, 0x69f7, 0x6af7, 0x6bf7, 0x6cf7, 0x6df7,
+  0x6ef7, 0x6ff7, 0x70f7, 0x71f7, 0x72f7, 0x73f7, 0x74f7, 0x75f7, 0x76f7, 0x77f7, 0x78f7, 0x79f7, 0x7af7, 0x7bf7, 0x7cf7, 0x7df7,
+  0x7ef7, 0x80f7, 0x81f7, 0x82f7, 0x83f7, 0x84f7, 0x85f7, 0x86f7, 0x87f7, 0x88f7, 0x89f7, 0x8af7, 0x8bf7, 0x8cf7, 0x8df7, 0x8ef7,
+  0x8ff7, 0x90f7, 0x91f7, 0x92f7, 0x93f7, 0x94f7, 0x95f7, 0x96f7, 0x97f7, 0x98f7, 0x99f7, 0x9af7, 0x9bf7, 0x9cf7, 0x9df7, 0x9ef7,
+  0x9ff7, 0xa0f7, 0xa1f7, 0xa2f7, 0xa3f7, 0xa4f7, 0xa5f7, 0xa6f7, 0xa7f7, 0xa8f7, 0xa9f7, 0xaaf7, 0xabf7, 0xacf7, 0xadf7, 0xaef7,
+  0xaff7, 0xb0f7, 0xb1f7, 0xb2f7, 0xb3f7, 0xb4f7, 0xb5f7, 0xb6f7, 0xb7f7, 0xb8f7, 0xb9f7, 0xbaf7, 0xbbf7, 0xbcf7, 0xbdf7, 0xbef7,
+  0xbff7, 0xc0f7, 0xc1f7, 0xc2f7, 0xc3f7, 0xc4f7, 0xc5f7, 0xc6f7, 0xc7f7, 0xc8f7, 0xc9f7, 0xcaf7, 0xcbf7, 0xccf7, 0xcdf7, 0xcef7,
+  0xcff7, 0xd0f7, 0xd1f7, 0xd2f7, 0xd3f7, 0xd4f7, 0xd5f7, 0xd6f7, 0xd7f7, 0xd8f7, 0xd9f7, 0xdaf7, 0xdbf7, 0xdcf7, 0xddf7, 0xdef7,
+  0xdff7, 0xe0f7, 0xe1f7, 0xe2f7, 0xe3f7, 0xe4f7, 0xe5f7, 0xe6f7, 0xe7f7, 0xe8f7, 0xe9f7, 0xeaf7, 0xebf7, 0xecf7, 0xedf7, 0xeef7,
+  0xeff7, 0xf0f7, 0xf1f7, 0xf2f7, 0xf3f7, 0xf4f7, 0xf5f7, 0xf6f7, 0xf7f7, 0xf8f7, 0xf9f7, 0xfaf7, 0xfbf7, 0xfcf7, 0x40f8, 0x41f8,
+  0x42f8, 0x43f8, 0x44f8, 0x45f8, 0x46f8, 0x47f8, 0x48f8, 0x49f8, 0x4af8, 0x4bf8, 0x4cf8, 0x4df8, 0x4ef8, 0x4ff8, 0x50f8, 0x51f8,
+  0x52f8, 0x53f8, 0x54f8, 0x55f8, 0x56f8, 0x57f8, 0x58f8, 0x59f8, 0x5af8, 0x5bf8, 0x5cf8, 0x5df8, 0x5ef8, 0x5ff8, 0x60f8, 0x61f8,
+  0x62f8, 0x63f8, 0x64f8, 0x65f8, 0x66f8, 0x67f8, 0x68f8, 0x69f8, 0x6af8, 0x6bf8, 0x6cf8, 0x6df8, 0x6ef8, 0x6ff8, 0x70f8, 0x71f8,
+  0x72f8, 0x73f8, 0x74f8, 0x75f8, 0x76f8, 0x77f8, 0x78f8, 0x79f8, 0x7af8, 0x7bf8, 0x7cf8, 0x7df8, 0x7ef8, 0x80f8, 0x81f8, 0x82f8,
+  0x83f8, 0x84f8, 0x85f8, 0x86f8, 0x87f8, 0x88f8, 0x89f8, 0x8af8, 0x8bf8, 0x8cf8, 0x8df8, 0x8ef8, 0x8ff8, 0x90f8, 0x91f8, 0x92f8,
+  0x93f8, 0x94f8, 0x95f8, 0x96f8, 0x97f8, 0x98f8, 0x99f8, 0x9af8, 0x9bf8, 0x9cf8, 0x9df8, 0x9ef8, 0x9ff8, 0xa0f8, 0xa1f8, 0xa2f8,
+  0xa3f8, 0xa4f8, 0xa5f8, 0xa6f8, 0xa7f8, 0xa8f8, 0xa9f8, 0xaaf8, 0xabf8, 0xacf8, 0xadf8, 0xaef8, 0xaff8, 0xb0f8, 0xb1f8, 0xb2f8,
+  0xb3f8, 0xb4f8, 0xb5f8, 0xb6f8, 0xb7f8, 0xb8f8, 0xb9f8, 0xbaf8, 0xbbf8, 0xbcf8, 0xbdf8, 0xbef8, 0xbff8, 0xc0f8, 0xc1f8, 0xc2f8,
+  0xc3f8, 0xc4f8, 0xc5f8, 0xc6f8, 0xc7f8, 0xc8f8, 0xc9f8, 0xcaf8, 0xcbf8, 0xccf8, 0xcdf8, 0xcef8, 0xcff8, 0xd0f8, 0xd1f8, 0xd2f8,
+  0xd3f8, 0xd4f8, 0xd5f8, 0xd6f8, 0xd7f8, 0xd8f8, 0xd9f8, 0xdaf8, 0xdbf8, 0xdcf8, 0xddf8, 0xdef8, 0xdff8, 0xe0f8, 0xe1f8, 0xe2f8,
+  0xe3f8, 0xe4f8, 0xe5f8, 0xe6f8, 0xe7f8, 0xe8f8, 0xe9f8, 0xeaf8, 0xebf8, 0xecf8, 0xedf8, 0xeef8, 0xeff8, 0xf0f8, 0xf1f8, 0xf2f8,
+  0xf3f8, 0xf4f8, 0xf5f8, 0xf6f8, 0xf7f8, 0xf8f8, 0xf9f8, 0xfaf8, 0xfbf8, 0xfcf8, 0x40f9, 0x41f9, 0x42f9, 0x43f9, 0x44f9, 0x45f9,
+  0x46f9, 0x47f9, 0x48f9, 0x49f9, 0x4af9, 0x4bf9, 0x4cf9, 0x4df9, 0x4ef9, 0x4ff9, 0x50f9, 0x51f9, 0x52f9, 0x53f9, 0x54f9, 0x55f9,
+  0x56f9, 0x57f9, 0x58f9, 0x59f9, 0x5af9, 0x5bf9, 0x5cf9, 0x5df9, 0x5ef9, 0x5ff9, 0x60f9, 0x61f9, 0x62f9, 0x63f9, 0x64f9, 0x65f9,
+  0x66f9, 0x67f9, 0x68f9, 0x69f9, 0x6af9, 0x6bf9, 0x6cf9, 0x6df9, 0x6ef9, 0x6ff9, 0x70f9, 0x71f9, 0x72f9, 0x73f9, 0x74f9, 0x75f9,
+  0x76f9, 0x77f9, 0x78f9, 0x79f9, 0x7af9, 0x7bf9, 0x7cf9, 0x7df9, 0x7ef9, 0x80f9, 0x81f9, 0x82f9, 0x83f9, 0x84f9, 0x85f9, 0x86f9,
+  0x87f9, 0x88f9, 0x89f9, 0x8af9, 0x8bf9, 0x8cf9, 0x8df9, 0x8ef9, 0x8ff9, 0x90f9, 0x91f9, 0x92f9, 0x93f9, 0x94f9, 0x95f9, 0x96f9,
+  0x97f9, 0x98f9, 0x99f9, 0x9af9, 0x9bf9, 0x9cf9, 0x9df9, 0x9ef9, 0x9ff9, 0xa0f9, 0xa1f9, 0xa2f9, 0xa3f9, 0xa4f9, 0xa5f9, 0xa6f9,
+  0xa7f9, 0xa8f9, 0xa9f9, 0xaaf9, 0xabf9, 0xacf9, 0xadf9, 0xaef9, 0xaff9, 0xb0f9, 0xb1f9, 0xb2f9, 0xb3f9, 0xb4f9, 0xb5f9, 0xb6f9,
+  0xb7f9, 0xb8f9, 0xb9f9, 0xbaf9, 0xbbf9, 0xbcf9, 0xbdf9, 0xbef9, 0xbff9, 0xc0f9, 0xc1f9, 0xc2f9, 0xc3f9, 0xc4f9, 0xc5f9, 0xc6f9,
+  0xc7f9, 0xc8f9, 0xc9f9, 0xcaf9, 0xcbf9, 0xccf9, 0xcdf9, 0xcef9, 0xcff9, 0xd0f9, 0xd1f9, 0xd2f9, 0xd3f9, 0xd4f9, 0xd5f9, 0xd6f9,
+  0xd7f9, 0xd8f9, 0xd9f9, 0xdaf9, 0xdbf9, 0xdcf9, 0xddf9, 0xdef9, 0xdff9, 0xe0f9, 0xe1f9, 0xe2f9, 0xe3f9, 0xe4f9, 0xe5f9, 0xe6f9,
+  0xe7f9, 0xe8f9, 0xe9f9, 0xeaf9, 0xebf9, 0xecf9, 0xedf9, 0xeef9, 0xeff9, 0xf0f9, 0xf1f9, 0xf2f9, 0xf3f9, 0xf4f9, 0xf5f9, 0xf6f9,
+  0xf7f9, 0xf8f9, 0xf9f9, 0xfaf9, 0xfbf9, 0xfcf9, 0x00a0, 0x00fd, 0x00fe, 0x00ff, 0xe0fa, 0xe9fb, 0x90fa, 0x9bfa, 0x9cfa, 0xb1fa,
+  0xd8fa, 0xe8fa, 0xeafa, 0x58fb, 0x5efb, 0x75fb, 0x7dfb, 0x7efb, 0x80fb, 0x82fb, 0x86fb, 0x89fb, 0x92fb, 0x9dfb, 0x9ffb, 0xa0fb,
+  0xa9fb, 0xb1fb, 0xb3fb, 0xb4fb, 0xb7fb, 0xd3fb, 0xdafb, 0xeafb, 0xf6fb, 0xf7fb, 0xf9fb, 0x49fc, 0x4981, 0x57fa, 0x9481, 0x9081,
+  0x9381, 0x9581, 0x56fa, 0x6981, 0x6a81, 0x9681, 0x7b81, 0x4381, 0x7c81, 0x4481, 0x5e81, 0x4f82, 0x5082, 0x5182, 0x5282, 0x5382,
+  0x5482, 0x5582, 0x5682, 0x5782, 0x5882, 0x4681, 0x4781, 0x8381, 0x8181, 0x8481, 0x4881, 0x9781, 0x6082, 0x6182, 0x6282, 0x6382,
+  0x6482, 0x6582, 0x6682, 0x6782, 0x6882, 0x6982, 0x6a82, 0x6b82, 0x6c82, 0x6d82, 0x6e82, 0x6f82, 0x7082, 0x7182, 0x7282, 0x7382,
+  0x7482, 0x7582, 0x7682, 0x7782, 0x7882, 0x7982, 0x6d81, 0x5f81, 0x6e81, 0x4f81, 0x5181, 0x4d81, 0x8182, 0x8282, 0x8382, 0x8482,
+  0x8582, 0x8682, 0x8782, 0x8882, 0x8982, 0x8a82, 0x8b82, 0x8c82, 0x8d82, 0x8e82, 0x8f82, 0x9082, 0x9182, 0x9282, 0x9382, 0x9482,
+  0x9582, 0x9682, 0x9782, 0x9882, 0x9982, 0x9a82, 0x6f81, 0x6281, 0x7081, 0x6081, 0x00a1, 0x00a2, 0x00a3, 0x00a4, 0x00a5, 0x00a6,
+  0x00a7, 0x00a8, 0x00a9, 0x00aa, 0x00ab, 0x00ac, 0x00ad, 0x00ae, 0x00af, 0x00b0, 0x00b1, 0x00b2, 0x00b3, 0x00b4, 0x00b5, 0x00b6,
+  0x00b7, 0x00b8, 0x00b9, 0x00ba, 0x00bb, 0x00bc, 0x00bd, 0x00be, 0x00bf, 0x00c0, 0x00c1, 0x00c2, 0x00c3, 0x00c4, 0x00c5, 0x00c6,
+  0x00c7, 0x00c8, 0x00c9, 0x00ca, 0x00cb, 0x00cc, 0x00cd, 0x00ce, 0x00cf, 0x00d0, 0x00d1, 0x00d2, 0x00d3, 0x00d4, 0x00d5, 0x00d6,
+  0x00d7, 0x00d8, 0x00d9, 0x00da, 0x00db, 0x00dc, 0x00dd, 0x00de, 0x00df, 0x9181, 0x9281, 0xca81, 0x5081, 0x55fa, 0x8f81, 0x0080,
+  0x0080
+};
+
+/// maps a unicode character in the BMP to Shift-JIS through the tables above; `0x8888` if unmapped
+/// \note The result holds the first byte in the low 8 bits; single-byte characters are less than `0x100`.
+constexpr nat4 _sjis_encode(const nat4 c) noexcept {
+  if (c >= 0x10000) return 0x8888;
+  const nat8 m = _sjis_encode_mask[c >> 6], bit = nat8(1) << (c & 63);
+  return m & bit ? _sjis_encode_table[_sjis_encode_base[c >> 6] + std::popcount(m & (bit - 1))] : 0x8888;
+}
+
+}
+
+namespace _ {
+
+template<typename T> inline __m128i _loadu128(const T* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+template<typename T> inline void _storeu128(T* p, const __m128i v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+
+/// decodes one code point of UTF-16; unpaired surrogates are `0xfffe`
+template<typename In> constexpr nat4 _utf16_next(const In*& i, const In* const last) noexcept {
+  nat4 c = nat2(*i++);
+  if ((c & 0xf800) != 0xd800) return c;
+  if (c < 0xdc00 && i < last && (nat2(*i) & 0xfc00) == 0xdc00) return 0x10000 + ((c & 0x3ff) << 10 | (nat2(*i++) & 0x3ff));
+  return 0xfffe;
+}
+
+/// writes one code point in UTF-8, UTF-16 or UTF-32
+template<typename Out> constexpr Out* _utf_put(Out* p, const nat4 c) noexcept {
+  if constexpr (sizeof(Out) == 1) {
+    if (c < 0x80) *p++ = Out(c);
+    else if (c < 0x800) *p++ = Out(0xc0 | c >> 6), *p++ = Out(0x80 | (c & 0x3f));
+    else if (c < 0x10000) *p++ = Out(0xe0 | c >> 12), *p++ = Out(0x80 | (c >> 6 & 0x3f)), *p++ = Out(0x80 | (c & 0x3f));
+    else *p++ = Out(0xf0 | c >> 18), *p++ = Out(0x80 | (c >> 12 & 0x3f)), *p++ = Out(0x80 | (c >> 6 & 0x3f)), *p++ = Out(0x80 | (c & 0x3f));
+    return p;
+  } else if constexpr (sizeof(Out) == 2) if (c >= 0x10000) return *p++ = Out(0xd800 | (c - 0x10000) >> 10), *p++ = Out(0xdc00 | (c & 0x3ff)), p;
+  return *p++ = Out(c), p;
+}
+
+/// stores 16 ASCII bytes widened to the units of `Out`
+template<typename Out> inline void _ascii_put(Out* p, const __m128i v) noexcept {
+  if constexpr (sizeof(Out) == 1) _storeu128(p, v);
+  else if constexpr (sizeof(Out) == 2) _storeu128(p, _mm_cvtepu8_epi16(v)), _storeu128(p + 8, _mm_cvtepu8_epi16(_mm_srli_si128(v, 8)));
+  else _storeu128(p, _mm_cvtepu8_epi32(v)), _storeu128(p + 4, _mm_cvtepu8_epi32(_mm_srli_si128(v, 4))),
+       _storeu128(p + 8, _mm_cvtepu8_epi32(_mm_srli_si128(v, 8))), _storeu128(p + 12, _mm_cvtepu8_epi32(_mm_srli_si128(v, 12)));
+}
+
+/// decodes UTF-8 to UTF-16 or UTF-32; runs of ASCII are widened 16 bytes at a time
+/// \note `p` must have room for `last - i` units.
+template<typename Out, typename In> constexpr Out* _utf8_decode(const In* i, const In* const last, Out* p) noexcept {
+  while (i < last) {
+    if (!IS_CEV) while (last - i >= 16) {
+      const auto v = _loadu128(i);
+      const nat n = std::countr_zero(nat4(_mm_movemask_epi8(v)) | 0x10000);
+      _ascii_put(p, v);
+      i += n, p += n;
+      if (n < 16) break;
+    }
+    if (i == last) break;
+    nat4 c = nat1(*i++);
+    if (c < 0x80) {
+    } else if (c < 0xc0) c = 0xfffe;
+    else if (c < 0xf8 && last - i < (c < 0xe0 ? 1 : c < 0xf0 ? 2 : 3)) c = 0xfffe, i = last;
+    else if (c < 0xe0) c = (c & 0x1f) << 6, c |= nat1(*i++) & 0x3f;
+    else if (c < 0xf0) c = (c & 0x0f) << 12, c |= (nat1(*i++) & 0x3f) << 6, c |= nat1(*i++) & 0x3f;
+    else if (c < 0xf8) c = (c & 0x07) << 18, c |= (nat1(*i++) & 0x3f) << 12, c |= (nat1(*i++) & 0x3f) << 6, c |= nat1(*i++) & 0x3f;
+    else c = 0xfffe;
+    p = _utf_put(p, c);
+  }
+  return p;
+}
+
+/// encodes UTF-16 or UTF-32 to UTF-8; runs of ASCII are narrowed 8 units at a time
+/// \note `p` must have room for `(last - i) * 3` units from UTF-16, or `(last - i) * 4` from UTF-32.
+template<typename Out, typename In> constexpr Out* _utf8_encode(const In* i, const In* const last, Out* p) noexcept {
+  while (i < last) {
+    if (!IS_CEV) while (last - i >= 8) {
+      __m128i v;
+      nat4 m;
+      if constexpr (sizeof(In) == 2) {
+        v = _loadu128(i);
+        m = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(-0x80)), _mm_setzero_si128()));
+      } else {
+        const auto a = _loadu128(i), b = _loadu128(i + 4), x = _mm_set1_epi32(-0x80), z = _mm_setzero_si128();
+        v = _mm_packus_epi32(a, b);
+        m = _mm_movemask_epi8(_mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(a, x), z), _mm_cmpeq_epi32(_mm_and_si128(b, x), z)));
+      }
+      const nat n = std::countr_one(m) / 2;
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(v, v));
+      i += n, p += n;
+      if (n < 8) break;
+    }
+    if (i == last) break;
+    p = _utf_put(p, sizeof(In) == 2 ? _utf16_next(i, last) : nat4(*i++));
+  }
+  return p;
+}
+
+/// converts UTF-16 to UTF-32; blocks of 8 units without surrogates are widened at once
+template<typename Out, typename In> constexpr Out* _utf16_to_utf32(const In* i, const In* const last, Out* p) noexcept {
+  while (i < last) {
+    if (!IS_CEV) while (last - i >= 8) {
+      const auto v = _loadu128(i);
+      const nat4 m = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(-0x800)), _mm_set1_epi16(-0x2800)));
+      const nat n = std::countr_zero(m | 0x10000) / 2;
+      _storeu128(p, _mm_cvtepu16_epi32(v)), _storeu128(p + 4, _mm_cvtepu16_epi32(_mm_srli_si128(v, 8)));
+      i += n, p += n;
+      if (n < 8) break;
+    }
+    if (i != last) *p++ = Out(_utf16_next(i, last));
+  }
+  return p;
+}
+
+/// converts UTF-32 to UTF-16; blocks of 8 code points in the BMP are narrowed at once
+/// \note `p` must have room for `(last - i) * 2` units.
+template<typename Out, typename In> constexpr Out* _utf32_to_utf16(const In* i, const In* const last, Out* p) noexcept {
+  while (i < last) {
+    if (!IS_CEV) while (last - i >= 8) {
+      const auto a = _loadu128(i), b = _loadu128(i + 4), x = _mm_set1_epi32(-0x10000), z = _mm_setzero_si128();
+      const nat4 m = _mm_movemask_epi8(_mm_packs_epi32(_mm_cmpeq_epi32(_mm_and_si128(a, x), z), _mm_cmpeq_epi32(_mm_and_si128(b, x), z)));
+      const nat n = std::countr_one(m) / 2;
+      _storeu128(p, _mm_packus_epi32(a, b));
+      i += n, p += n;
+      if (n < 8) break;
+    }
+    if (i != last) p = _utf_put(p, nat4(*i++));
+  }
+  return p;
+}
+
+/// checks if `c` is a lead byte of a double-byte character in Shift-JIS
+constexpr bool _sjis_lead(const nat1 c) noexcept { return (0x81 <= c && c < 0xa0) || (0xe0 <= c && c < 0xfd); }
+
+/// maps a double-byte character in Shift-JIS to unicode; `Trail` must be at least `0x40`
+constexpr nat4 _sjis_pair(const nat1 Lead, const nat1 Trail) noexcept {
+  return Lead < 0xa0 ? _shiftjis_table1[Lead - 0x81][Trail - 0x40] : _shiftjis_table2[Lead - 0xe0][Trail - 0x40];
+}
+
+/// decodes Shift-JIS to UTF-8, UTF-16 or UTF-32; runs of ASCII are copied 16 bytes at a time
+/// \param Lead (inout) lead byte left by the previous chunk, or 0; receives a lead byte at the end of this chunk
+/// \note `p` must have room for `(last - i + 1) * 3` UTF-8 units, or `last - i + 1` other units.
+template<typename Out, typename In> constexpr Out* _sjis_decode(const In* i, const In* const last, Out* p, nat1& Lead) noexcept {
+  if (Lead != 0 && i < last) {
+    const nat1 t = nat1(*i);
+    p = _utf_put(p, t < 0x40 ? 0xfffe : (++i, _sjis_pair(Lead, t)));
+    Lead = 0;
+  }
+  while (i < last) {
+    if (!IS_CEV) while (last - i >= 16) {
+      const auto v = _loadu128(i);
+      const nat n = std::countr_zero(nat4(_mm_movemask_epi8(v)) | 0x10000);
+      _ascii_put(p, v);
+      i += n, p += n;
+      if (n < 16) break;
+    }
+    if (i == last) break;
+    const nat1 c = nat1(*i++);
+    if (c < 0x80) *p++ = Out(c);
+    else if (0xa1 <= c && c < 0xe0) p = _utf_put(p, 0xfec0 + c);
+    else if (!_sjis_lead(c)) p = _utf_put(p, 0xfffe);
+    else if (i == last) Lead = c;
+    else if (nat1(*i) < 0x40) p = _utf_put(p, 0xfffe);
+    else p = _utf_put(p, _sjis_pair(c, nat1(*i++)));
+  }
+  return p;
+}
 
 }
 
 /// converts shift-jis string to unicode string
+/// \tparam Ct character type of the result; UTF-8, UTF-16 or UTF-32
 /// \param s shift-jis string
 /// \return unicode string
-constexpr String<cat2> from_sjis(const StringView<cat1> s) noexcept {
-  String<cat2> r(s.size() * 2, {});
-  auto p = r.data();
-  for (auto i = s.data(), last = i + s.size(); i < last;) {
-    nat1 c(*i++);
-    if (c < 0x80) *p++ = c;
-    else if (c < 0xa0) {
-      if (c == 0x80 || nat1(*i) < 0x40) *p++ = 0xfffe;
-      else *p++ = _::_shiftjis_table1[c - 0x81][nat1(*i++) - 0x40];
-    } else if (c < 0xe0) {
-      if (c == 0xa0) *p++ = 0xfffe;
-      else *p++ = 0xfec0_c2 + c;
-    } else if (c < 0xfd) {
-      if (nat1(*i) < 0x40) *p++ = 0xfffe;
-      else *p++ = _::_shiftjis_table2[c - 0xe0][nat1(*i++) - 0x40];
-    } else *p++ = 0xfffe;
-  }
+/// \note Invalid bytes, including a lead byte at the end, are converted to `0xfffe`.
+template<character Ct = cat2> constexpr String<Ct> from_sjis(const StringView<cat1> s) noexcept {
+  String<Ct> r((s.size() + 1) * (sizeof(Ct) == 1 ? 3 : 1), {});
+  nat1 lead{};
+  auto p = _::_sjis_decode(s.data(), s.data() + s.size(), r.data(), lead);
+  if (lead != 0) p = _::_utf_put(p, 0xfffe);
   r.resize(p - r.data());
   return r;
 }
 
+/// class to decode Shift-JIS text arriving in chunks
+/// \note A lead byte at the end of a chunk is kept and completed by the first byte of the next chunk.
+class SjisDecoder {
+protected:
+  nat1 _lead{};
+
+public:
+
+  /// checks if a lead byte is waiting for the next chunk
+  constexpr bool pending() const noexcept { return _lead != 0; }
+
+  /// decodes a chunk and appends the text to `Out`
+  /// \param Chunk (in) next bytes of Shift-JIS text
+  /// \param Out (out) string to append UTF-8, UTF-16 or UTF-32 text to
+  template<character Ct> constexpr void decode(const StringView<cat1> Chunk, String<Ct>& Out) {
+    const nat n = Out.size();
+    Out.resize(n + (Chunk.size() + 1) * (sizeof(Ct) == 1 ? 3 : 1));
+    Out.resize(_::_sjis_decode(Chunk.data(), Chunk.data() + Chunk.size(), Out.data() + n, _lead) - Out.data());
+  }
+
+  /// decodes a leading part of a chunk into a buffer without allocation
+  /// \param Chunk (inout) next bytes of Shift-JIS text; the decoded part is removed
+  /// \param Out (out) buffer to write UTF-8, UTF-16 or UTF-32 text to
+  /// \return number of code units written
+  /// \note `Out` needs at least 6 units for UTF-8, or 2 otherwise, to make progress.
+  template<character Ct> constexpr nat decode(StringView<cat1>& Chunk, const std::span<Ct> Out) noexcept {
+    constexpr nat k = sizeof(Ct) == 1 ? 3 : 1;
+    const nat m = Out.size() < k * 2 ? 0 : std::min<nat>(Chunk.size(), Out.size() / k - 1);
+    const auto p = _::_sjis_decode(Chunk.data(), Chunk.data() + m, Out.data(), _lead);
+    Chunk.remove_prefix(m);
+    return nat(p - Out.data());
+  }
+
+  /// ends the text; a pending lead byte is appended as `0xfffe`
+  template<character Ct> constexpr void finish(String<Ct>& Out) {
+    if (_lead == 0) return;
+    Ct u[4];
+    Out.append(u, _::_utf_put(u, 0xfffe) - u);
+    _lead = 0;
+  }
+};
+
+namespace _ {
+
+/// encodes UTF-16 to Shift-JIS
+/// \return end of the written bytes
+/// \note `p` must have room for `(last - i) * 2` bytes.
+constexpr cat1* _sjis_encode(const cat2* i, const cat2* const last, cat1* p) noexcept {
+  while (i < last) {
+    const nat4 c = _sjis_encode(nat4(*i++));
+    if (c & 0xff00) *p++ = bitcast<cat1>(nat1(c & 0xff)), *p++ = bitcast<cat1>(nat1(c >> 8));
+    else *p++ = bitcast<cat1>(nat1(c));
+  }
+  return p;
+}
+
+}
+
 /// converts unicode string to shift-jis string
 /// \param s unicode string
 /// \return shift-jis string
 constexpr String<cat1> to_sjis(const StringView<cat2> s) noexcept {
   String<cat1> r(s.size() * 2, {});
-  auto p = r.data();
-  for (auto i = s.data(), last = i + s.size(); i < last;) {
-    auto c = *i++;
-    if (c < 0x4e00) {
-      if (c < 0x0100) c = _::_unicode_table_0000_0100[c];
-      else if (c < 0x0390) c = 0x8888;
-      else if (c < 0x0460) c = _::_unicode_table_0390_0460[c - 0x0390];
-      else if (c < 0x2010) c = 0x8888;
-      else if (c < 0x2670) c = _::_unicode_table_2010_2670[c - 0x2010];
-      else if (c < 0x3000) c = 0x8888;
-      else if (c < 0x33d0) c = _::_unicode_table_3000_33d0[c - 0x3000];
-      else c = 0x8888;
-    } else {
-      if (c < 0x9fb0) c = _::_unicode_table_4e00_9fb0[c - 0x4e00];
-      else if (c < 0xe000) c = 0x8888;
-      else if (c < 0xe760) c = _::_unicode_table_e000_e760[c - 0xe000];
-      else if (c < 0xf8f0) c = 0x8888;
-      else if (c < 0xfa30) c = _::_unicode_table_f8f0_fa30[c - 0xf8f0];
-      else if (c < 0xff00) c = 0x8888;
-      else c = _::_unicode_table_ff00_10000[c - 0xff00];
+  r.resize(_::_sjis_encode(s.data(), s.data() + s.size(), r.data()) - r.data());
+  return r;
+}
+
+/// converts a leading part of unicode string to shift-jis into a buffer without allocation
+/// \param s (inout) unicode string; the converted part is removed
+/// \param Buffer (out) buffer to write shift-jis bytes to
+/// \return number of bytes written; `0` only if `s` is empty or `Buffer` has fewer than 2 bytes
+/// \note Only whole characters are converted, as with `yw::cvt_into`.
+constexpr nat to_sjis_into(StringView<cat2>& s, const std::span<cat1> Buffer) noexcept {
+  const nat m = std::min<nat>(s.size(), Buffer.size() / 2);
+  const auto p = _::_sjis_encode(s.data(), s.data() + m, Buffer.data());
+  s.remove_prefix(m);
+  return nat(p - Buffer.data());
+}
+
+namespace _ {
+
+/// maps a JIS X 0208 character to unicode through the Shift-JIS tables; both bytes must be in [0x21..0x7e]
+constexpr nat4 _jis_pair(const nat1 j1, const nat1 j2) noexcept {
+  const nat1 s1 = nat1(((j1 + 1) >> 1) + (j1 < 0x5f ? 0x70 : 0xb0));
+  const nat1 s2 = nat1(j2 + (j1 & 1 ? (j2 < 0x60 ? 0x1f : 0x20) : 0x7e));
+  return _sjis_pair(s1, s2);
+}
+
+/// maps a unicode character to JIS X 0208 through the Shift-JIS tables
+/// \return `j1 << 8 | j2`; a single byte for ASCII (< `0x80`) or half-width katakana (`0xa1`..`0xdf`); `0` if unmapped
+constexpr nat4 _jis_encode(const nat4 c) noexcept {
+  if (c >= 0x10000) return 0;
+  const nat4 v = c < 0x80 ? c : _sjis_encode(c);
+  if (v < 0x100) return v < 0x80 || (0xa1 <= v && v < 0xe0) ? v : 0;
+  nat4 s1 = v & 0xff, s2 = v >> 8;
+  if (v == 0x8888 || s1 >= 0xf0) return 0;
+  s1 = (s1 - (s1 < 0xa0 ? 0x70 : 0xb0)) << 1;
+  if (s2 < 0x9f) --s1, s2 -= s2 >= 0x80 ? 0x20 : 0x1f;
+  else s2 -= 0x7e;
+  return s1 << 8 | s2;
+}
+
+/// returns the length of the leading ASCII bytes except `Stop` in a block of 16 bytes
+inline nat _ascii_prefix(const __m128i v, const char Stop) noexcept {
+  return std::countr_zero(nat4(_mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, _mm_set1_epi8(Stop))))) | 0x10000);
+}
+
+/// decodes EUC-JP to UTF-8, UTF-16 or UTF-32; runs of ASCII are copied 16 bytes at a time
+/// \return the first byte of an incomplete sequence at the end, or `last`
+/// \note `p` must have room for `(last - i) * 3` UTF-8 units, or `last - i` other units.
+template<typename Out, typename In> constexpr const In* _eucjp_decode(const In* i, const In* const last, Out*& p) noexcept {
+  while (i < last) {
+    if (!IS_CEV) while (last - i >= 16) {
+      const auto v = _loadu128(i);
+      const nat n = std::countr_zero(nat4(_mm_movemask_epi8(v)) | 0x10000);
+      _ascii_put(p, v);
+      i += n, p += n;
+      if (n < 16) break;
     }
-    if (c & 0xff00) *p++ = bitcast<cat1>(nat1(c & 0xff)), *p++ = bitcast<cat1>(nat1(c >> 8));
-    else *p++ = bitcast<cat1>(nat1(c));
+    if (i == last) break;
+    const nat1 c = nat1(*i);
+    if (c < 0x80) { *p++ = Out(c), ++i; continue; }
+    const nat n = c == 0x8f ? 3 : c == 0x8e || (0xa1 <= c && c < 0xff) ? 2 : 1;
+    if (nat(last - i) < n) return i;
+    const nat1 t = nat1(i[n - 1]);
+    if (n == 1 || t < 0xa1 || t == 0xff || (n == 3 && (nat1(i[1]) < 0xa1 || nat1(i[1]) == 0xff))) p = _utf_put(p, 0xfffe), ++i;
+    else if (c == 0x8e) p = _utf_put(p, t < 0xe0 ? 0xfec0 + t : 0xfffe), i += 2;
+    else if (c == 0x8f) p = _utf_put(p, 0xfffe), i += 3; // JIS X 0212 is not in the tables
+    else p = _utf_put(p, _jis_pair(c - 0x80, t - 0x80)), i += 2;
+  }
+  return i;
+}
+
+/// modes of ISO-2022-JP switched by escape sequences
+enum class _jis_mode : nat1 { ASCII, KANJI, KANA };
+
+/// decodes ISO-2022-JP to UTF-8, UTF-16 or UTF-32; runs of ASCII are copied 16 bytes at a time
+/// \param Mode (inout) current mode, kept across chunks
+/// \return the first byte of an incomplete sequence at the end, or `last`
+/// \note `ESC ( J` is decoded as ASCII, and `ESC ( I` selects half-width katakana as in CP50221.
+template<typename Out, typename In> constexpr const In* _jis_decode(const In* i, const In* const last, Out*& p, _jis_mode& Mode) noexcept {
+  while (i < last) {
+    if (!IS_CEV) while (Mode == _jis_mode::ASCII && last - i >= 16) {
+      const auto v = _loadu128(i);
+      const nat n = _ascii_prefix(v, 0x1b);
+      _ascii_put(p, v);
+      i += n, p += n;
+      if (n < 16) break;
+    }
+    if (i == last) break;
+    const nat1 c = nat1(*i);
+    if (c == 0x1b) {
+      if (last - i < 3) return i;
+      const nat1 a = nat1(i[1]), b = nat1(i[2]);
+      if (a == '(' && (b == 'B' || b == 'J')) Mode = _jis_mode::ASCII;
+      else if (a == '(' && b == 'I') Mode = _jis_mode::KANA;
+      else if (a == '$' && (b == '@' || b == 'B')) Mode = _jis_mode::KANJI;
+      else { p = _utf_put(p, 0xfffe), ++i; continue; }
+      i += 3;
+    } else if (c >= 0x80) p = _utf_put(p, 0xfffe), ++i;
+    else if (c < 0x21 || c == 0x7f || Mode == _jis_mode::ASCII) *p++ = Out(c), ++i;
+    else if (Mode == _jis_mode::KANA) p = _utf_put(p, c < 0x60 ? 0xff40 + c : 0xfffe), ++i;
+    else if (last - i < 2) return i;
+    else if (const nat1 t = nat1(i[1]); t < 0x21 || t == 0x7f || t >= 0x80) p = _utf_put(p, 0xfffe), ++i;
+    else p = _utf_put(p, _jis_pair(c, t)), i += 2;
+  }
+  return i;
+}
+
+/// decodes a chunk with `Decode`, which stops at an incomplete sequence; the sequence is kept in `Carry`
+template<typename Ct, typename Fn> constexpr void _decode_chunk(nat1 (&Carry)[4], nat& Count, const StringView<cat1> Chunk, String<Ct>& Out, Fn&& Decode) {
+  const nat n = Out.size();
+  Out.resize(n + (Chunk.size() + Count) * (sizeof(Ct) == 1 ? 3 : 1));
+  Ct* p = Out.data() + n;
+  auto i = Chunk.data();
+  const auto last = i + Chunk.size();
+  while (Count != 0 && i < last) {
+    Carry[Count++] = nat1(*i++);
+    const nat k = nat(Decode(Carry + 0, Carry + Count, p) - Carry);
+    for (nat j = k; j < Count; ++j) Carry[j - k] = Carry[j];
+    Count -= k;
+  }
+  if (Count == 0) for (auto r = Decode(i, last, p); r < last; ++r) Carry[Count++] = nat1(*r);
+  Out.resize(p - Out.data());
+}
+
+/// encodes UTF-16 to EUC-JP or ISO-2022-JP; runs of ASCII are narrowed 8 units at a time
+/// \param Mode (inout) current mode of ISO-2022-JP, kept across chunks; not reset to ASCII at the end
+/// \return end of the written bytes
+/// \note `p` must have room for `(last - i) * 5` bytes of ISO-2022-JP, or `(last - i) * 2` of EUC-JP.
+/// \note Unmapped characters are encoded as `?`.
+template<bool Jis> constexpr cat1* _jp_encode(const cat2* i, const cat2* const last, cat1* p, _jis_mode& Mode) noexcept {
+  auto put = [&p](const nat4 c) { *p++ = bitcast<cat1>(nat1(c)); };
+  auto escape = [&](const _jis_mode m, const cat1 a, const cat1 b) { if (Mode != m) put(0x1b), put(a), put(b), Mode = m; };
+  while (i < last) {
+    if constexpr (sizeof(cat2) == 2) if (!IS_CEV) while ((!Jis || Mode == _jis_mode::ASCII) && last - i >= 8) {
+      const auto v = _loadu128(i);
+      const nat4 m = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(-0x80)), _mm_setzero_si128()));
+      const nat n = std::countr_one(m) / 2;
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packus_epi16(v, v));
+      i += n, p += n;
+      if (n < 8) break;
+    }
+    if (i == last) break;
+    nat4 c = _jis_encode(nat4(*i++));
+    if (c == 0) c = '?';
+    if (c < 0x80) {
+      if constexpr (Jis) escape(_jis_mode::ASCII, '(', 'B');
+      put(c);
+    } else if (c < 0x100) {
+      if constexpr (Jis) escape(_jis_mode::KANA, '(', 'I'), put(c - 0x80);
+      else put(0x8e), put(c);
+    } else if constexpr (Jis) escape(_jis_mode::KANJI, '$', 'B'), put(c >> 8), put(c & 0xff);
+    else put((c >> 8) | 0x80), put((c & 0xff) | 0x80);
   }
+  return p;
+}
+
+/// writes the escape sequence back to ASCII unless `Mode` is ASCII
+/// \return end of the written bytes; `p` must have room for 3 bytes
+constexpr cat1* _jis_reset(cat1* p, _jis_mode& Mode) noexcept {
+  if (Mode == _jis_mode::ASCII) return p;
+  Mode = _jis_mode::ASCII;
+  for (const nat1 c : {nat1(0x1b), nat1('('), nat1('B')}) *p++ = bitcast<cat1>(c);
+  return p;
+}
+
+}
+
+/// converts EUC-JP string to unicode string
+/// \tparam Ct character type of the result; UTF-8, UTF-16 or UTF-32
+/// \param s EUC-JP string
+/// \return unicode string
+/// \note JIS X 0208 is mapped through the Shift-JIS tables; JIS X 0212 and invalid bytes are converted to `0xfffe`.
+template<character Ct = cat2> constexpr String<Ct> from_eucjp(const StringView<cat1> s) noexcept {
+  String<Ct> r((s.size() + 1) * (sizeof(Ct) == 1 ? 3 : 1), {});
+  auto p = r.data();
+  if (_::_eucjp_decode(s.data(), s.data() + s.size(), p) != s.data() + s.size()) p = _::_utf_put(p, 0xfffe);
   r.resize(p - r.data());
   return r;
 }
 
+/// converts unicode string to EUC-JP string
+/// \param s unicode string
+/// \return EUC-JP string; unmapped characters are `?`
+constexpr String<cat1> to_eucjp(const StringView<cat2> s) noexcept {
+  String<cat1> r(s.size() * 2, {});
+  auto mode = _::_jis_mode::ASCII;
+  r.resize(_::_jp_encode<false>(s.data(), s.data() + s.size(), r.data(), mode) - r.data());
+  return r;
+}
+
+/// converts a leading part of unicode string to EUC-JP into a buffer without allocation
+/// \param s (inout) unicode string; the converted part is removed
+/// \param Buffer (out) buffer to write EUC-JP bytes to; unmapped characters are `?`
+/// \return number of bytes written; `0` only if `s` is empty or `Buffer` has fewer than 2 bytes
+/// \note Only whole characters are converted, as with `yw::cvt_into`.
+constexpr nat to_eucjp_into(StringView<cat2>& s, const std::span<cat1> Buffer) noexcept {
+  const nat m = std::min<nat>(s.size(), Buffer.size() / 2);
+  auto mode = _::_jis_mode::ASCII;
+  const auto p = _::_jp_encode<false>(s.data(), s.data() + m, Buffer.data(), mode);
+  s.remove_prefix(m);
+  return nat(p - Buffer.data());
+}
+
+/// converts ISO-2022-JP string to unicode string
+/// \tparam Ct character type of the result; UTF-8, UTF-16 or UTF-32
+/// \param s ISO-2022-JP string
+/// \return unicode string
+/// \note `ESC ( J` is treated as ASCII and `ESC ( I` selects half-width katakana; invalid bytes are converted to `0xfffe`.
+template<character Ct = cat2> constexpr String<Ct> from_jis(const StringView<cat1> s) noexcept {
+  String<Ct> r((s.size() + 1) * (sizeof(Ct) == 1 ? 3 : 1), {});
+  auto p = r.data();
+  auto mode = _::_jis_mode::ASCII;
+  if (_::_jis_decode(s.data(), s.data() + s.size(), p, mode) != s.data() + s.size()) p = _::_utf_put(p, 0xfffe);
+  r.resize(p - r.data());
+  return r;
+}
+
+/// converts unicode string to ISO-2022-JP string
+/// \param s unicode string
+/// \return ISO-2022-JP string ending in ASCII mode; half-width katakana uses `ESC ( I` and unmapped characters are `?`
+constexpr String<cat1> to_jis(const StringView<cat2> s) noexcept {
+  String<cat1> r(s.size() * 5 + 3, {});
+  auto mode = _::_jis_mode::ASCII;
+  r.resize(_::_jis_reset(_::_jp_encode<true>(s.data(), s.data() + s.size(), r.data(), mode), mode) - r.data());
+  return r;
+}
+
+/// class to decode EUC-JP text arriving in chunks
+/// \note An incomplete character at the end of a chunk is kept and completed by the next chunk.
+class EucjpDecoder {
+protected:
+  nat1 _carry[4]{};
+  nat _count{};
+
+public:
+
+  /// checks if an incomplete character is waiting for the next chunk
+  constexpr bool pending() const noexcept { return _count != 0; }
+
+  /// decodes a chunk and appends the text to `Out` in UTF-8, UTF-16 or UTF-32
+  template<character Ct> constexpr void decode(const StringView<cat1> Chunk, String<Ct>& Out) {
+    _::_decode_chunk(_carry, _count, Chunk, Out, [](const auto* i, const auto* last, Ct*& p) { return _::_eucjp_decode(i, last, p); });
+  }
+
+  /// ends the text; an incomplete character is appended as `0xfffe`
+  template<character Ct> constexpr void finish(String<Ct>& Out) {
+    if (_count == 0) return;
+    Ct u[4];
+    Out.append(u, _::_utf_put(u, 0xfffe) - u);
+    _count = 0;
+  }
+};
+
+/// class to decode ISO-2022-JP text arriving in chunks
+/// \note The mode and an incomplete escape sequence or character are kept across chunks.
+class JisDecoder {
+protected:
+  nat1 _carry[4]{};
+  nat _count{};
+  _::_jis_mode _mode{};
+
+public:
+
+  /// checks if an incomplete sequence is waiting for the next chunk
+  constexpr bool pending() const noexcept { return _count != 0; }
+
+  /// decodes a chunk and appends the text to `Out` in UTF-8, UTF-16 or UTF-32
+  template<character Ct> constexpr void decode(const StringView<cat1> Chunk, String<Ct>& Out) {
+    _::_decode_chunk(_carry, _count, Chunk, Out, [this](const auto* i, const auto* last, Ct*& p) { return _::_jis_decode(i, last, p, _mode); });
+  }
+
+  /// ends the text; an incomplete sequence is appended as `0xfffe` and the mode is reset to ASCII
+  template<character Ct> constexpr void finish(String<Ct>& Out) {
+    _mode = _::_jis_mode::ASCII;
+    if (_count == 0) return;
+    Ct u[4];
+    Out.append(u, _::_utf_put(u, 0xfffe) - u);
+    _count = 0;
+  }
+};
+
+/// class to encode unicode text to ISO-2022-JP into buffers in chunks
+/// \note The mode is kept across chunks, so that an escape sequence is written only when the mode changes.
+class JisEncoder {
+protected:
+  _::_jis_mode _mode{};
+
+public:
+
+  /// checks if the mode is not ASCII; `finish` has an escape sequence to write
+  constexpr bool pending() const noexcept { return _mode != _::_jis_mode::ASCII; }
+
+  /// converts a leading part of unicode string into a buffer without allocation
+  /// \param s (inout) unicode string; the converted part is removed
+  /// \param Buffer (out) buffer to write ISO-2022-JP bytes to; unmapped characters are `?`
+  /// \return number of bytes written; `0` only if `s` is empty or `Buffer` has fewer than 5 bytes
+  /// \note Only whole characters are converted, as with `yw::cvt_into`.
+  constexpr nat encode(StringView<cat2>& s, const std::span<cat1> Buffer) noexcept {
+    const nat m = std::min<nat>(s.size(), Buffer.size() / 5);
+    const auto p = _::_jp_encode<true>(s.data(), s.data() + m, Buffer.data(), _mode);
+    s.remove_prefix(m);
+    return nat(p - Buffer.data());
+  }
+
+  /// ends the text; writes the escape sequence back to ASCII if needed
+  /// \param Buffer (out) buffer to write the escape sequence to
+  /// \return number of bytes written; `0` if not `pending()` or `Buffer` has fewer than 3 bytes
+  constexpr nat finish(const std::span<cat1> Buffer) noexcept {
+    return Buffer.size() < 3 ? 0 : nat(_::_jis_reset(Buffer.data(), _mode) - Buffer.data());
+  }
+};
+
 /// converts the unicode encoding of a string
 /// \param s string to convert
 /// \return converted string
+/// \note Every pair of UTF-8, UTF-16 and UTF-32 converts directly; ASCII runs and BMP blocks are vectorized.
 template<character Out> requires same_as<Out, remove_cvref<Out>>
 constexpr String<Out> cvt(stringable auto&& s) noexcept {
   using In = remove_cvref<iter_value<decltype(s)>>;
   StringView<In> v(s);
   if constexpr (sizeof(In) == sizeof(Out)) return String<Out>(bitcast<StringView<Out>>(v));
-  else if constexpr (included_in<In, cat1, uct1>) {
-    if constexpr (same_as<Out, uct4>) {
-      String<uct4> r(v.size(), {});
-      auto p = r.data();
-      for (auto i = v.data(), last = i + v.size(); i < last;) {
-        uct1 c = *i++;
-        if (c < 0x80) *p++ = c;
-        else if (c < 0xc0) *p++ = 0xfffe;
-        else if (c < 0xe0) *p++ = (c & 0x1f) << 6 | (*i++ & 0x3f);
-        else if (c < 0xf0) *p++ = (c & 0x0f) << 12 | (*i++ & 0x3f) << 6 | (*i++ & 0x3f);
-        else if (c < 0xf8) *p++ = (c & 0x07) << 18 | (*i++ & 0x3f) << 12 | (*i++ & 0x3f) << 6 | (*i++ & 0x3f);
-        else *p++ = 0xfffe;
-      }
-      r.resize(p - r.data());
-      return r;
-    } else if constexpr (included_in<Out, cat2, uct2>) return cvt<Out>(cvt<uct4>(s));
-  } else if constexpr (included_in<In, cat2, uct2>) {
-    if constexpr (same_as<Out, uct4>) {
-      String<uct4> r(v.size(), {});
-      auto p = r.data();
-      for (auto i = v.data(), last = i + v.size(); i < last;) {
-        if (*i < 0xd800 || *i >= 0xe000) *p++ = *i++;
-        else *p++ = *i++ & 0x03ff_u2 | (*i++ & 0x03ff_u2 << 10);
-      }
-      r.resize(p - r.data());
-      return r;
-    } else if constexpr (included_in<Out, cat1, uct1>) return cvt<Out>(cvt<uct4>(s));
-  } else if constexpr (same_as<In, uct4>) {
-    if constexpr (included_in<Out, cat1, uct1>) {
-      String<Out> r(v.size() * 4, {});
-      auto p = r.data();
-      for (auto i = v.data(), last = i + v.size(); i < last;) {
-        uct4 c = *i++;
-        if (c < 0x80) *p++ = Out(c);
-        else if (c < 0x800) *p++ = Out(0xc0 | (c >> 6)), *p++ = Out(0x80 | (c & 0x3f));
-        else if (c < 0x10000) *p++ = Out(0xe0 | (c >> 12)),
-                              *p++ = Out(0x80 | ((c >> 6) & 0x3f)), *p++ = Out(0x80 | (c & 0x3f));
-        else *p++ = Out(0xf0 | (c >> 18)), *p++ = Out(0x80 | ((c >> 12) & 0x3f)),
-             *p++ = Out(0x80 | ((c >> 6) & 0x3f)), *p++ = Out(0x80 | (c & 0x3f));
-      }
-      r.resize(p - r.data());
-      return r;
-    } else if constexpr (included_in<Out, cat2, uct2>) {
-      String<Out> r(v.size() * 2, {});
-      auto p = r.data();
-      for (auto i = v.data(), last = i + v.size(); i < last;) {
-        auto c = *i++;
-        if (c < 0x10000) *p++ = Out(c);
-        else *p++ = Out(0xd800 | ((c - 0x10000) >> 10)), *p++ = Out(0xdc00_u2 | ((c - 0x10000) & 0x3ff));
-      }
-      r.resize(p - r.data());
-      return r;
+  else {
+    constexpr nat k = sizeof(Out) > sizeof(In) ? 1 : sizeof(Out) == 1 ? sizeof(In) == 2 ? 3 : 4 : 2;
+    String<Out> r(v.size() * k, {});
+    const auto i = v.data(), last = i + v.size();
+    Out* p;
+    if constexpr (sizeof(In) == 1) p = _::_utf8_decode(i, last, r.data());
+    else if constexpr (sizeof(Out) == 1) p = _::_utf8_encode(i, last, r.data());
+    else if constexpr (sizeof(In) == 2) p = _::_utf16_to_utf32(i, last, r.data());
+    else p = _::_utf32_to_utf16(i, last, r.data());
+    r.resize(p - r.data());
+    return r;
+  }
+}
+
+
+/// enum to represent how `yw::transcode` handles invalid sequences
+enum class Invalid {
+  REPLACE, // replaces each maximal invalid subpart with U+FFFD
+  SKIP,    // drops invalid sequences
+  FAIL,    // stops at the first invalid sequence
+};
+
+/// result of `yw::transcode`
+template<character Ct> struct Transcoded {
+  String<Ct> text{};
+  nat error{}; // offset of the first invalid sequence in input units; the size of the input if none
+};
+
+namespace _ {
+
+inline constexpr nat4 _utf_invalid = 0xffffffff;
+
+/// decodes one code point strictly; invalid sequences set `c` to `_utf_invalid`
+/// \return number of units consumed; for invalid UTF-8, the length of the maximal invalid subpart
+template<typename In> constexpr nat _utf_decode_strict(const In* const i, const In* const last, nat4& c) noexcept {
+  if constexpr (sizeof(In) == 1) {
+    const nat4 b = nat1(i[0]);
+    nat4 lo = 0x80, hi = 0xbf;
+    nat n;
+    if (b < 0x80) return c = b, 1;
+    else if (b < 0xc2) return c = _utf_invalid, 1;
+    else if (b < 0xe0) n = 2, c = b & 0x1f;
+    else if (b < 0xf0) n = 3, c = b & 0x0f, lo = b == 0xe0 ? 0xa0 : 0x80, hi = b == 0xed ? 0x9f : 0xbf;
+    else if (b < 0xf5) n = 4, c = b & 0x07, lo = b == 0xf0 ? 0x90 : 0x80, hi = b == 0xf4 ? 0x8f : 0xbf;
+    else return c = _utf_invalid, 1;
+    for (nat k = 1; k < n; ++k, lo = 0x80, hi = 0xbf) {
+      const nat4 t = k < nat(last - i) ? nat1(i[k]) : 0;
+      if (t < lo || hi < t) return c = _utf_invalid, k;
+      c = c << 6 | (t & 0x3f);
+    }
+    return n;
+  } else if constexpr (sizeof(In) == 2) {
+    c = nat2(i[0]);
+    if ((c & 0xf800) != 0xd800) return 1;
+    if (c < 0xdc00 && last - i > 1 && (nat2(i[1]) & 0xfc00) == 0xdc00) return c = 0x10000 + ((c & 0x3ff) << 10 | (nat2(i[1]) & 0x3ff)), 2;
+    return c = _utf_invalid, 1;
+  } else {
+    c = nat4(i[0]);
+    if (c > 0x10ffff || (c & 0xfffff800) == 0xd800) c = _utf_invalid;
+    return 1;
+  }
+}
+
+/// looks up 16 nibbles in a table of 16 bytes
+inline __m128i _lookup16(const __m128i Nibbles, const nat1 (&Table)[16]) noexcept {
+  return _mm_shuffle_epi8(_loadu128(Table), Nibbles);
+}
+
+/// returns the bytes of UTF-8 errors in a block of 16 bytes, given the previous block
+/// \note This is the lookup algorithm of Keiser and Lemire, "Validating UTF-8 in less than one instruction per byte".
+inline __m128i _utf8_block_error(const __m128i Input, const __m128i Prev) noexcept {
+  constexpr nat1 SHORT = 1, LONG = 2, OVER3 = 4, LARGE = 8, SURR = 16, OVER2 = 32, LARGE1000 = 64, OVER4 = 64, TWO = 128;
+  constexpr nat1 CARRY = SHORT | LONG | TWO;
+  static constexpr nat1 b1h[16] = {LONG, LONG, LONG, LONG, LONG, LONG, LONG, LONG, TWO, TWO, TWO, TWO,
+    SHORT | OVER2, SHORT, SHORT | OVER3 | SURR, SHORT | LARGE | LARGE1000 | OVER4};
+  static constexpr nat1 b1l[16] = {CARRY | OVER3 | OVER2 | OVER4, CARRY | OVER2, CARRY, CARRY,
+    CARRY | LARGE, CARRY | LARGE | LARGE1000, CARRY | LARGE | LARGE1000, CARRY | LARGE | LARGE1000,
+    CARRY | LARGE | LARGE1000, CARRY | LARGE | LARGE1000, CARRY | LARGE | LARGE1000, CARRY | LARGE | LARGE1000,
+    CARRY | LARGE | LARGE1000, CARRY | LARGE | LARGE1000 | SURR, CARRY | LARGE | LARGE1000, CARRY | LARGE | LARGE1000};
+  static constexpr nat1 b2h[16] = {SHORT, SHORT, SHORT, SHORT, SHORT, SHORT, SHORT, SHORT,
+    LONG | OVER2 | TWO | OVER3 | LARGE1000 | OVER4, LONG | OVER2 | TWO | OVER3 | LARGE,
+    LONG | OVER2 | TWO | SURR | LARGE, LONG | OVER2 | TWO | SURR | LARGE, SHORT, SHORT, SHORT, SHORT};
+  const auto lo4 = _mm_set1_epi8(0x0f);
+  const auto prev1 = _mm_alignr_epi8(Input, Prev, 15);
+  const auto sc = _mm_and_si128(_mm_and_si128(
+    _lookup16(_mm_and_si128(_mm_srli_epi16(prev1, 4), lo4), b1h), _lookup16(_mm_and_si128(prev1, lo4), b1l)),
+    _lookup16(_mm_and_si128(_mm_srli_epi16(Input, 4), lo4), b2h));
+  const auto third = _mm_subs_epu8(_mm_alignr_epi8(Input, Prev, 14), _mm_set1_epi8(char(0xe0 - 0x80)));
+  const auto fourth = _mm_subs_epu8(_mm_alignr_epi8(Input, Prev, 13), _mm_set1_epi8(char(0xf0 - 0x80)));
+  return _mm_xor_si128(_mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(char(0x80))), sc);
+}
+
+/// skips a prefix of valid characters 16, 8 or 4 units at a time
+/// \return the end of the skipped prefix, which is on a character boundary
+template<typename In> inline const In* _utf_skip_valid(const In* i, const In* const last) noexcept {
+  if constexpr (sizeof(In) == 1) {
+    const auto limit = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, char(0xf0 - 1), char(0xe0 - 1), char(0xc0 - 1));
+    const In* ok = i;
+    for (__m128i prev = _mm_setzero_si128(), incomplete = prev; last - i >= 16;) {
+      const auto v = _loadu128(i);
+      if (_mm_movemask_epi8(v) == 0) {
+        if (!_mm_testz_si128(incomplete, incomplete)) break;
+      } else if (const auto e = _utf8_block_error(v, prev); !_mm_testz_si128(e, e)) break;
+      prev = v, incomplete = _mm_subs_epu8(v, limit), i += 16, ok = i;
+      if (!_mm_testz_si128(incomplete, incomplete)) for (nat k = 1; k <= 3; ++k) if (nat1(i[-nat8(k)]) >= 0xc0) { ok = i - k; break; }
+    }
+    return ok;
+  } else if constexpr (sizeof(In) == 2) {
+    for (; last - i >= 8; i += 8) {
+      const auto v = _loadu128(i);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(-0x800)), _mm_set1_epi16(-0x2800))) != 0) break;
+    }
+    return i;
+  } else {
+    for (; last - i >= 4; i += 4) {
+      const auto v = _loadu128(i);
+      const auto bad = _mm_or_si128(_mm_cmpgt_epi32(_mm_min_epu32(v, _mm_set1_epi32(0x110000)), _mm_set1_epi32(0x10ffff)),
+        _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(-0x800)), _mm_set1_epi32(0xd800)));
+      if (!_mm_testz_si128(bad, bad)) break;
     }
+    return i;
   }
 }
 
+template<typename In> constexpr nat _utf_validate(const In* const first, const In* const last) noexcept {
+  for (auto i = first; i < last;) {
+    if (!IS_CEV) if (i = _utf_skip_valid(i, last); i == last) break;
+    nat4 c;
+    const nat n = _utf_decode_strict(i, last, c);
+    if (c == _utf_invalid) return nat(i - first);
+    i += n;
+  }
+  return nat(last - first);
+}
+
+}
+
+/// validates a UTF-8, UTF-16 or UTF-32 string
+/// \param s string to validate
+/// \return offset of the first invalid sequence in units; `s.size()` if valid
+/// \note Overlong forms, surrogates, code points beyond U+10FFFF and truncated sequences are invalid.
+/// \note UTF-8 is checked 16 bytes at a time with the lookup algorithm of Keiser and Lemire.
+constexpr nat validate_utf(stringable auto&& s) noexcept {
+  using In = remove_cvref<iter_value<decltype(s)>>;
+  StringView<In> v(s);
+  return _::_utf_validate(v.data(), v.data() + v.size());
+}
+
+/// converts the unicode encoding of a string with validation
+/// \param s string to convert
+/// \param Policy how to handle invalid sequences
+/// \return converted text and the offset of the first invalid sequence
+/// \note Valid runs are validated with `yw::validate_utf` and converted with `yw::cvt`.
+template<character Out> requires same_as<Out, remove_cvref<Out>>
+constexpr Transcoded<Out> transcode(stringable auto&& s, const Invalid Policy = Invalid::REPLACE) noexcept {
+  using In = remove_cvref<iter_value<decltype(s)>>;
+  const StringView<In> v(s);
+  Transcoded<Out> r{{}, v.size()};
+  for (auto i = v.data(), last = i + v.size(); i < last;) {
+    const nat n = _::_utf_validate(i, last);
+    r.text += cvt<Out>(StringView<In>(i, n));
+    if (i += n; i == last) break;
+    if (r.error == v.size()) r.error = nat(i - v.data());
+    if (Policy == Invalid::FAIL) break;
+    nat4 c;
+    i += _::_utf_decode_strict(i, last, c);
+    if (Policy == Invalid::SKIP) continue;
+    if constexpr (sizeof(Out) == 1) r.text += Out(0xef), r.text += Out(0xbf), r.text += Out(0xbd);
+    else r.text += Out(0xfffd);
+  }
+  return r;
+}
+
+/// view of the code points of a UTF-8, UTF-16 or UTF-32 string, decoded lazily
+/// \note Invalid sequences are U+FFFD as with `Invalid::REPLACE`; the string must outlive the view.
+template<character Ct> class CodePointView : public std::ranges::view_interface<CodePointView<Ct>> {
+protected:
+  StringView<Ct> _str{};
+
+public:
+
+  /// forward iterator over the code points
+  class iterator {
+    const Ct* _i{};
+    const Ct* _last{};
+    nat _n{};
+    nat4 _c{};
+    constexpr void _read() noexcept {
+      if (_i == _last) return;
+      if (_n = _::_utf_decode_strict(_i, _last, _c); _c == _::_utf_invalid) _c = 0xfffd;
+    }
+  public:
+    using value_type = uct4;
+    using difference_type = int8;
+    constexpr iterator() noexcept = default;
+    constexpr iterator(const Ct* First, const Ct* Last) noexcept : _i(First), _last(Last) { _read(); }
+    constexpr uct4 operator*() const noexcept { return uct4(_c); }
+    constexpr iterator& operator++() noexcept { return _i += _n, _read(), *this; }
+    constexpr iterator operator++(int) noexcept { auto t = *this; return ++*this, t; }
+    constexpr bool operator==(const iterator& i) const noexcept { return _i == i._i; }
+    constexpr bool operator==(std::default_sentinel_t) const noexcept { return _i == _last; }
+
+    /// returns the position of the current code point in the string
+    constexpr const Ct* base() const noexcept { return _i; }
+  };
+
+  constexpr CodePointView() noexcept = default;
+  constexpr explicit CodePointView(const StringView<Ct> s) noexcept : _str(s) {}
+  constexpr iterator begin() const noexcept { return {_str.data(), _str.data() + _str.size()}; }
+  constexpr std::default_sentinel_t end() const noexcept { return {}; }
+};
+
+/// view of the code units of a string converted to another unicode encoding lazily
+/// \note The string must outlive the view.
+template<character Out, character In> class CvtView : public std::ranges::view_interface<CvtView<Out, In>> {
+protected:
+  StringView<In> _str{};
+
+public:
+
+  /// forward iterator over the code units
+  class iterator {
+    typename CodePointView<In>::iterator _it{};
+    Out _u[4]{};
+    nat1 _k{};
+    nat1 _n{};
+    constexpr void _load() noexcept { _k = 0, _n = _it == std::default_sentinel ? 0 : nat1(_::_utf_put(_u, nat4(*_it)) - _u); }
+  public:
+    using value_type = Out;
+    using difference_type = int8;
+    constexpr iterator() noexcept = default;
+    constexpr explicit iterator(const typename CodePointView<In>::iterator& It) noexcept : _it(It) { _load(); }
+    constexpr Out operator*() const noexcept { return _u[_k]; }
+    constexpr iterator& operator++() noexcept {
+      if (++_k == _n) ++_it, _load();
+      return *this;
+    }
+    constexpr iterator operator++(int) noexcept { auto t = *this; return ++*this, t; }
+    constexpr bool operator==(const iterator& i) const noexcept { return _it == i._it && _k == i._k; }
+    constexpr bool operator==(std::default_sentinel_t) const noexcept { return _it == std::default_sentinel; }
+  };
+
+  constexpr CvtView() noexcept = default;
+  constexpr explicit CvtView(const StringView<In> s) noexcept : _str(s) {}
+  constexpr iterator begin() const noexcept { return iterator(CodePointView<In>(_str).begin()); }
+  constexpr std::default_sentinel_t end() const noexcept { return {}; }
+};
+
+/// returns a view of the code points of a string
+/// \note `s` must outlive the view.
+template<stringable St> constexpr auto code_points(St&& s) noexcept {
+  using In = remove_cvref<iter_value<St>>;
+  return CodePointView<In>(StringView<In>(s));
+}
+
+/// returns a view of the code units of a string converted to `Out` without allocation
+/// \note `s` must outlive the view.
+template<character Out, stringable St> constexpr auto cvt_view(St&& s) noexcept {
+  using In = remove_cvref<iter_value<St>>;
+  return CvtView<Out, In>(StringView<In>(s));
+}
+
+/// converts a leading part of a string into a buffer without allocation
+/// \param s (inout) string to convert; the converted part is removed
+/// \param Buffer (out) buffer to write the converted code units to
+/// \return number of code units written; `0` only if `s` is empty or `Buffer` has fewer than 4 units
+/// \note Only whole characters are converted, as with `yw::cvt`.
+template<character Out, character In> constexpr nat cvt_into(StringView<In>& s, const std::span<Out> Buffer) noexcept {
+  constexpr nat k = sizeof(Out) >= sizeof(In) ? 1 : sizeof(Out) == 1 ? sizeof(In) == 2 ? 3 : 4 : 2;
+  nat m = std::min<nat>(s.size(), Buffer.size() / k);
+  if constexpr (sizeof(In) == 1) for (nat t{}; t < 3 && 0 < m && m < s.size() && (nat1(s[m]) & 0xc0) == 0x80; ++t) --m;
+  else if constexpr (sizeof(In) == 2)
+    if (0 < m && m < s.size() && (nat2(s[m - 1]) & 0xfc00) == 0xd800 && (nat2(s[m]) & 0xfc00) == 0xdc00)
+      m = m == 1 && Buffer.size() >= 4 ? 2 : m - 1; // a surrogate pair takes 4 units even in UTF-8
+  if (m == 0) return 0;
+  const auto i = s.data(), last = i + m;
+  Out* p = Buffer.data();
+  if constexpr (sizeof(In) == sizeof(Out)) for (nat j{}; j < m; ++j) *p++ = bitcast<Out>(i[j]);
+  else if constexpr (sizeof(In) == 1) p = _::_utf8_decode(i, last, p);
+  else if constexpr (sizeof(Out) == 1) p = _::_utf8_encode(i, last, p);
+  else if constexpr (sizeof(In) == 2) p = _::_utf16_to_utf32(i, last, p);
+  else p = _::_utf32_to_utf16(i, last, p);
+  s.remove_prefix(m);
+  return nat(p - Buffer.data());
+}
+
+/// converts a string to `Out` and writes the code units to an output iterator
+/// \param s string to convert
+/// \param Iter output iterator of `Out`
+/// \return the iterator after the last written unit
+/// \note The string is converted through a fixed buffer on the stack, with the fast paths of `yw::cvt`.
+template<character Out, stringable St, std::output_iterator<Out> It> constexpr It cvt_to(St&& s, It Iter) {
+  using In = remove_cvref<iter_value<St>>;
+  StringView<In> v(s);
+  Out buf[256];
+  while (!v.empty()) Iter = std::ranges::copy(buf, buf + cvt_into(v, std::span<Out>(buf)), mv(Iter)).out;
+  return Iter;
+}
+
+/// enum to represent the character encoding of a text
+enum class Charset {
+  ASCII,   // only 7-bit bytes
+  UTF8,    // UTF-8, with or without BOM
+  UTF16LE, // UTF-16 little endian, with or without BOM
+  UTF16BE, // UTF-16 big endian, with or without BOM
+  SJIS,    // Shift-JIS (CP932)
+  EUCJP,   // EUC-JP
+  JIS,     // ISO-2022-JP
+};
+
+namespace _ {
+
+/// scores bytes as a double-byte Japanese encoding; valid characters add and invalid bytes subtract
+/// \note Half-width katakana in Shift-JIS scores less than a double-byte character because
+///       the bytes of EUC-JP are also valid as it.
+template<bool Euc> constexpr int8 _jp_score(const nat1* i, const nat1* const last) noexcept {
+  int8 score{};
+  while (i < last) {
+    const nat1 c = *i++;
+    if (c < 0x80) continue;
+    if constexpr (Euc) {
+      if (c == 0x8e) score += i < last && 0xa1 <= *i && *i < 0xe0 ? (++i, 2) : -8;
+      else if (0xa1 <= c && c < 0xff) score += i < last && 0xa1 <= *i && *i < 0xff ? (++i, 4) : -8;
+      else if (c != 0x8f) score -= 8;
+    } else {
+      if (0xa1 <= c && c < 0xe0) score += 1;
+      else if (_sjis_lead(c)) score += i < last && 0x40 <= *i && *i != 0x7f && *i < 0xfd ? (++i, 4) : -8;
+      else score -= 8;
+    }
+  }
+  return score;
+}
+
+}
+
+/// detects the character encoding of a text
+/// \param s bytes of the text
+/// \param Limit number of leading bytes to examine
+/// \return the most likely encoding; `Charset::ASCII` if nothing but 7-bit bytes is found
+/// \note BOMs decide first. Zero bytes (at least 4 and 1/32 of the bytes) mostly at even or odd
+///       offsets mean UTF-16, escape sequences ISO-2022-JP, and valid UTF-8 wins over Shift-JIS and
+///       EUC-JP, which are scored by their lead and trail bytes. Text of only half-width katakana is
+///       ambiguous and may be detected as EUC-JP.
+inline Charset detect_charset(const StringView<cat1> s, const nat Limit = 65536) noexcept {
+  const auto first = reinterpret_cast<const nat1*>(s.data()), last = first + std::min<nat>(s.size(), Limit);
+  const nat n = nat(last - first);
+  if (n >= 3 && first[0] == 0xef && first[1] == 0xbb && first[2] == 0xbf) return Charset::UTF8;
+  if (n >= 2 && first[0] == 0xff && first[1] == 0xfe) return Charset::UTF16LE;
+  if (n >= 2 && first[0] == 0xfe && first[1] == 0xff) return Charset::UTF16BE;
+  nat high{}, even{}, odd{}, esc{};
+  auto i = first;
+  auto sum = [](const __m128i v) { const auto t = _mm_sad_epu8(v, _mm_setzero_si128()); return nat(_mm_cvtsi128_si64(t) + _mm_extract_epi64(t, 1)); };
+  while (last - i >= 16) { // byte counters are summed every 255 blocks before they overflow
+    auto h = _mm_setzero_si128(), e = h, o = h, x = h;
+    for (nat k{}; k < 255 && last - i >= 16; ++k, i += 16) {
+      const auto v = _::_loadu128(i), z = _mm_cmpeq_epi8(v, _mm_setzero_si128()), m = _mm_set1_epi16(0x00ff);
+      h = _mm_sub_epi8(h, _mm_cmplt_epi8(v, _mm_setzero_si128()));
+      e = _mm_sub_epi8(e, _mm_and_si128(z, m)), o = _mm_sub_epi8(o, _mm_andnot_si128(m, z));
+      x = _mm_sub_epi8(x, _mm_cmpeq_epi8(v, _mm_set1_epi8(0x1b)));
+    }
+    high += sum(h), even += sum(e), odd += sum(o), esc += sum(x);
+  }
+  for (; i < last; ++i) high += *i >> 7, esc += *i == 0x1b, (((i - first) & 1) ? odd : even) += *i == 0;
+  if (even + odd >= std::max<nat>(n / 32, 4) && std::max(even, odd) > std::min(even, odd) * 4) return even > odd ? Charset::UTF16BE : Charset::UTF16LE;
+  if (high == 0) {
+    if (esc != 0) for (auto j = first; j + 2 < last; ++j)
+      if (*j == 0x1b && ((j[1] == '$' && (j[2] == 'B' || j[2] == '@')) || (j[1] == '(' && j[2] == 'I'))) return Charset::JIS;
+    return Charset::ASCII;
+  }
+  nat4 c;
+  const nat e = _::_utf_validate(first, last);
+  if (e == n || (n < s.size() && _::_utf_decode_strict(first + e, last, c) == n - e)) return Charset::UTF8; // cut by `Limit`
+  return _::_jp_score<true>(first, last) > _::_jp_score<false>(first, last) ? Charset::EUCJP : Charset::SJIS;
+}
+
+/// converts a text in the given encoding to unicode string
+/// \tparam Ct character type of the result; UTF-8, UTF-16 or UTF-32
+/// \param s bytes of the text
+/// \param Encoding encoding of `s`, e.g. by `yw::detect_charset`; a BOM is removed
+/// \return unicode string
+/// \note An odd trailing byte of UTF-16 is converted to `0xfffe`, as truncated input of the other decoders.
+template<character Ct = cat2> String<Ct> from_charset(StringView<cat1> s, const Charset Encoding) noexcept {
+  switch (Encoding) {
+    case Charset::SJIS: return from_sjis<Ct>(s);
+    case Charset::EUCJP: return from_eucjp<Ct>(s);
+    case Charset::JIS: return from_jis<Ct>(s);
+    case Charset::UTF16LE: case Charset::UTF16BE: {
+      String<uct2> u((s.size() + 1) / 2, {});
+      for (nat k{}; k < s.size() / 2; ++k) {
+        const nat1 a = nat1(s[k * 2]), b = nat1(s[k * 2 + 1]);
+        u[k] = uct2(Encoding == Charset::UTF16LE ? a | b << 8 : a << 8 | b);
+      }
+      if (s.size() & 1) u.back() = 0xfffe; // truncated unit
+      return cvt<Ct>(StringView<uct2>(u).substr(!u.empty() && u[0] == 0xfeff));
+    }
+    default:
+      if (s.starts_with("\xef\xbb\xbf")) s.remove_prefix(3);
+      return cvt<Ct>(s);
+  }
+}
 
 /// checks if the character is a digit
 inline constexpr auto is_digit = []<character Ct>(const Ct c)
@@ -2625,77 +2591,1039 @@ inline constexpr auto is_digit = []<character Ct>(const Ct c)
 
 namespace _ {
 
-template<typename Ct> constexpr nat8 _ston(StringView<Ct>& s) noexcept {
-  nat8 v{};
-  while (1) {
-    if (s.empty()) return v;
-    else if (is_digit(s.front())) { v = s.front() - '0'; break; }
-    else s.remove_prefix(1);
+/// mantissas of 10^e normalized to [2^127..2^128) and rounded down; generated by `scr/pow10_table.py`
+inline constexpr int4 _POW10_MIN = -342;
+inline constexpr nat8 _pow10_table[667][2]{
+  {0xeef453d6923bd65a, 0x113faa2906a13b3f}, // 1e-342
+  {0x9558b4661b6565f8, 0x4ac7ca59a424c507}, // 1e-341
+  {0xbaaee17fa23ebf76, 0x5d79bcf00d2df649}, // 1e-340
+  {0xe95a99df8ace6f53, 0xf4d82c2c107973dc}, // 1e-339
+  {0x91d8a02bb6c10594, 0x79071b9b8a4be869}, // 1e-338
+  {0xb64ec836a47146f9, 0x9748e2826cdee284}, // 1e-337
+  {0xe3e27a444d8d98b7, 0xfd1b1b2308169b25}, // 1e-336
+  {0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7}, // 1e-335
+  {0xb208ef855c969f4f, 0xbdbd2d335e51a935}, // 1e-334
+  {0xde8b2b66b3bc4723, 0xad2c788035e61382}, // 1e-333
+  {0x8b16fb203055ac76, 0x4c3bcb5021afcc31}, // 1e-332
+  {0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d}, // 1e-331
+  {0xd953e8624b85dd78, 0xd71d6dad34a2af0d}, // 1e-330
+  {0x87d4713d6f33aa6b, 0x8672648c40e5ad68}, // 1e-329
+  {0xa9c98d8ccb009506, 0x680efdaf511f18c2}, // 1e-328
+  {0xd43bf0effdc0ba48, 0x0212bd1b2566def2}, // 1e-327
+  {0x84a57695fe98746d, 0x014bb630f7604b57}, // 1e-326
+  {0xa5ced43b7e3e9188, 0x419ea3bd35385e2d}, // 1e-325
+  {0xcf42894a5dce35ea, 0x52064cac828675b9}, // 1e-324
+  {0x818995ce7aa0e1b2, 0x7343efebd1940993}, // 1e-323
+  {0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8}, // 1e-322
+  {0xca66fa129f9b60a6, 0xd41a26e077774ef6}, // 1e-321
+  {0xfd00b897478238d0, 0x8920b098955522b4}, // 1e-320
+  {0x9e20735e8cb16382, 0x55b46e5f5d5535b0}, // 1e-319
+  {0xc5a890362fddbc62, 0xeb2189f734aa831d}, // 1e-318
+  {0xf712b443bbd52b7b, 0xa5e9ec7501d523e4}, // 1e-317
+  {0x9a6bb0aa55653b2d, 0x47b233c92125366e}, // 1e-316
+  {0xc1069cd4eabe89f8, 0x999ec0bb696e840a}, // 1e-315
+  {0xf148440a256e2c76, 0xc00670ea43ca250d}, // 1e-314
+  {0x96cd2a865764dbca, 0x380406926a5e5728}, // 1e-313
+  {0xbc807527ed3e12bc, 0xc605083704f5ecf2}, // 1e-312
+  {0xeba09271e88d976b, 0xf7864a44c633682e}, // 1e-311
+  {0x93445b8731587ea3, 0x7ab3ee6afbe0211d}, // 1e-310
+  {0xb8157268fdae9e4c, 0x5960ea05bad82964}, // 1e-309
+  {0xe61acf033d1a45df, 0x6fb92487298e33bd}, // 1e-308
+  {0x8fd0c16206306bab, 0xa5d3b6d479f8e056}, // 1e-307
+  {0xb3c4f1ba87bc8696, 0x8f48a4899877186c}, // 1e-306
+  {0xe0b62e2929aba83c, 0x331acdabfe94de87}, // 1e-305
+  {0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14}, // 1e-304
+  {0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9}, // 1e-303
+  {0xdb71e91432b1a24a, 0xc9e82cd9f69d6150}, // 1e-302
+  {0x892731ac9faf056e, 0xbe311c083a225cd2}, // 1e-301
+  {0xab70fe17c79ac6ca, 0x6dbd630a48aaf406}, // 1e-300
+  {0xd64d3d9db981787d, 0x092cbbccdad5b108}, // 1e-299
+  {0x85f0468293f0eb4e, 0x25bbf56008c58ea5}, // 1e-298
+  {0xa76c582338ed2621, 0xaf2af2b80af6f24e}, // 1e-297
+  {0xd1476e2c07286faa, 0x1af5af660db4aee1}, // 1e-296
+  {0x82cca4db847945ca, 0x50d98d9fc890ed4d}, // 1e-295
+  {0xa37fce126597973c, 0xe50ff107bab528a0}, // 1e-294
+  {0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8}, // 1e-293
+  {0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a}, // 1e-292
+  {0x9faacf3df73609b1, 0x77b191618c54e9ac}, // 1e-291
+  {0xc795830d75038c1d, 0xd59df5b9ef6a2417}, // 1e-290
+  {0xf97ae3d0d2446f25, 0x4b0573286b44ad1d}, // 1e-289
+  {0x9becce62836ac577, 0x4ee367f9430aec32}, // 1e-288
+  {0xc2e801fb244576d5, 0x229c41f793cda73f}, // 1e-287
+  {0xf3a20279ed56d48a, 0x6b43527578c1110f}, // 1e-286
+  {0x9845418c345644d6, 0x830a13896b78aaa9}, // 1e-285
+  {0xbe5691ef416bd60c, 0x23cc986bc656d553}, // 1e-284
+  {0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8}, // 1e-283
+  {0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9}, // 1e-282
+  {0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53}, // 1e-281
+  {0xe858ad248f5c22c9, 0xd1b3400f8f9cff68}, // 1e-280
+  {0x91376c36d99995be, 0x23100809b9c21fa1}, // 1e-279
+  {0xb58547448ffffb2d, 0xabd40a0c2832a78a}, // 1e-278
+  {0xe2e69915b3fff9f9, 0x16c90c8f323f516c}, // 1e-277
+  {0x8dd01fad907ffc3b, 0xae3da7d97f6792e3}, // 1e-276
+  {0xb1442798f49ffb4a, 0x99cd11cfdf41779c}, // 1e-275
+  {0xdd95317f31c7fa1d, 0x40405643d711d583}, // 1e-274
+  {0x8a7d3eef7f1cfc52, 0x482835ea666b2572}, // 1e-273
+  {0xad1c8eab5ee43b66, 0xda3243650005eecf}, // 1e-272
+  {0xd863b256369d4a40, 0x90bed43e40076a82}, // 1e-271
+  {0x873e4f75e2224e68, 0x5a7744a6e804a291}, // 1e-270
+  {0xa90de3535aaae202, 0x711515d0a205cb36}, // 1e-269
+  {0xd3515c2831559a83, 0x0d5a5b44ca873e03}, // 1e-268
+  {0x8412d9991ed58091, 0xe858790afe9486c2}, // 1e-267
+  {0xa5178fff668ae0b6, 0x626e974dbe39a872}, // 1e-266
+  {0xce5d73ff402d98e3, 0xfb0a3d212dc8128f}, // 1e-265
+  {0x80fa687f881c7f8e, 0x7ce66634bc9d0b99}, // 1e-264
+  {0xa139029f6a239f72, 0x1c1fffc1ebc44e80}, // 1e-263
+  {0xc987434744ac874e, 0xa327ffb266b56220}, // 1e-262
+  {0xfbe9141915d7a922, 0x4bf1ff9f0062baa8}, // 1e-261
+  {0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9}, // 1e-260
+  {0xc4ce17b399107c22, 0xcb550fb4384d21d3}, // 1e-259
+  {0xf6019da07f549b2b, 0x7e2a53a146606a48}, // 1e-258
+  {0x99c102844f94e0fb, 0x2eda7444cbfc426d}, // 1e-257
+  {0xc0314325637a1939, 0xfa911155fefb5308}, // 1e-256
+  {0xf03d93eebc589f88, 0x793555ab7eba27ca}, // 1e-255
+  {0x96267c7535b763b5, 0x4bc1558b2f3458de}, // 1e-254
+  {0xbbb01b9283253ca2, 0x9eb1aaedfb016f16}, // 1e-253
+  {0xea9c227723ee8bcb, 0x465e15a979c1cadc}, // 1e-252
+  {0x92a1958a7675175f, 0x0bfacd89ec191ec9}, // 1e-251
+  {0xb749faed14125d36, 0xcef980ec671f667b}, // 1e-250
+  {0xe51c79a85916f484, 0x82b7e12780e7401a}, // 1e-249
+  {0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810}, // 1e-248
+  {0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15}, // 1e-247
+  {0xdfbdcece67006ac9, 0x67a791e093e1d49a}, // 1e-246
+  {0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0}, // 1e-245
+  {0xaecc49914078536d, 0x58fae9f773886e18}, // 1e-244
+  {0xda7f5bf590966848, 0xaf39a475506a899e}, // 1e-243
+  {0x888f99797a5e012d, 0x6d8406c952429603}, // 1e-242
+  {0xaab37fd7d8f58178, 0xc8e5087ba6d33b83}, // 1e-241
+  {0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64}, // 1e-240
+  {0x855c3be0a17fcd26, 0x5cf2eea09a55067f}, // 1e-239
+  {0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e}, // 1e-238
+  {0xd0601d8efc57b08b, 0xf13b94daf124da26}, // 1e-237
+  {0x823c12795db6ce57, 0x76c53d08d6b70858}, // 1e-236
+  {0xa2cb1717b52481ed, 0x54768c4b0c64ca6e}, // 1e-235
+  {0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09}, // 1e-234
+  {0xfe5d54150b090b02, 0xd3f93b35435d7c4c}, // 1e-233
+  {0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf}, // 1e-232
+  {0xc6b8e9b0709f109a, 0x359ab6419ca1091b}, // 1e-231
+  {0xf867241c8cc6d4c0, 0xc30163d203c94b62}, // 1e-230
+  {0x9b407691d7fc44f8, 0x79e0de63425dcf1d}, // 1e-229
+  {0xc21094364dfb5636, 0x985915fc12f542e4}, // 1e-228
+  {0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d}, // 1e-227
+  {0x979cf3ca6cec5b5a, 0xa705992ceecf9c42}, // 1e-226
+  {0xbd8430bd08277231, 0x50c6ff782a838353}, // 1e-225
+  {0xece53cec4a314ebd, 0xa4f8bf5635246428}, // 1e-224
+  {0x940f4613ae5ed136, 0x871b7795e136be99}, // 1e-223
+  {0xb913179899f68584, 0x28e2557b59846e3f}, // 1e-222
+  {0xe757dd7ec07426e5, 0x331aeada2fe589cf}, // 1e-221
+  {0x9096ea6f3848984f, 0x3ff0d2c85def7621}, // 1e-220
+  {0xb4bca50b065abe63, 0x0fed077a756b53a9}, // 1e-219
+  {0xe1ebce4dc7f16dfb, 0xd3e8495912c62894}, // 1e-218
+  {0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c}, // 1e-217
+  {0xb080392cc4349dec, 0xbd8d794d96aacfb3}, // 1e-216
+  {0xdca04777f541c567, 0xecf0d7a0fc5583a0}, // 1e-215
+  {0x89e42caaf9491b60, 0xf41686c49db57244}, // 1e-214
+  {0xac5d37d5b79b6239, 0x311c2875c522ced5}, // 1e-213
+  {0xd77485cb25823ac7, 0x7d633293366b828b}, // 1e-212
+  {0x86a8d39ef77164bc, 0xae5dff9c02033197}, // 1e-211
+  {0xa8530886b54dbdeb, 0xd9f57f830283fdfc}, // 1e-210
+  {0xd267caa862a12d66, 0xd072df63c324fd7b}, // 1e-209
+  {0x8380dea93da4bc60, 0x4247cb9e59f71e6d}, // 1e-208
+  {0xa46116538d0deb78, 0x52d9be85f074e608}, // 1e-207
+  {0xcd795be870516656, 0x67902e276c921f8b}, // 1e-206
+  {0x806bd9714632dff6, 0x00ba1cd8a3db53b6}, // 1e-205
+  {0xa086cfcd97bf97f3, 0x80e8a40eccd228a4}, // 1e-204
+  {0xc8a883c0fdaf7df0, 0x6122cd128006b2cd}, // 1e-203
+  {0xfad2a4b13d1b5d6c, 0x796b805720085f81}, // 1e-202
+  {0x9cc3a6eec6311a63, 0xcbe3303674053bb0}, // 1e-201
+  {0xc3f490aa77bd60fc, 0xbedbfc4411068a9c}, // 1e-200
+  {0xf4f1b4d515acb93b, 0xee92fb5515482d44}, // 1e-199
+  {0x991711052d8bf3c5, 0x751bdd152d4d1c4a}, // 1e-198
+  {0xbf5cd54678eef0b6, 0xd262d45a78a0635d}, // 1e-197
+  {0xef340a98172aace4, 0x86fb897116c87c34}, // 1e-196
+  {0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0}, // 1e-195
+  {0xbae0a846d2195712, 0x8974836059cca109}, // 1e-194
+  {0xe998d258869facd7, 0x2bd1a438703fc94b}, // 1e-193
+  {0x91ff83775423cc06, 0x7b6306a34627ddcf}, // 1e-192
+  {0xb67f6455292cbf08, 0x1a3bc84c17b1d542}, // 1e-191
+  {0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93}, // 1e-190
+  {0x8e938662882af53e, 0x547eb47b7282ee9c}, // 1e-189
+  {0xb23867fb2a35b28d, 0xe99e619a4f23aa43}, // 1e-188
+  {0xdec681f9f4c31f31, 0x6405fa00e2ec94d4}, // 1e-187
+  {0x8b3c113c38f9f37e, 0xde83bc408dd3dd04}, // 1e-186
+  {0xae0b158b4738705e, 0x9624ab50b148d445}, // 1e-185
+  {0xd98ddaee19068c76, 0x3badd624dd9b0957}, // 1e-184
+  {0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6}, // 1e-183
+  {0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c}, // 1e-182
+  {0xd47487cc8470652b, 0x7647c3200069671f}, // 1e-181
+  {0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073}, // 1e-180
+  {0xa5fb0a17c777cf09, 0xf468107100525890}, // 1e-179
+  {0xcf79cc9db955c2cc, 0x7182148d4066eeb4}, // 1e-178
+  {0x81ac1fe293d599bf, 0xc6f14cd848405530}, // 1e-177
+  {0xa21727db38cb002f, 0xb8ada00e5a506a7c}, // 1e-176
+  {0xca9cf1d206fdc03b, 0xa6d90811f0e4851c}, // 1e-175
+  {0xfd442e4688bd304a, 0x908f4a166d1da663}, // 1e-174
+  {0x9e4a9cec15763e2e, 0x9a598e4e043287fe}, // 1e-173
+  {0xc5dd44271ad3cdba, 0x40eff1e1853f29fd}, // 1e-172
+  {0xf7549530e188c128, 0xd12bee59e68ef47c}, // 1e-171
+  {0x9a94dd3e8cf578b9, 0x82bb74f8301958ce}, // 1e-170
+  {0xc13a148e3032d6e7, 0xe36a52363c1faf01}, // 1e-169
+  {0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1}, // 1e-168
+  {0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9}, // 1e-167
+  {0xbcb2b812db11a5de, 0x7415d448f6b6f0e7}, // 1e-166
+  {0xebdf661791d60f56, 0x111b495b3464ad21}, // 1e-165
+  {0x936b9fcebb25c995, 0xcab10dd900beec34}, // 1e-164
+  {0xb84687c269ef3bfb, 0x3d5d514f40eea742}, // 1e-163
+  {0xe65829b3046b0afa, 0x0cb4a5a3112a5112}, // 1e-162
+  {0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab}, // 1e-161
+  {0xb3f4e093db73a093, 0x59ed216765690f56}, // 1e-160
+  {0xe0f218b8d25088b8, 0x306869c13ec3532c}, // 1e-159
+  {0x8c974f7383725573, 0x1e414218c73a13fb}, // 1e-158
+  {0xafbd2350644eeacf, 0xe5d1929ef90898fa}, // 1e-157
+  {0xdbac6c247d62a583, 0xdf45f746b74abf39}, // 1e-156
+  {0x894bc396ce5da772, 0x6b8bba8c328eb783}, // 1e-155
+  {0xab9eb47c81f5114f, 0x066ea92f3f326564}, // 1e-154
+  {0xd686619ba27255a2, 0xc80a537b0efefebd}, // 1e-153
+  {0x8613fd0145877585, 0xbd06742ce95f5f36}, // 1e-152
+  {0xa798fc4196e952e7, 0x2c48113823b73704}, // 1e-151
+  {0xd17f3b51fca3a7a0, 0xf75a15862ca504c5}, // 1e-150
+  {0x82ef85133de648c4, 0x9a984d73dbe722fb}, // 1e-149
+  {0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba}, // 1e-148
+  {0xcc963fee10b7d1b3, 0x318df905079926a8}, // 1e-147
+  {0xffbbcfe994e5c61f, 0xfdf17746497f7052}, // 1e-146
+  {0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633}, // 1e-145
+  {0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0}, // 1e-144
+  {0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0}, // 1e-143
+  {0x9c1661a651213e2d, 0x06bea10ca65c084e}, // 1e-142
+  {0xc31bfa0fe5698db8, 0x486e494fcff30a62}, // 1e-141
+  {0xf3e2f893dec3f126, 0x5a89dba3c3efccfa}, // 1e-140
+  {0x986ddb5c6b3a76b7, 0xf89629465a75e01c}, // 1e-139
+  {0xbe89523386091465, 0xf6bbb397f1135823}, // 1e-138
+  {0xee2ba6c0678b597f, 0x746aa07ded582e2c}, // 1e-137
+  {0x94db483840b717ef, 0xa8c2a44eb4571cdc}, // 1e-136
+  {0xba121a4650e4ddeb, 0x92f34d62616ce413}, // 1e-135
+  {0xe896a0d7e51e1566, 0x77b020baf9c81d17}, // 1e-134
+  {0x915e2486ef32cd60, 0x0ace1474dc1d122e}, // 1e-133
+  {0xb5b5ada8aaff80b8, 0x0d819992132456ba}, // 1e-132
+  {0xe3231912d5bf60e6, 0x10e1fff697ed6c69}, // 1e-131
+  {0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1}, // 1e-130
+  {0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2}, // 1e-129
+  {0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde}, // 1e-128
+  {0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b}, // 1e-127
+  {0xad4ab7112eb3929d, 0x86c16c98d2c953c6}, // 1e-126
+  {0xd89d64d57a607744, 0xe871c7bf077ba8b7}, // 1e-125
+  {0x87625f056c7c4a8b, 0x11471cd764ad4972}, // 1e-124
+  {0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf}, // 1e-123
+  {0xd389b47879823479, 0x4aff1d108d4ec2c3}, // 1e-122
+  {0x843610cb4bf160cb, 0xcedf722a585139ba}, // 1e-121
+  {0xa54394fe1eedb8fe, 0xc2974eb4ee658828}, // 1e-120
+  {0xce947a3da6a9273e, 0x733d226229feea32}, // 1e-119
+  {0x811ccc668829b887, 0x0806357d5a3f525f}, // 1e-118
+  {0xa163ff802a3426a8, 0xca07c2dcb0cf26f7}, // 1e-117
+  {0xc9bcff6034c13052, 0xfc89b393dd02f0b5}, // 1e-116
+  {0xfc2c3f3841f17c67, 0xbbac2078d443ace2}, // 1e-115
+  {0x9d9ba7832936edc0, 0xd54b944b84aa4c0d}, // 1e-114
+  {0xc5029163f384a931, 0x0a9e795e65d4df11}, // 1e-113
+  {0xf64335bcf065d37d, 0x4d4617b5ff4a16d5}, // 1e-112
+  {0x99ea0196163fa42e, 0x504bced1bf8e4e45}, // 1e-111
+  {0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6}, // 1e-110
+  {0xf07da27a82c37088, 0x5d767327bb4e5a4c}, // 1e-109
+  {0x964e858c91ba2655, 0x3a6a07f8d510f86f}, // 1e-108
+  {0xbbe226efb628afea, 0x890489f70a55368b}, // 1e-107
+  {0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e}, // 1e-106
+  {0x92c8ae6b464fc96f, 0x3b0b8bc90012929d}, // 1e-105
+  {0xb77ada0617e3bbcb, 0x09ce6ebb40173744}, // 1e-104
+  {0xe55990879ddcaabd, 0xcc420a6a101d0515}, // 1e-103
+  {0x8f57fa54c2a9eab6, 0x9fa946824a12232d}, // 1e-102
+  {0xb32df8e9f3546564, 0x47939822dc96abf9}, // 1e-101
+  {0xdff9772470297ebd, 0x59787e2b93bc56f7}, // 1e-100
+  {0x8bfbea76c619ef36, 0x57eb4edb3c55b65a}, // 1e-99
+  {0xaefae51477a06b03, 0xede622920b6b23f1}, // 1e-98
+  {0xdab99e59958885c4, 0xe95fab368e45eced}, // 1e-97
+  {0x88b402f7fd75539b, 0x11dbcb0218ebb414}, // 1e-96
+  {0xaae103b5fcd2a881, 0xd652bdc29f26a119}, // 1e-95
+  {0xd59944a37c0752a2, 0x4be76d3346f0495f}, // 1e-94
+  {0x857fcae62d8493a5, 0x6f70a4400c562ddb}, // 1e-93
+  {0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952}, // 1e-92
+  {0xd097ad07a71f26b2, 0x7e2000a41346a7a7}, // 1e-91
+  {0x825ecc24c873782f, 0x8ed400668c0c28c8}, // 1e-90
+  {0xa2f67f2dfa90563b, 0x728900802f0f32fa}, // 1e-89
+  {0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9}, // 1e-88
+  {0xfea126b7d78186bc, 0xe2f610c84987bfa8}, // 1e-87
+  {0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9}, // 1e-86
+  {0xc6ede63fa05d3143, 0x91503d1c79720dbb}, // 1e-85
+  {0xf8a95fcf88747d94, 0x75a44c6397ce912a}, // 1e-84
+  {0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba}, // 1e-83
+  {0xc24452da229b021b, 0xfbe85badce996168}, // 1e-82
+  {0xf2d56790ab41c2a2, 0xfae27299423fb9c3}, // 1e-81
+  {0x97c560ba6b0919a5, 0xdccd879fc967d41a}, // 1e-80
+  {0xbdb6b8e905cb600f, 0x5400e987bbc1c920}, // 1e-79
+  {0xed246723473e3813, 0x290123e9aab23b68}, // 1e-78
+  {0x9436c0760c86e30b, 0xf9a0b6720aaf6521}, // 1e-77
+  {0xb94470938fa89bce, 0xf808e40e8d5b3e69}, // 1e-76
+  {0xe7958cb87392c2c2, 0xb60b1d1230b20e04}, // 1e-75
+  {0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2}, // 1e-74
+  {0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3}, // 1e-73
+  {0xe2280b6c20dd5232, 0x25c6da63c38de1b0}, // 1e-72
+  {0x8d590723948a535f, 0x579c487e5a38ad0e}, // 1e-71
+  {0xb0af48ec79ace837, 0x2d835a9df0c6d851}, // 1e-70
+  {0xdcdb1b2798182244, 0xf8e431456cf88e65}, // 1e-69
+  {0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff}, // 1e-68
+  {0xac8b2d36eed2dac5, 0xe272467e3d222f3f}, // 1e-67
+  {0xd7adf884aa879177, 0x5b0ed81dcc6abb0f}, // 1e-66
+  {0x86ccbb52ea94baea, 0x98e947129fc2b4e9}, // 1e-65
+  {0xa87fea27a539e9a5, 0x3f2398d747b36224}, // 1e-64
+  {0xd29fe4b18e88640e, 0x8eec7f0d19a03aad}, // 1e-63
+  {0x83a3eeeef9153e89, 0x1953cf68300424ac}, // 1e-62
+  {0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7}, // 1e-61
+  {0xcdb02555653131b6, 0x3792f412cb06794d}, // 1e-60
+  {0x808e17555f3ebf11, 0xe2bbd88bbee40bd0}, // 1e-59
+  {0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4}, // 1e-58
+  {0xc8de047564d20a8b, 0xf245825a5a445275}, // 1e-57
+  {0xfb158592be068d2e, 0xeed6e2f0f0d56712}, // 1e-56
+  {0x9ced737bb6c4183d, 0x55464dd69685606b}, // 1e-55
+  {0xc428d05aa4751e4c, 0xaa97e14c3c26b886}, // 1e-54
+  {0xf53304714d9265df, 0xd53dd99f4b3066a8}, // 1e-53
+  {0x993fe2c6d07b7fab, 0xe546a8038efe4029}, // 1e-52
+  {0xbf8fdb78849a5f96, 0xde98520472bdd033}, // 1e-51
+  {0xef73d256a5c0f77c, 0x963e66858f6d4440}, // 1e-50
+  {0x95a8637627989aad, 0xdde7001379a44aa8}, // 1e-49
+  {0xbb127c53b17ec159, 0x5560c018580d5d52}, // 1e-48
+  {0xe9d71b689dde71af, 0xaab8f01e6e10b4a6}, // 1e-47
+  {0x9226712162ab070d, 0xcab3961304ca70e8}, // 1e-46
+  {0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22}, // 1e-45
+  {0xe45c10c42a2b3b05, 0x8cb89a7db77c506a}, // 1e-44
+  {0x8eb98a7a9a5b04e3, 0x77f3608e92adb242}, // 1e-43
+  {0xb267ed1940f1c61c, 0x55f038b237591ed3}, // 1e-42
+  {0xdf01e85f912e37a3, 0x6b6c46dec52f6688}, // 1e-41
+  {0x8b61313bbabce2c6, 0x2323ac4b3b3da015}, // 1e-40
+  {0xae397d8aa96c1b77, 0xabec975e0a0d081a}, // 1e-39
+  {0xd9c7dced53c72255, 0x96e7bd358c904a21}, // 1e-38
+  {0x881cea14545c7575, 0x7e50d64177da2e54}, // 1e-37
+  {0xaa242499697392d2, 0xdde50bd1d5d0b9e9}, // 1e-36
+  {0xd4ad2dbfc3d07787, 0x955e4ec64b44e864}, // 1e-35
+  {0x84ec3c97da624ab4, 0xbd5af13bef0b113e}, // 1e-34
+  {0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e}, // 1e-33
+  {0xcfb11ead453994ba, 0x67de18eda5814af2}, // 1e-32
+  {0x81ceb32c4b43fcf4, 0x80eacf948770ced7}, // 1e-31
+  {0xa2425ff75e14fc31, 0xa1258379a94d028d}, // 1e-30
+  {0xcad2f7f5359a3b3e, 0x096ee45813a04330}, // 1e-29
+  {0xfd87b5f28300ca0d, 0x8bca9d6e188853fc}, // 1e-28
+  {0x9e74d1b791e07e48, 0x775ea264cf55347d}, // 1e-27
+  {0xc612062576589dda, 0x95364afe032a819d}, // 1e-26
+  {0xf79687aed3eec551, 0x3a83ddbd83f52204}, // 1e-25
+  {0x9abe14cd44753b52, 0xc4926a9672793542}, // 1e-24
+  {0xc16d9a0095928a27, 0x75b7053c0f178293}, // 1e-23
+  {0xf1c90080baf72cb1, 0x5324c68b12dd6338}, // 1e-22
+  {0x971da05074da7bee, 0xd3f6fc16ebca5e03}, // 1e-21
+  {0xbce5086492111aea, 0x88f4bb1ca6bcf584}, // 1e-20
+  {0xec1e4a7db69561a5, 0x2b31e9e3d06c32e5}, // 1e-19
+  {0x9392ee8e921d5d07, 0x3aff322e62439fcf}, // 1e-18
+  {0xb877aa3236a4b449, 0x09befeb9fad487c2}, // 1e-17
+  {0xe69594bec44de15b, 0x4c2ebe687989a9b3}, // 1e-16
+  {0x901d7cf73ab0acd9, 0x0f9d37014bf60a10}, // 1e-15
+  {0xb424dc35095cd80f, 0x538484c19ef38c94}, // 1e-14
+  {0xe12e13424bb40e13, 0x2865a5f206b06fb9}, // 1e-13
+  {0x8cbccc096f5088cb, 0xf93f87b7442e45d3}, // 1e-12
+  {0xafebff0bcb24aafe, 0xf78f69a51539d748}, // 1e-11
+  {0xdbe6fecebdedd5be, 0xb573440e5a884d1b}, // 1e-10
+  {0x89705f4136b4a597, 0x31680a88f8953030}, // 1e-9
+  {0xabcc77118461cefc, 0xfdc20d2b36ba7c3d}, // 1e-8
+  {0xd6bf94d5e57a42bc, 0x3d32907604691b4c}, // 1e-7
+  {0x8637bd05af6c69b5, 0xa63f9a49c2c1b10f}, // 1e-6
+  {0xa7c5ac471b478423, 0x0fcf80dc33721d53}, // 1e-5
+  {0xd1b71758e219652b, 0xd3c36113404ea4a8}, // 1e-4
+  {0x83126e978d4fdf3b, 0x645a1cac083126e9}, // 1e-3
+  {0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a3}, // 1e-2
+  {0xcccccccccccccccc, 0xcccccccccccccccc}, // 1e-1
+  {0x8000000000000000, 0x0000000000000000}, // 1e0
+  {0xa000000000000000, 0x0000000000000000}, // 1e1
+  {0xc800000000000000, 0x0000000000000000}, // 1e2
+  {0xfa00000000000000, 0x0000000000000000}, // 1e3
+  {0x9c40000000000000, 0x0000000000000000}, // 1e4
+  {0xc350000000000000, 0x0000000000000000}, // 1e5
+  {0xf424000000000000, 0x0000000000000000}, // 1e6
+  {0x9896800000000000, 0x0000000000000000}, // 1e7
+  {0xbebc200000000000, 0x0000000000000000}, // 1e8
+  {0xee6b280000000000, 0x0000000000000000}, // 1e9
+  {0x9502f90000000000, 0x0000000000000000}, // 1e10
+  {0xba43b74000000000, 0x0000000000000000}, // 1e11
+  {0xe8d4a51000000000, 0x0000000000000000}, // 1e12
+  {0x9184e72a00000000, 0x0000000000000000}, // 1e13
+  {0xb5e620f480000000, 0x0000000000000000}, // 1e14
+  {0xe35fa931a0000000, 0x0000000000000000}, // 1e15
+  {0x8e1bc9bf04000000, 0x0000000000000000}, // 1e16
+  {0xb1a2bc2ec5000000, 0x0000000000000000}, // 1e17
+  {0xde0b6b3a76400000, 0x0000000000000000}, // 1e18
+  {0x8ac7230489e80000, 0x0000000000000000}, // 1e19
+  {0xad78ebc5ac620000, 0x0000000000000000}, // 1e20
+  {0xd8d726b7177a8000, 0x0000000000000000}, // 1e21
+  {0x878678326eac9000, 0x0000000000000000}, // 1e22
+  {0xa968163f0a57b400, 0x0000000000000000}, // 1e23
+  {0xd3c21bcecceda100, 0x0000000000000000}, // 1e24
+  {0x84595161401484a0, 0x0000000000000000}, // 1e25
+  {0xa56fa5b99019a5c8, 0x0000000000000000}, // 1e26
+  {0xcecb8f27f4200f3a, 0x0000000000000000}, // 1e27
+  {0x813f3978f8940984, 0x4000000000000000}, // 1e28
+  {0xa18f07d736b90be5, 0x5000000000000000}, // 1e29
+  {0xc9f2c9cd04674ede, 0xa400000000000000}, // 1e30
+  {0xfc6f7c4045812296, 0x4d00000000000000}, // 1e31
+  {0x9dc5ada82b70b59d, 0xf020000000000000}, // 1e32
+  {0xc5371912364ce305, 0x6c28000000000000}, // 1e33
+  {0xf684df56c3e01bc6, 0xc732000000000000}, // 1e34
+  {0x9a130b963a6c115c, 0x3c7f400000000000}, // 1e35
+  {0xc097ce7bc90715b3, 0x4b9f100000000000}, // 1e36
+  {0xf0bdc21abb48db20, 0x1e86d40000000000}, // 1e37
+  {0x96769950b50d88f4, 0x1314448000000000}, // 1e38
+  {0xbc143fa4e250eb31, 0x17d955a000000000}, // 1e39
+  {0xeb194f8e1ae525fd, 0x5dcfab0800000000}, // 1e40
+  {0x92efd1b8d0cf37be, 0x5aa1cae500000000}, // 1e41
+  {0xb7abc627050305ad, 0xf14a3d9e40000000}, // 1e42
+  {0xe596b7b0c643c719, 0x6d9ccd05d0000000}, // 1e43
+  {0x8f7e32ce7bea5c6f, 0xe4820023a2000000}, // 1e44
+  {0xb35dbf821ae4f38b, 0xdda2802c8a800000}, // 1e45
+  {0xe0352f62a19e306e, 0xd50b2037ad200000}, // 1e46
+  {0x8c213d9da502de45, 0x4526f422cc340000}, // 1e47
+  {0xaf298d050e4395d6, 0x9670b12b7f410000}, // 1e48
+  {0xdaf3f04651d47b4c, 0x3c0cdd765f114000}, // 1e49
+  {0x88d8762bf324cd0f, 0xa5880a69fb6ac800}, // 1e50
+  {0xab0e93b6efee0053, 0x8eea0d047a457a00}, // 1e51
+  {0xd5d238a4abe98068, 0x72a4904598d6d880}, // 1e52
+  {0x85a36366eb71f041, 0x47a6da2b7f864750}, // 1e53
+  {0xa70c3c40a64e6c51, 0x999090b65f67d924}, // 1e54
+  {0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d}, // 1e55
+  {0x82818f1281ed449f, 0xbff8f10e7a8921a4}, // 1e56
+  {0xa321f2d7226895c7, 0xaff72d52192b6a0d}, // 1e57
+  {0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490}, // 1e58
+  {0xfee50b7025c36a08, 0x02f236d04753d5b4}, // 1e59
+  {0x9f4f2726179a2245, 0x01d762422c946590}, // 1e60
+  {0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5}, // 1e61
+  {0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2}, // 1e62
+  {0x9b934c3b330c8577, 0x63cc55f49f88eb2f}, // 1e63
+  {0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb}, // 1e64
+  {0xf316271c7fc3908a, 0x8bef464e3945ef7a}, // 1e65
+  {0x97edd871cfda3a56, 0x97758bf0e3cbb5ac}, // 1e66
+  {0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317}, // 1e67
+  {0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd}, // 1e68
+  {0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a}, // 1e69
+  {0xb975d6b6ee39e436, 0xb3e2fd538e122b44}, // 1e70
+  {0xe7d34c64a9c85d44, 0x60dbbca87196b616}, // 1e71
+  {0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd}, // 1e72
+  {0xb51d13aea4a488dd, 0x6babab6398bdbe41}, // 1e73
+  {0xe264589a4dcdab14, 0xc696963c7eed2dd1}, // 1e74
+  {0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2}, // 1e75
+  {0xb0de65388cc8ada8, 0x3b25a55f43294bcb}, // 1e76
+  {0xdd15fe86affad912, 0x49ef0eb713f39ebe}, // 1e77
+  {0x8a2dbf142dfcc7ab, 0x6e3569326c784337}, // 1e78
+  {0xacb92ed9397bf996, 0x49c2c37f07965404}, // 1e79
+  {0xd7e77a8f87daf7fb, 0xdc33745ec97be906}, // 1e80
+  {0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3}, // 1e81
+  {0xa8acd7c0222311bc, 0xc40832ea0d68ce0c}, // 1e82
+  {0xd2d80db02aabd62b, 0xf50a3fa490c30190}, // 1e83
+  {0x83c7088e1aab65db, 0x792667c6da79e0fa}, // 1e84
+  {0xa4b8cab1a1563f52, 0x577001b891185938}, // 1e85
+  {0xcde6fd5e09abcf26, 0xed4c0226b55e6f86}, // 1e86
+  {0x80b05e5ac60b6178, 0x544f8158315b05b4}, // 1e87
+  {0xa0dc75f1778e39d6, 0x696361ae3db1c721}, // 1e88
+  {0xc913936dd571c84c, 0x03bc3a19cd1e38e9}, // 1e89
+  {0xfb5878494ace3a5f, 0x04ab48a04065c723}, // 1e90
+  {0x9d174b2dcec0e47b, 0x62eb0d64283f9c76}, // 1e91
+  {0xc45d1df942711d9a, 0x3ba5d0bd324f8394}, // 1e92
+  {0xf5746577930d6500, 0xca8f44ec7ee36479}, // 1e93
+  {0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb}, // 1e94
+  {0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e}, // 1e95
+  {0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e}, // 1e96
+  {0x95d04aee3b80ece5, 0xbba1f1d158724a12}, // 1e97
+  {0xbb445da9ca61281f, 0x2a8a6e45ae8edc97}, // 1e98
+  {0xea1575143cf97226, 0xf52d09d71a3293bd}, // 1e99
+  {0x924d692ca61be758, 0x593c2626705f9c56}, // 1e100
+  {0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c}, // 1e101
+  {0xe498f455c38b997a, 0x0b6dfb9c0f956447}, // 1e102
+  {0x8edf98b59a373fec, 0x4724bd4189bd5eac}, // 1e103
+  {0xb2977ee300c50fe7, 0x58edec91ec2cb657}, // 1e104
+  {0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed}, // 1e105
+  {0x8b865b215899f46c, 0xbd79e0d20082ee74}, // 1e106
+  {0xae67f1e9aec07187, 0xecd8590680a3aa11}, // 1e107
+  {0xda01ee641a708de9, 0xe80e6f4820cc9495}, // 1e108
+  {0x884134fe908658b2, 0x3109058d147fdcdd}, // 1e109
+  {0xaa51823e34a7eede, 0xbd4b46f0599fd415}, // 1e110
+  {0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a}, // 1e111
+  {0x850fadc09923329e, 0x03e2cf6bc604ddb0}, // 1e112
+  {0xa6539930bf6bff45, 0x84db8346b786151c}, // 1e113
+  {0xcfe87f7cef46ff16, 0xe612641865679a63}, // 1e114
+  {0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e}, // 1e115
+  {0xa26da3999aef7749, 0xe3be5e330f38f09d}, // 1e116
+  {0xcb090c8001ab551c, 0x5cadf5bfd3072cc5}, // 1e117
+  {0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6}, // 1e118
+  {0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa}, // 1e119
+  {0xc646d63501a1511d, 0xb281e1fd541501b8}, // 1e120
+  {0xf7d88bc24209a565, 0x1f225a7ca91a4226}, // 1e121
+  {0x9ae757596946075f, 0x3375788de9b06958}, // 1e122
+  {0xc1a12d2fc3978937, 0x0052d6b1641c83ae}, // 1e123
+  {0xf209787bb47d6b84, 0xc0678c5dbd23a49a}, // 1e124
+  {0x9745eb4d50ce6332, 0xf840b7ba963646e0}, // 1e125
+  {0xbd176620a501fbff, 0xb650e5a93bc3d898}, // 1e126
+  {0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe}, // 1e127
+  {0x93ba47c980e98cdf, 0xc66f336c36b10137}, // 1e128
+  {0xb8a8d9bbe123f017, 0xb80b0047445d4184}, // 1e129
+  {0xe6d3102ad96cec1d, 0xa60dc059157491e5}, // 1e130
+  {0x9043ea1ac7e41392, 0x87c89837ad68db2f}, // 1e131
+  {0xb454e4a179dd1877, 0x29babe4598c311fb}, // 1e132
+  {0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a}, // 1e133
+  {0x8ce2529e2734bb1d, 0x1899e4a65f58660c}, // 1e134
+  {0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f}, // 1e135
+  {0xdc21a1171d42645d, 0x76707543f4fa1f73}, // 1e136
+  {0x899504ae72497eba, 0x6a06494a791c53a8}, // 1e137
+  {0xabfa45da0edbde69, 0x0487db9d17636892}, // 1e138
+  {0xd6f8d7509292d603, 0x45a9d2845d3c42b6}, // 1e139
+  {0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2}, // 1e140
+  {0xa7f26836f282b732, 0x8e6cac7768d7141e}, // 1e141
+  {0xd1ef0244af2364ff, 0x3207d795430cd926}, // 1e142
+  {0x8335616aed761f1f, 0x7f44e6bd49e807b8}, // 1e143
+  {0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6}, // 1e144
+  {0xcd036837130890a1, 0x36dba887c37a8c0f}, // 1e145
+  {0x802221226be55a64, 0xc2494954da2c9789}, // 1e146
+  {0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c}, // 1e147
+  {0xc83553c5c8965d3d, 0x6f92829494e5acc7}, // 1e148
+  {0xfa42a8b73abbf48c, 0xcb772339ba1f17f9}, // 1e149
+  {0x9c69a97284b578d7, 0xff2a760414536efb}, // 1e150
+  {0xc38413cf25e2d70d, 0xfef5138519684aba}, // 1e151
+  {0xf46518c2ef5b8cd1, 0x7eb258665fc25d69}, // 1e152
+  {0x98bf2f79d5993802, 0xef2f773ffbd97a61}, // 1e153
+  {0xbeeefb584aff8603, 0xaafb550ffacfd8fa}, // 1e154
+  {0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38}, // 1e155
+  {0x952ab45cfa97a0b2, 0xdd945a747bf26183}, // 1e156
+  {0xba756174393d88df, 0x94f971119aeef9e4}, // 1e157
+  {0xe912b9d1478ceb17, 0x7a37cd5601aab85d}, // 1e158
+  {0x91abb422ccb812ee, 0xac62e055c10ab33a}, // 1e159
+  {0xb616a12b7fe617aa, 0x577b986b314d6009}, // 1e160
+  {0xe39c49765fdf9d94, 0xed5a7e85fda0b80b}, // 1e161
+  {0x8e41ade9fbebc27d, 0x14588f13be847307}, // 1e162
+  {0xb1d219647ae6b31c, 0x596eb2d8ae258fc8}, // 1e163
+  {0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb}, // 1e164
+  {0x8aec23d680043bee, 0x25de7bb9480d5854}, // 1e165
+  {0xada72ccc20054ae9, 0xaf561aa79a10ae6a}, // 1e166
+  {0xd910f7ff28069da4, 0x1b2ba1518094da04}, // 1e167
+  {0x87aa9aff79042286, 0x90fb44d2f05d0842}, // 1e168
+  {0xa99541bf57452b28, 0x353a1607ac744a53}, // 1e169
+  {0xd3fa922f2d1675f2, 0x42889b8997915ce8}, // 1e170
+  {0x847c9b5d7c2e09b7, 0x69956135febada11}, // 1e171
+  {0xa59bc234db398c25, 0x43fab9837e699095}, // 1e172
+  {0xcf02b2c21207ef2e, 0x94f967e45e03f4bb}, // 1e173
+  {0x8161afb94b44f57d, 0x1d1be0eebac278f5}, // 1e174
+  {0xa1ba1ba79e1632dc, 0x6462d92a69731732}, // 1e175
+  {0xca28a291859bbf93, 0x7d7b8f7503cfdcfe}, // 1e176
+  {0xfcb2cb35e702af78, 0x5cda735244c3d43e}, // 1e177
+  {0x9defbf01b061adab, 0x3a0888136afa64a7}, // 1e178
+  {0xc56baec21c7a1916, 0x088aaa1845b8fdd0}, // 1e179
+  {0xf6c69a72a3989f5b, 0x8aad549e57273d45}, // 1e180
+  {0x9a3c2087a63f6399, 0x36ac54e2f678864b}, // 1e181
+  {0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd}, // 1e182
+  {0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5}, // 1e183
+  {0x969eb7c47859e743, 0x9f644ae5a4b1b325}, // 1e184
+  {0xbc4665b596706114, 0x873d5d9f0dde1fee}, // 1e185
+  {0xeb57ff22fc0c7959, 0xa90cb506d155a7ea}, // 1e186
+  {0x9316ff75dd87cbd8, 0x09a7f12442d588f2}, // 1e187
+  {0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f}, // 1e188
+  {0xe5d3ef282a242e81, 0x8f1668c8a86da5fa}, // 1e189
+  {0x8fa475791a569d10, 0xf96e017d694487bc}, // 1e190
+  {0xb38d92d760ec4455, 0x37c981dcc395a9ac}, // 1e191
+  {0xe070f78d3927556a, 0x85bbe253f47b1417}, // 1e192
+  {0x8c469ab843b89562, 0x93956d7478ccec8e}, // 1e193
+  {0xaf58416654a6babb, 0x387ac8d1970027b2}, // 1e194
+  {0xdb2e51bfe9d0696a, 0x06997b05fcc0319e}, // 1e195
+  {0x88fcf317f22241e2, 0x441fece3bdf81f03}, // 1e196
+  {0xab3c2fddeeaad25a, 0xd527e81cad7626c3}, // 1e197
+  {0xd60b3bd56a5586f1, 0x8a71e223d8d3b074}, // 1e198
+  {0x85c7056562757456, 0xf6872d5667844e49}, // 1e199
+  {0xa738c6bebb12d16c, 0xb428f8ac016561db}, // 1e200
+  {0xd106f86e69d785c7, 0xe13336d701beba52}, // 1e201
+  {0x82a45b450226b39c, 0xecc0024661173473}, // 1e202
+  {0xa34d721642b06084, 0x27f002d7f95d0190}, // 1e203
+  {0xcc20ce9bd35c78a5, 0x31ec038df7b441f4}, // 1e204
+  {0xff290242c83396ce, 0x7e67047175a15271}, // 1e205
+  {0x9f79a169bd203e41, 0x0f0062c6e984d386}, // 1e206
+  {0xc75809c42c684dd1, 0x52c07b78a3e60868}, // 1e207
+  {0xf92e0c3537826145, 0xa7709a56ccdf8a82}, // 1e208
+  {0x9bbcc7a142b17ccb, 0x88a66076400bb691}, // 1e209
+  {0xc2abf989935ddbfe, 0x6acff893d00ea435}, // 1e210
+  {0xf356f7ebf83552fe, 0x0583f6b8c4124d43}, // 1e211
+  {0x98165af37b2153de, 0xc3727a337a8b704a}, // 1e212
+  {0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c}, // 1e213
+  {0xeda2ee1c7064130c, 0x1162def06f79df73}, // 1e214
+  {0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8}, // 1e215
+  {0xb9a74a0637ce2ee1, 0x6d953e2bd7173692}, // 1e216
+  {0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437}, // 1e217
+  {0x910ab1d4db9914a0, 0x1d9c9892400a22a2}, // 1e218
+  {0xb54d5e4a127f59c8, 0x2503beb6d00cab4b}, // 1e219
+  {0xe2a0b5dc971f303a, 0x2e44ae64840fd61d}, // 1e220
+  {0x8da471a9de737e24, 0x5ceaecfed289e5d2}, // 1e221
+  {0xb10d8e1456105dad, 0x7425a83e872c5f47}, // 1e222
+  {0xdd50f1996b947518, 0xd12f124e28f77719}, // 1e223
+  {0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f}, // 1e224
+  {0xace73cbfdc0bfb7b, 0x636cc64d1001550b}, // 1e225
+  {0xd8210befd30efa5a, 0x3c47f7e05401aa4e}, // 1e226
+  {0x8714a775e3e95c78, 0x65acfaec34810a71}, // 1e227
+  {0xa8d9d1535ce3b396, 0x7f1839a741a14d0d}, // 1e228
+  {0xd31045a8341ca07c, 0x1ede48111209a050}, // 1e229
+  {0x83ea2b892091e44d, 0x934aed0aab460432}, // 1e230
+  {0xa4e4b66b68b65d60, 0xf81da84d5617853f}, // 1e231
+  {0xce1de40642e3f4b9, 0x36251260ab9d668e}, // 1e232
+  {0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019}, // 1e233
+  {0xa1075a24e4421730, 0xb24cf65b8612f81f}, // 1e234
+  {0xc94930ae1d529cfc, 0xdee033f26797b627}, // 1e235
+  {0xfb9b7cd9a4a7443c, 0x169840ef017da3b1}, // 1e236
+  {0x9d412e0806e88aa5, 0x8e1f289560ee864e}, // 1e237
+  {0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2}, // 1e238
+  {0xf5b5d7ec8acb58a2, 0xae10af696774b1db}, // 1e239
+  {0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29}, // 1e240
+  {0xbff610b0cc6edd3f, 0x17fd090a58d32af3}, // 1e241
+  {0xeff394dcff8a948e, 0xddfc4b4cef07f5b0}, // 1e242
+  {0x95f83d0a1fb69cd9, 0x4abdaf101564f98e}, // 1e243
+  {0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1}, // 1e244
+  {0xea53df5fd18d5513, 0x84c86189216dc5ed}, // 1e245
+  {0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4}, // 1e246
+  {0xb7118682dbb66a77, 0x3fbc8c33221dc2a1}, // 1e247
+  {0xe4d5e82392a40515, 0x0fabaf3feaa5334a}, // 1e248
+  {0x8f05b1163ba6832d, 0x29cb4d87f2a7400e}, // 1e249
+  {0xb2c71d5bca9023f8, 0x743e20e9ef511012}, // 1e250
+  {0xdf78e4b2bd342cf6, 0x914da9246b255416}, // 1e251
+  {0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e}, // 1e252
+  {0xae9672aba3d0c320, 0xa184ac2473b529b1}, // 1e253
+  {0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e}, // 1e254
+  {0x8865899617fb1871, 0x7e2fa67c7a658892}, // 1e255
+  {0xaa7eebfb9df9de8d, 0xddbb901b98feeab7}, // 1e256
+  {0xd51ea6fa85785631, 0x552a74227f3ea565}, // 1e257
+  {0x8533285c936b35de, 0xd53a88958f87275f}, // 1e258
+  {0xa67ff273b8460356, 0x8a892abaf368f137}, // 1e259
+  {0xd01fef10a657842c, 0x2d2b7569b0432d85}, // 1e260
+  {0x8213f56a67f6b29b, 0x9c3b29620e29fc73}, // 1e261
+  {0xa298f2c501f45f42, 0x8349f3ba91b47b8f}, // 1e262
+  {0xcb3f2f7642717713, 0x241c70a936219a73}, // 1e263
+  {0xfe0efb53d30dd4d7, 0xed238cd383aa0110}, // 1e264
+  {0x9ec95d1463e8a506, 0xf4363804324a40aa}, // 1e265
+  {0xc67bb4597ce2ce48, 0xb143c6053edcd0d5}, // 1e266
+  {0xf81aa16fdc1b81da, 0xdd94b7868e94050a}, // 1e267
+  {0x9b10a4e5e9913128, 0xca7cf2b4191c8326}, // 1e268
+  {0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0}, // 1e269
+  {0xf24a01a73cf2dccf, 0xbc633b39673c8cec}, // 1e270
+  {0x976e41088617ca01, 0xd5be0503e085d813}, // 1e271
+  {0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18}, // 1e272
+  {0xec9c459d51852ba2, 0xddf8e7d60ed1219e}, // 1e273
+  {0x93e1ab8252f33b45, 0xcabb90e5c942b503}, // 1e274
+  {0xb8da1662e7b00a17, 0x3d6a751f3b936243}, // 1e275
+  {0xe7109bfba19c0c9d, 0x0cc512670a783ad4}, // 1e276
+  {0x906a617d450187e2, 0x27fb2b80668b24c5}, // 1e277
+  {0xb484f9dc9641e9da, 0xb1f9f660802dedf6}, // 1e278
+  {0xe1a63853bbd26451, 0x5e7873f8a0396973}, // 1e279
+  {0x8d07e33455637eb2, 0xdb0b487b6423e1e8}, // 1e280
+  {0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62}, // 1e281
+  {0xdc5c5301c56b75f7, 0x7641a140cc7810fb}, // 1e282
+  {0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d}, // 1e283
+  {0xac2820d9623bf429, 0x546345fa9fbdcd44}, // 1e284
+  {0xd732290fbacaf133, 0xa97c177947ad4095}, // 1e285
+  {0x867f59a9d4bed6c0, 0x49ed8eabcccc485d}, // 1e286
+  {0xa81f301449ee8c70, 0x5c68f256bfff5a74}, // 1e287
+  {0xd226fc195c6a2f8c, 0x73832eec6fff3111}, // 1e288
+  {0x83585d8fd9c25db7, 0xc831fd53c5ff7eab}, // 1e289
+  {0xa42e74f3d032f525, 0xba3e7ca8b77f5e55}, // 1e290
+  {0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb}, // 1e291
+  {0x80444b5e7aa7cf85, 0x7980d163cf5b81b3}, // 1e292
+  {0xa0555e361951c366, 0xd7e105bcc332621f}, // 1e293
+  {0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7}, // 1e294
+  {0xfa856334878fc150, 0xb14f98f6f0feb951}, // 1e295
+  {0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3}, // 1e296
+  {0xc3b8358109e84f07, 0x0a862f80ec4700c8}, // 1e297
+  {0xf4a642e14c6262c8, 0xcd27bb612758c0fa}, // 1e298
+  {0x98e7e9cccfbd7dbd, 0x8038d51cb897789c}, // 1e299
+  {0xbf21e44003acdd2c, 0xe0470a63e6bd56c3}, // 1e300
+  {0xeeea5d5004981478, 0x1858ccfce06cac74}, // 1e301
+  {0x95527a5202df0ccb, 0x0f37801e0c43ebc8}, // 1e302
+  {0xbaa718e68396cffd, 0xd30560258f54e6ba}, // 1e303
+  {0xe950df20247c83fd, 0x47c6b82ef32a2069}, // 1e304
+  {0x91d28b7416cdd27e, 0x4cdc331d57fa5441}, // 1e305
+  {0xb6472e511c81471d, 0xe0133fe4adf8e952}, // 1e306
+  {0xe3d8f9e563a198e5, 0x58180fddd97723a6}, // 1e307
+  {0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648}, // 1e308
+  {0xb201833b35d63f73, 0x2cd2cc6551e513da}, // 1e309
+  {0xde81e40a034bcf4f, 0xf8077f7ea65e58d1}, // 1e310
+  {0x8b112e86420f6191, 0xfb04afaf27faf782}, // 1e311
+  {0xadd57a27d29339f6, 0x79c5db9af1f9b563}, // 1e312
+  {0xd94ad8b1c7380874, 0x18375281ae7822bc}, // 1e313
+  {0x87cec76f1c830548, 0x8f2293910d0b15b5}, // 1e314
+  {0xa9c2794ae3a3c69a, 0xb2eb3875504ddb22}, // 1e315
+  {0xd433179d9c8cb841, 0x5fa60692a46151eb}, // 1e316
+  {0x849feec281d7f328, 0xdbc7c41ba6bcd333}, // 1e317
+  {0xa5c7ea73224deff3, 0x12b9b522906c0800}, // 1e318
+  {0xcf39e50feae16bef, 0xd768226b34870a00}, // 1e319
+  {0x81842f29f2cce375, 0xe6a1158300d46640}, // 1e320
+  {0xa1e53af46f801c53, 0x60495ae3c1097fd0}, // 1e321
+  {0xca5e89b18b602368, 0x385bb19cb14bdfc4}, // 1e322
+  {0xfcf62c1dee382c42, 0x46729e03dd9ed7b5}, // 1e323
+  {0x9e19db92b4e31ba9, 0x6c07a2c26a8346d1}, // 1e324
+};
+
+/// powers of ten which fit in `nat8`
+inline constexpr nat8 _pow10_nat[20]{1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+  10000000000, 100000000000, 1000000000000, 10000000000000, 100000000000000, 1000000000000000, 10000000000000000,
+  100000000000000000, 1000000000000000000, 10000000000000000000u};
+
+/// multiplies 64-bit integers; returns the low half and stores the high half to `Hi`
+constexpr nat8 _mul128(const nat8 a, const nat8 b, nat8& Hi) noexcept {
+  const nat8 a0 = nat4(a), a1 = a >> 32, b0 = nat4(b), b1 = b >> 32;
+  const nat8 p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0;
+  const nat8 mid = (p00 >> 32) + nat4(p01) + nat4(p10);
+  Hi = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+  return mid << 32 | nat4(p00);
+}
+
+/// returns the bits of a floating-point value
+template<floating_point F> constexpr nat8 _float_bits(const F v) noexcept {
+  if constexpr (sizeof(F) == 8) return bitcast<nat8>(v);
+  else return bitcast<nat4>(v);
+}
+
+/// splits the bits of a finite nonzero value into `c * 2^q` ignoring the sign
+/// \return `true` if the lower neighbor is closer than the upper
+template<floating_point F> constexpr bool _float_split(const nat8 Bits, nat8& c, int4& q) noexcept {
+  constexpr int4 mbits = sizeof(F) == 8 ? 52 : 23, bias = sizeof(F) == 8 ? 1075 : 150;
+  const nat8 f = Bits & ((nat8(1) << mbits) - 1), x = (Bits >> mbits) & (sizeof(F) == 8 ? 0x7ff : 0xff);
+  c = x ? f | nat8(1) << mbits : f, q = x ? int4(x) - bias : 1 - bias;
+  return f == 0 && x > 1;
+}
+
+/// loads 8 characters as 8 bytes; characters out of a byte become 0 or 255
+template<typename Ct> inline nat8 _load8(const Ct* p) noexcept {
+  if constexpr (sizeof(Ct) == 1) return nat8(_mm_cvtsi128_si64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+  else if constexpr (sizeof(Ct) == 2) {
+    const auto v = _loadu128(p);
+    return nat8(_mm_cvtsi128_si64(_mm_packus_epi16(v, v)));
+  } else {
+    const auto v = _mm_packs_epi32(_loadu128(p), _loadu128(p + 4));
+    return nat8(_mm_cvtsi128_si64(_mm_packus_epi16(v, v)));
+  }
+}
+
+/// converts 8 bytes of digit values (0..9, the first in the lowest byte) to an integer
+constexpr nat8 _swar8(nat8 x) noexcept {
+  x = x * 10 + (x >> 8);
+  return ((x & 0x000000ff000000ff) * (100 + (1000000ull << 32)) + ((x >> 16) & 0x000000ff000000ff) * (1 + (10000ull << 32))) >> 32;
+}
+
+/// parses decimal digits 8 at a time and advances `p` past them
+/// \return `false` if the value overflows `nat8`; all digits are consumed even then
+template<typename Ct> constexpr bool _parse_digits(const Ct*& p, const Ct* const Last, nat8& v) noexcept {
+  bool ok = true;
+  nat n{};
+  v = 0;
+  if (!IS_CEV) while (Last - p >= 8) {
+    const nat8 x = _load8(p) ^ 0x3030303030303030;
+    const nat8 bad = (x & 0xf0f0f0f0f0f0f0f0) | (((x & 0x0f0f0f0f0f0f0f0f) + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0);
+    const nat k = bad ? nat(std::countr_zero(bad)) / 8 : 8;
+    if (k == 0) return ok;
+    const nat8 c = _swar8(k == 8 ? x : x << (64 - k * 8));
+    if ((n += k) <= 19) v = v * _pow10_nat[k] + c;
+    else {
+      nat8 hi{};
+      const nat8 lo = _mul128(v, _pow10_nat[k], hi) + c;
+      ok &= hi == 0 && lo >= c, v = lo;
+    }
+    if (p += k; k < 8) return ok;
   }
-  s.remove_prefix(1);
-  while (1) {
-    if (s.empty()) return v;
-    else if (is_digit(s.front())) v = v * 10 + s.front() - '0', s.remove_prefix(1);
-    else return v;
+  for (; p != Last && is_digit(*p); ++p) {
+    const nat d = nat(bitcast<makenat<Ct>>(*p)) - '0';
+    ok &= v < 1844674407370955161 || (v == 1844674407370955161 && d <= 5);
+    v = v * 10 + d;
+  }
+  return ok;
+}
+
+/// parses an unsigned integer after skipping characters which are not digits; saturates on overflow
+template<std::unsigned_integral T, typename Ct> constexpr T _ston(StringView<Ct>& s) noexcept {
+  while (!s.empty() && !is_digit(s.front())) s.remove_prefix(1);
+  if (s.empty()) return {};
+  const Ct* p = s.data();
+  nat8 v{};
+  const bool ok = _parse_digits(p, s.data() + s.size(), v);
+  s.remove_prefix(nat(p - s.data()));
+  return !ok || v > nat8(std::numeric_limits<T>::max()) ? std::numeric_limits<T>::max() : T(v);
+}
+
+/// parses a signed integer after skipping characters which do not start a number; saturates on overflow
+template<std::signed_integral T, typename Ct> constexpr T _stoi(StringView<Ct>& s) noexcept {
+  for (; !s.empty(); s.remove_prefix(1)) {
+    const bool sign = s.front() == Ct('-') || s.front() == Ct('+');
+    if (sign ? s.size() < 2 || !is_digit(s[1]) : !is_digit(s.front())) continue;
+    const bool neg = s.front() == Ct('-');
+    const Ct* p = s.data() + sign;
+    nat8 v{};
+    const bool ok = _parse_digits(p, s.data() + s.size(), v);
+    s.remove_prefix(nat(p - s.data()));
+    if (!ok || v > nat8(std::numeric_limits<T>::max()) + neg) return neg ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+    return neg ? T(0 - v) : T(v);
   }
+  return {};
+}
+
+/// returns the value of bits as a floating-point value
+template<floating_point F> constexpr F _float_from_bits(const nat8 Bits) noexcept {
+  if constexpr (sizeof(F) == 8) return bitcast<F>(Bits);
+  else return bitcast<F>(nat4(Bits));
+}
+
+/// powers of ten exactly representable in `fat8`
+inline constexpr fat8 _pow10_fat8[23]{
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/// returns the value of a hexadecimal digit, or 16 or more if not a digit
+constexpr nat4 _hex_value(const nat4 c) noexcept {
+  return c - '0' < 10 ? c - '0' : (c | 0x20) - 'a' < 6 ? (c | 0x20) - 'a' + 10 : 16;
+}
+
+/// rounds `m * 2^e` (`m` nonzero, `Sticky` if nonzero bits follow) to the nearest `F`, ties to even
+/// \return bits of the positive result; infinity on overflow
+template<floating_point F> constexpr nat8 _float_round(nat8 m, int8 e, const bool Sticky) noexcept {
+  constexpr int8 mbits = sizeof(F) == 8 ? 52 : 23, emax = sizeof(F) == 8 ? 0x7ff : 0xff, ebias = emax / 2;
+  const int4 lz = std::countl_zero(m);
+  m <<= lz, e -= lz;
+  const int8 be = e + 63 + ebias, shift = 63 - mbits + (be <= 0 ? 1 - be : 0);
+  if (be >= emax) return nat8(emax) << mbits;
+  else if (shift > 64) return 0;
+  else if (shift == 64) return m > nat8(1) << 63 || (m == nat8(1) << 63 && Sticky);
+  const nat8 keep = m >> shift, rest = m << (64 - shift), half = nat8(1) << 63;
+  const nat8 r = keep + (rest > half || (rest == half && (Sticky || (keep & 1))));
+  return std::min(be <= 0 ? r : (nat8(be - 1) << mbits) + r, nat8(emax) << mbits);
 }
 
-template<typename Ct> constexpr int8 _stoi(StringView<Ct>& s) noexcept {
-  int8 v{};
-  bool neg = false;
-  while (1) {
-    if (s.empty()) return {};
-    else if (is_digit(s.front())) { neg = true; v = s.front() - '0'; break; }
-    else if (s.front() == Ct('-')) { neg = true; break; }
-    else s.remove_prefix(1);
+/// converts `w * 10^q` to the nearest `F` with the Eisel-Lemire algorithm
+/// \param Sure (out) `false` if the 128-bit product is too close to a rounding boundary to decide
+/// \return bits of the positive result; within one unit in the last place if not `Sure`
+/// \note The table entries of 10^-27..10^-1 are rounded up to make the product exact on halfway cases.
+template<floating_point F> constexpr nat8 _eisel_lemire(nat8 w, const int8 q, bool& Sure) noexcept {
+  constexpr bool f8 = sizeof(F) == 8;
+  constexpr int4 mbits = f8 ? 52 : 23, emax = f8 ? 0x7ff : 0xff, emin = f8 ? -1023 : -127;
+  constexpr int8 qmin = f8 ? -342 : -64, qmax = f8 ? 308 : 38, qeven_min = f8 ? -4 : -17, qeven_max = f8 ? 23 : 10;
+  constexpr nat8 mask = ~nat8(0) >> (mbits + 3);
+  Sure = true;
+  if (w == 0 || q < qmin) return 0;
+  else if (q > qmax) return nat8(emax) << mbits;
+  const int4 lz = std::countl_zero(w);
+  w <<= lz;
+  const nat8* t = _pow10_table[q - _POW10_MIN];
+  nat8 hi{}, lo = _mul128(w, t[0], hi);
+  if ((hi & mask) == mask) {
+    nat8 h{};
+    _mul128(w, t[1] + (-27 <= q && q < 0), h);
+    lo += h, hi += lo < h;
   }
-  s.remove_prefix(1);
-  while (1) {
-    if (s.empty()) return neg ? -v : v;
-    else if (is_digit(s.front())) v = v * 10 + s.front() - '0', s.remove_prefix(1);
-    else return neg ? -v : v;
+  if (lo == ~nat8(0) && (q < -27 || 55 < q)) Sure = false;
+  const int4 upper = int4(hi >> 63), shift = upper + 64 - mbits - 3;
+  nat8 m = hi >> shift;
+  int4 e = int4((217706 * q) >> 16) + 63 + upper - lz - emin;
+  if (e <= 0) {
+    if (-e + 1 >= 64) return 0;
+    m >>= -e + 1;
+    return (m + (m & 1)) >> 1;
   }
+  if (lo <= 1 && qeven_min <= q && q <= qeven_max && (m & 3) == 1 && (m << shift) == hi) m &= ~nat8(1);
+  m = (m + (m & 1)) >> 1;
+  if (m >= nat8(2) << mbits) m = nat8(1) << mbits, ++e;
+  if (e >= emax) return nat8(emax) << mbits;
+  return (m & ~(nat8(1) << mbits)) | nat8(e) << mbits;
 }
 
-template<typename Ct> constexpr fat8 _stof(StringView<Ct>& s) noexcept {
-  fat8 v{};
-  bool neg = false, dot = false;
-  while (1) {
-    if (s.empty()) return {};
-    else if (is_digit(s.front())) { v = s.front() - '0'; break;}
-    else if (s.front() == Ct('-')) { neg = true; break; }
-    else if (s.front() == Ct('.')) { dot = true; break; }
-    else s.remove_prefix(1);
+/// digits of a decimal number; the value is `0.[int digits][fraction digits] * 10^(exp10 + number of int digits)`
+template<character Ct> struct _float_digits {
+  const Ct* int_first;
+  const Ct* int_last;
+  const Ct* frac_first;
+  const Ct* frac_last;
+  int8 exp10;
+};
+
+/// unsigned big integer for the exact comparisons of the fallback of `_parse_float`
+struct _bignum {
+  nat4 d[160]{};
+  nat n{};
+
+  constexpr void mul_add(const nat4 m, nat4 a) noexcept {
+    for (nat i{}; i < n; ++i) {
+      const nat8 t = nat8(d[i]) * m + a;
+      d[i] = nat4(t), a = nat4(t >> 32);
+    }
+    if (a != 0) d[n++] = a;
   }
-  s.remove_prefix(1);
-  while (!dot) {
-    if (s.empty()) return neg ? -v : v;
-    else if (is_digit(s.front())) v = v * 10 + s.front() - '0', s.remove_prefix(1);
-    else if (s.front() == Ct('.')) { dot = true; break; }
-    else return neg ? -v : v;
+
+  constexpr void mul_pow5(nat e) noexcept {
+    for (; e >= 13; e -= 13) mul_add(1220703125, 0);
+    nat4 m = 1;
+    for (; e > 0; --e) m *= 5;
+    mul_add(m, 0);
   }
-  s.remove_prefix(1);
-  fat8 p = 0.1;
-  while (1) {
-    if (s.empty()) return neg ? -v : v;
-    else if (is_digit(s.front())) { v += (s.front() - '0') * p; p *= 0.1, s.remove_prefix(1); }
-    else if ((s.front() == Ct('e') || s.front() == Ct('E'))) break;
-    else return neg ? -v : v;
+
+  constexpr void shl(const nat s) noexcept {
+    if (n == 0) return;
+    const nat w = s / 32, b = s % 32;
+    if (b != 0) {
+      d[n] = 0;
+      for (nat i = n + 1; i-- > 0;) d[i] = d[i] << b | (i ? d[i - 1] >> (32 - b) : 0);
+      n += d[n] != 0;
+    }
+    if (w != 0) {
+      for (nat i = n; i-- > 0;) d[i + w] = d[i];
+      for (nat i{}; i < w; ++i) d[i] = 0;
+      n += w;
+    }
   }
-  s.remove_prefix(1);
-  bool e_neg = false;
-  int8 e = 0;
-  if (s.empty()) return neg ? -v : v;
-  else if (s.front() == Ct('-')) e_neg = true, s.remove_prefix(1);
-  else if (s.front() == Ct('+')) s.remove_prefix(1);
-  while (1) {
-    if (s.empty()) break;
-    else if (is_digit(s.front())) e = e * 10 + s.front() - '0', s.remove_prefix(1);
-    else break;
+
+  friend constexpr int4 compare(const _bignum& a, const _bignum& b) noexcept {
+    if (a.n != b.n) return a.n < b.n ? -1 : 1;
+    for (nat i = a.n; i-- > 0;) if (a.d[i] != b.d[i]) return a.d[i] < b.d[i] ? -1 : 1;
+    return 0;
   }
-  for (int8 i = 0; i < e; ++i) v *= 10;
-  for (int8 i = 0; i > e; --i) v *= 0.1;
-  return neg ? -v : v;
+};
+
+/// compares the decimal number with `H * 2^j` exactly
+/// \return negative, zero or positive as the number is less than, equal to or greater than `H * 2^j`
+/// \note Only the first 800 significant digits are used exactly and the rest decide ties; a halfway
+///       point of `fat8` has at most 767 significant digits.
+template<character Ct> constexpr int4 _float_compare(const _float_digits<Ct>& Digits, const nat8 H, const int8 j) noexcept {
+  _bignum a, b;
+  int8 k = Digits.exp10 + (Digits.int_last - Digits.int_first);
+  nat count{}, chunk{}, size{};
+  bool sticky = false;
+  auto put = [&](const Ct* First, const Ct* Last) noexcept {
+    for (; First != Last; ++First) {
+      const nat4 x = nat4(bitcast<makenat<Ct>>(*First)) - '0';
+      if (count == 800) sticky |= x != 0;
+      else if (--k, count != 0 || x != 0) {
+        ++count, chunk = chunk * 10 + x;
+        if (++size == 9) a.mul_add(1000000000, nat4(chunk)), chunk = size = 0;
+      }
+    }
+  };
+  put(Digits.int_first, Digits.int_last), put(Digits.frac_first, Digits.frac_last);
+  if (size != 0) a.mul_add(nat4(_pow10_nat[size]), nat4(chunk));
+  b.d[0] = nat4(H), b.d[1] = nat4(H >> 32), b.n = H >> 32 ? 2 : 1;
+  if (k >= 0) a.mul_pow5(nat(k));
+  else b.mul_pow5(nat(-k));
+  const int8 m = std::min(k, j);
+  a.shl(nat(k - m)), b.shl(nat(j - m));
+  const int4 c = compare(a, b);
+  return c != 0 ? c : sticky;
+}
+
+/// corrects bits within a few units in the last place to the correctly rounded value of the digits
+template<floating_point F, character Ct> constexpr nat8 _float_fallback(nat8 Bits, const _float_digits<Ct>& Digits) noexcept {
+  constexpr nat8 inf = sizeof(F) == 8 ? nat8(0x7ff) << 52 : nat8(0xff) << 23;
+  auto compare_half = [&](const nat8 b) noexcept {
+    nat8 c0{}, c1{};
+    int4 q0{}, q1{};
+    _float_split<F>(b, c0, q0), _float_split<F>(b + 1, c1, q1);
+    const int4 m = std::min(q0, q1);
+    return _float_compare(Digits, (c0 << (q0 - m)) + (c1 << (q1 - m)), m - 1);
+  };
+  for (; Bits < inf; ++Bits) if (const int4 c = compare_half(Bits); c < 0 || (c == 0 && (Bits & 1) == 0)) break;
+  for (; Bits > 0; --Bits) if (const int4 c = compare_half(Bits - 1); c > 0 || (c == 0 && (Bits & 1) == 0)) break;
+  return Bits;
+}
+
+/// parses a floating-point number at the beginning of `[First..Last)`
+/// \param v (out) parsed value; not changed if no number is found
+/// \return number of characters used, or 0 if no number is found
+/// \note The syntax is that of `std::strtod`: an optional sign and decimal digits with an optional
+///       point and exponent, "0x" and hexadecimal digits with an optional "p" exponent, "inf",
+///       "infinity" or "nan"; letters are case-insensitive.
+template<floating_point F, character Ct> constexpr nat _parse_float(const Ct* const First, const Ct* const Last, F& v) noexcept {
+  constexpr bool f8 = sizeof(F) == 8;
+  constexpr nat8 mbits = f8 ? 52 : 23, inf = (f8 ? nat8(0x7ff) : nat8(0xff)) << mbits;
+  const Ct* p = First;
+  auto at = [&](const Ct* i) noexcept -> nat4 { return i < Last ? nat4(bitcast<makenat<Ct>>(*i)) : 0; };
+  auto digit = [&](const Ct* i) noexcept { return at(i) - '0' < 10; };
+  auto exponent = [&](int8& e) noexcept {
+    const Ct* i = p + 1;
+    const bool neg = at(i) == '-';
+    if (neg || at(i) == '+') ++i;
+    if (!digit(i)) return;
+    int8 x{};
+    for (; digit(i); ++i) if (x < 100000000) x = x * 10 + (at(i) - '0');
+    e += neg ? -x : x, p = i;
+  };
+  const nat8 sign = at(p) == '-' ? nat8(1) << (f8 ? 63 : 31) : 0;
+  if (sign || at(p) == '+') ++p;
+  nat8 bits{};
+  if ((at(p) | 0x20) == 'i' && (at(p + 1) | 0x20) == 'n' && (at(p + 2) | 0x20) == 'f') {
+    p += 3, bits = inf;
+    if (nat i{}; Last - p >= 5) {
+      while (i < 5 && (at(p + i) | 0x20) == nat4("inity"[i])) ++i;
+      if (i == 5) p += 5;
+    }
+  } else if ((at(p) | 0x20) == 'n' && (at(p + 1) | 0x20) == 'a' && (at(p + 2) | 0x20) == 'n') {
+    p += 3, bits = inf | nat8(1) << (mbits - 1);
+  } else if (at(p) == '0' && (at(p + 1) | 0x20) == 'x' && (_hex_value(at(p + 2)) < 16 || (at(p + 2) == '.' && _hex_value(at(p + 3)) < 16))) {
+    nat8 m{};
+    int8 e{};
+    bool sticky = false;
+    for (p += 2; _hex_value(at(p)) < 16; ++p) {
+      if (m >> 60) sticky |= _hex_value(at(p)) != 0, e += 4;
+      else m = m << 4 | _hex_value(at(p));
+    }
+    if (at(p) == '.') {
+      for (++p; _hex_value(at(p)) < 16; ++p) {
+        if (m >> 60) sticky |= _hex_value(at(p)) != 0;
+        else m = m << 4 | _hex_value(at(p)), e -= 4;
+      }
+    }
+    if ((at(p) | 0x20) == 'p') exponent(e);
+    bits = m == 0 ? 0 : _float_round<F>(m, e, sticky);
+  } else {
+    _float_digits<Ct> d{p, p, p, p, 0};
+    while (digit(p)) ++p;
+    d.int_last = d.frac_first = d.frac_last = p;
+    if (at(p) == '.') {
+      for (d.frac_first = ++p; digit(p);) ++p;
+      d.frac_last = p;
+    }
+    if (d.int_first == d.int_last && d.frac_first == d.frac_last) return 0;
+    if ((at(p) | 0x20) == 'e') exponent(d.exp10);
+    nat8 w{};
+    nat count{};
+    int8 q = d.exp10 + (d.int_last - d.int_first);
+    bool truncated = false;
+    auto scan = [&](const Ct* i, const Ct* const End) noexcept {
+      for (; i != End && !truncated; ++i)
+        if (const nat4 x = at(i) - '0'; count == 19) truncated = x != 0;
+        else if (--q, w != 0 || x != 0) w = w * 10 + x, ++count;
+    };
+    scan(d.int_first, d.int_last), scan(d.frac_first, d.frac_last);
+    if (w == 0) bits = 0;
+    else if (!truncated && -(f8 ? 22 : 10) <= q && q <= (f8 ? 22 : 10) && w <= nat8(1) << (mbits + 1)) {
+      const F x = F(w), t = F(_pow10_fat8[q < 0 ? -q : q]);
+      bits = _float_bits(q < 0 ? x / t : x * t);
+    } else {
+      bool sure{}, sure1{};
+      bits = _eisel_lemire<F>(w, q, sure);
+      if (truncated && sure) sure = _eisel_lemire<F>(w + 1, q, sure1) == bits && sure1;
+      if (!sure) bits = _float_fallback<F>(bits, d);
+    }
+  }
+  v = _float_from_bits<F>(sign | bits);
+  return nat(p - First);
+}
+
+/// parses a floating-point number after skipping characters which do not start a number
+/// \note "inf" and "nan" are taken only as whole words, so that those in words such as "info" are skipped.
+template<floating_point F, typename Ct> constexpr F _stof(StringView<Ct>& s) noexcept {
+  auto at = [&](const nat i) noexcept -> nat4 { return i < s.size() ? nat4(bitcast<makenat<Ct>>(s[i])) : 0; };
+  auto alnum = [](const nat4 c) noexcept { return c - '0' < 10 || (c | 0x20) - 'a' < 26; };
+  nat4 prev{};
+  for (F v{}; !s.empty(); prev = at(0), s.remove_prefix(1)) {
+    const nat4 c = at(0), k = (c == '-' || c == '+' ? at(1) : c) | 0x20;
+    const bool word = k == 'i' || k == 'n';
+    if (!(c - '0' < 10 || c == '-' || c == '+' || c == '.' || word) || (word && alnum(prev))) continue;
+    if (const nat n = _parse_float(s.data(), s.data() + s.size(), v); n && !(word && alnum(at(n)))) return s.remove_prefix(n), v;
+  }
+  return {};
 }
 
 }
@@ -2706,20 +3634,20 @@ template<typename Ct> constexpr fat8 _stof(StringView<Ct>& s) noexcept {
 /// \param s string to convert
 /// \return converted value
 /// \note if `s` is the lvalue reference to a `StringView`, it represents the rest part not used to convert
+/// \note Integers saturate on overflow; all of their digits are consumed.
+/// \note Floating-point values are correctly rounded and may be hexadecimal, "inf" or "nan" as in `std::strtod`;
+///       "inf" and "nan" are taken only as whole words, not as parts of words such as "info" or "banana".
 template<arithmetic T> inline constexpr auto stov = []<stringable St>(St&& s) noexcept -> T {
-  std::cout << typeid(St).name() << std::endl;
-  std::cout << typeid(StringView<iter_value<decltype(s)>>&).name() << std::endl;
+  using F = select_type<(sizeof(T) <= 4), fat4, fat8>;
   if constexpr (same_as<St, StringView<iter_value<decltype(s)>>&>) {
-    std::cout << "A" << std::endl;
-    if constexpr (floating_point<T>) return T(_::_stof(s));
-    else if constexpr (std::signed_integral<T>) return T(_::_stoi(s));
-    else if constexpr (std::unsigned_integral<T>) return T(_::_ston(s));
+    if constexpr (floating_point<T>) return T(_::_stof<F>(s));
+    else if constexpr (std::signed_integral<T>) return _::_stoi<T>(s);
+    else if constexpr (std::unsigned_integral<T>) return _::_ston<T>(s);
   } else {
-    std::cout << "B" << std::endl;
     StringView<iter_value<remove_ref<decltype(s)>>> t(s);
-    if constexpr (floating_point<T>) return T(_::_stof(t));
-    else if constexpr (std::signed_integral<T>) return T(_::_stoi(t));
-    else if constexpr (std::unsigned_integral<T>) return T(_::_ston(t));
+    if constexpr (floating_point<T>) return T(_::_stof<F>(t));
+    else if constexpr (std::signed_integral<T>) return _::_stoi<T>(t);
+    else if constexpr (std::unsigned_integral<T>) return _::_ston<T>(t);
   }
 };
 
@@ -2732,135 +3660,210 @@ inline constexpr auto ston = stov<nat8>;
 /// converts a string to a floating point value
 inline constexpr auto stof = stov<fat8>;
 
+/// enum to represent the notation of floating-point values
+enum class FloatFormat {
+  GENERAL,    // fixed if the decimal exponent is in [-4..6), otherwise scientific; like `%g`
+  FIXED,      // without exponent; like `%f`
+  SCIENTIFIC, // one digit before the point and an exponent of at least 2 digits; like `%e`
+};
+
+/// number of characters enough for `yw::ftos_to` to write any value of `T` in any notation
+template<floating_point T> inline constexpr nat FTOS_CAPACITY = sizeof(T) <= 4 ? 64 : 352;
+
 namespace _ {
-template<character Ct> constexpr String<Ct> _ntos(nat8 v) noexcept {
-  if (v == 0) return String<Ct>(1, Ct('0'));
-  Ct temp[20];
-  nat it = 20;
-  for (; v != 0; v /= 10) temp[--it] = Ct(v % 10 + '0');
-  return String<Ct>(temp + it, 20 - it);
-}
-template<character Ct> constexpr String<Ct> _itos(int8 v) noexcept {
-  if (v == 0) return String<Ct>(1, Ct('0'));
-  const bool neg = v < 0;
-  Ct temp[20];
-  nat it = 20;
-  for (; v != 0; v /= 10) temp[--it] = Ct(v % 10 + '0');
-  if (neg) temp[--it] = Ct('-');
-  return String<Ct>(temp + it, 20 - it);
-}
-constexpr fat8 _ftos_log10(fat8 v) noexcept {
-  int8 t = bitcast<int8>(v);
-  int8 exp = ((t & 0x7ff0000000000000) >> 52) - 1023;
-  t = (t & 0x000fffffffffffff) | 0x3ff0000000000000;
-  return exp * log10_2 - 0.652998017485824 + [&](const fat8 x) noexcept {
-    return x * (0.924793176223418 - 0.319987904734089 * x + 0.0480424904500012 * x * x); }(bitcast<fat8>(t));
-}
-template<character Ct> constexpr String<Ct> _ftos(fat8 v) noexcept {
-  if (v == 0) return String<Ct>(Array{Ct('0'), Ct('.'), Ct('0')});
-  else if (v != v) return String<Ct>(Array{Ct('n'), Ct('a'), Ct('n')});
-  else if (v == yw::inf) return String<Ct>(Array{Ct('i'), Ct('n'), Ct('f')});
-  else if (v == -yw::inf) return String<Ct>(Array{Ct('-'), Ct('i'), Ct('n'), Ct('f')});
-  Ct temp[32]{};
-  const bool neg = v < 0;
-  if (neg) v = -v;
-  int8 exp = int8(_ftos_log10(v)), count{};
-  exp += v < 1 ? -1 : 0;
-  if (exp < -3) {
-    nat mask = 1;
-    for (int8 i = exp; i < 0; ++i) v *= 10;
-    for (int8 i = 0; i < 15; ++i) v *= 10, mask *= 10;
-    nat vv = static_cast<nat>(v), ii{};
-    if (neg) temp[ii++] = Ct('-');
-    temp[ii++] = Ct(vv / mask + '0');
-    vv %= mask, mask /= 10;
-    temp[ii++] = Ct('.');
-    for (int8 i{}; i < 16 && vv != 0; ++i) {
-      if (count == 6) ii -= 6;
-      auto cc = vv / mask;
-      count = cc == 0 ? count + 1 : 0;
-      if (count == 3) return String<Ct>(temp, ii - 6);
-      temp[ii++] = Ct(cc + '0'), vv %= mask, mask /= 10;
-    }
-    temp[ii++] = Ct('e');
-    temp[ii++] = Ct('-');
-    exp = -exp;
-    temp[ii++] = Ct(exp / 100 + '0');
-    exp %= 100;
-    temp[ii++] = Ct(exp / 10 + '0');
-    temp[ii++] = Ct(exp % 10 + '0');
-    return String<Ct>(temp, ii);
-  } else if (exp < 0) {
-    nat mask = 1;
-    for (int8 i{}; i < 15; ++i) mask *= 10;
-    for (int8 i{15 - exp}; i > 0; --i) v *= 10;
-    nat vv = static_cast<nat>(v), ii{};
-    if (neg) temp[ii++] = Ct('-');
-    temp[ii++] = Ct('0');
-    temp[ii++] = Ct('.');
-    for (int8 i{exp + 1}; i < 0; ++i) temp[ii++] = Ct('0');
-    for (; vv != 0; vv %= mask, mask /= 10) {
-      auto cc = vv / mask;
-      count = cc == 0 ? count + 1 : 0;
-      if (count == 3) return String<Ct>(temp, ii - 6);
-      temp[ii++] = Ct(cc + '0');
-    }
-    return String<Ct>(temp, ii);
-  } else if (exp < 16) {
-    nat mask = 1;
-    for (int8 i{}; i < 15; ++i) mask *= 10;
-    for (int8 i{}, end = 15 - exp; i < end; ++i) v *= 10;
-    nat vv = static_cast<nat>(v), ii{};
-    if (neg) temp[ii++] = Ct('-');
-    bool dot = false;
-    for (int8 i{}; i < 16 && vv != 0; ++i) {
-      if (!dot && i > exp) temp[ii++] = Ct('.'), dot = true;
-      auto cc = vv / mask;
-      if (dot) {
-        count = cc == 0 ? count + 1 : 0;
-        if (count == 3) return String<Ct>(temp, ii - 6);
+/// pairs of digits from "00" to "99"
+inline constexpr cat1 _digit_pairs[201] =
+  "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+  "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+/// returns the number of decimal digits of `v`; 1 for 0
+constexpr nat _dec_length(const nat8 v) noexcept {
+  const nat n = (nat(std::bit_width(v | 1)) * 1233) >> 12;
+  return n + 1 - ((v | 1) < _pow10_nat[n]);
+}
+
+/// writes the last `n` decimal digits of `v` to `[p..p + n)`
+template<character Ct, typename U> constexpr void _write_digits(Ct* p, U v, nat n) noexcept {
+  for (; n >= 2; n -= 2, v /= 100) p[n - 1] = Ct(_digit_pairs[v % 100 * 2 + 1]), p[n - 2] = Ct(_digit_pairs[v % 100 * 2]);
+  if (n) p[0] = Ct('0' + v % 10);
+}
+
+/// writes `n` lowercase hexadecimal digits of `v` to `[p..p + n)`
+template<character Ct> constexpr void _write_hex(Ct* p, nat8 v, nat n) noexcept {
+  for (; n > 0; v >>= 4) p[--n] = Ct("0123456789abcdef"[v & 15]);
+}
+
+/// writes an unsigned integer; the upper digits of 64-bit values are split off to use 32-bit divisions
+template<character Ct> constexpr Ct* _ntos_to(Ct* p, const nat8 v) noexcept {
+  const nat n = _dec_length(v);
+  if (v >> 32) {
+    const nat8 hi = v / 100000000;
+    _write_digits(p, hi, n - 8), _write_digits(p + n - 8, nat4(v - hi * 100000000), 8);
+  } else _write_digits(p, nat4(v), n);
+  return p + n;
+}
+
+/// writes a signed integer
+template<character Ct> constexpr Ct* _itos_to(Ct* p, const int8 v) noexcept {
+  if (v < 0) *p++ = Ct('-');
+  return _ntos_to(p, v < 0 ? 0 - nat8(v) : nat8(v));
+}
+
+/// decimal `m * 10^e`
+struct _decimal {
+  nat8 m;
+  int4 e;
+};
+
+/// returns the shortest decimal that rounds to `c * 2^q`, closest to it on ties, without trailing zeros
+/// \note This is the Schubfach algorithm; the bounds of the rounding interval are computed with
+///       128-bit (`fat8`) or 64-bit (`fat4`) approximations of the powers of ten rounded up.
+template<floating_point F> constexpr _decimal _shortest(const nat8 c, const int4 q, const bool Closer) noexcept {
+  constexpr int4 mbits = sizeof(F) == 8 ? 52 : 23;
+  _decimal d{};
+  if (-mbits <= q && q <= 0 && (c & ((nat8(1) << -q) - 1)) == 0) d = {c >> -q, 0};
+  else {
+    const int4 k = (q * 1262611 - (Closer ? 524031 : 0)) >> 22, h = q + ((-k * 1741647) >> 19) + 1;
+    const nat8* g = _pow10_table[-k - _POW10_MIN];
+    auto round_to_odd = [g](const nat8 cp) noexcept -> nat8 {
+      if constexpr (sizeof(F) == 8) {
+        const nat8 g0 = g[1] + 1, g1 = g[0] + (g0 == 0);
+        nat8 xh{}, yh{};
+        _mul128(g0, cp, xh);
+        const nat8 yl = _mul128(g1, cp, yh) + xh;
+        return (yh + (yl < xh)) | (yl > 1);
+      } else {
+        const nat8 g1 = g[0] + 1, lo = (g1 & 0xffffffff) * cp, hi = (g1 >> 32) * cp + (lo >> 32);
+        return (hi >> 32) | ((hi & 0xffffffff) > 1);
       }
-      temp[ii++] = Ct(cc + '0');
-      vv %= mask;
-      mask /= 10;
-    }
-    return String<Ct>(temp, ii);
-  } else {
-    nat mask = 1;
-    for (int8 i{}; i < 15; ++i) mask *= 10;
-    for (int8 i{}, end = exp - 15; i < end; ++i) v /= 10;
-    nat vv = static_cast<nat>(v), ii{};
-    if (neg) temp[ii++] = Ct('-');
-    temp[ii++] = Ct(vv / mask + '0');
-    vv %= mask, mask /= 10;
-    temp[ii++] = Ct('.');
-    for (int8 i{}; i < 15 && vv != 0; ++i) {
-      if (count == 6) ii -= 6;
-      auto cc = vv / mask;
-      count = cc == 0 ? count + 1 : 0;
-      if (count == 3) return String<Ct>(temp, ii - 6);
-      temp[ii++] = Ct(cc + '0'), vv %= mask, mask /= 10;
+    };
+    const nat8 vbl = round_to_odd((4 * c - 2 + Closer) << h), vb = round_to_odd(4 * c << h), vbr = round_to_odd((4 * c + 2) << h);
+    const nat8 lower = vbl + (c & 1), upper = vbr - (c & 1), s = vb / 4;
+    const bool u = lower <= 4 * s, w = 4 * s + 4 <= upper;
+    if (const nat8 t = s / 10; s >= 10 && (lower <= 40 * t) != (40 * t + 40 <= upper)) d = {t + (40 * t + 40 <= upper), k + 1};
+    else if (u != w) d = {s + w, k};
+    else d = {s + (vb > 4 * s + 2 || (vb == 4 * s + 2 && (s & 1))), k};
+  }
+  while (d.m % 10 == 0) d.m /= 10, ++d.e;
+  return d;
+}
+
+/// writes the integer `c * 2^q` for `q > 0` exactly, with base-10^9 big-integer arithmetic
+template<character Ct> constexpr Ct* _write_exact(Ct* p, const nat8 c, int4 q) noexcept {
+  nat4 d[36]{nat4(c % 1000000000), nat4(c / 1000000000)};
+  nat n = 2;
+  for (; q > 0; q -= 32) {
+    const int4 s = std::min(q, 32);
+    nat8 carry{};
+    for (nat i{}; i < n; ++i) {
+      const nat8 t = (nat8(d[i]) << s) + carry;
+      d[i] = nat4(t % 1000000000), carry = t / 1000000000;
     }
-    temp[ii++] = Ct('e');
-    temp[ii++] = Ct('+');
-    temp[ii++] = Ct(exp / 100 + '0');
-    exp %= 100;
-    temp[ii++] = Ct(exp / 10 + '0');
-    temp[ii++] = Ct(exp % 10 + '0');
-    return String<Ct>(temp, ii);
+    for (; carry != 0; carry /= 1000000000) d[n++] = nat4(carry % 1000000000);
   }
+  while (n > 1 && d[n - 1] == 0) --n;
+  const nat l = _dec_length(d[n - 1]);
+  _write_digits(p, d[n - 1], l), p += l;
+  for (nat i = n - 1; i-- > 0; p += 9) _write_digits(p, d[i], 9);
+  return p;
 }
+
+/// writes `m * 10^e` in the notation
+template<character Ct> constexpr Ct* _write_decimal(Ct* p, const nat8 m, const int4 e, const FloatFormat Format) noexcept {
+  const nat n = _dec_length(m);
+  const int4 x = e + int4(n) - 1;
+  if (Format == FloatFormat::SCIENTIFIC || (Format == FloatFormat::GENERAL && (x < -4 || x >= 6))) {
+    _write_digits(p + 1, m, n);
+    p[0] = p[1];
+    if (n > 1) p[1] = Ct('.'), p += n + 1;
+    else ++p;
+    *p++ = Ct('e'), *p++ = Ct(x < 0 ? '-' : '+');
+    const nat a = nat(x < 0 ? -x : x);
+    if (a >= 100) *p++ = Ct('0' + a / 100);
+    _write_digits(p, a % 100, 2);
+    return p + 2;
+  } else if (e >= 0) {
+    _write_digits(p, m, n), p += n;
+    for (int4 i{}; i < e; ++i) *p++ = Ct('0');
+    return p;
+  } else if (x >= 0) {
+    _write_digits(p + 1, m, n);
+    for (int4 i{}; i <= x; ++i) p[i] = p[i + 1];
+    p[x + 1] = Ct('.');
+    return p + n + 1;
+  }
+  *p++ = Ct('0'), *p++ = Ct('.');
+  for (int4 i = -1; i > x; --i) *p++ = Ct('0');
+  _write_digits(p, m, n);
+  return p + n;
+}
+}
+
+/// writes the shortest decimal representation of a floating-point value which reads back to the same value
+/// \param Out (out) buffer of at least `FTOS_CAPACITY<T>` characters
+/// \param Value value to convert; `fat4` is formatted as `fat4`, and others as `fat8`
+/// \param Format notation; same as `std::to_chars` with `std::chars_format::general`, `fixed` or `scientific`
+/// \return pointer past the last character written
+/// \note Infinity and NaN are written as "inf" and "nan"; integers above 2^53 are written exactly in `FIXED`.
+template<character Ct, floating_point T>
+constexpr Ct* ftos_to(Ct* Out, const T Value, const FloatFormat Format = FloatFormat::GENERAL) noexcept {
+  using F = select_type<(sizeof(T) <= 4), fat4, fat8>;
+  constexpr nat8 mbits = sizeof(F) == 8 ? 52 : 23, emax = sizeof(F) == 8 ? 0x7ff : 0xff;
+  const nat8 bits = _::_float_bits(F(Value)), f = bits & ((nat8(1) << mbits) - 1), x = (bits >> mbits) & emax;
+  if (bits >> (sizeof(F) * 8 - 1)) *Out++ = Ct('-');
+  if (x == emax) {
+    const cat1* s = f ? "nan" : "inf";
+    for (nat i{}; i < 3; ++i) *Out++ = Ct(s[i]);
+    return Out;
+  } else if (x == 0 && f == 0) {
+    *Out++ = Ct('0');
+    if (Format == FloatFormat::SCIENTIFIC) for (nat i{}; i < 4; ++i) *Out++ = Ct("e+00"[i]);
+    return Out;
+  }
+  nat8 c{};
+  int4 q{};
+  const bool closer = _::_float_split<F>(bits, c, q);
+  if (Format == FloatFormat::FIXED && q > 0) return _::_write_exact(Out, c, q);
+  const auto d = _::_shortest<F>(c, q, closer);
+  return _::_write_decimal(Out, d.m, d.e, Format);
+}
+
+/// number of characters enough for `yw::vtos_to` to write any value of `T`
+template<arithmetic T> inline constexpr nat VTOS_CAPACITY = [] {
+  if constexpr (floating_point<T>) return FTOS_CAPACITY<T>;
+  else return nat(std::numeric_limits<T>::digits10 + 2);
+}();
+
+/// writes a value in decimal without allocation
+/// \param Out (out) buffer of at least `VTOS_CAPACITY<T>` characters
+/// \param Value value to write; floating-point values are written by `yw::ftos_to` in `FloatFormat::GENERAL`
+/// \return pointer past the last character written
+template<character Ct, arithmetic T> constexpr Ct* vtos_to(Ct* Out, const T Value) noexcept {
+  if constexpr (floating_point<T>) return ftos_to(Out, Value);
+  else if constexpr (std::signed_integral<T>) return _::_itos_to(Out, int8(Value));
+  else return _::_ntos_to(Out, nat8(Value));
+}
+
+/// writes a value in decimal into a span
+/// \return number of characters written, or 0 if `Out` is too short
+template<character Ct, arithmetic T> constexpr nat vtos_to(std::span<Ct> Out, const T Value) noexcept {
+  if (Out.size() >= VTOS_CAPACITY<T>) return nat(vtos_to(Out.data(), Value) - Out.data());
+  Ct temp[VTOS_CAPACITY<T>]{};
+  const nat n = nat(vtos_to(temp, Value) - temp);
+  if (n > Out.size()) return 0;
+  std::ranges::copy_n(temp, n, Out.begin());
+  return n;
 }
 
 /// converts a value to a string
 /// \tparam Ct character type of the string
 /// \param v value to convert
 /// \return converted string
+/// \note The characters are those of `yw::vtos_to`.
 template<character Ct> inline constexpr auto vtos =
   []<arithmetic T>(const T v) noexcept -> String<Ct> {
-  if constexpr (floating_point<T>) return _::_ftos<Ct>(v);
-  else if constexpr (std::signed_integral<T>) return _::_itos<Ct>(v);
-  else if constexpr (std::unsigned_integral<T>) return _::_ntos<Ct>(v);
+  Ct temp[VTOS_CAPACITY<T>]{};
+  return String<Ct>(temp, vtos_to(temp, v));
 };
 
 } // namespace yw
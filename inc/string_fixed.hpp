@@ -0,0 +1,130 @@
+/// \file string_fixed.hpp
+/// \brief defines `yw::FixedString` usable as a template argument
+
+#pragma once
+
+#ifndef YWLIB
+#include <compare>
+#include <string_view>
+#else
+import std;
+#endif
+
+#include "string.hpp"
+
+export namespace yw {
+
+
+/// returns the 64-bit FNV-1a hash of a string, taking each character as a whole
+/// \note The value is the same as `FixedString::hash` of the same characters.
+inline constexpr auto string_hash = []<stringable St>(St&& Str) noexcept -> nat {
+  nat h = 0xcbf29ce484222325;
+  for (auto c : StringView<iter_value<remove_ref<St>>>(Str)) h = (h ^ nat(bitcast<makenat<decltype(c)>>(c))) * 0x100000001b3;
+  return h;
+};
+
+
+/// class to represent a string of fixed capacity, usable as a template argument
+/// \tparam Ct character type
+/// \tparam N capacity in characters, excluding the terminating null
+/// \note All members are public so that the type is structural; characters past the length are null.
+template<character Ct, nat N> struct FixedString {
+
+  /// characters followed by nulls
+  Ct array[N + 1]{};
+
+  /// length of the string
+  nat count{};
+
+  /// default constructor; empty string
+  constexpr FixedString() noexcept = default;
+
+  /// constructor from a string literal
+  constexpr FixedString(const Ct (&Str)[N + 1]) noexcept : count(N) {
+    for (nat i{}; i < N; ++i) array[i] = Str[i];
+  }
+
+  /// constructor from a string view; characters beyond the capacity are dropped
+  constexpr explicit FixedString(const StringView<Ct> Str) noexcept : count(Str.size() < N ? Str.size() : N) {
+    for (nat i{}; i < count; ++i) array[i] = Str[i];
+  }
+
+  /// returns the length of the string
+  constexpr nat size() const noexcept { return count; }
+
+  /// returns the capacity of the string
+  static constexpr nat capacity() noexcept { return N; }
+
+  /// checks if the string is empty
+  constexpr bool empty() const noexcept { return count == 0; }
+
+  /// returns a pointer to the null-terminated characters
+  constexpr const Ct* data() const noexcept { return array; }
+
+  /// returns a pointer to the null-terminated characters
+  constexpr const Ct* c_str() const noexcept { return array; }
+
+  /// returns an iterator to the first character
+  constexpr const Ct* begin() const noexcept { return array; }
+
+  /// returns an iterator past the last character
+  constexpr const Ct* end() const noexcept { return array + count; }
+
+  /// index operator to access the character at index `I`
+  constexpr const Ct& operator[](const nat I) const noexcept { return array[I]; }
+
+  /// returns the string as a string view
+  constexpr StringView<Ct> view() const noexcept { return {array, count}; }
+
+  /// conversion operator to string view
+  constexpr operator StringView<Ct>() const noexcept { return view(); }
+
+  /// returns the 64-bit FNV-1a hash of the string; the same as `yw::string_hash`
+  constexpr nat hash() const noexcept { return string_hash(view()); }
+
+  /// returns a string with the characters of `Str` appended; the capacity is the sum of both
+  template<nat M> constexpr FixedString<Ct, N + M> operator+(const FixedString<Ct, M>& Str) const noexcept {
+    FixedString<Ct, N + M> s;
+    for (nat i{}; i < count; ++i) s.array[i] = array[i];
+    for (nat i{}; i < Str.count; ++i) s.array[count + i] = Str.array[i];
+    return s.count = count + Str.count, s;
+  }
+
+  /// returns a string with a string literal appended
+  template<nat M> constexpr FixedString<Ct, N + M - 1> operator+(const Ct (&Str)[M]) const noexcept {
+    return *this + FixedString<Ct, M - 1>(Str);
+  }
+
+  /// returns a string literal followed by a string
+  template<nat M> friend constexpr FixedString<Ct, M - 1 + N> operator+(const Ct (&l)[M], const FixedString& r) noexcept {
+    return FixedString<Ct, M - 1>(l) + r;
+  }
+
+  /// equality operator; compares the characters
+  template<nat M> constexpr bool operator==(const FixedString<Ct, M>& Str) const noexcept { return view() == Str.view(); }
+
+  /// equality operator with a string view
+  constexpr bool operator==(const StringView<Ct> Str) const noexcept { return view() == Str; }
+
+  /// three-way comparison operator; compares the characters lexicographically
+  template<nat M> constexpr auto operator<=>(const FixedString<Ct, M>& Str) const noexcept { return view() <=> Str.view(); }
+
+  /// three-way comparison operator with a string view
+  constexpr auto operator<=>(const StringView<Ct> Str) const noexcept { return view() <=> Str; }
+};
+
+template<character Ct, nat N> FixedString(const Ct (&)[N]) -> FixedString<Ct, N - 1>;
+
+
+/// returns the index of the first key equal to a string, or `npos` if none
+/// \tparam Keys keys to look up; compared by hash first
+/// \note e.g. `switch (string_index<"add", "sub">(s)) { case 0: ...; case 1: ...; default: ... }`
+template<FixedString... Keys> inline constexpr auto string_index = []<stringable St>(St&& Str) noexcept -> nat {
+  const StringView<iter_value<remove_ref<St>>> s(Str);
+  const nat h = string_hash(s);
+  nat i{};
+  (void)((h == constant<Keys.hash()>::value && s == Keys.view() ? false : (++i, true)) && ...);
+  return i < sizeof...(Keys) ? i : npos;
+};
+
+} // namespace yw
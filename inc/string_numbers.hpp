@@ -0,0 +1,163 @@
+/// \file string_numbers.hpp
+/// \brief defines `yw::parse_numbers` to parse delimited numeric text concurrently
+
+#pragma once
+
+#ifndef YWLIB
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "array.hpp"
+#include "parallel.hpp"
+#include "string.hpp"
+
+export namespace yw {
+
+
+/// approximate number of characters parsed by a thread at once in `yw::parse_numbers`
+inline constexpr nat PARSE_CHUNK = nat(1) << 20;
+
+/// struct to represent the result of `yw::parse_numbers`
+struct NumberParse {
+  nat count{};  // number of values appended
+  nat line{};   // 1-based line of the first error, or 0 if succeeded
+  nat column{}; // 1-based column of the first error in characters, or 0 if succeeded
+
+  /// checks if no error has occurred
+  explicit operator bool() const noexcept { return line == 0; }
+};
+
+} // namespace yw
+
+
+namespace yw::_ {
+
+/// checks if a character separates numbers
+template<character Ct> constexpr bool _is_number_delimiter(const Ct c) noexcept {
+  return c == Ct(' ') || c == Ct('\t') || c == Ct('\r') || c == Ct('\n') || c == Ct(',');
+}
+
+/// parses a number at `p`
+/// \return end of the number, or `nullptr` if no number is found or the value is out of the range of `T`
+template<arithmetic T, character Ct> constexpr const Ct* _parse_number(const Ct* p, const Ct* const Last, T& v) noexcept {
+  if constexpr (floating_point<T>) {
+    select_type<(sizeof(T) <= 4), fat4, fat8> x{};
+    const nat n = _parse_float(p, Last, x);
+    return v = T(x), n == 0 ? nullptr : p + n;
+  } else {
+    const bool neg = *p == Ct('-');
+    if (neg || *p == Ct('+')) ++p;
+    if (p == Last || !is_digit(*p)) return nullptr;
+    nat8 u{};
+    if (!_parse_digits(p, Last, u)) return nullptr;
+    if constexpr (std::signed_integral<T>) {
+      if (u > nat8(std::numeric_limits<T>::max()) + neg) return nullptr;
+      return v = neg ? T(0 - u) : T(u), p;
+    } else {
+      if (neg ? u != 0 : u > nat8(std::numeric_limits<T>::max())) return nullptr;
+      return v = T(u), p;
+    }
+  }
+}
+
+/// result of a chunk of `_parse_numbers`
+template<typename T> struct _number_chunk {
+  std::vector<T> values{}; // values of the chunk; those after an error are discarded
+  nat lines{};             // number of line breaks before the end or the error
+  nat column{};            // 1-based column of the error, or 0 if none
+};
+
+/// parses a chunk of numbers
+/// \param Fields number of values per line, or 0 if lines are not checked
+/// \note On error, only the values of complete lines are kept if `Fields` is not 0.
+template<arithmetic T, character Ct>
+void _parse_number_chunk(const Ct* p, const Ct* const Last, const nat Fields, _number_chunk<T>& r) {
+  const Ct* line = p;
+  nat fields{}, done{};
+  auto fail = [&](const Ct* at) {
+    r.column = nat(at - line) + 1;
+    if (Fields != 0) r.values.resize(done);
+  };
+  r.values.reserve(nat(Last - p) / 8);
+  while (true) {
+    while (p != Last && *p != Ct('\n') && _is_number_delimiter(*p)) ++p;
+    if (p == Last || *p == Ct('\n')) {
+      if (Fields != 0 && fields != 0 && fields != Fields) return fail(p);
+      done = r.values.size(), fields = 0;
+      if (p == Last) return;
+      ++r.lines, line = ++p;
+      continue;
+    }
+    if (Fields != 0 && fields == Fields) return fail(p);
+    T v{};
+    const Ct* e = _parse_number(p, Last, v);
+    if (e == nullptr || (e != Last && !_is_number_delimiter(*e))) return fail(p);
+    r.values.push_back(v), ++fields, p = e;
+  }
+}
+
+/// splits a text at line breaks and parses the chunks concurrently
+/// \param Append function to be called with the values of each chunk in order until the first error
+template<arithmetic T, character Ct, typename Fn>
+NumberParse _parse_numbers(const StringView<Ct> Text, const nat Fields, Fn&& Append) {
+  const Ct* const first = Text.data();
+  const Ct* const last = first + Text.size();
+  std::vector<const Ct*> bounds{first};
+  for (nat k = 1, n = std::max<nat>(Text.size() / PARSE_CHUNK, 1); k < n; ++k) {
+    const Ct* p = std::max(first + Text.size() * k / n, bounds.back());
+    if (p = std::find(p, last, Ct('\n')); p == last) break;
+    bounds.push_back(p + 1);
+  }
+  bounds.push_back(last);
+  std::vector<_number_chunk<T>> chunks(bounds.size() - 1);
+  parallel_for(chunks.size(), 1, [&](const nat i) { _parse_number_chunk(bounds[i], bounds[i + 1], Fields, chunks[i]); });
+  NumberParse r{};
+  for (nat i{}, lines{}; i < chunks.size(); ++i) {
+    auto& c = chunks[i];
+    Append(std::span<const T>(c.values));
+    r.count += c.values.size(), lines += c.lines;
+    if (c.column != 0) return r.line = lines + 1, r.column = c.column, r;
+    std::vector<T>().swap(c.values);
+  }
+  return r;
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+
+/// parses numbers separated by whitespace or commas and appends them to an array
+/// \param Text text to parse; chunks split at line breaks are parsed concurrently with `yw::parallel_for`
+/// \param Out (out) array to append the values to
+/// \return number of values appended, and the position of the first error if any
+/// \note Integers must be in the range of `T`; floating-point values follow the syntax of `yw::stov`.
+/// \note On error, the values before the error are appended.
+template<arithmetic T, stringable St> NumberParse parse_numbers(St&& Text, Array<T>& Out) {
+  const StringView<iter_value<remove_ref<St>>> s(Text);
+  return _::_parse_numbers<T>(s, 0, [&](std::span<const T> v) { Out.insert(Out.end(), v.begin(), v.end()); });
+}
+
+/// parses lines of numbers separated by whitespace or commas into columns
+/// \param Text text to parse; chunks split at line breaks are parsed concurrently with `yw::parallel_for`
+/// \param Columns (out) arrays to append the values to; the `k`-th value of each line goes to `Columns[k]`
+/// \return number of values appended, and the position of the first error if any
+/// \note Every non-empty line must have `Columns.size()` values; on error, the lines before the error are appended.
+/// \note If `Columns` is empty, nothing is parsed and the error is at line 1, column 1.
+template<arithmetic T, stringable St> NumberParse parse_numbers(St&& Text, std::span<Array<T>> Columns) {
+  if (Columns.empty()) return {0, 1, 1};
+  const StringView<iter_value<remove_ref<St>>> s(Text);
+  return _::_parse_numbers<T>(s, Columns.size(), [&](std::span<const T> v) {
+    const nat n = Columns.size(), rows = v.size() / n;
+    for (auto& c : Columns) c.reserve(c.size() + rows);
+    for (nat i{}; i < v.size(); ++i) Columns[i % n].push_back(v[i]);
+  });
+}
+
+} // namespace yw
@@ -0,0 +1,283 @@
+/// \file string_search.hpp
+/// \brief defines `yw::find`, `yw::rfind` and `yw::MultiSearcher` to search strings and bytes with SSE
+
+#pragma once
+
+#include <immintrin.h>
+
+#ifndef YWLIB
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+#else
+import std;
+#endif
+
+#include "string.hpp"
+
+
+namespace yw::_ {
+
+/// checks if `T` is a unit to search; a character or a byte
+template<typename T> concept _search_unit = character<T> || same_as<remove_cv<T>, nat1>;
+
+/// view of units to search; `StringView` for characters, or `std::span` for bytes
+template<typename T> struct _search_view : _type<std::span<const T>> {};
+template<character T> struct _search_view<T> : _type<StringView<T>> {};
+
+/// returns a vector whose units are all `c`
+template<typename T> inline __m128i _splat(const T c) noexcept {
+  if constexpr (sizeof(T) == 1) return _mm_set1_epi8(char(c));
+  else if constexpr (sizeof(T) == 2) return _mm_set1_epi16(short(c));
+  else return _mm_set1_epi32(int(c));
+}
+
+/// returns a bit per byte of the 32 bytes at `p`, set for the units equal to the units of `c`
+/// \note Only the lowest bit of the bits of each unit is kept.
+template<typename T> inline nat4 _match32(const T* const p, const __m128i c) noexcept {
+  const auto a = _loadu128(p), b = _loadu128(p + 16 / sizeof(T));
+  if constexpr (sizeof(T) == 1)
+    return nat4(_mm_movemask_epi8(_mm_cmpeq_epi8(a, c))) | nat4(_mm_movemask_epi8(_mm_cmpeq_epi8(b, c))) << 16;
+  else if constexpr (sizeof(T) == 2)
+    return (nat4(_mm_movemask_epi8(_mm_cmpeq_epi16(a, c))) | nat4(_mm_movemask_epi8(_mm_cmpeq_epi16(b, c))) << 16) & 0x55555555;
+  else
+    return (nat4(_mm_movemask_epi8(_mm_cmpeq_epi32(a, c))) | nat4(_mm_movemask_epi8(_mm_cmpeq_epi32(b, c))) << 16) & 0x11111111;
+}
+
+/// returns a bit per unit of the 16 units at `p`, set if the low byte of the unit may be in a set
+/// \param Lo bit masks of buckets indexed by the low nibble of the bytes in the set
+/// \param Hi bit masks of buckets indexed by the high nibble
+/// \note A byte is in the set if the masks of both nibbles share a bucket, as looked up with `pshufb`.
+template<typename T> inline nat4 _match_set16(const T* const p, const __m128i Lo, const __m128i Hi) noexcept {
+  __m128i v;
+  if constexpr (sizeof(T) == 1) v = _loadu128(p);
+  else if constexpr (sizeof(T) == 2) {
+    const auto m = _mm_set1_epi16(0xff);
+    v = _mm_packus_epi16(_mm_and_si128(_loadu128(p), m), _mm_and_si128(_loadu128(p + 8), m));
+  } else {
+    const auto m = _mm_set1_epi32(0xff);
+    v = _mm_packus_epi16(_mm_packus_epi32(_mm_and_si128(_loadu128(p), m), _mm_and_si128(_loadu128(p + 4), m)),
+                         _mm_packus_epi32(_mm_and_si128(_loadu128(p + 8), m), _mm_and_si128(_loadu128(p + 12), m)));
+  }
+  const auto f = _mm_set1_epi8(15);
+  const auto x = _mm_and_si128(_mm_shuffle_epi8(Lo, _mm_and_si128(v, f)), _mm_shuffle_epi8(Hi, _mm_and_si128(_mm_srli_epi16(v, 4), f)));
+  return nat4(_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_setzero_si128()))) ^ 0xffff;
+}
+
+/// returns the index of the first unit equal to `c` in `[p..p + n)`, or `npos`
+template<typename T> constexpr nat _find_unit(const T* const p, const nat n, const T c) noexcept {
+  constexpr nat k = 32 / sizeof(T);
+  nat i{};
+  if (!IS_CEV && n >= k) {
+    const auto v = _splat(c);
+    for (; i + k <= n; i += k) if (const nat4 m = _match32(p + i, v)) return i + std::countr_zero(m) / sizeof(T);
+    if (i == n) return npos;
+    if (const nat4 m = _match32(p + n - k, v)) return n - k + std::countr_zero(m) / sizeof(T);
+    return npos;
+  }
+  for (; i < n; ++i) if (p[i] == c) return i;
+  return npos;
+}
+
+/// returns the index of the last unit equal to `c` in `[p..p + n)`, or `npos`
+template<typename T> constexpr nat _rfind_unit(const T* const p, const nat n, const T c) noexcept {
+  constexpr nat k = 32 / sizeof(T);
+  nat i = n;
+  if (!IS_CEV && n >= k) {
+    const auto v = _splat(c);
+    for (; i >= k; i -= k) if (const nat4 m = _match32(p + i - k, v)) return i - k + (31 - std::countl_zero(m)) / sizeof(T);
+    if (i == 0) return npos;
+    if (const nat4 m = _match32(p, v)) return (31 - std::countl_zero(m)) / sizeof(T);
+    return npos;
+  }
+  while (i-- > 0) if (p[i] == c) return i;
+  return npos;
+}
+
+/// returns the index of the first occurrence of `[q..q + m)` in `[p..p + n)`, or `npos`
+/// \note Candidates are the positions where both the first and the last units match, 32 bytes at a time.
+template<typename T> constexpr nat _find_units(const T* const p, const nat n, const T* const q, const nat m) noexcept {
+  if (m == 0) return 0;
+  if (m > n) return npos;
+  if (m == 1) return _find_unit(p, n, q[0]);
+  constexpr nat k = 32 / sizeof(T);
+  nat i{};
+  if (!IS_CEV) {
+    const auto first = _splat(q[0]), last = _splat(q[m - 1]);
+    for (; i + k + m - 1 <= n; i += k)
+      for (nat4 b = _match32(p + i, first) & _match32(p + i + m - 1, last); b; b &= b - 1) {
+        const nat j = i + std::countr_zero(b) / sizeof(T);
+        if (std::memcmp(p + j + 1, q + 1, (m - 2) * sizeof(T)) == 0) return j;
+      }
+  }
+  const T* const r = std::search(p + i, p + n, q, q + m);
+  return r == p + n ? npos : nat(r - p);
+}
+
+/// returns the index of the last occurrence of `[q..q + m)` in `[p..p + n)`, or `npos`
+template<typename T> constexpr nat _rfind_units(const T* const p, const nat n, const T* const q, const nat m) noexcept {
+  if (m == 0) return n;
+  if (m > n) return npos;
+  if (m == 1) return _rfind_unit(p, n, q[0]);
+  constexpr nat k = 32 / sizeof(T);
+  nat s = n - m + 1;
+  if (!IS_CEV) {
+    const auto first = _splat(q[0]), last = _splat(q[m - 1]);
+    for (; s >= k; s -= k)
+      for (nat4 b = _match32(p + s - k, first) & _match32(p + s - k + m - 1, last); b; b &= ~(nat4(1) << (31 - std::countl_zero(b)))) {
+        const nat j = s - k + (31 - std::countl_zero(b)) / sizeof(T);
+        if (std::memcmp(p + j + 1, q + 1, (m - 2) * sizeof(T)) == 0) return j;
+      }
+  }
+  const T* const r = std::find_end(p, p + s + m - 1, q, q + m);
+  return r == p + s + m - 1 ? npos : nat(r - p);
+}
+
+} ////////////////////////////////////////////////////////////////////////////// namespace yw::_
+
+
+export namespace yw {
+
+
+/// returns the index of the first occurrence of a character or a string, or `npos`
+/// \note Strings of every character type and byte spans are searched 32 bytes at a time with SSE.
+inline constexpr Overload find{
+  []<stringable St>(St&& Text, const iter_value<remove_ref<St>> Char) noexcept -> nat {
+    const StringView<iter_value<remove_ref<St>>> s(Text);
+    return _::_find_unit(s.data(), s.size(), Char);
+  },
+  []<stringable St, stringable<iter_value<remove_ref<St>>> Sn>(St&& Text, Sn&& Needle) noexcept -> nat {
+    const StringView<iter_value<remove_ref<St>>> s(Text), t(Needle);
+    return _::_find_units(s.data(), s.size(), t.data(), t.size());
+  },
+  [](const std::span<const nat1> Bytes, const nat1 Byte) noexcept -> nat {
+    return _::_find_unit(Bytes.data(), Bytes.size(), Byte);
+  },
+  [](const std::span<const nat1> Bytes, const std::span<const nat1> Needle) noexcept -> nat {
+    return _::_find_units(Bytes.data(), Bytes.size(), Needle.data(), Needle.size());
+  }};
+
+/// returns the index of the last occurrence of a character or a string, or `npos`
+/// \note An empty string is found at the end, as in `std::basic_string_view::rfind`.
+inline constexpr Overload rfind{
+  []<stringable St>(St&& Text, const iter_value<remove_ref<St>> Char) noexcept -> nat {
+    const StringView<iter_value<remove_ref<St>>> s(Text);
+    return _::_rfind_unit(s.data(), s.size(), Char);
+  },
+  []<stringable St, stringable<iter_value<remove_ref<St>>> Sn>(St&& Text, Sn&& Needle) noexcept -> nat {
+    const StringView<iter_value<remove_ref<St>>> s(Text), t(Needle);
+    return _::_rfind_units(s.data(), s.size(), t.data(), t.size());
+  },
+  [](const std::span<const nat1> Bytes, const nat1 Byte) noexcept -> nat {
+    return _::_rfind_unit(Bytes.data(), Bytes.size(), Byte);
+  },
+  [](const std::span<const nat1> Bytes, const std::span<const nat1> Needle) noexcept -> nat {
+    return _::_rfind_units(Bytes.data(), Bytes.size(), Needle.data(), Needle.size());
+  }};
+
+
+/// class to search a text for any of several patterns at once
+/// \tparam T character type, or `nat1` to search bytes
+/// \note Positions are filtered by the first units of the patterns with SSE; up to 4 distinct first units are
+///       compared directly 32 bytes at a time, and more are looked up by the nibbles of their low bytes.
+template<typename T> requires _::_search_unit<T> class MultiSearcher {
+public:
+
+  /// type of patterns and texts; `StringView<T>`, or `std::span<const nat1>` for bytes
+  using view_type = typename _::_search_view<T>::type;
+
+  /// struct to represent a match
+  struct Match {
+    nat position = npos; // index of the first unit of the match, or `npos` if not found
+    nat pattern = npos;  // index of the pattern matched, or `npos` if not found
+
+    /// checks if a pattern is found
+    explicit operator bool() const noexcept { return position != npos; }
+  };
+
+protected:
+  std::vector<T> _units{};     // patterns concatenated
+  std::vector<nat> _bounds{0}; // pattern `i` is `_units[_bounds[i].._bounds[i + 1])`
+  std::vector<T> _heads{};     // distinct first units in ascending order
+  std::vector<nat> _order{};   // indices of the patterns sorted by the first unit, stably
+  std::vector<nat> _starts{};  // patterns starting with `_heads[h]` are `_order[_starts[h].._starts[h + 1])`
+  nat1 _lo[16]{};              // buckets of the low bytes of the first units by the low nibble; see `_match_set16`
+  nat1 _hi[16]{};              // buckets by the high nibble
+
+  nat _check(const T* const p, const nat n, const nat i) const noexcept {
+    const auto h = std::ranges::lower_bound(_heads, p[i]);
+    if (h == _heads.end() || *h != p[i]) return npos;
+    for (nat k = _starts[h - _heads.begin()], e = _starts[h - _heads.begin() + 1]; k < e; ++k) {
+      const nat j = _order[k], m = _bounds[j + 1] - _bounds[j];
+      if (m <= n - i && std::equal(p + i + 1, p + i + m, _units.data() + _bounds[j] + 1)) return j;
+    }
+    return npos;
+  }
+
+public:
+
+  /// constructor from patterns
+  /// \param Patterns (in) patterns to search for; empty patterns never match
+  template<range Rg> requires convertible_to<iter_value<Rg>, view_type> explicit MultiSearcher(Rg&& Patterns) {
+    for (const auto& x : Patterns) {
+      const view_type v(x);
+      _units.insert(_units.end(), v.begin(), v.end()), _bounds.push_back(_units.size());
+      if (!v.empty()) _order.push_back(_bounds.size() - 2);
+    }
+    std::ranges::stable_sort(_order, {}, [&](const nat j) { return _units[_bounds[j]]; });
+    for (nat k{}; k < _order.size(); ++k) {
+      const T c = _units[_bounds[_order[k]]];
+      if (_heads.empty() || _heads.back() != c) _heads.push_back(c), _starts.push_back(k);
+      const nat b = nat(bitcast<makenat<T>>(c)) & 0xff;
+      _lo[b & 15] |= nat1(1 << (b >> 4 & 7));
+    }
+    for (nat h{}; h < 16; ++h) _hi[h] = nat1(1 << (h & 7));
+    _starts.push_back(_order.size());
+  }
+
+  /// constructor from a list of patterns
+  explicit MultiSearcher(std::initializer_list<view_type> Patterns) : MultiSearcher(std::span(Patterns)) {}
+
+  /// returns the number of patterns
+  nat size() const noexcept { return _bounds.size() - 1; }
+
+  /// returns a pattern
+  view_type operator[](const nat I) const noexcept { return view_type(_units.data() + _bounds[I], _bounds[I + 1] - _bounds[I]); }
+
+  /// finds the leftmost match of any pattern
+  /// \param Text text to search
+  /// \param From index to start the search at
+  /// \return leftmost match; if several patterns match there, the one given first
+  Match find(const view_type Text, const nat From = 0) const noexcept {
+    const T* const p = Text.data();
+    const nat n = Text.size();
+    constexpr nat k = 32 / sizeof(T);
+    nat i = From;
+    if (const nat heads = _heads.size(); heads > 4) {
+      const auto lo = _::_loadu128(_lo), hi = _::_loadu128(_hi);
+      for (; i + 16 <= n; i += 16)
+        for (nat4 b = _::_match_set16(p + i, lo, hi); b; b &= b - 1)
+          if (const nat c = i + std::countr_zero(b), j = _check(p, n, c); j != npos) return {c, j};
+    } else if (heads != 0) {
+      __m128i v[4];
+      for (nat h{}; h < 4; ++h) v[h] = _::_splat(_heads[h < heads ? h : 0]);
+      for (; i + k <= n; i += k) {
+        nat4 b = _::_match32(p + i, v[0]) | _::_match32(p + i, v[1]);
+        if (heads > 2) b |= _::_match32(p + i, v[2]) | _::_match32(p + i, v[3]);
+        for (; b; b &= b - 1)
+          if (const nat c = i + std::countr_zero(b) / sizeof(T), j = _check(p, n, c); j != npos) return {c, j};
+      }
+    }
+    for (; i < n; ++i) {
+      const nat b = nat(bitcast<makenat<T>>(p[i])) & 0xff;
+      if (_lo[b & 15] & _hi[b >> 4])
+        if (const nat j = _check(p, n, i); j != npos) return {i, j};
+    }
+    return {};
+  }
+};
+
+} // namespace yw
@@ -130,24 +130,38 @@ import std;
 #include "array.hpp"
 #include "chrono.hpp"
 #include "color.hpp"
+#include "color_lab.hpp"
+#include "color_srgb.hpp"
+#include "colormap.hpp"
 #include "comptr.hpp"
 #include "core.hpp"
 #include "directx.hpp"
 #include "dwrite.hpp"
 #include "exception.hpp"
 #include "file.hpp"
+#include "file_pnm.hpp"
+#include "file_qoi.hpp"
 #include "get.hpp"
+#include "image.hpp"
+#include "image_composite.hpp"
+#include "image_filter.hpp"
+#include "image_quantize.hpp"
 #include "input.hpp"
 #include "list.hpp"
 #include "logger.hpp"
 #include "main.hpp"
+#include "matrix.hpp"
 #include "none.hpp"
+#include "parallel.hpp"
 #include "projector.hpp"
 #include "sequence.hpp"
 #include "sha256.hpp"
 #include "source.hpp"
 #include "status.hpp"
 #include "string.hpp"
+#include "string_fixed.hpp"
+#include "string_numbers.hpp"
+#include "string_search.hpp"
 #include "typepack.hpp"
 #include "utility.hpp"
 #include "value.hpp"
@@ -0,0 +1,37 @@
+# generates the table of powers of ten used by the floating-point conversions of `inc/string.hpp`
+#
+# usage: python scr/pow10_table.py
+#
+# `_pow10_table[e - POW10_MIN]` is the 128-bit mantissa of 10^e normalized to [2^127..2^128) and
+# rounded down, as `{high 64 bits, low 64 bits}`; the exponents cover both the shortest formatting
+# of `fat8` (10^-292..10^324) and the parsing of up to 19 digits (10^-342..10^308).
+#
+# Since 10^e = 5^e * 2^e, the entries are also the normalized mantissas of the powers of five.
+
+POW10_MIN = -342
+POW10_MAX = 324
+
+
+def mantissa(e):
+    if e >= 0:
+        v = 10 ** e
+        b = v.bit_length()
+        return v << (128 - b) if b <= 128 else v >> (b - 128)
+    v = 10 ** -e
+    return (1 << (127 + v.bit_length())) // v
+
+
+def main():
+    rows = []
+    for e in range(POW10_MIN, POW10_MAX + 1):
+        m = mantissa(e)
+        assert 1 << 127 <= m < 1 << 128
+        rows.append(f"  {{0x{m >> 64:016x}, 0x{m & (1 << 64) - 1:016x}}}, // 1e{e}")
+    print(f"inline constexpr int4 _POW10_MIN = {POW10_MIN};")
+    print(f"inline constexpr nat8 _pow10_table[{len(rows)}][2]{{")
+    print("\n".join(rows))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
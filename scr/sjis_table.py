@@ -0,0 +1,67 @@
+# generates the compact unicode-to-shift-jis table of `inc/string.hpp`
+#
+# usage: python scr/sjis_table.py [inc/string.hpp]
+#
+# The table is read from the header, either from the compact table itself or from the
+# `_unicode_table_XXXX_YYYY` range arrays it replaced, and is printed to stdout.
+#
+# layout: the code points are split into 1024 pages of 64; `_sjis_encode_mask[page]` has a bit per
+# mapped code point, `_sjis_encode_base[page]` is the index of the first one in `_sjis_encode_table`,
+# and the value of a code point is at the base plus the number of mapped code points before it.
+
+import re
+import sys
+
+UNMAPPED = 0x8888
+
+
+def numbers(text):
+    return [int(x, 16) for x in re.findall(r"0x[0-9a-fA-F]+", text)]
+
+
+def load(source):
+    table = [UNMAPPED] * 0x10000
+    ranges = re.findall(r"_unicode_table_([0-9a-f]{4})_([0-9a-f]{4,5})\[\]\{(.*?)\};", source, re.S)
+    if ranges:
+        for lo, hi, body in ranges:
+            table[int(lo, 16):int(hi, 16)] = numbers(body)
+        return table
+    mask = numbers(re.search(r"_sjis_encode_mask\[\d+\]\{(.*?)\};", source, re.S).group(1))
+    value = numbers(re.search(r"_sjis_encode_table\[\d+\]\{(.*?)\};", source, re.S).group(1))
+    k = 0
+    for c in range(0x10000):
+        if mask[c >> 6] >> (c & 63) & 1:
+            table[c] = value[k]
+            k += 1
+    return table
+
+
+def emit(name, type_, values, per_line, width):
+    rows = ["  " + ", ".join(f"0x{v:0{width}x}" for v in values[i:i + per_line]) for i in range(0, len(values), per_line)]
+    return f"inline constexpr {type_} {name}[{len(values)}]{{\n" + ",\n".join(rows) + "\n};"
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else "inc/string.hpp"
+    table = load(open(path, encoding="utf-8").read())
+    mask, base, value = [], [], []
+    for page in range(0x10000 >> 6):
+        m = 0
+        base.append(len(value))
+        for k in range(64):
+            v = table[page << 6 | k]
+            if v != UNMAPPED:
+                m |= 1 << k
+                value.append(v)
+        mask.append(m)
+    print(emit("_sjis_encode_mask", "nat8", mask, 8, 16))
+    print()
+    print(emit("_sjis_encode_base", "nat2", base, 16, 4))
+    print()
+    print(emit("_sjis_encode_table", "nat2", value, 16, 4))
+    total = len(mask) * 8 + len(base) * 2 + len(value) * 2
+    print(f"// {total} bytes", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()